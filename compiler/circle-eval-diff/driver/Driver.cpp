@@ -101,6 +101,10 @@ int entry(const int argc, char **argv)
     .default_value("h5")
     .help("Input data format. h5/hdf5 (default) or directory");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .help("Number of threads used to split heavy kernels (default: 1)");
+
   try
   {
     arser.parse(argc, argv);
@@ -121,6 +125,7 @@ int entry(const int argc, char **argv)
   std::string metric;
   std::string input_data_format;
   std::string output_prefix;
+  int32_t num_threads = 1;
 
   if (arser["--first_input_data"])
     first_input_data_path = arser.get<std::string>("--first_input_data");
@@ -135,6 +140,12 @@ int entry(const int argc, char **argv)
   if (arser["--dump_output_with_prefix"])
     output_prefix = arser.get<std::string>("--dump_output_with_prefix");
 
+  if (arser["--num_threads"])
+    num_threads = arser.get<int>("--num_threads");
+
+  if (num_threads < 1)
+    throw std::runtime_error("The number of threads must be greater than zero");
+
   // Set Metrics
   std::vector<Metric> metrics;
   if (arser["--print_mae"] and arser.get<bool>("--print_mae"))
@@ -173,6 +184,7 @@ int entry(const int argc, char **argv)
     ctx->metric = metrics;
     ctx->input_format = to_input_format(input_data_format);
     ctx->output_prefix = output_prefix;
+    ctx->num_threads = num_threads;
   }
 
   CircleEvalDiff ced(std::move(ctx));
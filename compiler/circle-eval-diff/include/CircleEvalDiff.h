@@ -56,6 +56,8 @@ public:
     std::vector<Metric> metric;
     InputFormat input_format = InputFormat::Undefined;
     std::string output_prefix;
+    // Number of threads used to split heavy kernels
+    uint32_t num_threads = 1;
   };
 
 public:
@@ -72,6 +74,8 @@ private:
   std::unique_ptr<Context> _ctx;
   std::unique_ptr<luci::Module> _first_module;
   std::unique_ptr<luci::Module> _second_module;
+  std::unique_ptr<luci_interpreter::Interpreter> _first_interpreter;
+  std::unique_ptr<luci_interpreter::Interpreter> _second_interpreter;
   std::vector<std::unique_ptr<MetricPrinter>> _metrics;
 };
 
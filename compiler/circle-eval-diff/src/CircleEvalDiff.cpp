@@ -122,11 +122,20 @@ void checkOutputs(const luci::Module *first, const luci::Module *second)
 namespace circle_eval_diff
 {
 
-std::vector<std::shared_ptr<Tensor>> interpret(const luci::Module *module,
-                                               const InputDataLoader::Data &data)
+std::unique_ptr<luci_interpreter::Interpreter> make_interpreter(const luci::Module *module,
+                                                                uint32_t num_threads)
 {
   auto interpreter = std::make_unique<luci_interpreter::Interpreter>(module);
+  // Outputs are read right after each run, so memory of activations can be reused across runs
+  interpreter->enableArenaPlan();
+  interpreter->setNumThreads(num_threads);
+  return interpreter;
+}
 
+std::vector<std::shared_ptr<Tensor>> interpret(const luci::Module *module,
+                                               luci_interpreter::Interpreter *interpreter,
+                                               const InputDataLoader::Data &data)
+{
   auto input_nodes = ::inputs_of(module);
   auto output_nodes = ::outputs_of(module);
 
@@ -171,6 +180,10 @@ void CircleEvalDiff::init()
   // Exception will be thrown if they have different signature
   checkOutputs(_first_module.get(), _second_module.get());
 
+  // Interpreters are kept for all data, so that memory planned by the first run is reused
+  _first_interpreter = make_interpreter(_first_module.get(), _ctx->num_threads);
+  _second_interpreter = make_interpreter(_second_module.get(), _ctx->num_threads);
+
   // Set metric
   std::unique_ptr<MetricPrinter> metric;
   for (auto metric : _ctx->metric)
@@ -228,8 +241,8 @@ void CircleEvalDiff::evalDiff(void) const
     auto first_data = first_input_loader->get(data_idx);
     auto second_data = second_input_loader->get(data_idx);
 
-    auto first_output = interpret(_first_module.get(), first_data);
-    auto second_output = interpret(_second_module.get(), second_data);
+    auto first_output = interpret(_first_module.get(), _first_interpreter.get(), first_data);
+    auto second_output = interpret(_second_module.get(), _second_interpreter.get(), second_data);
 
     for (auto &metric : _metrics)
     {
@@ -24,6 +24,9 @@
 
 #include <dio_hdf5/HDF5Importer.h>
 
+#include <algorithm>
+#include <thread>
+
 using namespace mpqsolver::core;
 
 using Shape = std::vector<loco::Dimension>;
@@ -58,6 +61,10 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
 
   // Create interpreter.
   luci_interpreter::Interpreter interpreter(module);
+  // Outputs are read right after each run, so memory of activations can be reused across runs
+  interpreter.enableArenaPlan();
+  // Records are run one by one, so let heavy kernels use all cores
+  interpreter.setNumThreads(std::max(1u, std::thread::hardware_concurrency()));
   for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
   {
     if (num_inputs != data_provider->numInputs(record_idx))
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FODER_MAPPED_FILE_LOADER_H__
+#define __FODER_MAPPED_FILE_LOADER_H__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace foder
+{
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ *
+ * @note  Pages are read on demand and shared with page cache, so a large file does not take
+ *        private memory. The file should not be modified while it is mapped.
+ */
+class MappedFile
+{
+public:
+  MappedFile(void *data, size_t size) : _data(data), _size(size) {}
+  ~MappedFile() { munmap(_data, _size); }
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  const char *data(void) const { return static_cast<const char *>(_data); }
+  size_t size(void) const { return _size; }
+
+private:
+  void *_data;
+  size_t _size;
+};
+
+class MappedFileLoader
+{
+public:
+  explicit MappedFileLoader(const std::string &path) : _path(path) {}
+
+public:
+  MappedFileLoader(const MappedFileLoader &) = delete;
+  MappedFileLoader &operator=(const MappedFileLoader &) = delete;
+
+public:
+  std::shared_ptr<const MappedFile> load(void) const
+  {
+    int fd = open(_path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      std::string errmsg = "Failed to open file: " + _path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+      close(fd);
+      std::string errmsg = "Failed to read file: " + _path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    const auto size = static_cast<size_t>(st.st_size);
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Mapping is still valid after the file is closed
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      std::string errmsg = "Failed to map file: " + _path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    return std::make_shared<const MappedFile>(data, size);
+  }
+
+private:
+  const std::string _path;
+};
+
+} // namespace foder
+
+#endif // __FODER_MAPPED_FILE_LOADER_H__
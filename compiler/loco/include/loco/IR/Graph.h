@@ -222,7 +222,21 @@ public:
   OutputContext *outputs(void) { return &_output_ctx; }
   const OutputContext *outputs(void) const { return &_output_ctx; }
 
+public:
+  /**
+   * @brief Return the revision of this graph
+   *
+   * The revision increases whenever a node of this graph is created or rewired, and the node
+   * remembers it. Nodes changed after a revision are found without comparing the whole graph.
+   */
+  uint64_t revision(void) const { return _revision; }
+
+private:
+  friend class Node;
+
 private:
+  // NOTE _revision is declared before _node_ctx so that it outlives nodes
+  uint64_t _revision = 0;
   NodeContext _node_ctx;
   InputContext _input_ctx;
   OutputContext _output_ctx;
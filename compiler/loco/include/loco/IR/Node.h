@@ -78,6 +78,18 @@ private:
    */
   void graph(Graph *g) { _graph = g; }
 
+public:
+  /**
+   * @brief Return the revision of associated "Graph" when this node was created or rewired last
+   *
+   * A node is rewired when one of its arguments or users is changed.
+   */
+  uint64_t revision(void) const { return _revision; }
+
+private:
+  /// @brief Update the revision to the next revision of associated "Graph"
+  void touch(void);
+
 public:
   /**
    * @brief Return "Dialect" identifier that this node belongs to
@@ -110,6 +122,8 @@ private:
    */
   Graph *_graph = nullptr;
 
+  uint64_t _revision = 0;
+
   /**
    * @brief The edges to a node that uses this node as its argument
    *
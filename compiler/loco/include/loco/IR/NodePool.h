@@ -38,6 +38,7 @@ public:
   {
     std::unique_ptr<Derived> ptr{new Derived(std::forward<Args>(args)...)};
     ptr->graph(_graph);
+    ptr->touch();
     return ObjectPool<Node>::take<Derived>(std::move(ptr));
   }
 
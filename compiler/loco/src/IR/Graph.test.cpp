@@ -81,6 +81,33 @@ TEST(GraphTest, create_and_destroy_node)
   ASSERT_NO_THROW(g->nodes()->destroy(pull));
 }
 
+TEST(GraphTest, revision)
+{
+  auto g = loco::make_graph();
+
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+  ASSERT_EQ(2, g->revision());
+  ASSERT_EQ(1, pull->revision());
+  ASSERT_EQ(2, push->revision());
+
+  // Both the user and its argument are rewired
+  push->from(pull);
+  ASSERT_LT(2, push->revision());
+  ASSERT_LT(2, pull->revision());
+
+  // Setting the same argument changes nothing
+  const auto revision = g->revision();
+  push->from(pull);
+  ASSERT_EQ(revision, g->revision());
+
+  auto relu = g->nodes()->create<loco::ReLU>();
+  loco::replace(pull).with(relu);
+  ASSERT_LT(revision, pull->revision());
+  ASSERT_LT(revision, push->revision());
+  ASSERT_LT(revision, relu->revision());
+}
+
 TEST(GraphTest, DISABLED_create_and_destroy_node_again)
 {
   auto g = loco::make_graph();
@@ -15,6 +15,7 @@
  */
 
 #include "loco/IR/Node.h"
+#include "loco/IR/Graph.h"
 #include "loco/IR/Use.h"
 
 #include <cassert>
@@ -28,6 +29,14 @@ Node::~Node()
   assert(_uses.size() == 0);
 }
 
+void Node::touch(void)
+{
+  if (_graph != nullptr)
+  {
+    _revision = ++(_graph->_revision);
+  }
+}
+
 std::set<Node *> preds(const Node *node)
 {
   std::set<Node *> res;
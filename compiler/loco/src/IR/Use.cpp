@@ -24,10 +24,21 @@ namespace loco
 
 void Use::node(Node *node)
 {
+  if (_node == node)
+  {
+    return;
+  }
+
+  if (_user != nullptr)
+  {
+    _user->touch();
+  }
+
   if (_node != nullptr)
   {
     assert(_node->_uses.find(this) != _node->_uses.end());
     _node->_uses.erase(this);
+    _node->touch();
     _node = nullptr;
   }
 
@@ -37,6 +48,7 @@ void Use::node(Node *node)
   {
     _node = node;
     _node->_uses.insert(this);
+    _node->touch();
   }
 
   assert(_node == node);
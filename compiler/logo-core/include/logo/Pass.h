@@ -39,6 +39,15 @@ public:
    * @return false if there was nothing changed
    */
   virtual bool run(loco::Graph *graph) = 0;
+
+public:
+  /**
+   * @brief  Check if the pass may make a change around the node
+   *
+   * @note   PhaseRunner<PhaseStrategy::Worklist> runs a pass again only if it is interested in
+   *         a node changed by other passes. A pass is interested in every node by default.
+   */
+  virtual bool interested(const loco::Node *) const { return true; }
 };
 
 std::string pass_name(const Pass *);
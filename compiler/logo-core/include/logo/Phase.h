@@ -21,6 +21,8 @@
 
 #include <loco.h>
 
+#include <chrono>
+#include <functional>
 #include <vector>
 #include <memory>
 
@@ -70,9 +72,14 @@ public:
   void changed(bool changed) { _changed = changed; }
   bool changed(void) const { return _changed; }
 
+  // Time taken to run the pass
+  void elapsed(std::chrono::microseconds elapsed) { _elapsed = elapsed; }
+  std::chrono::microseconds elapsed(void) const { return _elapsed; }
+
 private:
   const Pass *_pass;
   bool _changed;
+  std::chrono::microseconds _elapsed{0};
 };
 
 struct PhaseEventListener
@@ -97,6 +104,26 @@ public:
 public:
   void attach(PhaseEventListener *listener) { _listener = listener; }
 
+public:
+  /**
+   * @brief Run the pass notifying its begin and end
+   *
+   * @return false if there was nothing changed
+   */
+  bool runPass(Pass *pass, loco::Graph *graph) const
+  {
+    notifyPassBegin(pass);
+
+    const auto begin = std::chrono::steady_clock::now();
+    bool changed = pass->run(graph);
+    const auto end = std::chrono::steady_clock::now();
+
+    notifyPassEnd(pass, changed,
+                  std::chrono::duration_cast<std::chrono::microseconds>(end - begin));
+
+    return changed;
+  }
+
 public:
   void notifyPhaseBegin(void) const
   {
@@ -130,7 +157,8 @@ public:
     }
   }
 
-  void notifyPassEnd(Pass *pass, bool changed) const
+  void notifyPassEnd(Pass *pass, bool changed,
+                     std::chrono::microseconds elapsed = std::chrono::microseconds{0}) const
   {
     if (_listener)
     {
@@ -138,6 +166,7 @@ public:
 
       info.pass(pass);
       info.changed(changed);
+      info.elapsed(elapsed);
 
       _listener->notify(&info);
     }
@@ -153,6 +182,8 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Same as Restart but will skip passes not interested in nodes around changes
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +218,38 @@ private:
   loco::Graph *_graph;
 };
 
+/**
+ * @brief Phase runner which re-runs only the passes interested in changed nodes
+ *
+ * After a pass makes a change, nodes that are created or rewired by the pass are found by their
+ * revisions(loco::Node::revision). These nodes and their neighbours(arguments and users) make
+ * dirty all passes interested in one of them. The first dirty pass runs next like Restart, until
+ * there is no dirty pass.
+ *
+ * Changes of node attributes do not update revisions. NodeDigest finds them if it is given, and
+ * all passes become dirty if a change is found nowhere.
+ */
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  // Digest of node attributes which passes may change without rewiring the node
+  using NodeDigest = std::function<size_t(const loco::Node *)>;
+
+public:
+  PhaseRunner(loco::Graph *graph, NodeDigest digest = nullptr)
+    : _graph{graph}, _digest{std::move(digest)}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+  NodeDigest _digest;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
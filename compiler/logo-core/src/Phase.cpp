@@ -16,6 +16,62 @@
 
 #include <logo/Phase.h>
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+using NodeDigest = logo::PhaseRunner<logo::PhaseStrategy::Worklist>::NodeDigest;
+using NodeDigests = std::unordered_map<const loco::Node *, size_t>;
+
+/**
+ * @brief Return nodes around the nodes changed after the given revision
+ *
+ * Nodes created or rewired after the revision are found by their revisions. Digests of the other
+ * nodes are compared with the previous ones to find changes of attributes, and are updated.
+ *
+ * @note  A node created at the address of a removed node has a new revision, so it is found
+ *        even if its digest is the same as the removed one.
+ */
+std::unordered_set<loco::Node *> around(loco::Graph *g, uint64_t revision,
+                                        const NodeDigest &digest, NodeDigests &digests)
+{
+  std::unordered_set<loco::Node *> nodes;
+
+  for (uint32_t n = 0; n < g->nodes()->size(); ++n)
+  {
+    auto node = g->nodes()->at(n);
+
+    bool changed = node->revision() > revision;
+    if (digest)
+    {
+      const auto node_digest = digest(node);
+      auto it = digests.find(node);
+      if (it == digests.end() || it->second != node_digest)
+        changed = true;
+      digests[node] = node_digest;
+    }
+    if (!changed)
+      continue;
+
+    // Users and arguments of removed nodes are rewired, so they are found by their revisions
+    nodes.insert(node);
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      if (auto arg = node->arg(i))
+        nodes.insert(arg);
+    }
+    for (auto succ : loco::succs(node))
+      nodes.insert(succ);
+  }
+
+  return nodes;
+}
+
+} // namespace
+
 namespace logo
 {
 
@@ -29,12 +85,8 @@ void PhaseRunner<PhaseStrategy::Saturate>::run(const Phase &phase) const
 
     for (auto &pass : phase)
     {
-      notifyPassBegin(pass.get());
-
-      bool pass_changed = pass->run(_graph);
+      bool pass_changed = runPass(pass.get(), _graph);
       changed = changed || pass_changed;
-
-      notifyPassEnd(pass.get(), pass_changed);
     }
   }
 
@@ -51,13 +103,9 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
 
     for (auto &pass : phase)
     {
-      notifyPassBegin(pass.get());
-
-      bool pass_changed = pass->run(_graph);
+      bool pass_changed = runPass(pass.get(), _graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
-
       if (changed)
       {
         break;
@@ -68,4 +116,67 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  notifyPhaseBegin();
+
+  std::vector<bool> dirty(phase.size(), true);
+  NodeDigests digests;
+  if (_digest)
+  {
+    for (uint32_t n = 0; n < _graph->nodes()->size(); ++n)
+    {
+      auto node = _graph->nodes()->at(n);
+      digests[node] = _digest(node);
+    }
+  }
+
+  for (bool done = false; !done;)
+  {
+    done = true;
+
+    for (uint32_t p = 0; p < phase.size(); ++p)
+    {
+      if (!dirty[p])
+        continue;
+
+      dirty[p] = false;
+      done = false;
+
+      const auto revision = _graph->revision();
+      if (!runPass(phase.at(p).get(), _graph))
+        continue;
+
+      const auto nodes = around(_graph, revision, _digest, digests);
+
+      for (uint32_t q = 0; q < phase.size(); ++q)
+      {
+        if (dirty[q])
+          continue;
+
+        // Pass may change what is not visible in the graph. Assume everything is changed then.
+        if (nodes.empty())
+        {
+          dirty[q] = true;
+          continue;
+        }
+
+        for (auto node : nodes)
+        {
+          if (phase.at(q)->interested(node))
+          {
+            dirty[q] = true;
+            break;
+          }
+        }
+      }
+
+      // Restart from the first dirty pass
+      break;
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
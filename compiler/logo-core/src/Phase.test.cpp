@@ -29,6 +29,95 @@ struct Bumblebee final : public logo::Pass
   bool run(loco::Graph *) final { return false; }
 };
 
+// Insert a ReLU after Pull once
+struct InsertReLU final : public logo::Pass
+{
+  const char *name(void) const final { return "InsertReLU"; }
+  bool run(loco::Graph *g) final
+  {
+    runs++;
+    for (uint32_t n = 0; n < g->nodes()->size(); ++n)
+    {
+      auto push = dynamic_cast<loco::Push *>(g->nodes()->at(n));
+      if (push == nullptr || dynamic_cast<loco::Pull *>(push->from()) == nullptr)
+        continue;
+
+      auto relu = g->nodes()->create<loco::ReLU>();
+      relu->input(push->from());
+      push->from(relu);
+      return true;
+    }
+    return false;
+  }
+
+  uint32_t runs = 0;
+};
+
+// Count runs, interested in nodes of the given opcode only
+struct Watcher final : public logo::Pass
+{
+  Watcher(loco::CanonicalOpcode opcode) : opcode{opcode} {}
+
+  const char *name(void) const final { return "Watcher"; }
+  bool run(loco::Graph *) final
+  {
+    runs++;
+    return false;
+  }
+  bool interested(const loco::Node *node) const final
+  {
+    auto canonical = dynamic_cast<const loco::CanonicalNode *>(node);
+    return canonical != nullptr && canonical->opcode() == opcode;
+  }
+
+  loco::CanonicalOpcode opcode;
+  uint32_t runs = 0;
+};
+
+// Replace the ReLU after Pull with a new ReLU once
+struct RecreateReLU final : public logo::Pass
+{
+  const char *name(void) const final { return "RecreateReLU"; }
+  bool run(loco::Graph *g) final
+  {
+    if (done)
+      return false;
+
+    for (uint32_t n = 0; n < g->nodes()->size(); ++n)
+    {
+      auto relu = dynamic_cast<loco::ReLU *>(g->nodes()->at(n));
+      if (relu == nullptr)
+        continue;
+
+      auto push = dynamic_cast<loco::Push *>(*loco::succs(relu).begin());
+      auto input = relu->input();
+      push->from(nullptr);
+      g->nodes()->destroy(relu);
+
+      // The new node may be at the address of the destroyed one
+      auto new_relu = g->nodes()->create<loco::ReLU>();
+      new_relu->input(input);
+      push->from(new_relu);
+      // Unrelated change
+      g->nodes()->create<loco::Pull>();
+      done = true;
+      return true;
+    }
+    return false;
+  }
+  bool interested(const loco::Node *) const final { return false; }
+
+  bool done = false;
+};
+
+// Pull -> Push
+void build_graph(loco::Graph *g)
+{
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(pull);
+}
+
 } // namespace
 
 TEST(LogoPhaseSaturateTests, simple)
@@ -54,3 +143,86 @@ TEST(LogoPhaseRestartTests, simple)
 
   SUCCEED();
 }
+
+TEST(LogoPhaseWorklistTests, simple)
+{
+  loco::Graph g;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+
+  phase.emplace_back(std::make_unique<Bumblebee>());
+  phase_runner.run(phase);
+
+  SUCCEED();
+}
+
+TEST(LogoPhaseWorklistTests, rerun_interested_only)
+{
+  loco::Graph g;
+  build_graph(&g);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+
+  auto insert = new InsertReLU;
+  auto relu_watcher = new Watcher(loco::CanonicalOpcode::ReLU);
+  auto conv_watcher = new Watcher(loco::CanonicalOpcode::Conv2D);
+  phase.emplace_back(relu_watcher);
+  phase.emplace_back(insert);
+  phase.emplace_back(conv_watcher);
+  phase_runner.run(phase);
+
+  // InsertReLU is interested in everything, so it runs again after its change
+  ASSERT_EQ(2, insert->runs);
+  ASSERT_EQ(2, relu_watcher->runs);
+  ASSERT_EQ(1, conv_watcher->runs);
+}
+
+TEST(LogoPhaseWorklistTests, recreated_node)
+{
+  loco::Graph g;
+  auto pull = g.nodes()->create<loco::Pull>();
+  auto relu = g.nodes()->create<loco::ReLU>();
+  auto push = g.nodes()->create<loco::Push>();
+  relu->input(pull);
+  push->from(relu);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+
+  auto recreate = new RecreateReLU;
+  auto relu_watcher = new Watcher(loco::CanonicalOpcode::ReLU);
+  phase.emplace_back(relu_watcher);
+  phase.emplace_back(recreate);
+  phase_runner.run(phase);
+
+  // New ReLU is found even if it is identical to the destroyed one
+  ASSERT_EQ(2, relu_watcher->runs);
+}
+
+TEST(LogoPhaseWorklistTests, pass_end_elapsed)
+{
+  struct Listener final : public logo::PhaseEventListener
+  {
+    void notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info) final
+    {
+      count++;
+      ASSERT_GE(info->elapsed().count(), 0);
+    }
+
+    uint32_t count = 0;
+  };
+
+  loco::Graph g;
+  build_graph(&g);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+  Listener listener;
+
+  phase.emplace_back(std::make_unique<InsertReLU>());
+  phase_runner.attach(&listener);
+  phase_runner.run(phase);
+
+  ASSERT_EQ(2, listener.count);
+}
@@ -58,12 +58,22 @@ public:
 
   void writeInputTensor(const luci::CircleInput *input_node, const void *data, size_t data_size);
 
+  // Change the shape of an input, e.g. to run several records as a batch
+  void resizeInputTensor(const luci::CircleInput *input_node, const Shape &shape);
+
   void readOutputTensor(const luci::CircleOutput *output_node, void *data, size_t data_size);
 
   size_t getOutputTensorSize(const luci::CircleOutput *output_node);
 
   void interpret();
 
+  // Reuse memory of intermediate tensors planned once from the previous run, instead of
+  // allocating it with the memory manager for every run
+  void enableArenaPlan();
+
+  // Split heavy kernels(Conv2D, FullyConnected, BatchMatMul) over num_threads threads
+  void setNumThreads(uint32_t num_threads);
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
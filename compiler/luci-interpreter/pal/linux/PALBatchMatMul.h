@@ -17,16 +17,49 @@
 #ifndef LUCI_INTERPRETER_PAL_BATCHMATMUL_H
 #define LUCI_INTERPRETER_PAL_BATCHMATMUL_H
 
+#include "core/ThreadPool.h"
+
 #include <tensorflow/lite/kernels/internal/reference/batch_matmul.h>
 
 namespace luci_interpreter_pal
 {
+
+// Multiply-accumulates below which BatchMatMul is not split over threads
+constexpr int64_t kMinParallelBatchMatMulWork = 1 << 16;
+
+// Split batches over threads if they are not broadcasted
 inline void BatchMatMul(const tflite::RuntimeShape &lhs_shape, const float *lhs_data,
                         const tflite::RuntimeShape &rhs_shape, const float *rhs_data,
                         const tflite::RuntimeShape &output_shape, float *output_data)
 {
-  tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
-                                     output_data);
+  const int rank = output_shape.DimensionsCount();
+  bool same_batches = lhs_shape.DimensionsCount() == rank && rhs_shape.DimensionsCount() == rank;
+  int32_t batches = 1;
+  for (int i = 0; same_batches && i < rank - 2; ++i)
+  {
+    same_batches = lhs_shape.Dims(i) == rhs_shape.Dims(i);
+    batches *= lhs_shape.Dims(i);
+  }
+
+  const int64_t work = static_cast<int64_t>(output_shape.FlatSize()) * lhs_shape.Dims(rank - 1);
+  if (luci_interpreter::ThreadPool::current() == nullptr || !same_batches || batches <= 1 ||
+      work < kMinParallelBatchMatMulWork)
+  {
+    tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
+                                       output_data);
+    return;
+  }
+
+  const int32_t lhs_rows = lhs_shape.Dims(rank - 2), lhs_cols = lhs_shape.Dims(rank - 1);
+  const int32_t rhs_rows = rhs_shape.Dims(rank - 2), rhs_cols = rhs_shape.Dims(rank - 1);
+  const int32_t out_rows = output_shape.Dims(rank - 2), out_cols = output_shape.Dims(rank - 1);
+  luci_interpreter::parallelFor(batches, [&](uint32_t begin, uint32_t end) {
+    const int32_t num = end - begin;
+    tflite::reference_ops::BatchMatMul(
+      tflite::RuntimeShape{num, lhs_rows, lhs_cols}, lhs_data + begin * lhs_rows * lhs_cols,
+      tflite::RuntimeShape{num, rhs_rows, rhs_cols}, rhs_data + begin * rhs_rows * rhs_cols,
+      tflite::RuntimeShape{num, out_rows, out_cols}, output_data + begin * out_rows * out_cols);
+  });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *lhs_scratchpad,
@@ -17,11 +17,84 @@
 #ifndef LUCI_INTERPRETER_PAL_CONV2D_H
 #define LUCI_INTERPRETER_PAL_CONV2D_H
 
+#include "core/ThreadPool.h"
+
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
+#include <algorithm>
+
 namespace luci_interpreter_pal
 {
+
+// Multiply-accumulates below which a convolution is not split over threads
+constexpr int64_t kMinParallelConvWork = 1 << 16;
+
+/**
+ * Run conv over chunks of output rows with the thread pool. Each chunk is a convolution of input
+ * rows it reads, with the top padding adjusted, so the result is the same as running at once.
+ *
+ * conv(params, input_shape, input_data, output_shape, output_data, im2col_shape, im2col_data)
+ */
+template <typename T, typename ConvFn>
+static inline void SplitConvRows(const tflite::ConvParams &params,
+                                 const tflite::RuntimeShape &input_shape, const T *input_data,
+                                 const tflite::RuntimeShape &filter_shape,
+                                 const tflite::RuntimeShape &output_shape, T *output_data,
+                                 T *im2col_data, ConvFn conv)
+{
+  const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t input_depth = input_shape.Dims(3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_width = output_shape.Dims(2);
+  const int32_t output_depth = output_shape.Dims(3);
+  const int32_t filter_extent = (filter_shape.Dims(1) - 1) * params.dilation_height_factor + 1;
+  const int32_t im2col_depth = input_depth * filter_shape.Dims(1) * filter_shape.Dims(2);
+
+  const int64_t work =
+    static_cast<int64_t>(output_shape.FlatSize()) * filter_shape.FlatSize() / output_depth;
+  if (luci_interpreter::ThreadPool::current() == nullptr || work < kMinParallelConvWork)
+  {
+    tflite::RuntimeShape im2col_shape{batches, output_height, output_width, im2col_depth};
+    conv(params, input_shape, input_data, output_shape, output_data, im2col_shape, im2col_data);
+    return;
+  }
+
+  luci_interpreter::parallelFor(batches * output_height, [&](uint32_t begin, uint32_t end) {
+    for (int32_t row = begin; row < static_cast<int32_t>(end);)
+    {
+      const int32_t batch = row / output_height;
+      const int32_t out_begin = row % output_height;
+      const int32_t out_end = std::min(output_height, out_begin + static_cast<int32_t>(end) - row);
+
+      const int32_t in_begin = out_begin * params.stride_height - params.padding_values.height;
+      const int32_t in_end = (out_end - 1) * params.stride_height - params.padding_values.height +
+                             filter_extent;
+      const int32_t clipped_begin = std::min(std::max(in_begin, 0), input_height);
+      const int32_t clipped_end = std::max(std::min(in_end, input_height), clipped_begin);
+
+      tflite::ConvParams chunk_params = params;
+      chunk_params.padding_values.height = static_cast<int16_t>(clipped_begin - in_begin);
+
+      const int32_t num_rows = out_end - out_begin;
+      const int32_t out_offset = batch * output_height + out_begin;
+      tflite::RuntimeShape chunk_input_shape{1, clipped_end - clipped_begin, input_width,
+                                             input_depth};
+      tflite::RuntimeShape chunk_output_shape{1, num_rows, output_width, output_depth};
+      tflite::RuntimeShape chunk_im2col_shape{1, num_rows, output_width, im2col_depth};
+      conv(chunk_params, chunk_input_shape,
+           input_data + (batch * input_height + clipped_begin) * input_width * input_depth,
+           chunk_output_shape, output_data + out_offset * output_width * output_depth,
+           chunk_im2col_shape,
+           im2col_data ? im2col_data + out_offset * output_width * im2col_depth : nullptr);
+
+      row += num_rows;
+    }
+  });
+}
+
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
                         const float *input_data, const tflite::RuntimeShape &filter_shape,
                         const float *filter_data, const tflite::RuntimeShape &bias_shape,
@@ -30,25 +103,22 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         float *scratchpad_data)
 {
   (void)scratchpad_shape;
-  if (scratchpad_data)
-  {
-    const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
-    const int32_t input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
-    const int32_t output_height = output_shape.Dims(1);
-    const int32_t output_width = output_shape.Dims(2);
-    const int32_t filter_height = filter_shape.Dims(1);
-    const int32_t filter_width = filter_shape.Dims(2);
-    tflite::RuntimeShape im2col_shape{batches, output_height, output_width,
-                                      input_depth * filter_height * filter_width};
-
-    tflite::optimized_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data, im2col_shape,
-                                scratchpad_data);
-  }
-  else
-    tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data,
-                                tflite::RuntimeShape(), nullptr);
+  SplitConvRows<float>(
+    params, input_shape, input_data, filter_shape, output_shape, output_data, scratchpad_data,
+    [&](const tflite::ConvParams &chunk_params, const tflite::RuntimeShape &chunk_input_shape,
+        const float *chunk_input_data, const tflite::RuntimeShape &chunk_output_shape,
+        float *chunk_output_data, const tflite::RuntimeShape &im2col_shape, float *im2col_data) {
+      if (im2col_data)
+        tflite::optimized_ops::Conv(chunk_params, chunk_input_shape, chunk_input_data,
+                                    filter_shape, filter_data, bias_shape, bias_data,
+                                    chunk_output_shape, chunk_output_data, im2col_shape,
+                                    im2col_data);
+      else
+        tflite::reference_ops::Conv(chunk_params, chunk_input_shape, chunk_input_data,
+                                    filter_shape, filter_data, bias_shape, bias_data,
+                                    chunk_output_shape, chunk_output_data,
+                                    tflite::RuntimeShape(), nullptr);
+    });
 }
 
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -79,9 +149,15 @@ static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_
   (void)scratchpad_shape;
   (void)scratchpad_data;
   // TODO enable optimized version
-  tflite::reference_integer_ops::ConvPerChannel(params, mult, shifts, input_shape, input_data,
-                                                filter_shape, filter_data, bias_shape, bias_data,
-                                                output_shape, output_data);
+  SplitConvRows<int8>(
+    params, input_shape, input_data, filter_shape, output_shape, output_data, nullptr,
+    [&](const tflite::ConvParams &chunk_params, const tflite::RuntimeShape &chunk_input_shape,
+        const int8 *chunk_input_data, const tflite::RuntimeShape &chunk_output_shape,
+        int8 *chunk_output_data, const tflite::RuntimeShape &, int8 *) {
+      tflite::reference_integer_ops::ConvPerChannel(
+        chunk_params, mult, shifts, chunk_input_shape, chunk_input_data, filter_shape,
+        filter_data, bias_shape, bias_data, chunk_output_shape, chunk_output_data);
+    });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *scratchpad,
@@ -17,11 +17,61 @@
 #ifndef LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 #define LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 
+#include "core/ThreadPool.h"
+
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
 namespace luci_interpreter_pal
 {
+
+// Multiply-accumulates below which FullyConnected is not split over threads
+constexpr int64_t kMinParallelFullyConnectedWork = 1 << 16;
+
+// Split rows of batches over threads, or output units if there is only one row
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const float *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const float *bias_data, const tflite::RuntimeShape &output_shape,
+                                  float *output_data)
+{
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int filter_dims_count = filter_shape.DimensionsCount();
+  const int32_t batches = tflite::FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int32_t output_depth = output_shape.Dims(output_dims_count - 1);
+  const int32_t accum_depth = filter_shape.Dims(filter_dims_count - 1);
+
+  const int64_t work = static_cast<int64_t>(batches) * output_depth * accum_depth;
+  if (luci_interpreter::ThreadPool::current() == nullptr || work < kMinParallelFullyConnectedWork)
+  {
+    tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape,
+                                          filter_data, bias_shape, bias_data, output_shape,
+                                          output_data);
+    return;
+  }
+
+  if (batches > 1)
+  {
+    luci_interpreter::parallelFor(batches, [&](uint32_t begin, uint32_t end) {
+      const int32_t rows = end - begin;
+      tflite::reference_ops::FullyConnected(
+        params, tflite::RuntimeShape{rows, accum_depth}, input_data + begin * accum_depth,
+        filter_shape, filter_data, bias_shape, bias_data, tflite::RuntimeShape{rows, output_depth},
+        output_data + begin * output_depth);
+    });
+    return;
+  }
+
+  luci_interpreter::parallelFor(output_depth, [&](uint32_t begin, uint32_t end) {
+    const int32_t units = end - begin;
+    tflite::reference_ops::FullyConnected(
+      params, input_shape, input_data, tflite::RuntimeShape{units, accum_depth},
+      filter_data + begin * accum_depth, tflite::RuntimeShape{units},
+      bias_data ? bias_data + begin : nullptr, tflite::RuntimeShape{1, units},
+      output_data + begin);
+  });
+}
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
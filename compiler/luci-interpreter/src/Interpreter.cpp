@@ -112,6 +112,17 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     tensor->writeData(data, data_size);
 }
 
+void Interpreter::resizeInputTensor(const luci::CircleInput *input_node, const Shape &shape)
+{
+  const auto &input_tensors = _runtime_module->getInputTensors();
+  if (input_node->index() >= input_tensors.size() || input_tensors[input_node->index()] == nullptr)
+  {
+    const std::string &name = input_node->name();
+    throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
+  }
+  _runtime_module->resizeInputTensor(input_node->index(), shape);
+}
+
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
                                    size_t data_size)
 {
@@ -141,6 +152,13 @@ size_t Interpreter::getOutputTensorSize(const luci::CircleOutput *output_node)
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::enableArenaPlan() { _runtime_module->enableArenaPlan(); }
+
+void Interpreter::setNumThreads(uint32_t num_threads)
+{
+  _runtime_module->setNumThreads(num_threads);
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace luci_interpreter
 {
@@ -31,13 +32,31 @@ class RuntimeGraph::TensorAllocPlan
   bool _valid = false;
   IMemoryManager *_memory_manager;
 
+  // Arena for tensors allocated and deallocated by this plan. Offsets are planned with lifetimes
+  // and sizes of tensors in the previous run, and reused while the sizes do not grow.
+  using Lifetime = std::pair<size_t, size_t>;
+  std::unordered_map<Tensor *, Lifetime> _lifetimes;
+  bool _arena_enabled = false;
+  bool _arena_planned = false;
+  std::vector<uint8_t> _arena;
+  std::unordered_map<Tensor *, std::pair<size_t, size_t>> _arena_offsets; // offset and size
+  std::unordered_map<Tensor *, size_t> _sizes;
+  std::unordered_set<Tensor *> _in_arena;
+
 public:
   explicit TensorAllocPlan(IMemoryManager *memory_manager);
+  ~TensorAllocPlan() { releaseArena(); }
   void invalidate() { _valid = false; }
   bool isValid() const { return _valid; }
   void build(const RuntimeGraph &graph);
-  void allocate(size_t kernel_index) const;
-  void deallocate(size_t kernel_index) const;
+  void allocate(size_t kernel_index);
+  void deallocate(size_t kernel_index);
+
+  void enableArena() { _arena_enabled = true; }
+  // Plan offsets in arena if sizes of tensors have changed in the previous run
+  void planArena();
+  // Detach tensors from arena, which is not managed by the memory manager
+  void releaseArena();
 };
 
 RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
@@ -48,7 +67,8 @@ RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
 void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
 {
   invalidate();
-  using Lifetime = std::pair<size_t, size_t>;
+  releaseArena();
+  _arena_planned = false;
   std::unordered_map<Tensor *, Lifetime> lifetimes;
   const size_t num_kernels = graph._kernels.size();
   for (size_t index = 0; index < num_kernels; ++index)
@@ -79,27 +99,127 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
     _alloc_plan[item.second.first].push_back(item.first);
     _dealloc_plan[item.second.second].push_back(item.first);
   }
+  _lifetimes = std::move(lifetimes);
   _valid = true;
 }
 
-void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _alloc_plan.size());
   for (Tensor *tensor : _alloc_plan[kernel_index])
   {
+    if (!_arena_enabled)
+    {
+      _memory_manager->allocate_memory(*tensor);
+      continue;
+    }
+
+    if (!tensor->is_allocatable())
+      continue;
+
+    const size_t size =
+      getDataTypeSize(tensor->element_type()) * tensor->shape().large_num_elements();
+    // Keep the largest size to avoid planning again for shapes changing back and forth
+    _sizes[tensor] = std::max(_sizes[tensor], size);
+
+    auto it = _arena_offsets.find(tensor);
+    if (_arena_planned && it != _arena_offsets.end() && size <= it->second.second)
+    {
+      if (_in_arena.count(tensor) == 0 && tensor->is_data_allocated())
+        _memory_manager->release_memory(*tensor);
+      tensor->set_data_buffer(_arena.data() + it->second.first);
+      _in_arena.insert(tensor);
+      continue;
+    }
+
+    // Tensor grows or is not planned. Allocate it separately and plan again after this run.
+    if (_in_arena.erase(tensor) > 0)
+      tensor->set_data_buffer(nullptr);
     _memory_manager->allocate_memory(*tensor);
+    _arena_planned = false;
   }
 }
 
-void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _dealloc_plan.size());
   for (Tensor *tensor : _dealloc_plan[kernel_index])
   {
+    if (_in_arena.erase(tensor) > 0)
+    {
+      tensor->set_data_buffer(nullptr);
+      continue;
+    }
     _memory_manager->release_memory(*tensor);
   }
 }
 
+void RuntimeGraph::TensorAllocPlan::planArena()
+{
+  if (!_arena_enabled || _arena_planned)
+    return;
+
+  // Tensors still in arena(e.g. graph outputs) are moved to the new arena when reallocated
+  releaseArena();
+  if (_sizes.empty())
+    return;
+  _arena_offsets.clear();
+
+  // Greedy by size: place larger tensors first at the lowest offset not overlapping with tensors
+  // alive at the same time
+  constexpr size_t alignment = 16;
+  std::vector<std::pair<Tensor *, size_t>> tensors;
+  for (const auto &item : _sizes)
+  {
+    if (item.second > 0 && _lifetimes.count(item.first) > 0)
+      tensors.emplace_back(item.first, (item.second + alignment - 1) / alignment * alignment);
+  }
+  std::sort(tensors.begin(), tensors.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+
+  size_t arena_size = 0;
+  std::vector<std::pair<Tensor *, size_t>> placed;
+  for (const auto &item : tensors)
+  {
+    const auto &lifetime = _lifetimes.at(item.first);
+    // Ranges of alive tensors sorted by offset
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (const auto &other : placed)
+    {
+      const auto &other_lifetime = _lifetimes.at(other.first);
+      if (lifetime.first <= other_lifetime.second && other_lifetime.first <= lifetime.second)
+      {
+        const auto offset = _arena_offsets.at(other.first).first;
+        ranges.emplace_back(offset, offset + other.second);
+      }
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    size_t offset = 0;
+    for (const auto &range : ranges)
+    {
+      if (offset + item.second <= range.first)
+        break;
+      offset = std::max(offset, range.second);
+    }
+
+    _arena_offsets[item.first] = {offset, item.second};
+    placed.emplace_back(item);
+    arena_size = std::max(arena_size, offset + item.second);
+  }
+
+  _arena.assign(arena_size, 0);
+  _arena.shrink_to_fit();
+  _arena_planned = true;
+}
+
+void RuntimeGraph::TensorAllocPlan::releaseArena()
+{
+  for (Tensor *tensor : _in_arena)
+    tensor->set_data_buffer(nullptr);
+  _in_arena.clear();
+}
+
 RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager)
   : _owning_module(owning_module), _memory_manager(memory_manager),
     _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager))
@@ -108,6 +228,8 @@ RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_
 
 RuntimeGraph::~RuntimeGraph()
 {
+  // Tensors in arena are not allocated by the memory manager
+  _tensor_alloc_plan->releaseArena();
   for (auto &tensor : _tensors)
   {
     if (tensor->is_data_allocated())
@@ -141,6 +263,13 @@ void RuntimeGraph::configureAllocations(Tensor *tensor)
   _memory_manager->allocate_memory(*tensor);
 }
 
+void RuntimeGraph::resizeInputTensor(size_t index, const Shape &shape)
+{
+  Tensor *tensor = _input_tensors.at(index);
+  tensor->resize(shape);
+  configureAllocations(tensor);
+}
+
 void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
 {
   assert(kernel != nullptr);
@@ -148,11 +277,16 @@ void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
   _tensor_alloc_plan->invalidate();
 }
 
+void RuntimeGraph::enableArenaPlan() { _tensor_alloc_plan->enableArena(); }
+
 void RuntimeGraph::execute() const
 {
   if (!_tensor_alloc_plan->isValid())
     _tensor_alloc_plan->build(*this);
 
+  // Outputs of the previous run are kept until here
+  _tensor_alloc_plan->planArena();
+
   EventNotifier *event_notifier = _owning_module->getEventNotifier();
 
   // Notify the observers that the input tensors have changed.
@@ -46,11 +46,18 @@ public:
 
   void configureAllocations(Tensor *tensor);
 
+  // Resize an input tensor and reallocate it. Shapes of the other tensors follow in the next run.
+  void resizeInputTensor(size_t index, const Shape &shape);
+
   const std::vector<Tensor *> &getInputTensors() const { return _input_tensors; }
   const std::vector<Tensor *> &getOutputTensors() const { return _output_tensors; }
 
   void addKernel(std::unique_ptr<Kernel> &&kernel);
 
+  // Place tensors allocated during execution in an arena planned once from the previous run,
+  // instead of allocating them with the memory manager for every run.
+  void enableArenaPlan();
+
   void execute() const;
 
 private:
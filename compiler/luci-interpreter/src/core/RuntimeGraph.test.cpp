@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+
+#include "luci_interpreter/SimpleMemoryManager.h"
+
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+class AddOne final : public Kernel
+{
+public:
+  AddOne(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+
+  void configure() override { _outputs[0]->resize(_inputs[0]->shape()); }
+
+  void execute() const override
+  {
+    const auto *input = _inputs[0]->data<float>();
+    auto *output = _outputs[0]->data<float>();
+    for (int32_t i = 0; i < _inputs[0]->shape().num_elements(); ++i)
+      output[i] = input[i] + 1.0f;
+  }
+};
+
+class CountingMemoryManager final : public IMemoryManager
+{
+public:
+  void allocate_memory(Tensor &tensor) override
+  {
+    if (tensor.is_allocatable())
+      allocations++;
+    _manager.allocate_memory(tensor);
+  }
+  void release_memory(Tensor &tensor) override { _manager.release_memory(tensor); }
+
+  uint32_t allocations = 0;
+
+private:
+  SimpleMemoryManager _manager;
+};
+
+class RuntimeGraphTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _graph = _module.addGraph(&_memory_manager);
+
+    // input -> AddOne -> AddOne -> AddOne -> output
+    auto make_tensor = [&]() {
+      return _graph->addTensor(
+        std::make_unique<Tensor>(DataType::FLOAT32, Shape({2, 3}), AffineQuantization{}, ""));
+    };
+    _input = make_tensor();
+    Tensor *prev = _input;
+    for (int i = 0; i < 3; ++i)
+    {
+      Tensor *next = make_tensor();
+      _graph->addKernel(std::make_unique<AddOne>(prev, next));
+      prev = next;
+    }
+    _output = prev;
+    _graph->setInputTensors({_input});
+    _graph->setOutputTensors({_output});
+    _graph->configureAllocations(_input);
+  }
+
+  void run(float value)
+  {
+    for (int32_t i = 0; i < 6; ++i)
+      _input->data<float>()[i] = value;
+    _graph->execute();
+    for (int32_t i = 0; i < 6; ++i)
+      ASSERT_FLOAT_EQ(value + 3.0f, _output->data<float>()[i]);
+  }
+
+  CountingMemoryManager _memory_manager;
+  RuntimeModule _module{nullptr};
+  RuntimeGraph *_graph = nullptr;
+  Tensor *_input = nullptr;
+  Tensor *_output = nullptr;
+};
+
+} // namespace
+
+TEST_F(RuntimeGraphTest, Execute)
+{
+  run(1.0f);
+  const auto allocations = _memory_manager.allocations;
+  run(2.0f);
+  EXPECT_EQ(allocations + 3, _memory_manager.allocations);
+}
+
+TEST_F(RuntimeGraphTest, ResizeInput)
+{
+  _graph->resizeInputTensor(0, Shape({3, 2, 3}));
+  for (int32_t i = 0; i < 18; ++i)
+    _input->data<float>()[i] = static_cast<float>(i);
+  _graph->execute();
+
+  ASSERT_EQ(18, _output->shape().num_elements());
+  for (int32_t i = 0; i < 18; ++i)
+    EXPECT_FLOAT_EQ(i + 3.0f, _output->data<float>()[i]);
+}
+
+TEST_F(RuntimeGraphTest, ArenaPlan)
+{
+  _graph->enableArenaPlan();
+
+  // Sizes of tensors are found in the first run
+  run(1.0f);
+  const auto allocations = _memory_manager.allocations;
+
+  run(2.0f);
+  const auto *output_data = _output->data<float>();
+  run(3.0f);
+  EXPECT_EQ(allocations, _memory_manager.allocations);
+  EXPECT_EQ(output_data, _output->data<float>());
+}
+
+TEST_F(RuntimeGraphTest, ArenaPlanGrow)
+{
+  _graph->enableArenaPlan();
+  run(1.0f);
+  run(2.0f);
+
+  // Larger tensors than planned are allocated separately and planned again
+  _input->resize(Shape({4, 3}));
+  _graph->configureAllocations(_input);
+  const auto allocations = _memory_manager.allocations;
+  run(3.0f);
+  EXPECT_EQ(allocations + 3, _memory_manager.allocations);
+
+  run(4.0f);
+  EXPECT_EQ(allocations + 3, _memory_manager.allocations);
+}
+
+} // namespace luci_interpreter
@@ -19,6 +19,7 @@
 
 #include "core/RuntimeGraph.h"
 #include "core/EventNotifier.h"
+#include "core/ThreadPool.h"
 #include "luci_interpreter/MemoryManager.h"
 
 #include <memory>
@@ -46,13 +47,35 @@ public:
     return getMainGraph()->getOutputTensors();
   }
 
-  void execute() const { getMainGraph()->execute(); }
+  void resizeInputTensor(size_t index, const Shape &shape)
+  {
+    getMainGraph()->resizeInputTensor(index, shape);
+  }
+
+  void enableArenaPlan()
+  {
+    for (auto &graph : _graphs)
+      graph->enableArenaPlan();
+  }
+
+  void setNumThreads(uint32_t num_threads)
+  {
+    _thread_pool = num_threads > 1 ? std::make_unique<ThreadPool>(num_threads) : nullptr;
+  }
+
+  void execute() const
+  {
+    ThreadPool::Scope scope(_thread_pool.get());
+    getMainGraph()->execute();
+  }
 
 private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
+  // Used by kernels which can split their work
+  std::unique_ptr<ThreadPool> _thread_pool;
 };
 
 } // namespace luci_interpreter
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace luci_interpreter
+{
+
+namespace
+{
+
+thread_local ThreadPool *current_pool = nullptr;
+
+// Range of the chunk_index-th of num_chunks chunks of [0, size)
+std::pair<uint32_t, uint32_t> chunkRange(uint32_t size, uint32_t num_chunks, uint32_t chunk_index)
+{
+  const uint64_t begin = static_cast<uint64_t>(size) * chunk_index / num_chunks;
+  const uint64_t end = static_cast<uint64_t>(size) * (chunk_index + 1) / num_chunks;
+  return {static_cast<uint32_t>(begin), static_cast<uint32_t>(end)};
+}
+
+} // namespace
+
+ThreadPool::Scope::Scope(ThreadPool *pool) : _prev(current_pool) { current_pool = pool; }
+
+ThreadPool::Scope::~Scope() { current_pool = _prev; }
+
+ThreadPool::ThreadPool(uint32_t num_threads)
+{
+  for (uint32_t i = 1; i < num_threads; ++i)
+    _workers.emplace_back(&ThreadPool::work, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _job_cv.notify_all();
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+ThreadPool *ThreadPool::current() { return current_pool; }
+
+void ThreadPool::parallelFor(uint32_t size, const RangeFn &fn)
+{
+  const uint32_t num_chunks = std::min(size, numThreads());
+  if (num_chunks <= 1)
+  {
+    if (size > 0)
+      fn(0, size);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _fn = &fn;
+    _size = size;
+    _num_chunks = num_chunks;
+    // Workers with index less than num_chunks take a chunk
+    _pending = num_chunks - 1;
+    _generation++;
+  }
+  _job_cv.notify_all();
+
+  // The calling thread takes the first chunk
+  const auto range = chunkRange(size, num_chunks, 0);
+  fn(range.first, range.second);
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done_cv.wait(lock, [this] { return _pending == 0; });
+  _fn = nullptr;
+}
+
+void ThreadPool::work(uint32_t worker_index)
+{
+  uint64_t generation = 0;
+  while (true)
+  {
+    const RangeFn *fn = nullptr;
+    std::pair<uint32_t, uint32_t> range;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _job_cv.wait(lock, [&] { return _stop || _generation != generation; });
+      if (_stop)
+        return;
+
+      generation = _generation;
+      if (worker_index >= _num_chunks)
+        continue;
+
+      fn = _fn;
+      range = chunkRange(_size, _num_chunks, worker_index);
+    }
+
+    (*fn)(range.first, range.second);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      assert(_pending > 0);
+      _pending--;
+    }
+    _done_cv.notify_one();
+  }
+}
+
+void parallelFor(uint32_t size, const ThreadPool::RangeFn &fn)
+{
+  auto pool = ThreadPool::current();
+  if (pool == nullptr)
+  {
+    if (size > 0)
+      fn(0, size);
+    return;
+  }
+  pool->parallelFor(size, fn);
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_THREADPOOL_H
+#define LUCI_INTERPRETER_CORE_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Runs a range of work split into contiguous chunks on worker threads and the calling thread.
+class ThreadPool
+{
+public:
+  using RangeFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+  // Sets the pool used by kernels of the calling thread during its lifetime.
+  class Scope
+  {
+  public:
+    explicit Scope(ThreadPool *pool);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    ThreadPool *_prev;
+  };
+
+public:
+  // num_threads includes the calling thread.
+  explicit ThreadPool(uint32_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  uint32_t numThreads() const { return static_cast<uint32_t>(_workers.size()) + 1; }
+
+  // Calls fn for chunks of [0, size) and returns when all of them are done.
+  void parallelFor(uint32_t size, const RangeFn &fn);
+
+  // Pool of the calling thread, nullptr if there is none.
+  static ThreadPool *current();
+
+private:
+  void work(uint32_t worker_index);
+
+private:
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _job_cv;
+  std::condition_variable _done_cv;
+
+  const RangeFn *_fn = nullptr;
+  uint32_t _size = 0;
+  uint32_t _num_chunks = 0;
+  uint64_t _generation = 0;
+  uint32_t _pending = 0;
+  bool _stop = false;
+};
+
+// Calls fn for chunks of [0, size) with the pool of the calling thread, or at once if there is
+// no pool.
+void parallelFor(uint32_t size, const ThreadPool::RangeFn &fn);
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_THREADPOOL_H
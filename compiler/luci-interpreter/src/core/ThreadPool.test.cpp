@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+TEST(ThreadPoolTest, ParallelFor)
+{
+  ThreadPool pool(4);
+  ASSERT_EQ(4, pool.numThreads());
+
+  for (uint32_t size : {1u, 3u, 4u, 100u})
+  {
+    std::vector<std::atomic<int>> visited(size);
+    pool.parallelFor(size, [&](uint32_t begin, uint32_t end) {
+      for (uint32_t i = begin; i < end; ++i)
+        visited[i]++;
+    });
+    for (const auto &v : visited)
+      EXPECT_EQ(1, v.load());
+  }
+}
+
+TEST(ThreadPoolTest, Scope)
+{
+  ASSERT_EQ(nullptr, ThreadPool::current());
+
+  ThreadPool pool(2);
+  {
+    ThreadPool::Scope scope(&pool);
+    ASSERT_EQ(&pool, ThreadPool::current());
+
+    std::atomic<int> sum{0};
+    parallelFor(10, [&](uint32_t begin, uint32_t end) { sum += end - begin; });
+    EXPECT_EQ(10, sum.load());
+  }
+  ASSERT_EQ(nullptr, ThreadPool::current());
+}
+
+TEST(ThreadPoolTest, NoPool_NEG)
+{
+  uint32_t calls = 0;
+  parallelFor(10, [&](uint32_t begin, uint32_t end) {
+    EXPECT_EQ(0, begin);
+    EXPECT_EQ(10, end);
+    calls++;
+  });
+  EXPECT_EQ(1, calls);
+}
+
+} // namespace
+} // namespace luci_interpreter
@@ -17,6 +17,8 @@
 #include "luci/CircleExporter.h"
 
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 #include <luci/IR/Nodes/CircleRelu.h>
@@ -81,6 +83,67 @@ private:
   std::unique_ptr<std::vector<char>> _buffer;
 };
 
+class ViewedConstGraphContract : public luci::CircleExporter::Contract
+{
+public:
+  ViewedConstGraphContract() : luci::CircleExporter::Contract(), _buffer(new std::vector<char>)
+  {
+    _g = loco::make_graph();
+    auto graph_input = _g->inputs()->create();
+    auto graph_output = _g->outputs()->create();
+    input_node = _g->nodes()->create<luci::CircleInput>();
+    output_node = _g->nodes()->create<luci::CircleOutput>();
+    const_node = _g->nodes()->create<luci::CircleConst>();
+    add_node = _g->nodes()->create<luci::CircleAdd>();
+
+    add_node->x(input_node);
+    add_node->y(const_node);
+    add_node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output_node->from(add_node);
+    input_node->index(graph_input->index());
+    output_node->index(graph_output->index());
+
+    input_node->name("input");
+    output_node->name("output");
+    const_node->name("const");
+    add_node->name("add");
+    input_node->dtype(loco::DataType::FLOAT32);
+    input_node->shape({4});
+    const_node->dtype(loco::DataType::FLOAT32);
+    const_node->shape({4});
+    add_node->dtype(loco::DataType::FLOAT32);
+    add_node->shape({4});
+
+    graph_input->shape({4});
+    graph_input->dtype(loco::DataType::FLOAT32);
+
+    graph_output->shape({4});
+    graph_output->dtype(loco::DataType::FLOAT32);
+  }
+
+  loco::Graph *graph(void) const override { return _g.get(); }
+
+public:
+  bool store(const char *ptr, const size_t size) const override
+  {
+    _buffer->resize(size);
+    std::copy(ptr, ptr + size, _buffer->begin());
+    return true;
+  }
+
+  const std::vector<char> &get_buffer() { return *_buffer; }
+
+public:
+  luci::CircleInput *input_node;
+  luci::CircleOutput *output_node;
+  luci::CircleConst *const_node;
+  luci::CircleAdd *add_node;
+
+private:
+  std::unique_ptr<loco::Graph> _g;
+  std::unique_ptr<std::vector<char>> _buffer;
+};
+
 TEST(CircleExport, export_execution_plan)
 {
   SampleGraphContract contract;
@@ -135,3 +198,36 @@ TEST(CircleExport, export_execution_plan_nosetting_NEG)
   ASSERT_NE(model.get(), nullptr);
   ASSERT_EQ(model->metadata.size(), 0);
 }
+
+TEST(CircleExport, export_viewed_const)
+{
+  ViewedConstGraphContract contract;
+  auto values = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+  contract.const_node->view(reinterpret_cast<const uint8_t *>(values->data()),
+                            values->size() * sizeof(float), values);
+  ASSERT_TRUE(contract.const_node->viewing());
+
+  luci::CircleExporter exporter;
+
+  exporter.invoke(&contract);
+
+  // Exporting only reads the constant, so it should not take its own copy
+  ASSERT_TRUE(contract.const_node->viewing());
+
+  ASSERT_FALSE(contract.get_buffer().empty());
+  std::unique_ptr<circle::ModelT> model(circle::GetModel(contract.get_buffer().data())->UnPack());
+  ASSERT_NE(model.get(), nullptr);
+  bool found = false;
+  for (const auto &tensor : model->subgraphs[0]->tensors)
+  {
+    if (tensor->name != "const")
+      continue;
+    auto &data = model->buffers[tensor->buffer]->data;
+    ASSERT_EQ(data.size(), values->size() * sizeof(float));
+    const float *exported = reinterpret_cast<const float *>(data.data());
+    for (uint32_t i = 0; i < values->size(); ++i)
+      ASSERT_EQ(exported[i], values->at(i));
+    found = true;
+  }
+  ASSERT_TRUE(found);
+}
@@ -58,8 +58,8 @@ public:
   void shape_status(luci::ShapeStatus ss) { _shape_status = ss; }
 
 public:
-  luci::CircleConst *content(void) const { return _content; }
-  void content(luci::CircleConst *c) { _content = c; }
+  const luci::CircleConst *content(void) const { return _content; }
+  void content(const luci::CircleConst *c) { _content = c; }
 
   luci::CircleQuantParam *quantparam(void) const { return _quantparam; }
   void quantparam(luci::CircleQuantParam *qp) { _quantparam = qp; }
@@ -77,7 +77,7 @@ private:
   ShapeDescription _shape{};
   luci::ShapeStatus _shape_status{luci::ShapeStatus::UNDEFINED};
 
-  luci::CircleConst *_content = nullptr;
+  const luci::CircleConst *_content = nullptr;
   luci::CircleQuantParam *_quantparam = nullptr;
   luci::SparsityParam *_sparsityparam = nullptr;
 
@@ -146,7 +146,7 @@ void allocateCircleTensorInfo(CircleNode *node, CircleTensorContext &ctx)
     tensor_info.shape(to_shape_description(node));
   tensor_info.shape_status(node->shape_status());
 
-  tensor_info.content(dynamic_cast<luci::CircleConst *>(node));
+  tensor_info.content(dynamic_cast<const luci::CircleConst *>(node));
   tensor_info.quantparam(node->quantparam());
   tensor_info.sparsityparam(node->sparsityparam());
 
@@ -345,7 +345,7 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, N
 
 template <loco::DataType DT>
 flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+                                                          const luci::CircleConst *c)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
@@ -363,7 +363,8 @@ flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &bui
 
 template <>
 flatbuffers::Offset<circle::Buffer>
-encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, luci::CircleConst *c)
+encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder,
+                                              const luci::CircleConst *c)
 {
   const uint32_t count = c->size<loco::DataType::STRING>();
   uint32_t raw_size = sizeof(int32_t) * (count + 2);
@@ -411,7 +412,7 @@ encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, luci::
 
 template <loco::DataType DT>
 flatbuffers::Offset<circle::Buffer> encodeOpBufferPack4bit(FlatBufferBuilder &builder,
-                                                           luci::CircleConst *c)
+                                                           const luci::CircleConst *c)
 {
   const uint32_t size = c->size<DT>();
   const uint32_t raw_size = (size + 1) / 2;
@@ -435,7 +436,8 @@ flatbuffers::Offset<circle::Buffer> encodeOpBufferPack4bit(FlatBufferBuilder &bu
 }
 
 template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   const luci::CircleConst *c)
 {
   switch (c->dtype())
   {
@@ -526,7 +528,8 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -538,7 +541,7 @@ template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -586,7 +589,8 @@ bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
   return false;
 }
 
-uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci::CircleConst *node)
+uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md,
+                       const luci::CircleConst *node)
 {
   if (node != nullptr)
   {
@@ -124,7 +124,7 @@ struct SerializedModelData final
   CircleExportMetadata _metadata;
 
   // This is used for removing buffers with same values
-  std::map<luci::CircleConst *, uint32_t> _cached_buffer_id;
+  std::map<const luci::CircleConst *, uint32_t> _cached_buffer_id;
 
   /**
    * @brief if opcode is not registered in table of opcodes add it
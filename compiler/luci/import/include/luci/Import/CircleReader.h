@@ -117,9 +117,18 @@ public:
   bool parse(const circle::Model *model);
   bool select_subgraph(uint32_t subgraph);
 
+public:
+  /**
+   * @brief Memory holding the model, which should be alive while nodes refer to it
+   * @note  Constant nodes view their data in the memory without copying if it is set
+   */
+  void storage(std::shared_ptr<const void> storage) { _storage = std::move(storage); }
+  const std::shared_ptr<const void> &storage() const { return _storage; }
+
 private:
   const circle::Model *_model{nullptr};
   const circle::SubGraph *_current_subgraph{nullptr};
+  std::shared_ptr<const void> _storage;
 };
 
 } // namespace luci
@@ -44,6 +44,12 @@ public:
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  /**
+   * @brief Import module whose constants view the model data until they are modified
+   * @param storage Memory holding the model. Constants keep it alive while they view it.
+   */
+  std::unique_ptr<Module> importModule(const circle::Model *model,
+                                       std::shared_ptr<const void> storage) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
@@ -302,6 +302,12 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  return importModule(model, nullptr);
+}
+
+std::unique_ptr<Module> Importer::importModule(const circle::Model *model,
+                                               std::shared_ptr<const void> storage) const
 {
   auto module = make_module();
 
@@ -316,6 +322,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   CircleReader reader;
   if (!reader.parse(model))
     return nullptr;
+  reader.storage(std::move(storage));
 
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
   {
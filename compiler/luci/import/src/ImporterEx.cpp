@@ -17,7 +17,7 @@
 #include "luci/Importer.h"
 #include "luci/ImporterEx.h"
 
-#include <foder/FileLoader.h>
+#include <foder/MappedFileLoader.h>
 
 #include <memory>
 #include <iostream>
@@ -27,12 +27,13 @@ namespace luci
 
 std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_path) const
 {
-  foder::FileLoader file_loader{input_path};
-  std::vector<char> model_data;
+  // Map the file instead of reading it, so that constants view their data in the file
+  foder::MappedFileLoader file_loader{input_path};
+  std::shared_ptr<const foder::MappedFile> model_file;
 
   try
   {
-    model_data = file_loader.load();
+    model_file = file_loader.load();
   }
   catch (const std::runtime_error &err)
   {
@@ -40,14 +41,15 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
     return nullptr;
   }
 
-  flatbuffers::Verifier verifier{reinterpret_cast<uint8_t *>(model_data.data()), model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_file->data()),
+                                 model_file->size()};
   if (!circle::VerifyModelBuffer(verifier))
   {
     std::cerr << "ERROR: Invalid input file '" << input_path << "'" << std::endl;
     return nullptr;
   }
 
-  const circle::Model *circle_model = circle::GetModel(model_data.data());
+  const circle::Model *circle_model = circle::GetModel(model_file->data());
   if (circle_model == nullptr)
   {
     std::cerr << "ERROR: Failed to load circle '" << input_path << "'" << std::endl;
@@ -55,7 +57,7 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
   }
 
   Importer importer;
-  return importer.importModule(circle_model);
+  return importer.importModule(circle_model, model_file);
 }
 
 } // namespace luci
@@ -23,6 +23,8 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -45,9 +47,10 @@ std::ostream &operator<<(std::ostream &os, const luci::VectorWrapper<int32_t> &v
 
 using namespace luci;
 
+// NOTE const_node views raw_data without copying if storage holding raw_data is given
 template <loco::DataType DT>
 void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
-               CircleConst *const_node)
+               CircleConst *const_node, const std::shared_ptr<const void> &storage)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
@@ -60,6 +63,12 @@ void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   assert(raw_data.size() == num_elements * sizeof(T));
   const auto *data = reinterpret_cast<const T *>(raw_data.data());
 
+  if (storage != nullptr && reinterpret_cast<uintptr_t>(data) % alignof(T) == 0)
+  {
+    const_node->view(raw_data.data(), raw_data.size(), storage);
+    return;
+  }
+
   const_node->size<DT>(num_elements);
   for (uint32_t i = 0; i < num_elements; ++i)
   {
@@ -69,7 +78,8 @@ void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
 
 template <>
 void copy_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
-                                       uint32_t num_elements, CircleConst *const_node)
+                                       uint32_t num_elements, CircleConst *const_node,
+                                       const std::shared_ptr<const void> &)
 {
   assert(const_node->sparsityparam() == nullptr);
 
@@ -192,14 +202,15 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
           << const_dims << std::endl;
   if (num_elements > 0)
   {
+    const auto &storage = reader->storage();
     switch (luci_datatype(const_tensor->type()))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::FLOAT16:
-        copy_data<loco::DataType::FLOAT16>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::FLOAT16>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::U4:
@@ -207,7 +218,7 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::U8>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::S4:
@@ -215,27 +226,27 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S8>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S16>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S32>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S64>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node, storage);
         break;
 
       case loco::DataType::STRING:
-        copy_data<loco::DataType::STRING>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::STRING>(buffer, num_elements, const_node, storage);
         break;
 
       default:
@@ -24,6 +24,8 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
@@ -42,8 +44,27 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Use external memory as data without copying it
+   * @param owner Keeps the memory alive while data views it
+   * @note  Data is copied when it is accessed with a non-const method(copy-on-write),
+   *        so the memory is never modified.
+   */
+  void view(const uint8_t *data, uint32_t size, std::shared_ptr<const void> owner);
+  bool viewing(void) const { return _view != nullptr; }
+
+private:
+  const uint8_t *data(void) const { return viewing() ? _view : _data.data(); }
+  uint32_t data_size(void) const { return viewing() ? _view_size : _data.size(); }
+  // Copy viewed data to own it before modification
+  void own(void);
+
 private:
   std::vector<uint8_t> _data;
+  const uint8_t *_view = nullptr;
+  uint32_t _view_size = 0;
+  std::shared_ptr<const void> _view_owner;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
@@ -21,16 +21,40 @@
 namespace luci
 {
 
+void CircleConst::view(const uint8_t *data, uint32_t size, std::shared_ptr<const void> owner)
+{
+  assert(dtype() != loco::DataType::STRING);
+  assert(data != nullptr || size == 0);
+
+  _data.clear();
+  _data.shrink_to_fit();
+  _view = data;
+  _view_size = size;
+  _view_owner = std::move(owner);
+}
+
+void CircleConst::own(void)
+{
+  if (!viewing())
+    return;
+
+  _data.assign(_view, _view + _view_size);
+  _view = nullptr;
+  _view_size = 0;
+  _view_owner.reset();
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(data_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return data_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  own();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +63,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +78,13 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
@@ -88,14 +114,14 @@ INSTANTIATE(loco::DataType::FLOAT16);
 template <> uint32_t CircleConst::size<loco::DataType::STRING>(void) const
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(data_size() == 0);
   return _strings.size();
 }
 
 template <> void CircleConst::size<loco::DataType::STRING>(uint32_t l)
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(data_size() == 0);
   _strings.resize(l);
 }
 
@@ -64,3 +64,27 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, view)
+{
+  auto buffer = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(reinterpret_cast<const uint8_t *>(buffer->data()),
+                  buffer->size() * sizeof(int32_t), buffer);
+
+  const auto &cref = const_node;
+  ASSERT_TRUE(const_node.viewing());
+  ASSERT_EQ(3, cref.size<loco::DataType::S32>());
+  ASSERT_EQ(2, cref.at<loco::DataType::S32>(1));
+  ASSERT_EQ(&buffer->at(1), &cref.at<loco::DataType::S32>(1));
+  ASSERT_EQ(2, buffer.use_count());
+
+  // Modification copies data
+  const_node.at<loco::DataType::S32>(1) = 5;
+  ASSERT_FALSE(const_node.viewing());
+  ASSERT_EQ(5, cref.at<loco::DataType::S32>(1));
+  ASSERT_EQ(2, buffer->at(1));
+  ASSERT_EQ(1, buffer.use_count());
+}
@@ -31,6 +31,8 @@ struct FoldCastPass final : public logo::Pass
   const char *name(void) const final { return "luci::FoldCastPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -31,6 +31,8 @@ struct FoldDequantizePass final : public logo::Pass
   const char *name(void) const final { return "luci::FOLD_DEQUANTIZE"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
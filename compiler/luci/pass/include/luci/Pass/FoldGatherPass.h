@@ -31,6 +31,8 @@ struct FoldGatherPass final : public logo::Pass
   const char *name(void) const final { return "luci::FoldGatherPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
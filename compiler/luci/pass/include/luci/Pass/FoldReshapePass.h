@@ -31,6 +31,8 @@ struct FoldReshapePass final : public logo::Pass
   const char *name(void) const final { return "luci::FoldReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct FoldShapePass final : public logo::Pass
   const char *name(void) const final { return "luci::FoldShapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -32,6 +32,8 @@ struct FuseMulWithDivPass final : public logo::Pass
   const char *name(void) const final { return "luci::FuseMulWithDivPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
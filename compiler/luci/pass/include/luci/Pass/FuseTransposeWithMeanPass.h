@@ -30,6 +30,8 @@ struct FuseTransposeWithMeanPass final : public logo::Pass
   const char *name(void) const final { return "luci::FuseTransposeWithMeanPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
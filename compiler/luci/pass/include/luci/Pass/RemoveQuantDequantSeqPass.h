@@ -30,6 +30,8 @@ struct RemoveQuantDequantSeqPass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveQuantDequantSeqPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct RemoveRedundantQuantizePass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveRedundantQuantizePass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
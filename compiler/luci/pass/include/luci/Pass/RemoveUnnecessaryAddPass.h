@@ -30,6 +30,8 @@ struct RemoveUnnecessaryAddPass final : public logo::Pass
   const char *name(void) const final { return "luci::RemoveUnnecessaryAddPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -31,6 +31,8 @@ struct ReplaceSubWithAddPass final : public logo::Pass
   const char *name(void) const final { return "luci::ReplaceSubWithAddPass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct TransformMinMaxToRelu6Pass final : public logo::Pass
   const char *name(void) const final { return "luci::TransformMinMaxToRelu6Pass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -30,6 +30,8 @@ struct TransformMinReluToRelu6Pass final : public logo::Pass
   const char *name(void) const final { return "luci::TransformMinReluToRelu6Pass"; }
 
   bool run(loco::Graph *g) final;
+
+  bool interested(const loco::Node *node) const final;
 };
 
 } // namespace luci
@@ -101,6 +101,7 @@
 
 #include "ModulePhase.h"
 #include "ProgressReporter.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <logo/Phase.h>
@@ -552,8 +553,9 @@ void CircleOptimizer::optimize(loco::Graph *g) const
 
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  // Passes run again only when a change is made around nodes they are interested in
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g, node_digest};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
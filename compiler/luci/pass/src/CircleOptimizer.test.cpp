@@ -15,9 +15,104 @@
  */
 
 #include "luci/CircleOptimizer.h"
+#include "luci/Pass/FoldCastPass.h"
+#include "luci/Pass/FoldDequantizePass.h"
+#include "luci/Pass/FoldGatherPass.h"
+#include "luci/Pass/FoldSqueezePass.h"
+#include "luci/Pass/RemoveFakeQuantPass.h"
+#include "luci/Pass/RemoveUnnecessaryReshapePass.h"
+#include "luci/Pass/RemoveUnnecessarySlicePass.h"
+#include "luci/Pass/RemoveUnnecessarySplitPass.h"
+#include "luci/Pass/SubstituteTransposeToReshapePass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <logo/Phase.h>
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct PassCounter final : public logo::PhaseEventListener
+{
+  void notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassBegin> *) final { runs++; }
+
+  uint32_t runs = 0;
+};
+
+// Input -> Transpose x length -> Output, where every Transpose can be a Reshape
+luci::CircleOutput *build_transpose_chain(loco::Graph *g, uint32_t length)
+{
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->index(g->inputs()->create()->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->shape_status(luci::ShapeStatus::VALID);
+  input->shape({1, 1, 4});
+  input->name("input");
+
+  loco::Node *tail = input;
+  for (uint32_t i = 0; i < length; ++i)
+  {
+    auto perm = g->nodes()->create<luci::CircleConst>();
+    perm->dtype(loco::DataType::S32);
+    perm->size<loco::DataType::S32>(3);
+    perm->shape_status(luci::ShapeStatus::VALID);
+    perm->shape({3});
+    perm->at<loco::DataType::S32>(0) = 1;
+    perm->at<loco::DataType::S32>(1) = 0;
+    perm->at<loco::DataType::S32>(2) = 2;
+    perm->name("perm_" + std::to_string(i));
+
+    auto transpose = g->nodes()->create<luci::CircleTranspose>();
+    transpose->a(tail);
+    transpose->perm(perm);
+    transpose->dtype(loco::DataType::FLOAT32);
+    transpose->shape_status(luci::ShapeStatus::VALID);
+    transpose->shape({1, 1, 4});
+    transpose->name("transpose_" + std::to_string(i));
+    tail = transpose;
+  }
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->index(g->outputs()->create()->index());
+  output->from(tail);
+  output->name("output");
+  return output;
+}
+
+logo::Phase make_phase(void)
+{
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<luci::FoldCastPass>());
+  phase.emplace_back(std::make_unique<luci::FoldDequantizePass>());
+  phase.emplace_back(std::make_unique<luci::FoldGatherPass>());
+  phase.emplace_back(std::make_unique<luci::FoldSqueezePass>());
+  phase.emplace_back(std::make_unique<luci::RemoveFakeQuantPass>());
+  phase.emplace_back(std::make_unique<luci::RemoveUnnecessarySlicePass>());
+  phase.emplace_back(std::make_unique<luci::RemoveUnnecessarySplitPass>());
+  phase.emplace_back(std::make_unique<luci::SubstituteTransposeToReshapePass>());
+  phase.emplace_back(std::make_unique<luci::RemoveUnnecessaryReshapePass>());
+  return phase;
+}
+
+// Opcodes from output to input
+std::vector<luci::CircleOpcode> chain_of(const luci::CircleOutput *output)
+{
+  std::vector<luci::CircleOpcode> opcodes;
+  auto node = loco::must_cast<luci::CircleNode *>(output->from());
+  while (node->arity() > 0)
+  {
+    opcodes.emplace_back(node->opcode());
+    node = loco::must_cast<luci::CircleNode *>(node->arg(0));
+  }
+  return opcodes;
+}
+
+} // namespace
+
 using namespace luci;
 using Algorithms = luci::CircleOptimizer::Options::Algorithm;
 using AlgorithmParameters = luci::CircleOptimizer::Options::AlgorithmParameters;
@@ -53,6 +148,32 @@ TEST(CircleOptimizerTest, optimize_algorithms)
   SUCCEED();
 }
 
+TEST(CircleOptimizerTest, worklist_matches_restart)
+{
+  const uint32_t length = 8;
+
+  loco::Graph restart_g;
+  auto restart_output = build_transpose_chain(&restart_g, length);
+  auto restart_phase = make_phase();
+  PassCounter restart_counter;
+  logo::PhaseRunner<logo::PhaseStrategy::Restart> restart_runner{&restart_g};
+  restart_runner.attach(&restart_counter);
+  restart_runner.run(restart_phase);
+
+  loco::Graph worklist_g;
+  auto worklist_output = build_transpose_chain(&worklist_g, length);
+  auto worklist_phase = make_phase();
+  PassCounter worklist_counter;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> worklist_runner{&worklist_g};
+  worklist_runner.attach(&worklist_counter);
+  worklist_runner.run(worklist_phase);
+
+  // Same result with fewer pass runs, as passes not interested in Transpose and Reshape are skipped
+  ASSERT_EQ(chain_of(restart_output), chain_of(worklist_output));
+  ASSERT_TRUE(chain_of(worklist_output).empty());
+  ASSERT_LT(worklist_counter.runs, restart_counter.runs);
+}
+
 TEST(CircleOptimizerTest, sparsify_simple)
 {
   loco::Graph g;
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldCastPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -122,4 +124,9 @@ bool FoldCastPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldCastPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::CAST});
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 
 #include "luci/Pass/FoldDensifyPass.h"
 #include "helpers/SparsityFormatConverter.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -177,4 +178,9 @@ bool FoldDensifyPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldDensifyPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::DENSIFY});
+}
+
 } // namespace luci
@@ -18,6 +18,7 @@
 
 #include "helpers/Compute.h"
 #include "helpers/Shape.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/AttrFusedActFunc.h>
@@ -167,4 +168,9 @@ bool FoldDepthwiseConv2DPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldDepthwiseConv2DPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::DEPTHWISE_CONV_2D});
+}
+
 } // namespace luci
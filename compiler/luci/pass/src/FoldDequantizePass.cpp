@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldDequantizePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -261,4 +263,9 @@ bool FoldDequantizePass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldDequantizePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::DEQUANTIZE, luci::CircleOpcode::CIRCLECONST});
+}
+
 } // namespace luci
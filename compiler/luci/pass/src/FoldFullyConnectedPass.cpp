@@ -18,6 +18,7 @@
 
 #include "helpers/Compute.h"
 #include "helpers/Shape.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/AttrFusedActFunc.h>
@@ -167,6 +168,11 @@ bool FoldFullyConnectedPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldFullyConnectedPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::FULLY_CONNECTED});
+}
+
 } // namespace luci
 
 #undef RETURN_FALSE_UNLESS
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldGatherPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -181,4 +183,9 @@ bool FoldGatherPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldGatherPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::GATHER});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -123,4 +125,9 @@ bool FoldReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::RESHAPE});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldShapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -115,4 +117,9 @@ bool FoldShapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldShapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SHAPE});
+}
+
 } // namespace luci
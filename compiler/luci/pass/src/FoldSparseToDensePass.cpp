@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldSparseToDensePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 #include <limits>
@@ -138,4 +140,9 @@ bool FoldSparseToDensePass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldSparseToDensePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SPARSE_TO_DENSE});
+}
+
 } // namespace luci
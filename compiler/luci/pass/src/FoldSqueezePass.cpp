@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldSqueezePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -118,4 +120,9 @@ bool FoldSqueezePass::run(loco::Graph *g)
   return changed;
 }
 
+bool FoldSqueezePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SQUEEZE});
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseAddWithConvPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -158,4 +159,9 @@ bool FuseAddWithConvPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseAddWithConvPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::ADD, luci::CircleOpcode::CONV_2D});
+}
+
 } // namespace luci
@@ -26,7 +26,8 @@
 namespace
 {
 
-bool is_fusable_const(luci::CircleConst *before, luci::CircleConst *after, bool do_w_x)
+bool is_fusable_const(const luci::CircleConst *before, const luci::CircleConst *after,
+                      bool do_w_x)
 {
   if (after->dtype() != loco::DataType::FLOAT32)
     return false;
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseMeanWithMeanPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNode.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -169,4 +171,9 @@ bool FuseMeanWithMeanPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseMeanWithMeanPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::MEAN});
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseMulWithDivPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/IR/CircleNodes.h>
@@ -243,4 +244,9 @@ bool FuseMulWithDivPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseMulWithDivPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::MUL, luci::CircleOpcode::DIV});
+}
+
 } // namespace luci
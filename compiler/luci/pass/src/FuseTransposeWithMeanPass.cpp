@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseTransposeWithMeanPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNode.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -161,4 +163,9 @@ bool FuseTransposeWithMeanPass::run(loco::Graph *g)
   return changed;
 }
 
+bool FuseTransposeWithMeanPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::MEAN, luci::CircleOpcode::TRANSPOSE});
+}
+
 } // namespace luci
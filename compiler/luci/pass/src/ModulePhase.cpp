@@ -16,6 +16,8 @@
 
 #include "ModulePhase.h"
 
+#include <chrono>
+
 namespace luci
 {
 
@@ -31,10 +33,13 @@ void PhaseRunner<logo::PhaseStrategy::Saturate>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      const auto begin = std::chrono::steady_clock::now();
       bool pass_changed = pass->run(_module);
+      const auto elapsed = std::chrono::steady_clock::now() - begin;
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed,
+                    std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
     }
   }
 
@@ -53,10 +58,13 @@ void PhaseRunner<logo::PhaseStrategy::Restart>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      const auto begin = std::chrono::steady_clock::now();
       bool pass_changed = pass->run(_module);
+      const auto elapsed = std::chrono::steady_clock::now() - begin;
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed,
+                    std::chrono::duration_cast<std::chrono::microseconds>(elapsed));
 
       if (changed)
       {
@@ -22,7 +22,9 @@
 #include <logo/Phase.h>
 #include <logo/Pass.h>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 namespace
 {
@@ -37,11 +39,42 @@ const char *to_str(logo::PhaseStrategy s)
       return "Saturate";
     case logo::PhaseStrategy::Restart:
       return "Restart";
+    case logo::PhaseStrategy::Worklist:
+      return "Worklist";
   }
   assert(false);
   return "";
 }
 
+void record(luci::PhaseProfile &profile,
+            const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info)
+{
+  auto &pass_profile = profile[logo::pass_name(info->pass())];
+  pass_profile.runs++;
+  pass_profile.changes += info->changed() ? 1 : 0;
+  pass_profile.elapsed += info->elapsed();
+}
+
+// Print passes in descending order of elapsed time
+void report(luci::PhaseProfile &profile)
+{
+  LOGGER(prime);
+
+  std::vector<std::pair<std::string, luci::PassProfile>> passes(profile.begin(), profile.end());
+  std::sort(passes.begin(), passes.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.second.elapsed > rhs.second.elapsed;
+  });
+
+  for (const auto &pass : passes)
+  {
+    VERBOSE(prime, 1) << pass.first << ": " << pass.second.elapsed.count() << "us"
+                      << " (runs: " << pass.second.runs << ", changes: " << pass.second.changes
+                      << ")";
+  }
+
+  profile.clear();
+}
+
 } // namespace
 
 namespace luci
@@ -62,6 +95,8 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::Phase
   LOGGER(prime);
 
   INFO(prime) << "PhaseRunner<" << to_str(strategy()) << "> - done";
+
+  report(_profile);
 }
 
 void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassBegin> *info)
@@ -76,8 +111,11 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassE
 {
   LOGGER(prime);
 
+  record(_profile, info);
+
   INFO(prime) << "After " << logo::pass_name(info->pass())
-              << " (changed: " << to_char(info->changed()) << ")";
+              << " (changed: " << to_char(info->changed())
+              << ", elapsed: " << info->elapsed().count() << "us)";
   INFO(prime) << luci::fmt(graph());
 }
 
@@ -100,6 +138,8 @@ void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent:
   LOGGER(prime);
 
   INFO(prime) << "ModulePhaseRunner<" << to_str(strategy()) << "> - done";
+
+  report(_profile);
 }
 
 void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassBegin> *info)
@@ -114,8 +154,11 @@ void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent:
 {
   LOGGER(prime);
 
+  record(_profile, info);
+
   INFO(prime) << "After " << logo::pass_name(info->pass())
-              << " (changed: " << to_char(info->changed()) << ")";
+              << " (changed: " << to_char(info->changed())
+              << ", elapsed: " << info->elapsed().count() << "us)";
   for (size_t g = 0; g < module()->size(); ++g)
   {
     INFO(prime) << "graphs #" << g;
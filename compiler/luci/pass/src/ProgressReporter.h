@@ -23,9 +23,23 @@
 
 #include <luci/IR/Module.h>
 
+#include <chrono>
+#include <map>
+#include <string>
+
 namespace luci
 {
 
+// Accumulated runs of a pass in a phase
+struct PassProfile
+{
+  uint32_t runs = 0;
+  uint32_t changes = 0;
+  std::chrono::microseconds elapsed{0};
+};
+
+using PhaseProfile = std::map<std::string, PassProfile>;
+
 class ProgressReporter : public logo::PhaseEventListener
 {
 public:
@@ -48,6 +62,7 @@ public:
 private:
   loco::Graph *_graph;
   logo::PhaseStrategy _strategy;
+  PhaseProfile _profile;
 };
 
 class ModuleProgressReporter : public logo::PhaseEventListener
@@ -72,6 +87,7 @@ public:
 private:
   luci::Module *_module;
   logo::PhaseStrategy _strategy;
+  PhaseProfile _profile;
 };
 
 } // namespace luci
@@ -21,7 +21,7 @@
 namespace
 {
 
-bool compare_quant_params(luci::CircleConst *left, luci::CircleConst *right)
+bool compare_quant_params(const luci::CircleConst *left, const luci::CircleConst *right)
 {
   const auto left_quant_param = left->quantparam();
   const auto right_quant_param = right->quantparam();
@@ -43,7 +43,7 @@ bool compare_quant_params(luci::CircleConst *left, luci::CircleConst *right)
   return false;
 }
 
-bool compare_dim_values(luci::CircleConst *left, luci::CircleConst *right)
+bool compare_dim_values(const luci::CircleConst *left, const luci::CircleConst *right)
 {
   const auto left_rank = left->rank();
   const auto right_rank = right->rank();
@@ -60,7 +60,8 @@ bool compare_dim_values(luci::CircleConst *left, luci::CircleConst *right)
   return true;
 }
 
-template <loco::DataType DT> bool is_equal_consts(luci::CircleConst *left, luci::CircleConst *right)
+template <loco::DataType DT>
+bool is_equal_consts(const luci::CircleConst *left, const luci::CircleConst *right)
 {
   if (not compare_quant_params(left, right))
     return false;
@@ -154,12 +155,14 @@ bool RemoveDuplicateConstPass::remove_duplicate_const()
 template <loco::DataType DT>
 void RemoveDuplicateConstPass::add_to_map(luci::CircleConst *const_node)
 {
-  const auto const_size = const_node->size<DT>();
+  // Read values through const to keep a viewed constant from being copied
+  const luci::CircleConst *values = const_node;
+  const auto const_size = values->size<DT>();
   float sum = 0.0;
 
   for (uint32_t i = 0; i < const_size; ++i)
   {
-    sum += const_node->at<DT>(i);
+    sum += values->at<DT>(i);
   }
 
   if (_sum_to_const.find(sum) == _sum_to_const.end())
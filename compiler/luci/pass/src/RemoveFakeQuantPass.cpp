@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveFakeQuantPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -66,4 +68,9 @@ bool RemoveFakeQuantPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveFakeQuantPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::FAKE_QUANT});
+}
+
 } // namespace luci
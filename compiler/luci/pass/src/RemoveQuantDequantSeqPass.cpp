@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveQuantDequantSeqPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -74,4 +76,9 @@ bool RemoveQuantDequantSeqPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveQuantDequantSeqPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::QUANTIZE, luci::CircleOpcode::DEQUANTIZE});
+}
+
 } // namespace luci
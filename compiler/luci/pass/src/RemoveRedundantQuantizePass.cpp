@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveRedundantQuantizePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNode.h>
 
 /**
@@ -101,4 +103,9 @@ bool RemoveRedundantQuantizePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveRedundantQuantizePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::QUANTIZE});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveRedundantTransposePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -127,4 +129,9 @@ bool RemoveRedundantTransposePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveRedundantTransposePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::TRANSPOSE});
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/RemoveUnnecessaryAddPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 
@@ -104,4 +105,9 @@ bool RemoveUnnecessaryAddPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessaryAddPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::ADD});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessaryReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -91,4 +93,9 @@ bool RemoveUnnecessaryReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessaryReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::RESHAPE});
+}
+
 } // namespace luci
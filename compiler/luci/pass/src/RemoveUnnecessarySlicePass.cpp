@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessarySlicePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -108,4 +110,9 @@ bool RemoveUnnecessarySlicePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessarySlicePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SLICE});
+}
+
 } // namespace luci
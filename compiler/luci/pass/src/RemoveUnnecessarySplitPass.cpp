@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessarySplitPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -61,4 +63,9 @@ bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessarySplitPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SPLIT, luci::CircleOpcode::CIRCLESPLITOUT});
+}
+
 } // namespace luci
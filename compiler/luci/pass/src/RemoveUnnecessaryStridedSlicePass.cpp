@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessaryStridedSlicePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -121,4 +123,9 @@ bool RemoveUnnecessaryStridedSlicePass::run(loco::Graph *g)
   return changed;
 }
 
+bool RemoveUnnecessaryStridedSlicePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::STRIDED_SLICE});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/ReplaceSubWithAddPass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -73,4 +75,9 @@ bool ReplaceSubWithAddPass::run(loco::Graph *g)
   return changed;
 }
 
+bool ReplaceSubWithAddPass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SUB});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/SubstitutePackToReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -123,4 +125,9 @@ bool SubstitutePackToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstitutePackToReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::PACK});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/SubstituteSqueezeToReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -181,4 +183,9 @@ bool SubstituteSqueezeToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstituteSqueezeToReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::SQUEEZE});
+}
+
 } // namespace luci
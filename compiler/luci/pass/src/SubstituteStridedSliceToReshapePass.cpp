@@ -16,6 +16,8 @@
 
 #include "luci/Pass/SubstituteStridedSliceToReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -212,4 +214,9 @@ bool SubstituteStridedSliceToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstituteStridedSliceToReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::STRIDED_SLICE});
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/SubstituteTransposeToReshapePass.h"
 
+#include "helpers/NodeInterest.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -134,4 +136,9 @@ bool SubstituteTransposeToReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+bool SubstituteTransposeToReshapePass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::TRANSPOSE});
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/TransformMinMaxToRelu6Pass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -130,4 +131,9 @@ bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
   return changed;
 }
 
+bool TransformMinMaxToRelu6Pass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::MINIMUM, luci::CircleOpcode::MAXIMUM});
+}
+
 } // namespace luci
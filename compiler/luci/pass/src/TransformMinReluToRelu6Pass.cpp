@@ -17,6 +17,7 @@
 #include "luci/Pass/TransformMinReluToRelu6Pass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/NodeInterest.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -120,4 +121,9 @@ bool TransformMinReluToRelu6Pass::run(loco::Graph *g)
   return changed;
 }
 
+bool TransformMinReluToRelu6Pass::interested(const loco::Node *node) const
+{
+  return is_one_of(node, {luci::CircleOpcode::MINIMUM, luci::CircleOpcode::RELU});
+}
+
 } // namespace luci
@@ -120,8 +120,8 @@ bool same_attributes(const luci::CircleTranspose *x, luci::CircleTranspose *y)
 
   assert(same_common_attributes(x, y)); // FIX_CALLER_UNLESS
 
-  const auto perm_x = dynamic_cast<luci::CircleConst *>(x->perm());
-  const auto perm_y = dynamic_cast<luci::CircleConst *>(y->perm());
+  const auto perm_x = dynamic_cast<const luci::CircleConst *>(x->perm());
+  const auto perm_y = dynamic_cast<const luci::CircleConst *>(y->perm());
 
   RETURN_FALSE_UNLESS(perm_x);
   RETURN_FALSE_UNLESS(perm_y);
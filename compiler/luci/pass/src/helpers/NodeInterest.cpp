@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NodeInterest.h"
+
+namespace
+{
+
+void hash_combine(size_t &seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool is_one_of(const loco::Node *node, std::initializer_list<luci::CircleOpcode> opcodes)
+{
+  auto circle_node = dynamic_cast<const luci::CircleNode *>(node);
+  if (circle_node == nullptr)
+    return false;
+
+  for (auto opcode : opcodes)
+  {
+    if (circle_node->opcode() == opcode)
+      return true;
+  }
+  return false;
+}
+
+size_t node_digest(const loco::Node *node)
+{
+  auto circle_node = dynamic_cast<const luci::CircleNode *>(node);
+  if (circle_node == nullptr)
+    return 0;
+
+  size_t digest = 0;
+  hash_combine(digest, static_cast<size_t>(circle_node->dtype()));
+  hash_combine(digest, static_cast<size_t>(circle_node->shape_status()));
+  hash_combine(digest, circle_node->rank());
+  for (uint32_t i = 0; i < circle_node->rank(); ++i)
+  {
+    const auto &dim = circle_node->dim(i);
+    hash_combine(digest, dim.known() ? dim.value() + 1 : 0);
+  }
+  return digest;
+}
+
+} // namespace luci
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_HELPERS_NODE_INTEREST_H__
+#define __LUCI_PASS_HELPERS_NODE_INTEREST_H__
+
+#include <luci/IR/CircleNodes.h>
+
+#include <initializer_list>
+
+namespace luci
+{
+
+/**
+ * @brief Return true if node is one of the given opcodes
+ *
+ * @note  Use this to implement logo::Pass::interested with opcodes of nodes a pass starts from
+ */
+bool is_one_of(const loco::Node *node, std::initializer_list<luci::CircleOpcode> opcodes);
+
+/**
+ * @brief Return digest of node attributes that shape and type inference may change
+ */
+size_t node_digest(const loco::Node *node);
+
+} // namespace luci
+
+#endif // __LUCI_PASS_HELPERS_NODE_INTEREST_H__
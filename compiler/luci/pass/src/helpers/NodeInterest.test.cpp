@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NodeInterest.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+TEST(NodeInterestTest, is_one_of)
+{
+  luci::CircleAdd add;
+  luci::CircleMul mul;
+
+  ASSERT_TRUE(luci::is_one_of(&add, {luci::CircleOpcode::ADD}));
+  ASSERT_TRUE(luci::is_one_of(&mul, {luci::CircleOpcode::ADD, luci::CircleOpcode::MUL}));
+}
+
+TEST(NodeInterestTest, is_one_of_NEG)
+{
+  luci::CircleAdd add;
+
+  ASSERT_FALSE(luci::is_one_of(&add, {luci::CircleOpcode::MUL}));
+  ASSERT_FALSE(luci::is_one_of(&add, {}));
+  ASSERT_FALSE(luci::is_one_of(nullptr, {luci::CircleOpcode::ADD}));
+}
+
+TEST(NodeInterestTest, node_digest)
+{
+  luci::CircleAdd add;
+  add.dtype(loco::DataType::FLOAT32);
+  add.shape({1, 2});
+  const auto digest = luci::node_digest(&add);
+
+  ASSERT_EQ(digest, luci::node_digest(&add));
+
+  add.shape({2, 1});
+  ASSERT_NE(digest, luci::node_digest(&add));
+
+  add.shape({1, 2});
+  add.dtype(loco::DataType::S32);
+  ASSERT_NE(digest, luci::node_digest(&add));
+}
@@ -77,18 +77,18 @@ struct StridedSliceContext
     params.shrink_axis_mask = node->shrink_axis_mask();
 
     input = loco::must_cast<luci::CircleNode *>(node->input());
-    begin = loco::must_cast<luci::CircleConst *>(node->begin());
-    end = loco::must_cast<luci::CircleConst *>(node->end());
-    strides = loco::must_cast<luci::CircleConst *>(node->strides());
+    begin = loco::must_cast<const luci::CircleConst *>(node->begin());
+    end = loco::must_cast<const luci::CircleConst *>(node->end());
+    strides = loco::must_cast<const luci::CircleConst *>(node->strides());
 
     loco::TensorShape input_shape = luci::shape_get(input).as<loco::TensorShape>();
     input_dims = input_shape.rank();
   }
   StridedSliceParams params;
   luci::CircleNode *input = nullptr;
-  luci::CircleConst *begin = nullptr;
-  luci::CircleConst *end = nullptr;
-  luci::CircleConst *strides = nullptr;
+  const luci::CircleConst *begin = nullptr;
+  const luci::CircleConst *end = nullptr;
+  const luci::CircleConst *strides = nullptr;
 
   // Equivalent input shape after adding axis according to new_axis_mask.
   loco::TensorShape effective_input_shape;
@@ -374,9 +374,9 @@ loco::TensorShape infer_output_shape(const CircleStridedSlice *node)
 
   auto input_node = loco::must_cast<luci::CircleNode *>(node->input());
 
-  auto begin_node = dynamic_cast<luci::CircleConst *>(node->begin());
-  auto end_node = dynamic_cast<luci::CircleConst *>(node->end());
-  auto strides_node = dynamic_cast<luci::CircleConst *>(node->strides());
+  auto begin_node = dynamic_cast<const luci::CircleConst *>(node->begin());
+  auto end_node = dynamic_cast<const luci::CircleConst *>(node->end());
+  auto strides_node = dynamic_cast<const luci::CircleConst *>(node->strides());
   if (begin_node == nullptr || end_node == nullptr || strides_node == nullptr)
   {
     INTERNAL_EXN("StridedSlice begin/end/strides nodes are not Constant");
@@ -59,6 +59,15 @@ int entry(const int argc, char **argv)
     .type(arser::DataType::INT32)
     .help("Number of threads (default: 1)");
 
+  arser.add_argument("--num_kernel_threads")
+    .type(arser::DataType::INT32)
+    .help("Number of threads used to split heavy kernels of each interpreter (default: 1)");
+
+  arser.add_argument("--batch_size")
+    .type(arser::DataType::INT32)
+    .help("Number of records run at once for h5 input data (default: 1). "
+          "Inputs should have batch dimension of 1, and records should not be mixed in the model");
+
   arser.add_argument("--max_percentile")
     .type(arser::DataType::FLOAT)
     .help("Record n'th percentile of max");
@@ -72,7 +81,14 @@ int entry(const int argc, char **argv)
     .help("Hyperparameter (C) to compute moving average (default: 0.1). Update equation: avg <- "
           "avg + C * (curr_batch_avg - avg)");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--num_bins")
+    .type(arser::DataType::INT32)
+    .help("Number of histogram bins for histogram_percentile and entropy mode (default: 2048)");
+
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average, histogram_percentile or entropy. "
+    "histogram_percentile is the same as percentile, but uses constant memory. "
+    "entropy clips min/max to minimize KL divergence caused by quantization");
 
   arser.add_argument("--input_data_format")
     .help("Input data format. h5/hdf5 (default) or list/filelist");
@@ -111,8 +127,11 @@ int entry(const int argc, char **argv)
   float max_percentile = 99.0;
   uint32_t moving_avg_batch = 16;
   float moving_avg_const = 0.1;
+  uint32_t num_bins = 2048;
   std::string input_data_format("h5");
   uint32_t num_threads = 1;
+  int32_t num_kernel_threads = 1;
+  int32_t batch_size = 1;
 
   if (arser["--min_percentile"])
     min_percentile = arser.get<float>("--min_percentile");
@@ -123,6 +142,18 @@ int entry(const int argc, char **argv)
   if (num_threads < 1)
     throw std::runtime_error("The number of threads must be greater than zero");
 
+  if (arser["--num_kernel_threads"])
+    num_kernel_threads = arser.get<int>("--num_kernel_threads");
+
+  if (num_kernel_threads < 1)
+    throw std::runtime_error("The number of kernel threads must be greater than zero");
+
+  if (arser["--batch_size"])
+    batch_size = arser.get<int>("--batch_size");
+
+  if (batch_size < 1)
+    throw std::runtime_error("The batch size must be greater than zero");
+
   if (arser["--max_percentile"])
     max_percentile = arser.get<float>("--max_percentile");
 
@@ -135,7 +166,11 @@ int entry(const int argc, char **argv)
   if (arser["--moving_avg_const"])
     moving_avg_const = arser.get<float>("--moving_avg_const");
 
-  if (mode != "percentile" && mode != "moving_average")
+  if (arser["--num_bins"])
+    num_bins = arser.get<int>("--num_bins");
+
+  if (mode != "percentile" && mode != "moving_average" && mode != "histogram_percentile" &&
+      mode != "entropy")
     throw std::runtime_error("Unsupported mode");
 
   if (arser["--generate_profile_data"])
@@ -154,13 +189,23 @@ int entry(const int argc, char **argv)
     {
       computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const);
     }
+    else if (mode == "histogram_percentile")
+    {
+      computer = make_histogram_percentile_computer(min_percentile, max_percentile, num_bins);
+    }
+    else if (mode == "entropy")
+    {
+      // Levels of one side of 8-bit quantization
+      const uint32_t num_quantized_bins = 128;
+      computer = make_entropy_computer(num_bins, num_quantized_bins);
+    }
     else
     {
       assert(false);
     }
   }
 
-  RecordMinMax rmm(num_threads, std::move(computer));
+  RecordMinMax rmm(num_threads, std::move(computer), batch_size, num_kernel_threads);
 
   // TODO: support parallel record for profile with random data
   if (num_threads > 1 and not arser["--input_data"])
@@ -168,6 +213,11 @@ int entry(const int argc, char **argv)
     throw std::runtime_error("Input data must be given for parallel recording");
   }
 
+  if (batch_size > 1 and not arser["--input_data"])
+  {
+    throw std::runtime_error("Input data must be given for batched recording");
+  }
+
   // Initialize interpreter and observer
   rmm.initialize(input_model_path);
 
@@ -181,6 +231,13 @@ int entry(const int argc, char **argv)
       throw std::runtime_error("Parallel recording is used only for h5 now");
     }
 
+    // TODO: support batched record for parallel record and other input data formats
+    if (batch_size > 1 and
+        (num_threads > 1 or not(input_data_format == "h5" or input_data_format == "hdf5")))
+    {
+      throw std::runtime_error("Batched recording is used only for h5 without parallel recording");
+    }
+
     if (input_data_format == "h5" || input_data_format == "hdf5")
     {
       // Profile min/max while executing the H5 data
@@ -17,6 +17,7 @@
 #ifndef __RECORD_MINMAX_MINMAXCOMPUTER_H__
 #define __RECORD_MINMAX_MINMAXCOMPUTER_H__
 
+#include "MinMaxHistograms.h"
 #include "MinMaxVectors.h"
 
 #include <luci/IR/CircleNode.h>
@@ -40,6 +41,13 @@ public:
   // Child class must implement this
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+
+  // Return histograms to be recorded, or nullptr if min/max vectors are used
+  virtual const HistogramConfig *histogram_config() const { return nullptr; }
+
+  // Child class which returns histogram_config must implement this
+  virtual void update_qparam_from_histograms(
+    const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *histogram_map);
 };
 
 class PercentileComputer : public MinMaxComputer
@@ -74,12 +82,69 @@ private:
   float _update_const = 0.0;
 };
 
+// Same as PercentileComputer, but min/max are recorded in histograms of fixed size
+class HistogramPercentileComputer : public MinMaxComputer
+{
+public:
+  HistogramPercentileComputer(float min_percentile, float max_percentile, uint32_t num_bins)
+    : _min_percentile(min_percentile), _max_percentile(max_percentile)
+  {
+    _config.num_bins = num_bins;
+    _config.record_minmax = true;
+  }
+
+  virtual void
+  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+
+  const HistogramConfig *histogram_config() const override { return &_config; }
+
+  void update_qparam_from_histograms(
+    const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *histogram_map) override;
+
+private:
+  float _min_percentile = 0.0;
+  float _max_percentile = 0.0;
+  HistogramConfig _config;
+};
+
+// Clip min/max by the threshold which minimizes KL divergence after quantization
+class EntropyComputer : public MinMaxComputer
+{
+public:
+  EntropyComputer(uint32_t num_bins, uint32_t num_quantized_bins)
+    : _num_quantized_bins(num_quantized_bins)
+  {
+    _config.num_bins = num_bins;
+    _config.record_minmax = true;
+    _config.record_abs = true;
+  }
+
+  // Not supported, because min/max vectors do not have distribution of values
+  virtual void
+  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+
+  const HistogramConfig *histogram_config() const override { return &_config; }
+
+  void update_qparam_from_histograms(
+    const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *histogram_map) override;
+
+private:
+  uint32_t _num_quantized_bins = 0;
+  HistogramConfig _config;
+};
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile,
                                                          float max_percentile);
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
                                                          float moving_avg_const);
 
+std::unique_ptr<MinMaxComputer>
+make_histogram_percentile_computer(float min_percentile, float max_percentile, uint32_t num_bins);
+
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins,
+                                                      uint32_t num_quantized_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_MINMAXCOMPUTER_H__
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXHISTOGRAMS_H__
+#define __RECORD_MINMAX_MINMAXHISTOGRAMS_H__
+
+#include "StreamingHistogram.h"
+
+#include <cstdint>
+
+namespace record_minmax
+{
+
+// Histograms to be recorded for a MinMaxComputer
+struct HistogramConfig
+{
+  uint32_t num_bins = 2048;
+  bool record_minmax = false; // Record min/max of each tensor write
+  bool record_abs = false;    // Record absolute values of all elements
+};
+
+struct MinMaxHistograms
+{
+  explicit MinMaxHistograms(uint32_t num_bins)
+    : min_histogram(num_bins), max_histogram(num_bins), abs_histogram(num_bins)
+  {
+  }
+
+  StreamingHistogram min_histogram;
+  StreamingHistogram max_histogram;
+  StreamingHistogram abs_histogram;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXHISTOGRAMS_H__
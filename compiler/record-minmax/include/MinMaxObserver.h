@@ -20,8 +20,10 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
+#include "MinMaxHistograms.h"
 #include "MinMaxVectors.h"
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -57,6 +59,32 @@ private:
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
 };
 
+class MinMaxHistogramMap
+{
+public:
+  explicit MinMaxHistogramMap(const HistogramConfig &config) : _config(config) {}
+
+public:
+  // Record min/max and elements of node
+  // NOTE Elements which are NaN or lowest are already excluded from min/max
+  void recordMinMax(const luci::CircleNode *node, float min, float max,
+                    const std::vector<float> &elements);
+
+  void mergeHistograms(const luci::CircleNode *node, const MinMaxHistograms &histograms);
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *getMap() const
+  {
+    return &_histogram_map;
+  }
+
+private:
+  MinMaxHistograms &histograms(const luci::CircleNode *node);
+
+private:
+  HistogramConfig _config;
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> _histogram_map;
+};
+
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
@@ -65,14 +93,32 @@ public:
     // Do nothing
   }
 
+  // Record histograms instead of min/max vectors
+  explicit MinMaxObserver(const HistogramConfig &config)
+    : _histogram_data(std::make_unique<MinMaxHistogramMap>(config))
+  {
+  }
+
   void postTensorWrite(const luci::CircleNode *node,
                        const luci_interpreter::Tensor *tensor) override;
 
+  // Number of records in the batch dimension(0) of tensors. Each record is recorded separately,
+  // so the result is the same as running records one by one.
+  void setBatchSize(uint32_t batch_size) { _batch_size = batch_size; }
+
   // Never return nullptr
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  // Return nullptr if histograms are not recorded
+  const MinMaxHistogramMap *histogramData() { return _histogram_data.get(); }
+
+private:
+  void record(const luci::CircleNode *node, const float *data, uint32_t num_elements);
+
 private:
   MinMaxMap _minmax_data;
+  std::unique_ptr<MinMaxHistogramMap> _histogram_data;
+  uint32_t _batch_size = 1;
 };
 
 } // namespace record_minmax
@@ -17,6 +17,8 @@
 #ifndef __RECORD_MINMAX_RECORD_FUNCTION_H__
 #define __RECORD_MINMAX_RECORD_FUNCTION_H__
 
+#include "StreamingHistogram.h"
+
 #include <vector>
 #include <cstdint>
 
@@ -36,6 +38,13 @@ float getNthPercentile(std::vector<float> &vector, float percentile);
 float getMovingAverage(const std::vector<float> &vector, const float alpha,
                        const uint8_t batch_size, bool is_min);
 
+/**
+ * @brief  getEntropyThreshold finds the threshold of a histogram of absolute values which
+ *         minimizes KL divergence between the histogram clipped by the threshold and its
+ *         quantized version with num_quantized_bins levels
+ */
+float getEntropyThreshold(const StreamingHistogram &histogram, uint32_t num_quantized_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_RECORD_FUNCTION_H__
@@ -36,11 +36,15 @@ using WholeOutput = std::vector<Output>;
 class RecordMinMax
 {
 public:
-  explicit RecordMinMax(uint32_t num_threads, std::unique_ptr<MinMaxComputer> &&minmax_computer)
-    : _threads_size(num_threads), _minmax_computer(std::move(minmax_computer))
+  explicit RecordMinMax(uint32_t num_threads, std::unique_ptr<MinMaxComputer> &&minmax_computer,
+                        uint32_t batch_size = 1, uint32_t kernel_threads = 1)
+    : _threads_size(num_threads), _minmax_computer(std::move(minmax_computer)),
+      _batch_size(batch_size), _kernel_threads(kernel_threads)
   {
     assert(_threads_size > 0);
     assert(_minmax_computer != nullptr);
+    assert(_batch_size > 0);
+    assert(_kernel_threads > 0);
   }
 
   ~RecordMinMax() = default;
@@ -73,6 +77,9 @@ private:
 
   WholeOutput importH5Data(const std::string &input_data_path);
 
+  // Compute min/max from data recorded by all observers and save them to the module
+  void updateQuantParam();
+
   std::unique_ptr<luci::Module> _module;
 
   // Multiple interpreters are used for parallel execution
@@ -81,6 +88,12 @@ private:
 
   uint32_t _threads_size = 0;
   std::unique_ptr<MinMaxComputer> _minmax_computer;
+
+  // Number of records run by an interpreter at once in profileData
+  uint32_t _batch_size = 1;
+
+  // Number of threads used by each interpreter to split heavy kernels
+  uint32_t _kernel_threads = 1;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_STREAMING_HISTOGRAM_H__
+#define __RECORD_MINMAX_STREAMING_HISTOGRAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Histogram with a fixed number of bins whose range grows with recorded values
+ *
+ * When a value is out of range, bin width is doubled by merging adjacent bins, and the range
+ * is extended to the side of the value. Bins are merged exactly, so memory does not depend on
+ * the number of recorded values. Non-finite values are ignored.
+ */
+class StreamingHistogram
+{
+public:
+  explicit StreamingHistogram(uint32_t num_bins = 2048);
+
+public:
+  void add(float value);
+  void add(const float *data, uint32_t size);
+
+  /**
+   * @brief Merge other histogram into this histogram
+   * @note  Counts of other histogram are moved to the bins containing centers of its bins,
+   *        so the error is less than a bin width
+   */
+  void merge(const StreamingHistogram &other);
+
+  /**
+   * @brief  Return n-th percentile of recorded values (0.0 <= n <= 100.0)
+   *         linear interpolation is used in the bin where the percentile lies
+   */
+  float percentile(float percentile) const;
+
+  /**
+   * @brief Reset histogram to be empty with the given range
+   * @note  Histogram is initialized with the range of the first recorded values by default
+   */
+  void reset(float lower, float upper);
+
+  uint64_t count() const { return _count; }
+  float min() const { return _min; }
+  float max() const { return _max; }
+  double lower() const { return _lower; }
+  double upper() const { return _lower + _width * _num_bins; }
+  double width() const { return _width; }
+  const std::vector<uint64_t> &bins() const { return _bins; }
+
+private:
+  bool initialized() const { return !_bins.empty(); }
+  void grow(bool to_lower);
+  void cover(float value);
+  uint32_t index(float value) const;
+
+private:
+  uint32_t _num_bins;
+  // Bins are allocated at the first record, so unused histogram does not take memory
+  std::vector<uint64_t> _bins;
+  double _lower = 0.0;
+  double _width = 0.0;
+  uint64_t _count = 0;
+  float _min = 0.0f;
+  float _max = 0.0f;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_STREAMING_HISTOGRAM_H__
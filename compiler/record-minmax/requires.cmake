@@ -3,4 +3,5 @@ require("luci-interpreter")
 require("safemain")
 require("arser")
 require("dio-hdf5")
+require("foder")
 require("vconone")
@@ -19,9 +19,34 @@
 
 #include <luci/IR/CircleQuantParam.h>
 
+#include <algorithm>
+
+namespace
+{
+
+void set_minmax(const luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+
+  assert(node->quantparam() == nullptr);
+
+  auto mutable_node = const_cast<luci::CircleNode *>(node);
+  mutable_node->quantparam(std::move(quantparam));
+}
+
+} // namespace
+
 namespace record_minmax
 {
 
+void MinMaxComputer::update_qparam_from_histograms(
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *)
+{
+  throw std::runtime_error("This MinMaxComputer does not support histograms");
+}
+
 void PercentileComputer::update_qparam(
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
 {
@@ -72,6 +97,66 @@ void MovingAvgComputer::update_qparam(
   }
 }
 
+void HistogramPercentileComputer::update_qparam(
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
+{
+  if (minmax_map == nullptr)
+    throw std::invalid_argument("minmax_map is nullptr");
+
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> histogram_map;
+  for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
+  {
+    const auto &minmax = iter->second;
+    auto histograms = MinMaxHistograms(_config.num_bins);
+    histograms.min_histogram.add(minmax.min_vector.data(), minmax.min_vector.size());
+    histograms.max_histogram.add(minmax.max_vector.data(), minmax.max_vector.size());
+    histogram_map.emplace(iter->first, std::move(histograms));
+  }
+
+  update_qparam_from_histograms(&histogram_map);
+}
+
+void HistogramPercentileComputer::update_qparam_from_histograms(
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *histogram_map)
+{
+  if (histogram_map == nullptr)
+    throw std::invalid_argument("histogram_map is nullptr");
+
+  for (auto iter = histogram_map->begin(); iter != histogram_map->end(); ++iter)
+  {
+    const auto &histograms = iter->second;
+
+    auto min = histograms.min_histogram.percentile(_min_percentile);
+    auto max = histograms.max_histogram.percentile(_max_percentile);
+
+    set_minmax(iter->first, min, max);
+  }
+}
+
+void EntropyComputer::update_qparam(
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *)
+{
+  throw std::runtime_error("EntropyComputer requires histograms of values");
+}
+
+void EntropyComputer::update_qparam_from_histograms(
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *histogram_map)
+{
+  if (histogram_map == nullptr)
+    throw std::invalid_argument("histogram_map is nullptr");
+
+  for (auto iter = histogram_map->begin(); iter != histogram_map->end(); ++iter)
+  {
+    const auto &histograms = iter->second;
+
+    const auto threshold = getEntropyThreshold(histograms.abs_histogram, _num_quantized_bins);
+    auto min = std::max(histograms.min_histogram.min(), -threshold);
+    auto max = std::max(std::min(histograms.max_histogram.max(), threshold), min);
+
+    set_minmax(iter->first, min, max);
+  }
+}
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile)
 {
   return std::make_unique<PercentileComputer>(min_percentile, max_percentile);
@@ -83,4 +168,16 @@ std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
   return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const);
 }
 
+std::unique_ptr<MinMaxComputer>
+make_histogram_percentile_computer(float min_percentile, float max_percentile, uint32_t num_bins)
+{
+  return std::make_unique<HistogramPercentileComputer>(min_percentile, max_percentile, num_bins);
+}
+
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins,
+                                                      uint32_t num_quantized_bins)
+{
+  return std::make_unique<EntropyComputer>(num_bins, num_quantized_bins);
+}
+
 } // namespace record_minmax
@@ -18,6 +18,8 @@
 
 #include <luci/IR/CircleOpcode.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <math.h>
 
@@ -83,6 +85,34 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
+  if (_batch_size == 1)
+  {
+    record(node, data, num_elements);
+    return;
+  }
+
+  // Records of a batch must not be mixed, i.e. tensor should have the shape of node whose
+  // batch dimension is 1, except for the batch dimension
+  const auto &shape = tensor->shape();
+  bool batched = node->rank() > 0 && shape.num_dims() == static_cast<int>(node->rank()) &&
+                 node->dim(0).known() && node->dim(0).value() == 1 &&
+                 shape.dim(0) == static_cast<int32_t>(_batch_size);
+  for (uint32_t i = 1; batched && i < node->rank(); ++i)
+  {
+    if (node->dim(i).known() && static_cast<int32_t>(node->dim(i).value()) != shape.dim(i))
+      batched = false;
+  }
+  if (not batched)
+    throw std::runtime_error("Tensor cannot be recorded in batch. " + node->name());
+
+  const auto record_size = num_elements / _batch_size;
+  for (uint32_t record_idx = 0; record_idx < _batch_size; ++record_idx)
+    record(node, data + record_idx * record_size, record_size);
+}
+
+void MinMaxObserver::record(const luci::CircleNode *node, const float *data,
+                            uint32_t num_elements)
+{
   std::vector<float> buf(data, data + num_elements);
 
   float max = std::numeric_limits<float>::lowest();
@@ -110,7 +140,67 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   if (all_nan)
     throw std::runtime_error("All values are NaN(Not a Number)");
 
-  _minmax_data.recordMinMax(node, min, max);
+  if (_histogram_data != nullptr)
+    _histogram_data->recordMinMax(node, min, max, buf);
+  else
+    _minmax_data.recordMinMax(node, min, max);
+}
+
+MinMaxHistograms &MinMaxHistogramMap::histograms(const luci::CircleNode *node)
+{
+  auto iter = _histogram_map.find(node);
+  if (iter == _histogram_map.end())
+    iter = _histogram_map.emplace(node, MinMaxHistograms(_config.num_bins)).first;
+  return iter->second;
+}
+
+void MinMaxHistogramMap::recordMinMax(const luci::CircleNode *node, float min, float max,
+                                      const std::vector<float> &elements)
+{
+  auto &node_histograms = histograms(node);
+
+  if (_config.record_minmax)
+  {
+    node_histograms.min_histogram.add(min);
+    node_histograms.max_histogram.add(max);
+  }
+
+  if (_config.record_abs)
+  {
+    std::vector<float> abs_elements(elements.size());
+    float abs_max = 0.0f;
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+      const auto number = elements[i];
+      // Excluded elements and infinities are ignored by histogram
+      if (!std::isfinite(number) || number == std::numeric_limits<float>::lowest())
+      {
+        abs_elements[i] = NAN;
+        continue;
+      }
+      abs_elements[i] = std::fabs(number);
+      abs_max = std::max(abs_max, abs_elements[i]);
+    }
+
+    auto &abs_histogram = node_histograms.abs_histogram;
+    // Absolute values are binned from zero
+    if (abs_histogram.count() == 0)
+      abs_histogram.reset(0.0f, abs_max);
+    abs_histogram.add(abs_elements.data(), abs_elements.size());
+  }
+}
+
+void MinMaxHistogramMap::mergeHistograms(const luci::CircleNode *node,
+                                         const MinMaxHistograms &other)
+{
+  auto &node_histograms = histograms(node);
+  node_histograms.min_histogram.merge(other.min_histogram);
+  node_histograms.max_histogram.merge(other.max_histogram);
+  // Absolute values are binned from zero, while merge starts from the minimum of other
+  auto &abs_histogram = node_histograms.abs_histogram;
+  if (abs_histogram.count() == 0 && other.abs_histogram.count() > 0)
+    abs_histogram.reset(0.0f, other.abs_histogram.max());
+  abs_histogram.merge(other.abs_histogram);
 }
 
 } // namespace record_minmax
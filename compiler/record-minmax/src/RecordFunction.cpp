@@ -94,4 +94,86 @@ float getMovingAverage(const std::vector<float> &vector, const float alpha,
   return curr_avg;
 }
 
+float getEntropyThreshold(const StreamingHistogram &histogram, uint32_t num_quantized_bins)
+{
+  if (histogram.count() == 0)
+    throw std::runtime_error("Entropy threshold must take a non-empty histogram as an argument");
+
+  if (num_quantized_bins == 0)
+    throw std::runtime_error("Number of quantized bins must be positive");
+
+  const auto &bins = histogram.bins();
+  uint32_t num_bins = bins.size();
+  while (num_bins > 0 && bins[num_bins - 1] == 0)
+    num_bins--;
+  assert(num_bins > 0);
+
+  auto bin_upper = [&](uint32_t i) {
+    return static_cast<float>(std::min<double>(histogram.lower() + i * histogram.width(),
+                                               histogram.max()));
+  };
+
+  // Values fit into quantized bins without clipping
+  if (num_bins <= num_quantized_bins)
+    return bin_upper(num_bins);
+
+  std::vector<double> p(num_bins);
+  std::vector<double> q(num_bins);
+  double best_divergence = std::numeric_limits<double>::max();
+  uint32_t best_threshold = num_bins;
+  for (uint32_t threshold = num_quantized_bins; threshold <= num_bins; ++threshold)
+  {
+    // Reference distribution: values over threshold are clipped into the last bin
+    double outliers = 0.0;
+    for (uint32_t i = threshold; i < num_bins; ++i)
+      outliers += bins[i];
+    for (uint32_t i = 0; i < threshold; ++i)
+      p[i] = bins[i];
+    p[threshold - 1] += outliers;
+
+    // Quantized distribution: count of each level is spread over its non-empty bins
+    for (uint32_t level = 0; level < num_quantized_bins; ++level)
+    {
+      const uint32_t begin = static_cast<uint64_t>(level) * threshold / num_quantized_bins;
+      const uint32_t end = static_cast<uint64_t>(level + 1) * threshold / num_quantized_bins;
+      double total = 0.0;
+      uint32_t non_empty = 0;
+      for (uint32_t i = begin; i < end; ++i)
+      {
+        total += bins[i];
+        non_empty += bins[i] != 0 ? 1 : 0;
+      }
+      for (uint32_t i = begin; i < end; ++i)
+        q[i] = (bins[i] != 0) ? total / non_empty : 0.0;
+    }
+
+    double p_sum = 0.0;
+    double q_sum = 0.0;
+    for (uint32_t i = 0; i < threshold; ++i)
+    {
+      p_sum += p[i];
+      q_sum += q[i];
+    }
+
+    double divergence = 0.0;
+    for (uint32_t i = 0; i < threshold; ++i)
+    {
+      if (p[i] == 0.0)
+        continue;
+      const double p_i = p[i] / p_sum;
+      // Last bin can be empty in quantized distribution if it has only outliers
+      const double q_i = (q[i] == 0.0) ? 1e-10 : q[i] / q_sum;
+      divergence += p_i * std::log(p_i / q_i);
+    }
+
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best_threshold = threshold;
+    }
+  }
+
+  return bin_upper(best_threshold);
+}
+
 } // namespace record_minmax
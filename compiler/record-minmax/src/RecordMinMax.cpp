@@ -24,6 +24,7 @@
 #include <luci/IR/CircleQuantParam.h>
 #include <luci/Log.h>
 #include <dio_hdf5/HDF5Importer.h>
+#include <foder/MappedFileLoader.h>
 
 #include <dirent.h>
 #include <algorithm>
@@ -183,30 +184,32 @@ void RecordMinMax::initialize(const std::string &input_model_path)
 {
   assert(_threads_size > 0);
 
-  // Load model from the file
-  std::ifstream fs(input_model_path, std::ifstream::binary);
-  if (fs.fail())
+  // Map model file, so that constants of module view their data in the file
+  std::shared_ptr<const foder::MappedFile> model_file;
+  try
+  {
+    model_file = foder::MappedFileLoader{input_model_path}.load();
+  }
+  catch (const std::runtime_error &)
   {
     throw std::runtime_error("Cannot open model file \"" + input_model_path + "\".\n");
   }
-  std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
-                               std::istreambuf_iterator<char>());
 
   // Verify flatbuffers
-  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_data.data()),
-                                 model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_file->data()),
+                                 model_file->size()};
   if (!circle::VerifyModelBuffer(verifier))
   {
     throw std::runtime_error("Failed to verify circle '" + input_model_path + "'");
   }
 
-  const circle::Model *circle_model = circle::GetModel(model_data.data());
+  const circle::Model *circle_model = circle::GetModel(model_file->data());
   if (circle_model == nullptr)
   {
     throw std::runtime_error("Failed to load '" + input_model_path + "'");
   }
 
-  _module = luci::Importer().importModule(circle_model);
+  _module = luci::Importer().importModule(circle_model, model_file);
 
   if (_module == nullptr)
   {
@@ -220,7 +223,12 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    // Observers read activations right after they are written, so reusing their memory is safe
+    interpreter->enableArenaPlan();
+    interpreter->setNumThreads(_kernel_threads);
+    const auto histogram_config = _minmax_computer->histogram_config();
+    auto observer = histogram_config ? std::make_unique<MinMaxObserver>(*histogram_config)
+                                     : std::make_unique<MinMaxObserver>();
 
     interpreter->attachObserver(observer.get());
 
@@ -293,7 +301,7 @@ void RecordMinMax::profileRawDataDirectory(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQuantParam();
 }
 
 // input_data_path is a text file which specifies the representative data
@@ -388,7 +396,7 @@ void RecordMinMax::profileRawData(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQuantParam();
 }
 
 WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
@@ -465,34 +473,60 @@ void RecordMinMax::profileData(const std::string &input_data_path)
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
     {
-      if (num_inputs != static_cast<uint32_t>(importer.numInputs(record_idx)))
-        throw std::runtime_error("Wrong number of inputs.");
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+      checkInputDimension(input_node);
+      if (_batch_size > 1 and (input_node->rank() == 0 or input_node->dim(0).value() != 1))
+        throw std::runtime_error(input_node->name() + " does not have batch dimension of 1");
+    }
 
-      std::cout << "Recording " << record_idx << "'th data" << std::endl;
+    // Records are run in batches of _batch_size records, resizing the batch dimension of inputs
+    for (int32_t first_idx = 0; first_idx < num_records; first_idx += _batch_size)
+    {
+      const auto batch_size =
+        static_cast<uint32_t>(std::min<int32_t>(_batch_size, num_records - first_idx));
 
       for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
       {
         const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        checkInputDimension(input_node);
-        std::vector<char> input_data(getTensorSize(input_node));
+        const auto record_size = getTensorSize(input_node);
+        std::vector<char> input_data(record_size * batch_size);
 
-        if (!is_raw_data)
+        for (uint32_t batch_idx = 0; batch_idx < batch_size; batch_idx++)
         {
-          DataType dtype;
-          Shape shape;
-          importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data(),
-                              input_data.size());
-
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
+          const auto record_idx = first_idx + static_cast<int32_t>(batch_idx);
+          if (num_inputs != static_cast<uint32_t>(importer.numInputs(record_idx)))
+            throw std::runtime_error("Wrong number of inputs.");
+
+          if (input_idx == 0)
+            std::cout << "Recording " << record_idx << "'th data" << std::endl;
+
+          auto record_data = input_data.data() + batch_idx * record_size;
+          if (!is_raw_data)
+          {
+            DataType dtype;
+            Shape shape;
+            importer.readTensor(record_idx, input_idx, &dtype, &shape, record_data, record_size);
+
+            // Check the type and the shape of the input data is valid
+            verifyTypeShape(input_node, dtype, shape);
+          }
+          else
+          {
+            // Skip type/shape check for raw data
+            importer.readTensor(record_idx, input_idx, record_data, record_size);
+          }
         }
-        else
+
+        if (_batch_size > 1)
         {
-          // Skip type/shape check for raw data
-          importer.readTensor(record_idx, input_idx, input_data.data(), input_data.size());
+          luci_interpreter::Shape batch_shape(input_node->rank());
+          batch_shape.dim(0) = batch_size;
+          for (uint32_t i = 1; i < input_node->rank(); i++)
+            batch_shape.dim(i) = input_node->dim(i).value();
+          getInterpreter()->resizeInputTensor(input_node, batch_shape);
         }
 
         // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
@@ -500,6 +534,7 @@ void RecordMinMax::profileData(const std::string &input_data_path)
         getInterpreter()->writeInputTensor(input_node, input_data.data(), input_data.size());
       }
 
+      getObserver()->setBatchSize(batch_size);
       getInterpreter()->interpret();
     }
 
@@ -511,7 +546,7 @@ void RecordMinMax::profileData(const std::string &input_data_path)
     throw std::runtime_error("HDF5 error occurred.");
   }
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQuantParam();
 }
 
 void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
@@ -580,24 +615,9 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
 
   // End parallel part
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
-
-  for (const auto &obs : _observers)
-  {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
-    {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
-
-      main_min_max_map.appendMinMaxVector(node, minmax);
-    }
-  }
-
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(main_min_max_map.getMap());
+  updateQuantParam();
 }
 
 void RecordMinMax::profileDataWithRandomInputs(void)
@@ -668,7 +688,67 @@ void RecordMinMax::profileDataWithRandomInputs(void)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQuantParam();
+}
+
+void RecordMinMax::updateQuantParam()
+{
+  const auto histogram_config = _minmax_computer->histogram_config();
+  if (histogram_config != nullptr)
+  {
+    // Only the first observer is used if data are not profiled in parallel
+    const bool single_observer =
+      std::all_of(_observers.begin() + 1, _observers.end(),
+                  [](const std::unique_ptr<MinMaxObserver> &obs) {
+                    return obs->histogramData()->getMap()->empty();
+                  });
+    if (single_observer)
+    {
+      _minmax_computer->update_qparam_from_histograms(getObserver()->histogramData()->getMap());
+      return;
+    }
+
+    // Merge histograms of all observers, whose size does not depend on the number of records
+    MinMaxHistogramMap main_histogram_map(*histogram_config);
+    for (const auto &obs : _observers)
+    {
+      assert(obs->histogramData() != nullptr);
+      for (auto &iter : *obs->histogramData()->getMap())
+        main_histogram_map.mergeHistograms(iter.first, iter.second);
+    }
+
+    _minmax_computer->update_qparam_from_histograms(main_histogram_map.getMap());
+    return;
+  }
+
+  // Only the first observer is used if data are not profiled in parallel
+  const bool single_observer =
+    std::all_of(_observers.begin() + 1, _observers.end(),
+                [](const std::unique_ptr<MinMaxObserver> &obs) {
+                  return obs->minMaxData()->getMap()->empty();
+                });
+  if (single_observer)
+  {
+    _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+    return;
+  }
+
+  // Copy all min, max values to one min/max map
+  MinMaxMap main_min_max_map;
+
+  for (const auto &obs : _observers)
+  {
+    const auto cur_minmax_map = obs->minMaxData()->getMap();
+    for (auto &iter : *cur_minmax_map)
+    {
+      const auto node = iter.first;
+      const auto &minmax = iter.second;
+
+      main_min_max_map.appendMinMaxVector(node, minmax);
+    }
+  }
+
+  _minmax_computer->update_qparam(main_min_max_map.getMap());
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+StreamingHistogram::StreamingHistogram(uint32_t num_bins) : _num_bins(num_bins)
+{
+  // Bins are merged in pairs when histogram grows
+  if (num_bins < 2 || num_bins % 2 != 0)
+    throw std::invalid_argument("Number of histogram bins must be a positive even number");
+}
+
+void StreamingHistogram::reset(float lower, float upper)
+{
+  assert(std::isfinite(lower) && std::isfinite(upper));
+  assert(lower <= upper);
+
+  double span = static_cast<double>(upper) - lower;
+  if (span <= 0.0)
+    span = std::max({std::fabs(static_cast<double>(lower)), std::fabs(static_cast<double>(upper)),
+                     1.0}) *
+           1e-6;
+
+  _bins.assign(_num_bins, 0);
+  _lower = lower;
+  _width = span / _num_bins;
+  _count = 0;
+  _min = std::numeric_limits<float>::max();
+  _max = std::numeric_limits<float>::lowest();
+}
+
+void StreamingHistogram::grow(bool to_lower)
+{
+  // Merge each pair of bins. To extend to the lower side, merged bins are moved to the upper
+  // half, so the upper bound is kept.
+  const uint32_t offset = to_lower ? _num_bins / 2 : 0;
+  std::vector<uint64_t> bins(_num_bins, 0);
+  for (uint32_t i = 0; i < _num_bins; ++i)
+    bins[i / 2 + offset] += _bins[i];
+
+  _bins.swap(bins);
+  _width *= 2.0;
+  _lower -= offset * _width;
+}
+
+void StreamingHistogram::cover(float value)
+{
+  assert(initialized());
+  while (value < _lower)
+    grow(true);
+  while (value > upper())
+    grow(false);
+}
+
+uint32_t StreamingHistogram::index(float value) const
+{
+  const auto index = static_cast<int64_t>((value - _lower) / _width);
+  return static_cast<uint32_t>(std::min<int64_t>(std::max<int64_t>(index, 0), _num_bins - 1));
+}
+
+void StreamingHistogram::add(float value) { add(&value, 1); }
+
+void StreamingHistogram::add(const float *data, uint32_t size)
+{
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  uint32_t num_finite = 0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (!std::isfinite(data[i]))
+      continue;
+    min = std::min(min, data[i]);
+    max = std::max(max, data[i]);
+    num_finite++;
+  }
+  if (num_finite == 0)
+    return;
+
+  if (!initialized())
+    reset(min, max);
+  cover(min);
+  cover(max);
+
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (std::isfinite(data[i]))
+      _bins[index(data[i])]++;
+  }
+  _count += num_finite;
+  _min = std::min(_min, min);
+  _max = std::max(_max, max);
+}
+
+void StreamingHistogram::merge(const StreamingHistogram &other)
+{
+  if (other._count == 0)
+    return;
+
+  if (!initialized())
+    reset(other._min, other._max);
+  cover(other._min);
+  cover(other._max);
+
+  for (uint32_t i = 0; i < other._num_bins; ++i)
+  {
+    if (other._bins[i] == 0)
+      continue;
+
+    // Other bin may be wider than recorded values
+    const double center = other._lower + (i + 0.5) * other._width;
+    const auto value = std::min<double>(std::max<double>(center, other._min), other._max);
+    _bins[index(static_cast<float>(value))] += other._bins[i];
+  }
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+}
+
+float StreamingHistogram::percentile(float percentile) const
+{
+  if (percentile < 0 || percentile > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (_count == 0)
+    throw std::runtime_error("Percentile must take a non-empty histogram as an argument");
+
+  if (percentile == 0.0)
+    return _min;
+
+  if (percentile == 100.0)
+    return _max;
+
+  const double target = _count * (percentile / 100.0);
+  double accumulated = 0.0;
+  for (uint32_t i = 0; i < _num_bins; ++i)
+  {
+    if (_bins[i] == 0)
+      continue;
+
+    if (accumulated + _bins[i] >= target)
+    {
+      const double fraction = (target - accumulated) / _bins[i];
+      const double value = _lower + (i + fraction) * _width;
+      return static_cast<float>(std::min<double>(std::max<double>(value, _min), _max));
+    }
+    accumulated += _bins[i];
+  }
+  return _max;
+}
+
+} // namespace record_minmax
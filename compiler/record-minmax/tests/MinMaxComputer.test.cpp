@@ -73,3 +73,99 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, histogram_percentile)
+{
+  auto computer = make_histogram_percentile_computer(0.0, 100.0, 64);
+  ASSERT_NE(nullptr, computer->histogram_config());
+
+  luci::CircleAdd node;
+  MinMaxHistograms histograms(64);
+  {
+    const float min[] = {1.0, 2.0, 3.0};
+    const float max[] = {4.0, 5.0, 6.0};
+    histograms.min_histogram.add(min, 3);
+    histograms.max_histogram.add(max, 3);
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> histogram_map;
+  histogram_map.emplace(&node, histograms);
+
+  computer->update_qparam_from_histograms(&histogram_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(1.0, node.quantparam()->min[0]);
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, histogram_percentile_vectors)
+{
+  auto computer = make_histogram_percentile_computer(0.0, 100.0, 64);
+
+  luci::CircleAdd node;
+  MinMaxVectors minmax;
+  {
+    minmax.min_vector = {1.0, 2.0, 3.0};
+    minmax.max_vector = {4.0, 5.0, 6.0};
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  min_max_map.insert({&node, minmax});
+
+  computer->update_qparam(&min_max_map);
+
+  EXPECT_TRUE(node.quantparam() != nullptr);
+}
+
+TEST(MinMaxComputerTest, histogram_percentile_nullptr_NEG)
+{
+  auto computer = make_histogram_percentile_computer(0.0, 100.0, 64);
+
+  EXPECT_ANY_THROW(computer->update_qparam_from_histograms(nullptr));
+}
+
+TEST(MinMaxComputerTest, entropy)
+{
+  auto computer = make_entropy_computer(64, 8);
+  ASSERT_NE(nullptr, computer->histogram_config());
+  EXPECT_TRUE(computer->histogram_config()->record_abs);
+
+  luci::CircleAdd node;
+  MinMaxHistograms histograms(64);
+  {
+    const float min[] = {-2.0, -1.0};
+    const float max[] = {1.0, 2.0};
+    const float abs[] = {0.0, 0.5, 1.0, 1.0, 2.0, 0.5};
+    histograms.min_histogram.add(min, 2);
+    histograms.max_histogram.add(max, 2);
+    histograms.abs_histogram.reset(0.0, 2.0);
+    histograms.abs_histogram.add(abs, 6);
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> histogram_map;
+  histogram_map.emplace(&node, histograms);
+
+  computer->update_qparam_from_histograms(&histogram_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_GE(node.quantparam()->min[0], -2.0);
+  EXPECT_LE(node.quantparam()->max[0], 2.0);
+  EXPECT_LT(node.quantparam()->min[0], node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, entropy_vectors_NEG)
+{
+  auto computer = make_entropy_computer(64, 8);
+
+  luci::CircleAdd node;
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  min_max_map.insert({&node, MinMaxVectors()});
+
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
+}
+
+TEST(MinMaxComputerTest, moving_avg_histograms_NEG)
+{
+  auto computer = make_moving_avg_computer(1, 0.99);
+  EXPECT_EQ(nullptr, computer->histogram_config());
+
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> histogram_map;
+  EXPECT_ANY_THROW(computer->update_qparam_from_histograms(&histogram_map));
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <luci/IR/Nodes/CircleRelu.h>
+#include <loco/IR/Graph.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace record_minmax
+{
+namespace
+{
+
+class MinMaxObserverTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _node = _graph.nodes()->create<luci::CircleRelu>();
+    _node->dtype(loco::DataType::FLOAT32);
+    _node->shape({1, 2});
+    _node->name("relu");
+  }
+
+  // Write data to a tensor of shape [batch, 2]
+  std::unique_ptr<luci_interpreter::Tensor> makeTensor(std::vector<float> &data)
+  {
+    auto tensor = std::make_unique<luci_interpreter::Tensor>(
+      loco::DataType::FLOAT32, luci_interpreter::Shape({static_cast<int>(data.size() / 2), 2}),
+      luci_interpreter::AffineQuantization{}, "");
+    tensor->set_data_buffer(reinterpret_cast<uint8_t *>(data.data()));
+    return tensor;
+  }
+
+  loco::Graph _graph;
+  luci::CircleRelu *_node = nullptr;
+};
+
+} // namespace
+
+TEST_F(MinMaxObserverTest, batch)
+{
+  std::vector<float> data{1, 2, -3, 4, 5, -6};
+
+  MinMaxObserver batch_observer;
+  batch_observer.setBatchSize(3);
+  batch_observer.postTensorWrite(_node, makeTensor(data).get());
+
+  MinMaxObserver record_observer;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    std::vector<float> record(data.begin() + i * 2, data.begin() + i * 2 + 2);
+    record_observer.postTensorWrite(_node, makeTensor(record).get());
+  }
+
+  const auto &batch_vectors = batch_observer.minMaxData()->getMap()->at(_node);
+  const auto &record_vectors = record_observer.minMaxData()->getMap()->at(_node);
+  EXPECT_EQ((std::vector<float>{1, -3, -6}), batch_vectors.min_vector);
+  EXPECT_EQ((std::vector<float>{2, 4, 5}), batch_vectors.max_vector);
+  EXPECT_EQ(record_vectors.min_vector, batch_vectors.min_vector);
+  EXPECT_EQ(record_vectors.max_vector, batch_vectors.max_vector);
+}
+
+TEST_F(MinMaxObserverTest, batch_histogram)
+{
+  std::vector<float> data{1, 2, -3, 4, 5, -6};
+  HistogramConfig config;
+  config.num_bins = 4;
+  config.record_minmax = true;
+  config.record_abs = true;
+
+  MinMaxObserver batch_observer(config);
+  batch_observer.setBatchSize(3);
+  batch_observer.postTensorWrite(_node, makeTensor(data).get());
+
+  MinMaxObserver record_observer(config);
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    std::vector<float> record(data.begin() + i * 2, data.begin() + i * 2 + 2);
+    record_observer.postTensorWrite(_node, makeTensor(record).get());
+  }
+
+  const auto &batch = batch_observer.histogramData()->getMap()->at(_node);
+  const auto &record = record_observer.histogramData()->getMap()->at(_node);
+  EXPECT_EQ(record.min_histogram.bins(), batch.min_histogram.bins());
+  EXPECT_EQ(record.max_histogram.bins(), batch.max_histogram.bins());
+  EXPECT_EQ(record.abs_histogram.bins(), batch.abs_histogram.bins());
+}
+
+TEST_F(MinMaxObserverTest, merge_abs_histogram_from_zero)
+{
+  HistogramConfig config;
+  config.num_bins = 4;
+  config.record_abs = true;
+
+  // Absolute values of elements do not include zero
+  const std::vector<float> elements{2, -3, 4};
+  MinMaxHistogramMap worker_map(config);
+  worker_map.recordMinMax(_node, -3, 4, elements);
+  EXPECT_EQ((std::vector<float>{2, -3, 4}), elements);
+
+  MinMaxHistogramMap main_map(config);
+  main_map.mergeHistograms(_node, worker_map.getMap()->at(_node));
+
+  const auto &abs_histogram = main_map.getMap()->at(_node).abs_histogram;
+  EXPECT_EQ(3u, abs_histogram.count());
+  EXPECT_DOUBLE_EQ(0.0, abs_histogram.lower());
+}
+
+TEST_F(MinMaxObserverTest, batch_mismatch_NEG)
+{
+  std::vector<float> data{1, 2, -3, 4, 5, -6};
+
+  MinMaxObserver observer;
+  observer.setBatchSize(2);
+  EXPECT_ANY_THROW(observer.postTensorWrite(_node, makeTensor(data).get()));
+}
+
+} // namespace record_minmax
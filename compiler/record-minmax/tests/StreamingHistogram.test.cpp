@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingHistogram.h"
+#include "RecordFunction.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+TEST(StreamingHistogramTest, constant_memory)
+{
+  StreamingHistogram histogram(64);
+
+  // Range grows in both directions
+  for (int i = 0; i < 10000; ++i)
+    histogram.add(static_cast<float>(i % 2 == 0 ? i : -i));
+
+  EXPECT_EQ(10000, histogram.count());
+  EXPECT_EQ(64, histogram.bins().size());
+  EXPECT_FLOAT_EQ(-9999, histogram.min());
+  EXPECT_FLOAT_EQ(9998, histogram.max());
+  EXPECT_LE(histogram.lower(), -9999);
+  EXPECT_GE(histogram.upper(), 9998);
+
+  uint64_t total = 0;
+  for (auto count : histogram.bins())
+    total += count;
+  EXPECT_EQ(10000, total);
+}
+
+TEST(StreamingHistogramTest, percentile)
+{
+  StreamingHistogram histogram(1024);
+  std::vector<float> values;
+  std::mt19937 gen(1);
+  std::normal_distribution<float> dist(3.0, 2.0);
+  for (int i = 0; i < 10000; ++i)
+    values.push_back(dist(gen));
+  histogram.add(values.data(), values.size());
+
+  const float tolerance = 2 * histogram.width();
+  for (float p : {1.0f, 10.0f, 50.0f, 90.0f, 99.0f})
+    EXPECT_NEAR(getNthPercentile(values, p), histogram.percentile(p), tolerance);
+
+  EXPECT_FLOAT_EQ(histogram.min(), histogram.percentile(0));
+  EXPECT_FLOAT_EQ(histogram.max(), histogram.percentile(100));
+}
+
+TEST(StreamingHistogramTest, merge)
+{
+  StreamingHistogram whole(256);
+  StreamingHistogram first(256);
+  StreamingHistogram second(256);
+  for (int i = 0; i < 1000; ++i)
+  {
+    whole.add(static_cast<float>(i));
+    (i < 500 ? first : second).add(static_cast<float>(i));
+  }
+  first.merge(second);
+
+  EXPECT_EQ(whole.count(), first.count());
+  EXPECT_FLOAT_EQ(whole.min(), first.min());
+  EXPECT_FLOAT_EQ(whole.max(), first.max());
+  EXPECT_NEAR(whole.percentile(50), first.percentile(50), 2 * first.width());
+}
+
+TEST(StreamingHistogramTest, non_finite)
+{
+  StreamingHistogram histogram(16);
+  const float values[] = {1.0f, NAN, std::numeric_limits<float>::infinity(), 2.0f};
+  histogram.add(values, 4);
+
+  EXPECT_EQ(2, histogram.count());
+  EXPECT_FLOAT_EQ(2.0f, histogram.max());
+}
+
+TEST(StreamingHistogramTest, entropy_threshold)
+{
+  StreamingHistogram histogram(2048);
+  histogram.reset(0.0f, 1.0f);
+
+  // Most values are small, and a few outliers are large
+  std::vector<float> values;
+  std::mt19937 gen(1);
+  std::exponential_distribution<float> dist(1.0);
+  for (int i = 0; i < 100000; ++i)
+    values.push_back(dist(gen));
+  values.push_back(100.0f);
+  histogram.add(values.data(), values.size());
+
+  const auto threshold = getEntropyThreshold(histogram, 128);
+  EXPECT_GT(threshold, 1.0f);
+  EXPECT_LT(threshold, 100.0f);
+}
+
+TEST(StreamingHistogramTest, odd_bins_NEG)
+{
+  EXPECT_ANY_THROW(StreamingHistogram(3));
+  EXPECT_ANY_THROW(StreamingHistogram(0));
+}
+
+TEST(StreamingHistogramTest, empty_NEG)
+{
+  StreamingHistogram histogram(16);
+
+  EXPECT_ANY_THROW(histogram.percentile(50));
+  EXPECT_ANY_THROW(getEntropyThreshold(histogram, 8));
+}
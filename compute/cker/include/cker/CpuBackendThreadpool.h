@@ -21,7 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +48,60 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Minimum amount of work, e.g. number of elements to copy, to use one more thread
+static constexpr int64_t kMinCostPerThread = 1 << 14;
+
+// Task to run a function on indices in [start, end)
+template <typename Function> struct RangeTask : Task
+{
+  RangeTask(const Function &fn, int start, int end) : fn_(fn), start_(start), end_(end) {}
+
+  void Run() override { fn_(start_, end_); }
+
+private:
+  const Function &fn_;
+  int start_;
+  int end_;
+};
+
+// Returns how many threads are worth to use for `size` indices with `cost_per_index` work each
+inline int HowManyThreads(int size, int64_t cost_per_index, const ruy::Context *ruy_context)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int64_t total_cost = static_cast<int64_t>(size) * std::max<int64_t>(cost_per_index, 1);
+  const int64_t thread_count =
+    std::min<int64_t>({max_threads, size, total_cost / kMinCostPerThread});
+  return static_cast<int>(std::max<int64_t>(thread_count, 1));
+}
+
+// Splits indices in [0, size) into contiguous ranges and calls fn(start, end) for each range
+// on the threads of ruy_context. Ranges are disjoint, so fn may write to each index freely.
+// It runs fn(0, size) on the calling thread when ruy_context is null or work is small.
+template <typename Function>
+void ParallelFor(int size, int64_t cost_per_index, ruy::Context *ruy_context, const Function &fn)
+{
+  if (size <= 0)
+    return;
+
+  const int thread_count = HowManyThreads(size, cost_per_index, ruy_context);
+  if (thread_count == 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<RangeTask<Function>> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int end = start + (size - start) / (thread_count - i);
+    tasks.emplace_back(fn, start, end);
+    start = end;
+  }
+  Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
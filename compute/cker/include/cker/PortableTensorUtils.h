@@ -45,6 +45,8 @@ public:
         return a < 0.f ? 0.f : a;
       case FusedActivationFunctionType::kRelu6:
         return std::max(0.f, std::min(a, 6.f));
+      case FusedActivationFunctionType::kRelu1:
+        return std::max(-1.f, std::min(a, 1.f));
       case FusedActivationFunctionType::kTanh:
         return std::tanh(a);
       case FusedActivationFunctionType::kSigmoid:
@@ -294,6 +294,11 @@ struct LSTMParams
   bool asymmetric_quantize_inputs;
 };
 
+struct RNNParams
+{
+  FusedActivationFunctionType activation{FusedActivationFunctionType::kNone};
+};
+
 struct GatherParams
 {
   int32_t axis;
@@ -306,6 +311,14 @@ struct InstanceNormParams
   float float_activation_max;
 };
 
+struct LocalResponseNormalizationParams
+{
+  int32_t range;
+  float bias;
+  float alpha;
+  float beta;
+};
+
 struct ResizeBilinearParams
 {
   int32_t output_height;
@@ -314,6 +327,13 @@ struct ResizeBilinearParams
   bool half_pixel_centers;
 };
 
+struct ResizeNearestNeighborParams
+{
+  int32_t output_height;
+  int32_t output_width;
+  bool align_corners;
+};
+
 struct TransposeConvParams
 {
   PaddingType padding_type;
@@ -397,6 +417,30 @@ struct LeakyReluParams
   float alpha;
 };
 
+struct GeluParams
+{
+  // Use tanh approximation instead of erf
+  bool approximate;
+};
+
+struct LayerNormParams
+{
+  float epsilon;
+};
+
+struct RmsNormParams
+{
+  float epsilon;
+};
+
+struct AttentionParams
+{
+  // Scale of query-key products. 1/sqrt(depth) is used if it is 0.
+  float scale;
+  // Mask keys after each query, aligned to the last key
+  bool causal;
+};
+
 struct PadParams
 {
   int32_t data[8];
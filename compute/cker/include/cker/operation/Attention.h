@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ATTENTION_H__
+#define __NNFW_CKER_ATTENTION_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace attention
+{
+
+// Strides of mask for each dimension of scores([..., query, key]). A mask dimension of 1 is
+// broadcast, so its stride is 0.
+inline std::vector<int64_t> MaskStrides(const Shape &scores_shape, const Shape &mask_shape)
+{
+  const int rank = scores_shape.DimensionsCount();
+  const int mask_rank = mask_shape.DimensionsCount();
+  if (mask_rank > rank)
+    throw std::runtime_error("Attention: mask rank must not be greater than query rank");
+
+  std::vector<int64_t> strides(rank, 0);
+  int64_t stride = 1;
+  for (int i = 1; i <= mask_rank; ++i)
+  {
+    const int32_t dim = mask_shape.Dims(mask_rank - i);
+    if (dim != 1 && dim != scores_shape.Dims(rank - i))
+      throw std::runtime_error("Attention: mask is not broadcastable to scores");
+    strides[rank - i] = dim == 1 ? 0 : stride;
+    stride *= dim;
+  }
+  return strides;
+}
+
+} // namespace attention
+
+/**
+ * @brief Compute softmax(scale * query * key^T + mask) * value with tiles of queries and keys
+ *
+ * query is [..., query_len, depth], key is [..., key_len, depth], value is [..., key_len,
+ * value_depth] and output is [..., query_len, value_depth]. The dimension before query_len is
+ * heads, and heads of query may be a multiple of heads of key and value(grouped-query attention).
+ * Other leading dimensions should be same. mask is optional, added to scores and broadcastable to
+ * [..., query_len, key_len].
+ *
+ * Queries are split into blocks of kQueryBlock, which are distributed over threads. A block of
+ * queries visits keys and values by blocks of kKeyBlock, so a block of keys and values is reused
+ * by all queries of the block while it is in cache. Softmax is computed online: running max and
+ * sum of each query are updated per key block, and its output is rescaled when the max grows.
+ * Only scores of a query block and a key block are kept in memory.
+ */
+inline void ScaledDotProductAttention(const AttentionParams &params, const Shape &query_shape,
+                                      const float *query_data, const Shape &key_shape,
+                                      const float *key_data, const Shape &value_shape,
+                                      const float *value_data, const Shape &mask_shape,
+                                      const float *mask_data, const Shape &output_shape,
+                                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  constexpr int kQueryBlock = 32;
+  constexpr int kKeyBlock = 64;
+
+  const int rank = query_shape.DimensionsCount();
+  if (rank < 2 || key_shape.DimensionsCount() != rank || value_shape.DimensionsCount() != rank ||
+      output_shape.DimensionsCount() != rank)
+    throw std::runtime_error("Attention: query, key, value and output should have same rank >= 2");
+
+  const int query_len = MatchingDim(query_shape, rank - 2, output_shape, rank - 2);
+  const int key_len = MatchingDim(key_shape, rank - 2, value_shape, rank - 2);
+  const int depth = MatchingDim(query_shape, rank - 1, key_shape, rank - 1);
+  const int value_depth = MatchingDim(value_shape, rank - 1, output_shape, rank - 1);
+
+  // Leading dimensions are flattened into (outer, heads)
+  int outer = 1;
+  for (int i = 0; i < rank - 3; ++i)
+  {
+    if (query_shape.Dims(i) != key_shape.Dims(i) || key_shape.Dims(i) != value_shape.Dims(i) ||
+        query_shape.Dims(i) != output_shape.Dims(i))
+      throw std::runtime_error("Attention: batch dimensions do not match");
+    outer *= query_shape.Dims(i);
+  }
+  const int heads = rank >= 3 ? MatchingDim(query_shape, rank - 3, output_shape, rank - 3) : 1;
+  const int kv_heads = rank >= 3 ? MatchingDim(key_shape, rank - 3, value_shape, rank - 3) : 1;
+  if (kv_heads == 0 || heads % kv_heads != 0)
+    throw std::runtime_error("Attention: query heads should be a multiple of key heads");
+  const int group = heads / kv_heads;
+
+  const float scale =
+    params.scale != 0.f ? params.scale : 1.f / std::sqrt(static_cast<float>(depth));
+
+  std::vector<int64_t> mask_strides;
+  if (mask_data != nullptr)
+  {
+    Shape scores_shape(output_shape);
+    scores_shape.SetDim(rank - 1, key_len);
+    mask_strides = attention::MaskStrides(scores_shape, mask_shape);
+  }
+
+  // Keys after the query are masked in causal attention. The last query sees all keys.
+  auto num_keys_of = [&](int query_pos) {
+    return params.causal ? std::max(0, std::min(key_len, query_pos + key_len - query_len + 1))
+                         : key_len;
+  };
+
+  const int query_blocks = (query_len + kQueryBlock - 1) / kQueryBlock;
+  const float neg_inf = -std::numeric_limits<float>::infinity();
+
+  auto attend = [&](int start, int end) {
+    std::vector<float> scores(kQueryBlock * kKeyBlock);
+    std::vector<float> max_scores(kQueryBlock);
+    std::vector<float> sums(kQueryBlock);
+    for (int tile = start; tile < end; ++tile)
+    {
+      const int batch = tile / query_blocks;
+      const int query_begin = (tile % query_blocks) * kQueryBlock;
+      const int query_end = std::min(query_len, query_begin + kQueryBlock);
+      const int head = batch % heads;
+      const int kv_batch = (batch / heads) * kv_heads + head / group;
+
+      const int64_t first_index = static_cast<int64_t>(batch) * query_len + query_begin;
+      const float *q = query_data + first_index * depth;
+      const float *k = key_data + static_cast<int64_t>(kv_batch) * key_len * depth;
+      const float *v = value_data + static_cast<int64_t>(kv_batch) * key_len * value_depth;
+      float *out = output_data + first_index * value_depth;
+
+      int64_t mask_batch_offset = 0;
+      if (mask_data != nullptr)
+      {
+        int remain = batch;
+        for (int i = rank - 3; i >= 0; --i)
+        {
+          mask_batch_offset += (remain % output_shape.Dims(i)) * mask_strides[i];
+          remain /= output_shape.Dims(i);
+        }
+      }
+
+      const int rows = query_end - query_begin;
+      std::fill(out, out + static_cast<int64_t>(rows) * value_depth, 0.f);
+      std::fill(max_scores.begin(), max_scores.end(), neg_inf);
+      std::fill(sums.begin(), sums.end(), 0.f);
+
+      // The last query of the block sees the most keys
+      const int tile_keys = num_keys_of(query_end - 1);
+      for (int key_begin = 0; key_begin < tile_keys; key_begin += kKeyBlock)
+      {
+        const int key_end = std::min(tile_keys, key_begin + kKeyBlock);
+        for (int r = 0; r < rows; ++r)
+        {
+          const int query_pos = query_begin + r;
+          const int row_keys = std::min(key_end, num_keys_of(query_pos)) - key_begin;
+          if (row_keys <= 0)
+            continue;
+
+          const float *q_row = q + static_cast<int64_t>(r) * depth;
+          const float *mask = nullptr;
+          if (mask_data != nullptr)
+            mask = mask_data + mask_batch_offset + query_pos * mask_strides[rank - 2] +
+                   key_begin * mask_strides[rank - 1];
+
+          float *row_scores = scores.data() + r * kKeyBlock;
+          float block_max = neg_inf;
+          for (int j = 0; j < row_keys; ++j)
+          {
+            const float *k_row = k + static_cast<int64_t>(key_begin + j) * depth;
+            float dot = 0.f;
+            for (int d = 0; d < depth; ++d)
+              dot += q_row[d] * k_row[d];
+            float score = dot * scale;
+            if (mask != nullptr)
+              score += mask[j * mask_strides[rank - 1]];
+            row_scores[j] = score;
+            block_max = std::max(block_max, score);
+          }
+
+          const float new_max = std::max(max_scores[r], block_max);
+          // All keys seen so far are masked
+          if (new_max == neg_inf)
+            continue;
+
+          float *out_row = out + static_cast<int64_t>(r) * value_depth;
+          if (new_max > max_scores[r])
+          {
+            // exp(-inf) is 0, and the output and sum are still 0 for the first unmasked block
+            const float correction = std::exp(max_scores[r] - new_max);
+            sums[r] *= correction;
+            for (int d = 0; d < value_depth; ++d)
+              out_row[d] *= correction;
+            max_scores[r] = new_max;
+          }
+
+          for (int j = 0; j < row_keys; ++j)
+          {
+            const float weight = std::exp(row_scores[j] - new_max);
+            sums[r] += weight;
+            const float *v_row = v + static_cast<int64_t>(key_begin + j) * value_depth;
+            for (int d = 0; d < value_depth; ++d)
+              out_row[d] += weight * v_row[d];
+          }
+        }
+      }
+
+      for (int r = 0; r < rows; ++r)
+      {
+        // Output of a query whose keys are all masked stays 0
+        if (sums[r] == 0.f)
+          continue;
+        const float inv_sum = 1.f / sums[r];
+        float *out_row = out + static_cast<int64_t>(r) * value_depth;
+        for (int d = 0; d < value_depth; ++d)
+          out_row[d] *= inv_sum;
+      }
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(outer * heads * query_blocks,
+                                      static_cast<int64_t>(kQueryBlock) * key_len *
+                                        (depth + value_depth),
+                                      ruy_context, attend);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ATTENTION_H__
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_BROADCAST_TO_H__
 #define __NNFW_CKER_BROADCAST_TO_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
@@ -26,6 +27,7 @@
 
 #include "cker/operation/Helper/Tensor.h"
 #include "cker/operation/Helper/BCast.h"
+#include "cker/operation/Tile.h"
 
 #include <vector>
 
@@ -130,7 +132,7 @@ template <typename Device, typename T> struct BroadcastTo
 
 template <typename T>
 inline void BroadcastTo(const Shape &input_shape, T *input_data, const Shape &output_shape,
-                        T *output_data)
+                        T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int input_flatsize = input_shape.FlatSize();
 
@@ -172,6 +174,20 @@ inline void BroadcastTo(const Shape &input_shape, T *input_data, const Shape &ou
   // should be same.
   assert(BCast::ToShape(bcast.output_shape()) == output_shape);
 
+  // Broadcast is same with tiling reshaped input by broadcast multiples, so it runs on the
+  // threads of ruy_context if they are given. Otherwise, Eigen thread pool is used.
+  if (input_flatsize > 0 && ruy_context != nullptr && ruy_context->max_num_threads() > 1)
+  {
+    const auto &x_reshape = bcast.x_reshape();
+    Shape reshaped_input_shape(static_cast<int>(x_reshape.size()));
+    for (size_t i = 0; i < x_reshape.size(); ++i)
+    {
+      reshaped_input_shape.SetDim(i, x_reshape[i]);
+    }
+    Tile(reshaped_input_shape, input_data, bcast.x_bcast().data(), output_data, ruy_context);
+    return;
+  }
+
   functor::BroadcastTo<Eigen::ThreadPoolDevice, T>()(device, output_tensor, output_shape,
                                                      input_tensor, input_shape, bcast);
 }
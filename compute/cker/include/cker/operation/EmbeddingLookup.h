@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_EMBEDDING_LOOKUP_H__
+#define __NNFW_CKER_EMBEDDING_LOOKUP_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Copy the rows of values selected by lookups. Lookups are validated before copying, so output
+// is not partially written with invalid lookups.
+template <typename T>
+inline void EmbeddingLookup(const Shape &lookups_shape, const int32_t *lookups_data,
+                            const Shape &values_shape, const T *values_data,
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context *ruy_context = nullptr)
+{
+  const int num_lookups = lookups_shape.FlatSize();
+  const int num_rows = values_shape.Dims(0);
+  const int row_size = FlatSizeSkipDim(values_shape, 0);
+  UNUSED_RELEASE(output_shape);
+  assert(output_shape.FlatSize() == num_lookups * row_size);
+
+  for (int i = 0; i < num_lookups; ++i)
+  {
+    if (lookups_data[i] < 0 || lookups_data[i] >= num_rows)
+      throw std::runtime_error{"EmbeddingLookup: Lookup " + std::to_string(lookups_data[i]) +
+                               " is out of range"};
+  }
+
+  auto copy_rows = [&](int start, int end) {
+    for (int i = start; i < end; ++i)
+    {
+      std::memcpy(output_data + static_cast<int64_t>(i) * row_size,
+                  values_data + static_cast<int64_t>(lookups_data[i]) * row_size,
+                  row_size * sizeof(T));
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(num_lookups, row_size, ruy_context, copy_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_EMBEDDING_LOOKUP_H__
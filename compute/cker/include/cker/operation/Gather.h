@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_GATHER_H__
 #define __NNFW_CKER_GATHER_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -30,7 +31,7 @@ namespace cker
 template <typename T, typename CoordsT = int32_t>
 inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
                    const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+                   T *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -54,17 +55,21 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int i = 0; i < coords_count; ++i)
+  // Each output slice of inner_size is copied from one input slice, so split them over threads
+  const auto gather_slices = [&](int start, int end) {
+    for (int slice = start; slice < end; ++slice)
     {
+      const int outer = slice / coords_count;
+      const int i = slice % coords_count;
       assert(coords_data[i] >= 0);
       assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
+      std::memcpy(output_data + slice * inner_size,
                   input_data + (outer * axis_size + coords_data[i]) * inner_size,
                   sizeof(T) * inner_size);
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(outer_size * coords_count, inner_size, ruy_context,
+                                      gather_slices);
 }
 
 } // namespace cker
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_GELU_H__
+#define __NNFW_CKER_GELU_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <cmath>
+
+namespace nnfw
+{
+namespace cker
+{
+
+inline void GELU(const GeluParams &params, const Shape &input_shape, const float *input_data,
+                 const Shape &output_shape, float *output_data)
+{
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+
+  if (params.approximate)
+  {
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+    constexpr float kSqrt2OverPi = 0.7978845608028654f;
+    for (int i = 0; i < flat_size; i++)
+    {
+      const float val = input_data[i];
+      const float inner = kSqrt2OverPi * (val + 0.044715f * val * val * val);
+      output_data[i] = 0.5f * val * (1.f + std::tanh(inner));
+    }
+  }
+  else
+  {
+    // 0.5 * x * (1 + erf(x / sqrt(2)))
+    constexpr float kInvSqrt2 = 0.7071067811865475f;
+    for (int i = 0; i < flat_size; i++)
+    {
+      const float val = input_data[i];
+      output_data[i] = 0.5f * val * (1.f + std::erf(val * kInvSqrt2));
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_GELU_H__
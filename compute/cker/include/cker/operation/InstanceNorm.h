@@ -17,10 +17,12 @@
 #ifndef __NNFW_CKER_INSTANCE_NORM_H__
 #define __NNFW_CKER_INSTANCE_NORM_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace nnfw
@@ -28,10 +30,13 @@ namespace nnfw
 namespace cker
 {
 
+// Channels are split into blocks of a cache line, and each thread computes mean and variance of
+// a block over all pixels of a batch, then normalizes the block. A pixel of a block is read as a
+// contiguous chunk rather than visiting each channel with the stride of depth.
 inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_shape,
                          const float *input_data, const Shape &gamma_shape, const float *gamma_data,
                          const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
-                         float *output_data)
+                         float *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
   const int32_t heights = MatchingDim(input_shape, 1, output_shape, 1);
@@ -44,46 +49,59 @@ inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_sh
   UNUSED_RELEASE(beta_shape);
   assert(output_activation_min <= output_activation_max);
 
-  for (int32_t batch = 0; batch < batches; batch++)
-  {
-    for (int32_t channel = 0; channel < channels; channel++)
+  constexpr int32_t kChannelBlock = 16;
+  const int32_t blocks = (channels + kChannelBlock - 1) / kChannelBlock;
+  const int32_t size = heights * widths;
+
+  auto normalize_blocks = [&](int start, int end) {
+    double sum[kChannelBlock];
+    double square_sum[kChannelBlock];
+    float a[kChannelBlock];
+    float b[kChannelBlock];
+    for (int unit = start; unit < end; ++unit)
     {
-      double sum = 0.0f;
-      double square_sum = 0.0f;
-      int32_t size = heights * widths;
+      const int32_t batch = unit / blocks;
+      const int32_t channel_begin = (unit % blocks) * kChannelBlock;
+      const int32_t block_size = std::min(kChannelBlock, channels - channel_begin);
+      const int64_t batch_offset = static_cast<int64_t>(batch) * size * channels + channel_begin;
+      const float *in = input_data + batch_offset;
+      float *out = output_data + batch_offset;
 
-      for (int32_t height = 0; height < heights; height++)
+      std::fill(sum, sum + block_size, 0.0);
+      std::fill(square_sum, square_sum + block_size, 0.0);
+      for (int32_t i = 0; i < size; ++i)
       {
-        for (int32_t width = 0; width < widths; width++)
+        const float *pixel = in + static_cast<int64_t>(i) * channels;
+        for (int32_t c = 0; c < block_size; ++c)
         {
-          double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-          sum += input_val;
-          square_sum += (input_val * input_val);
+          const double input_val = pixel[c];
+          sum[c] += input_val;
+          square_sum[c] += input_val * input_val;
         }
       }
 
-      double mean = sum / size;
-      double var = square_sum / size - mean * mean;
-
-      double gamma = gamma_data[channel];
-      double beta = beta_data[channel];
-
-      double a = gamma / (std::sqrt(var + params.epsilon));
-      double b = -mean * a + beta;
+      for (int32_t c = 0; c < block_size; ++c)
+      {
+        const double mean = sum[c] / size;
+        const double var = square_sum[c] / size - mean * mean;
+        const double scale = gamma_data[channel_begin + c] / std::sqrt(var + params.epsilon);
+        a[c] = static_cast<float>(scale);
+        b[c] = static_cast<float>(-mean * scale + beta_data[channel_begin + c]);
+      }
 
-      for (int32_t height = 0; height < heights; height++)
+      for (int32_t i = 0; i < size; ++i)
       {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_value = input_data[Offset(output_shape, batch, height, width, channel)];
-          double output_value = input_value * a + b;
-          output_data[Offset(output_shape, batch, height, width, channel)] =
-            ActivationFunctionWithMinMax((float)output_value, output_activation_min,
-                                         output_activation_max);
-        }
+        const float *pixel = in + static_cast<int64_t>(i) * channels;
+        float *out_pixel = out + static_cast<int64_t>(i) * channels;
+        for (int32_t c = 0; c < block_size; ++c)
+          out_pixel[c] = ActivationFunctionWithMinMax(pixel[c] * a[c] + b[c],
+                                                      output_activation_min, output_activation_max);
       }
     }
-  }
+  };
+  const int64_t cost_per_block = static_cast<int64_t>(3) * size * kChannelBlock;
+  cpu_backend_threadpool::ParallelFor(batches * blocks, cost_per_block, ruy_context,
+                                      normalize_blocks);
 }
 
 } // namespace cker
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LAYER_NORM_H__
+#define __NNFW_CKER_LAYER_NORM_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <cmath>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Normalize each row of the last axis with its mean and variance, then scale by gamma and shift
+// by beta. Mean, variance and outputs of a row are computed while the row stays in cache.
+inline void LayerNorm(const LayerNormParams &params, const Shape &input_shape,
+                      const float *input_data, const Shape &gamma_shape, const float *gamma_data,
+                      const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
+                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int rows = FlatSizeSkipDim(input_shape, trailing_dim);
+  UNUSED_RELEASE(gamma_shape);
+  UNUSED_RELEASE(beta_shape);
+  assert(gamma_shape.FlatSize() == depth);
+  assert(beta_shape.FlatSize() == depth);
+
+  auto normalize_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const float *in = input_data + static_cast<int64_t>(row) * depth;
+      float *out = output_data + static_cast<int64_t>(row) * depth;
+
+      float sum = 0.f;
+      for (int i = 0; i < depth; ++i)
+        sum += in[i];
+      const float mean = sum / depth;
+
+      float square_sum = 0.f;
+      for (int i = 0; i < depth; ++i)
+      {
+        const float diff = in[i] - mean;
+        square_sum += diff * diff;
+      }
+      const float inv_std = 1.f / std::sqrt(square_sum / depth + params.epsilon);
+
+      for (int i = 0; i < depth; ++i)
+        out[i] = (in[i] - mean) * inv_std * gamma_data[i] + beta_data[i];
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(rows, 3 * depth, ruy_context, normalize_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LAYER_NORM_H__
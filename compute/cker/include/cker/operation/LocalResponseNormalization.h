@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+#define __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Normalize each element by the squared sum of its neighbors within range along the last axis.
+// Squared sums of all windows of a row are taken from prefix sums, so a row costs O(depth)
+// regardless of range.
+inline void LocalResponseNormalization(const LocalResponseNormalizationParams &params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &output_shape, float *output_data,
+                                       ruy::Context *ruy_context = nullptr)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int rows = FlatSizeSkipDim(input_shape, trailing_dim);
+
+  auto normalize_rows = [&](int start, int end) {
+    // prefix[c] is the squared sum of input[0, c)
+    std::vector<double> prefix(depth + 1);
+    for (int row = start; row < end; ++row)
+    {
+      const float *in = input_data + static_cast<int64_t>(row) * depth;
+      float *out = output_data + static_cast<int64_t>(row) * depth;
+
+      prefix[0] = 0.0;
+      for (int c = 0; c < depth; ++c)
+        prefix[c + 1] = prefix[c] + static_cast<double>(in[c]) * in[c];
+
+      for (int c = 0; c < depth; ++c)
+      {
+        const int window_begin = std::max(0, c - params.range);
+        const int window_end = std::min(depth, c + params.range + 1);
+        const float square_sum = static_cast<float>(prefix[window_end] - prefix[window_begin]);
+        const float multiplier = std::pow(params.bias + params.alpha * square_sum, -params.beta);
+        out[c] = in[c] * multiplier;
+      }
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(rows, 4 * depth, ruy_context, normalize_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_PRELU_H__
+#define __NNFW_CKER_PRELU_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace prelu
+{
+
+// Whether alpha is repeated along the leading dimensions of input, like per-channel alpha
+inline bool IsAlphaRepeated(const Shape &input_shape, const Shape &alpha_shape,
+                            const Shape &output_shape)
+{
+  if (!(input_shape == output_shape))
+    return false;
+
+  const int input_rank = input_shape.DimensionsCount();
+  const int alpha_rank = alpha_shape.DimensionsCount();
+  int first = 0;
+  while (first < alpha_rank && alpha_shape.Dims(first) == 1)
+    ++first;
+  if (alpha_rank - first > input_rank)
+    return false;
+  for (int i = first; i < alpha_rank; ++i)
+  {
+    if (alpha_shape.Dims(i) != input_shape.Dims(input_rank - alpha_rank + i))
+      return false;
+  }
+  return true;
+}
+
+} // namespace prelu
+
+inline void PReLU(const Shape &input_shape, const float *input_data, const Shape &alpha_shape,
+                  const float *alpha_data, const Shape &output_shape, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
+{
+  if (prelu::IsAlphaRepeated(input_shape, alpha_shape, output_shape))
+  {
+    // Rows of alpha size are processed independently without computing broadcast indices
+    const int alpha_size = alpha_shape.FlatSize();
+    if (alpha_size == 0)
+      return;
+    const int rows = output_shape.FlatSize() / alpha_size;
+    auto compute_rows = [&](int start, int end) {
+      for (int row = start; row < end; ++row)
+      {
+        const int64_t offset = static_cast<int64_t>(row) * alpha_size;
+        const float *in = input_data + offset;
+        float *out = output_data + offset;
+        for (int i = 0; i < alpha_size; ++i)
+          out[i] = in[i] >= 0.0f ? in[i] : in[i] * alpha_data[i];
+      }
+    };
+    cpu_backend_threadpool::ParallelFor(rows, alpha_size, ruy_context, compute_rows);
+    return;
+  }
+
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error{"PReLU: Unsupported broadcast of rank > 4"};
+
+  NdArrayDesc<4> input_desc;
+  NdArrayDesc<4> alpha_desc;
+  NdArrayDescsForElementwiseBroadcast(input_shape, alpha_shape, &input_desc, &alpha_desc);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const float input = input_data[SubscriptToIndex(input_desc, b, y, x, c)];
+          const float alpha = alpha_data[SubscriptToIndex(alpha_desc, b, y, x, c)];
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+            input >= 0.0f ? input : input * alpha;
+        }
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PRELU_H__
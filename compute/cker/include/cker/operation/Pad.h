@@ -17,6 +17,7 @@
 #ifndef __NNFW_CKER_PAD_H__
 #define __NNFW_CKER_PAD_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -29,7 +30,7 @@ namespace cker
 template <typename T>
 inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &input_shape,
                 const T *input_data, const Shape &output_shape, T *output_data,
-                const T *constant_value_data)
+                const T *constant_value_data, ruy::Context *ruy_context = nullptr)
 {
   // Note, this is pad with mode=`CONSTANT`: it doesn't support `REFLECT` and `SYMMETRIC`
   // TODO: come up with more subtle solution that uses subtensors like arm compute
@@ -53,6 +54,12 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
     assert(output_shape.Dims(i) ==
            input_shape.Dims(i) + padding_list[i].first + padding_list[i].second);
   }
+  // Output of empty input has padding only
+  if (input_shape.FlatSize() == 0)
+  {
+    std::fill_n(output_data, output_shape.FlatSize(), constant_value);
+    return;
+  }
   /* Use pad_rank since given input/output shapes are expanded to 4d before calling all cker
      functions:
      1. to prevent access violation in padding_list;
@@ -79,24 +86,28 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * out_row_size, constant_value);
 
       const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, j = 0; i < r_h_inp_lim; ++i, ++j)
-      {
-        auto out_offset = i * out_row_size;
-        const auto in_offset = j * in_row_len;
+      const auto pad_rows = [&](int start, int end) {
+        for (auto i = padding_list[0].first + start, j = start; j < end; ++i, ++j)
+        {
+          auto out_offset = i * out_row_size;
+          const auto in_offset = j * in_row_len;
 
-        // prepend padding values
-        std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
+          // prepend padding values
+          std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
 
-        out_offset += padding_list[1].first;
+          out_offset += padding_list[1].first;
 
-        // copy a row of input data
-        memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
+          // copy a row of input data
+          memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
 
-        out_offset += in_row_len;
+          out_offset += in_row_len;
 
-        // append padding values
-        std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
-      }
+          // append padding values
+          std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(input_shape.Dims(0), out_row_size, ruy_context,
+                                          pad_rows);
 
       // append padding rows
       std::fill_n(output_data + r_h_inp_lim * out_row_size, padding_list[0].second * out_row_size,
@@ -113,17 +124,24 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * plain_size, constant_value);
 
       const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_h_inp_lim; ++i, ++i_inp)
-      {
-        const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
-
-        // prepend padding rows
-        std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
-                    constant_value);
+      const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
 
-        const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_w_inp_lim; ++j, ++j_inp)
+      // Rows of input are padded in parallel. The first and last rows of each plain also fill
+      // padding rows of the plain.
+      const auto pad_rows = [&](int start, int end) {
+        for (int row = start; row < end; ++row)
         {
+          const auto i_inp = row / input_shape.Dims(1);
+          const auto j_inp = row % input_shape.Dims(1);
+          const auto i = i_inp + padding_list[0].first;
+          const auto j = j_inp + padding_list[1].first;
+          const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
+
+          // prepend padding rows
+          if (j_inp == 0)
+            std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
+                        constant_value);
+
           auto out_offset = (i * output_shape.Dims(1) + j) * output_shape.Dims(2);
           const auto in_offset = (i_inp * input_shape.Dims(1) + j_inp) * input_shape.Dims(2);
 
@@ -139,12 +157,15 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
 
           // append padding values
           std::fill_n(output_data + out_offset, padding_list[2].second, constant_value);
-        }
 
-        // append padding rows
-        std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                    padding_list[1].second * out_row_size, constant_value);
-      }
+          // append padding rows
+          if (j_inp == input_shape.Dims(1) - 1)
+            std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
+                        padding_list[1].second * out_row_size, constant_value);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(input_shape.Dims(0) * input_shape.Dims(1), out_row_size,
+                                          ruy_context, pad_rows);
 
       // append padding plains
       std::fill_n(output_data + r_h_inp_lim * plain_size, padding_list[0].second * plain_size,
@@ -165,22 +186,31 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * parallelepiped_size, constant_value);
 
       const auto r_b_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_b_inp_lim; ++i, ++i_inp)
-      {
-        const auto out_h_offset = get_offset(output_shape, i, 0, 0);
-        // prepend padding plains
-        std::fill_n(output_data + out_h_offset, padding_list[1].first * plain_size, constant_value);
-
-        const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_h_inp_lim; ++j, ++j_inp)
+      const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
+      const auto r_w_inp_lim = input_shape.Dims(2) + padding_list[2].first;
+
+      // Plains of input are padded in parallel. The first and last plains of each
+      // parallelepiped also fill padding plains of the parallelepiped.
+      const auto pad_plains = [&](int start, int end) {
+        for (int plain = start; plain < end; ++plain)
         {
+          const auto i_inp = plain / input_shape.Dims(1);
+          const auto j_inp = plain % input_shape.Dims(1);
+          const auto i = i_inp + padding_list[0].first;
+          const auto j = j_inp + padding_list[1].first;
+          const auto out_h_offset = get_offset(output_shape, i, 0, 0);
+
+          // prepend padding plains
+          if (j_inp == 0)
+            std::fill_n(output_data + out_h_offset, padding_list[1].first * plain_size,
+                        constant_value);
+
           const auto out_w_offset = get_offset(output_shape, i, j, 0);
 
           // prepend padding rows
           std::fill_n(output_data + out_w_offset, padding_list[2].first * out_row_size,
                       constant_value);
 
-          const auto r_w_inp_lim = input_shape.Dims(2) + padding_list[2].first;
           for (auto k = padding_list[2].first, k_inp = 0; k < r_w_inp_lim; ++k, ++k_inp)
           {
             auto out_c_offset = get_offset(output_shape, i, j, k);
@@ -203,12 +233,15 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
           // append padding rows
           std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
                       padding_list[2].second * out_row_size, constant_value);
-        }
 
-        // append padding plains
-        std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
-                    padding_list[1].second * plain_size, constant_value);
-      }
+          // append padding plains
+          if (j_inp == input_shape.Dims(1) - 1)
+            std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
+                        padding_list[1].second * plain_size, constant_value);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(input_shape.Dims(0) * input_shape.Dims(1), plain_size,
+                                          ruy_context, pad_plains);
       // append padding parallelepipeds
       std::fill_n(output_data + r_b_inp_lim * parallelepiped_size,
                   padding_list[0].second * parallelepiped_size, constant_value);
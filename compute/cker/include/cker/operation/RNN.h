@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/PortableTensorUtils.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Basic RNN cell
+//   hidden_state_out = activation(input * weights' + hidden_state_in * recurrent_weights' + bias)
+//   output = hidden_state_out
+// Each unit of a batch is a pair of dot products over contiguous rows, and units are computed by
+// threads independently. hidden_state_in should not share memory with outputs.
+inline void RNN(const RNNParams &params, const Shape &input_shape, const float *input_data,
+                const Shape &weights_shape, const float *weights_data,
+                const Shape &recurrent_weights_shape, const float *recurrent_weights_data,
+                const Shape &bias_shape, const float *bias_data, const Shape &hidden_state_in_shape,
+                const float *hidden_state_in_data, const Shape &output_shape, float *output_data,
+                float *hidden_state_out_data, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  const int batches = MatchingDim(input_shape, 0, hidden_state_in_shape, 0);
+  const int input_size = MatchingDim(input_shape, 1, weights_shape, 1);
+  const int num_units = MatchingDim(weights_shape, 0, recurrent_weights_shape, 0);
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(output_shape);
+  assert(recurrent_weights_shape.Dims(1) == num_units);
+  assert(bias_shape.FlatSize() == num_units);
+  assert(hidden_state_in_shape.Dims(1) == num_units);
+  assert(output_shape.FlatSize() == batches * num_units);
+
+  const ActivationFunctor activation(params.activation);
+  auto compute_units = [&](int start, int end) {
+    for (int index = start; index < end; ++index)
+    {
+      const int batch = index / num_units;
+      const int unit = index % num_units;
+      const float *input = input_data + static_cast<int64_t>(batch) * input_size;
+      const float *hidden = hidden_state_in_data + static_cast<int64_t>(batch) * num_units;
+      const float *weights = weights_data + static_cast<int64_t>(unit) * input_size;
+      const float *recurrent = recurrent_weights_data + static_cast<int64_t>(unit) * num_units;
+
+      float sum = bias_data[unit];
+      for (int i = 0; i < input_size; ++i)
+        sum += input[i] * weights[i];
+      for (int i = 0; i < num_units; ++i)
+        sum += hidden[i] * recurrent[i];
+
+      const float value = activation(sum);
+      output_data[index] = value;
+      hidden_state_out_data[index] = value;
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(batches * num_units, input_size + num_units, ruy_context,
+                                      compute_units);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
@@ -18,11 +18,14 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
@@ -34,7 +37,7 @@ namespace cker
 
 #ifdef USE_NEON
 inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape,
-                               float *output_data)
+                               float *output_data, ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -46,78 +49,83 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
     input_size *= input_dims[idx];
   }
   reduce_size = input_dims[input_num_dims - 1];
-  int offset = 0;
-  for (int idx = 0; idx < input_size; idx++)
-  {
-    int r_idx = 0;
-    float tmp_data[4] = {
-      0,
-    };
-    float32x4_t tmp_data_32x4 = vld1q_f32(tmp_data);
-    for (; r_idx <= reduce_size - 32; r_idx += 32)
-    {
-      float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
-      float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
-      float32x4_t a20 = vld1q_f32(input_data + offset + r_idx + 16);
-      float32x4_t a21 = vld1q_f32(input_data + offset + r_idx + 20);
-      float32x4_t a22 = vld1q_f32(input_data + offset + r_idx + 24);
-      float32x4_t a23 = vld1q_f32(input_data + offset + r_idx + 28);
-
-      float32x4_t x0 = vaddq_f32(a10, a20);
-      float32x4_t x1 = vaddq_f32(a11, a21);
-      float32x4_t x2 = vaddq_f32(a12, a22);
-      float32x4_t x3 = vaddq_f32(a13, a23);
-
-      float32x4_t y0 = vaddq_f32(x0, x1);
-      float32x4_t y1 = vaddq_f32(x2, x3);
-      float32x4_t y2 = vaddq_f32(y0, y1);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y2);
-    }
-    for (; r_idx <= reduce_size - 16; r_idx += 16)
+  // Each output is reduced from its own row, so rows are split over threads
+  const auto reduce_rows = [&](int start, int end) {
+    int offset = start * reduce_size;
+    for (int idx = start; idx < end; idx++)
     {
-      float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
-      float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
-
-      float32x4_t x0 = vaddq_f32(a10, a11);
-      float32x4_t x1 = vaddq_f32(a12, a13);
+      int r_idx = 0;
+      float tmp_data[4] = {
+        0,
+      };
+      float32x4_t tmp_data_32x4 = vld1q_f32(tmp_data);
+      for (; r_idx <= reduce_size - 32; r_idx += 32)
+      {
+        float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
+        float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
+        float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
+        float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
+        float32x4_t a20 = vld1q_f32(input_data + offset + r_idx + 16);
+        float32x4_t a21 = vld1q_f32(input_data + offset + r_idx + 20);
+        float32x4_t a22 = vld1q_f32(input_data + offset + r_idx + 24);
+        float32x4_t a23 = vld1q_f32(input_data + offset + r_idx + 28);
+
+        float32x4_t x0 = vaddq_f32(a10, a20);
+        float32x4_t x1 = vaddq_f32(a11, a21);
+        float32x4_t x2 = vaddq_f32(a12, a22);
+        float32x4_t x3 = vaddq_f32(a13, a23);
+
+        float32x4_t y0 = vaddq_f32(x0, x1);
+        float32x4_t y1 = vaddq_f32(x2, x3);
+        float32x4_t y2 = vaddq_f32(y0, y1);
+        tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y2);
+      }
+      for (; r_idx <= reduce_size - 16; r_idx += 16)
+      {
+        float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
+        float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
+        float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
+        float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
 
-      float32x4_t y0 = vaddq_f32(x0, x1);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y0);
-    }
-    for (; r_idx <= reduce_size - 8; r_idx += 8)
-    {
-      float32x4_t a1 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a2 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t x = vaddq_f32(a1, a2);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, x);
-    }
-    vst1q_f32(tmp_data, tmp_data_32x4);
-    output_data[idx] = tmp_data[0] + tmp_data[1] + tmp_data[2] + tmp_data[3];
+        float32x4_t x0 = vaddq_f32(a10, a11);
+        float32x4_t x1 = vaddq_f32(a12, a13);
 
-    for (; r_idx < reduce_size; r_idx++)
-    {
-      if (r_idx == 0)
+        float32x4_t y0 = vaddq_f32(x0, x1);
+        tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y0);
+      }
+      for (; r_idx <= reduce_size - 8; r_idx += 8)
       {
-        output_data[idx] = input_data[offset];
+        float32x4_t a1 = vld1q_f32(input_data + offset + r_idx);
+        float32x4_t a2 = vld1q_f32(input_data + offset + r_idx + 4);
+        float32x4_t x = vaddq_f32(a1, a2);
+        tmp_data_32x4 = vaddq_f32(tmp_data_32x4, x);
       }
-      else
+      vst1q_f32(tmp_data, tmp_data_32x4);
+      output_data[idx] = tmp_data[0] + tmp_data[1] + tmp_data[2] + tmp_data[3];
+
+      for (; r_idx < reduce_size; r_idx++)
       {
-        output_data[idx] += input_data[offset + r_idx];
+        if (r_idx == 0)
+        {
+          output_data[idx] = input_data[offset];
+        }
+        else
+        {
+          output_data[idx] += input_data[offset + r_idx];
+        }
       }
+      offset += reduce_size;
     }
-    offset += reduce_size;
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(input_size, reduce_size, ruy_context, reduce_rows);
 }
 #endif // NEON
 
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       Out reducer(const Out current, const In in), Out *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -132,23 +140,63 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+    const auto reduce_rows = [&](int start, int end) {
+      for (int idx = start; idx < end; idx++)
       {
-        if (r_idx == 0)
+        for (int r_idx = 0; r_idx < reduce_size; r_idx++)
         {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
-        {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          if (r_idx == 0)
+          {
+            output_data[idx] = input_data[idx * reduce_size];
+          }
+          else
+          {
+            output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          }
         }
       }
-    }
+    };
+    cpu_backend_threadpool::ParallelFor(input_size, reduce_size, ruy_context, reduce_rows);
     return true;
   }
 
+  // If the first dimension is not reduced, its slices are reduced to distinct outputs
+  const bool first_dim_reduced = std::find(axis, axis + num_axis, 0) != axis + num_axis;
+  if (!first_dim_reduced && input_num_dims > 1)
+  {
+    int input_stride = 1;
+    int output_stride = 1;
+    for (int idx = 1; idx < input_num_dims; ++idx)
+    {
+      input_stride *= input_dims[idx];
+      if (std::find(axis, axis + num_axis, idx) == axis + num_axis)
+        output_stride *= input_dims[idx];
+    }
+
+    if (cpu_backend_threadpool::HowManyThreads(input_dims[0], input_stride, ruy_context) > 1)
+    {
+      const auto reduce_slices = [&](int start, int end) {
+        std::vector<int> slice_dims(input_dims, input_dims + input_num_dims);
+        slice_dims[0] = end - start;
+        std::vector<int> slice_iter(input_num_dims, 0);
+        const In *slice_input = input_data + start * input_stride;
+        Out *slice_output = output_data + start * output_stride;
+        do
+        {
+          size_t input_offset =
+            ReducedOutputOffset(input_num_dims, slice_dims.data(), slice_iter.data(), 0, nullptr);
+          size_t output_offset = ReducedOutputOffset(input_num_dims, slice_dims.data(),
+                                                     slice_iter.data(), num_axis, axis);
+          slice_output[output_offset] =
+            reducer(slice_output[output_offset], slice_input[input_offset]);
+        } while (NextIndex(input_num_dims, slice_dims.data(), slice_iter.data()));
+      };
+      cpu_backend_threadpool::ParallelFor(input_dims[0], input_stride, ruy_context,
+                                          reduce_slices);
+      return true;
+    }
+  }
+
   for (int idx = 0; idx < input_num_dims; ++idx)
   {
     input_iter[idx] = 0;
@@ -250,7 +298,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -266,7 +315,8 @@ public:
     }
 
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
-                            num_resolved_axis, temp_index_data(), reducer, output_data);
+                            num_resolved_axis, temp_index_data(), reducer, output_data,
+                            ruy_context);
   }
 
   // Computes the mean of elements across dimensions given in axis.
@@ -278,7 +328,8 @@ public:
                                  int32_t output_zero_point, float output_scale,
                                  const Shape &output_shape, const std::vector<int> &axes,
                                  bool /*keep_dims*/, U *temp_sum, bool compute_sum,
-                                 U reducer(const U current, const T in))
+                                 U reducer(const U current, const T in),
+                                 ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     size_t num_outputs = 1;
@@ -306,7 +357,7 @@ public:
     }
 
     if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
-                          num_resolved_axis, temp_index_data(), reducer, temp_sum))
+                          num_resolved_axis, temp_index_data(), reducer, temp_sum, ruy_context))
     {
       return false;
     }
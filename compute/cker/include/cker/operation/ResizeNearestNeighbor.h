@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+#define __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace resize_nearest_neighbor
+{
+
+inline int32_t NearestIndex(int32_t output_index, int32_t input_size, int32_t output_size,
+                            bool align_corners)
+{
+  const float scale = (align_corners && output_size > 1)
+                        ? (input_size - 1) / static_cast<float>(output_size - 1)
+                        : input_size / static_cast<float>(output_size);
+  const float value = output_index * scale;
+  const int32_t index =
+    static_cast<int32_t>(align_corners ? std::round(value) : std::floor(value));
+  return std::min(index, input_size - 1);
+}
+
+} // namespace resize_nearest_neighbor
+
+// Each output row copies depth elements of the nearest input pixel at once. Source columns are
+// computed once and shared by all rows.
+template <typename T>
+inline void ResizeNearestNeighbor(const ResizeNearestNeighborParams &params,
+                                  const Shape &input_shape, const T *input_data,
+                                  const Shape &output_shape, T *output_data,
+                                  ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int32_t output_height = params.output_height;
+  const int32_t output_width = params.output_width;
+  assert(output_shape.Dims(1) == output_height);
+  assert(output_shape.Dims(2) == output_width);
+
+  std::vector<int32_t> input_x(output_width);
+  for (int32_t x = 0; x < output_width; ++x)
+    input_x[x] = resize_nearest_neighbor::NearestIndex(x, input_width, output_width,
+                                                       params.align_corners);
+
+  const size_t pixel_size = depth * sizeof(T);
+  auto resize_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int32_t batch = row / output_height;
+      const int32_t y = row % output_height;
+      const int32_t in_y = resize_nearest_neighbor::NearestIndex(y, input_height, output_height,
+                                                                 params.align_corners);
+      const T *in = input_data + Offset(input_shape, batch, in_y, 0, 0);
+      T *out = output_data + Offset(output_shape, batch, y, 0, 0);
+      for (int32_t x = 0; x < output_width; ++x)
+        std::memcpy(out + x * depth, in + input_x[x] * depth, pixel_size);
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(batches * output_height, output_width * depth, ruy_context,
+                                      resize_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
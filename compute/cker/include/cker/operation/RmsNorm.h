@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RMS_NORM_H__
+#define __NNFW_CKER_RMS_NORM_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <cmath>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Divide each row of the last axis by its root mean square, then scale by gamma
+inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &gamma_shape, const float *gamma_data, const Shape &output_shape,
+                    float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int rows = FlatSizeSkipDim(input_shape, trailing_dim);
+  UNUSED_RELEASE(gamma_shape);
+  assert(gamma_shape.FlatSize() == depth);
+
+  auto normalize_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const float *in = input_data + static_cast<int64_t>(row) * depth;
+      float *out = output_data + static_cast<int64_t>(row) * depth;
+
+      float square_sum = 0.f;
+      for (int i = 0; i < depth; ++i)
+        square_sum += in[i] * in[i];
+      const float inv_rms = 1.f / std::sqrt(square_sum / depth + params.epsilon);
+
+      for (int i = 0; i < depth; ++i)
+        out[i] = in[i] * inv_rms * gamma_data[i];
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(rows, 2 * depth, ruy_context, normalize_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RMS_NORM_H__
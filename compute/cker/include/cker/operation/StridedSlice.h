@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_STRIDEDSLICE_H__
 #define __NNFW_CKER_STRIDEDSLICE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -190,6 +191,14 @@ inline bool LoopCondition(int index, int stop, int stride)
   return stride > 0 ? index >= stop : index <= stop;
 }
 
+// Return the number of iterations along an axis from start to stop
+inline int LoopCount(int start, int stop, int stride)
+{
+  const int distance = stride > 0 ? stop - start : start - stop;
+  const int abs_stride = stride > 0 ? stride : -stride;
+  return distance > 0 ? (distance + abs_stride - 1) / abs_stride : 0;
+}
+
 template <typename T>
 inline StridedSliceParams
 buildStridedSliceParams(const T *begin, const T *end, const T *strides, const uint32_t begin_mask,
@@ -258,7 +267,8 @@ void checkOutputSize(const StridedSliceParams &op_params, const Shape &input_sha
 
 template <typename T>
 inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unextended_input_shape,
-                         const T *input_data, const Shape &unextended_output_shape, T *output_data)
+                         const T *input_data, const Shape &unextended_output_shape, T *output_data,
+                         ruy::Context *ruy_context = nullptr)
 {
   assert(unextended_input_shape.DimensionsCount() <= 4);
   assert(unextended_output_shape.DimensionsCount() <= 4);
@@ -311,13 +321,19 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
   const int start_d = StartForAxis(params_copy, input_shape, 3);
   const int stop_d = StopForAxis(params_copy, input_shape, 3, start_d);
 
-  T *out_ptr = output_data;
-  for (int in_b = start_b; !LoopCondition(in_b, stop_b, params_copy.strides[0]);
-       in_b += params_copy.strides[0])
-  {
-    for (int in_h = start_h; !LoopCondition(in_h, stop_h, params_copy.strides[1]);
-         in_h += params_copy.strides[1])
+  // Output rows of batch and height are written in parallel
+  const int count_h = LoopCount(start_h, stop_h, params_copy.strides[1]);
+  const int count_w = LoopCount(start_w, stop_w, params_copy.strides[2]);
+  const int count_d = LoopCount(start_d, stop_d, params_copy.strides[3]);
+  const int num_rows = LoopCount(start_b, stop_b, params_copy.strides[0]) * count_h;
+  const int row_size = count_w * count_d;
+
+  const auto slice_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
     {
+      const int in_b = start_b + (row / count_h) * params_copy.strides[0];
+      const int in_h = start_h + (row % count_h) * params_copy.strides[1];
+      T *out_ptr = output_data + row * row_size;
       for (int in_w = start_w; !LoopCondition(in_w, stop_w, params_copy.strides[2]);
            in_w += params_copy.strides[2])
       {
@@ -328,7 +344,8 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
         }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(num_rows, row_size, ruy_context, slice_rows);
 }
 
 } // namespace cker
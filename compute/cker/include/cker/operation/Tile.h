@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TILE_H__
 #define __NNFW_CKER_TILE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 
 namespace nnfw
@@ -67,6 +68,49 @@ std::pair<int, int> TileOneDimension(const Shape &in_dimensions, const T *in_dat
                         static_cast<int>(total_tiled_stride_size * multipliers[dimension]));
 }
 
+// Same with TileOneDimension() from the outermost dimension, but slices of the outermost
+// dimension are tiled in parallel, and then their result is repeated in parallel
+template <typename T, typename M>
+void Tile(const Shape &in_dimensions, const T *in_data, const M *multipliers, T *out_data,
+          ruy::Context *ruy_context = nullptr)
+{
+  const int num_dims = in_dimensions.DimensionsCount();
+  assert(num_dims > 0);
+
+  const int outer_size = in_dimensions.Dims(0);
+  int in_stride = 1;
+  int tiled_stride = 1;
+  for (int i = 1; i < num_dims; ++i)
+  {
+    in_stride *= in_dimensions.Dims(i);
+    tiled_stride *= in_dimensions.Dims(i) * static_cast<int>(multipliers[i]);
+  }
+
+  const auto tile_slices = [&](int start, int end) {
+    if (num_dims == 1)
+    {
+      std::copy(in_data + start, in_data + end, out_data + start);
+      return;
+    }
+    for (int i = start; i < end; ++i)
+    {
+      TileOneDimension(in_dimensions, in_data + i * in_stride, multipliers,
+                       out_data + i * tiled_stride, 1);
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(outer_size, tiled_stride, ruy_context, tile_slices);
+
+  const int tiled_size = outer_size * tiled_stride;
+  const auto repeat_tiled = [&](int start, int end) {
+    for (int i = start; i < end; ++i)
+    {
+      std::copy(out_data, out_data + tiled_size, out_data + (i + 1) * tiled_size);
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(static_cast<int>(multipliers[0]) - 1, tiled_size,
+                                      ruy_context, repeat_tiled);
+}
+
 } // namespace cker
 } // namespace nnfw
 
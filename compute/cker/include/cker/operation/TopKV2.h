@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_TOPK_V2_H__
+#define __NNFW_CKER_TOPK_V2_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Find k largest values of each row of the last axis. Values are in descending order, and the
+// smaller index comes first among equal values. Only k entries of a row are kept sorted, so a row
+// costs O(n log k).
+template <typename T>
+inline void TopKV2(const Shape &input_shape, const T *input_data, int32_t k,
+                   const Shape &values_shape, T *values_data, const Shape &indices_shape,
+                   int32_t *indices_data, ruy::Context *ruy_context = nullptr)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int row_size = input_shape.Dims(trailing_dim);
+  const int rows = FlatSizeSkipDim(input_shape, trailing_dim);
+  if (k < 0 || k > row_size)
+    throw std::runtime_error{"TopKV2: k should be in [0, " + std::to_string(row_size) + "]"};
+
+  UNUSED_RELEASE(values_shape);
+  UNUSED_RELEASE(indices_shape);
+  assert(values_shape.FlatSize() == rows * k);
+  assert(indices_shape.FlatSize() == rows * k);
+
+  auto compute_rows = [&](int start, int end) {
+    std::vector<int32_t> order(row_size);
+    for (int row = start; row < end; ++row)
+    {
+      const T *in = input_data + static_cast<int64_t>(row) * row_size;
+      std::iota(order.begin(), order.end(), 0);
+      std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                        [in](int32_t lhs, int32_t rhs) {
+                          return in[lhs] > in[rhs] || (in[lhs] == in[rhs] && lhs < rhs);
+                        });
+
+      T *values = values_data + static_cast<int64_t>(row) * k;
+      int32_t *indices = indices_data + static_cast<int64_t>(row) * k;
+      for (int i = 0; i < k; ++i)
+      {
+        indices[i] = order[i];
+        values[i] = in[order[i]];
+      }
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(rows, static_cast<int64_t>(4) * row_size, ruy_context,
+                                      compute_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TOPK_V2_H__
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -31,7 +32,8 @@ namespace reference
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &unextended_input_shape,
-                   const T *input_data, const Shape &unextended_output_shape, T *output_data)
+                   const T *input_data, const Shape &unextended_output_shape, T *output_data,
+                   ruy::Context *ruy_context = nullptr)
 {
   const int unextended_output_size = unextended_output_shape.DimensionsCount();
   assert(unextended_input_shape.DimensionsCount() <= 4);
@@ -63,30 +65,36 @@ void TransposeImpl(const TransposeParams &params, const Shape &unextended_input_
   }
 
   // Naive transpose loop (iterate on output index and compute input index).
-  int o[4]; // loop index (on output).
-  int i[4];
-  for (o[3] = 0; o[3] < out_sizes[3]; o[3]++)
-  {
-    i[extended_perm[3]] = o[3];
-    for (o[2] = 0; o[2] < out_sizes[2]; o[2]++)
+  // Threads are split along the outer output dimensions flattened into rows, so each thread
+  // writes whole rows of the innermost dimension to its own contiguous range of output
+  const int inner_size = out_sizes[3];
+  const int num_rows = out_sizes[0] * out_sizes[1] * out_sizes[2];
+  const auto transpose_range = [&](int start, int end) {
+    int o[4]; // loop index (on output).
+    int i[4];
+    for (int row = start; row < end; ++row)
     {
+      o[0] = row / (out_sizes[1] * out_sizes[2]);
+      o[1] = (row / out_sizes[2]) % out_sizes[1];
+      o[2] = row % out_sizes[2];
+      i[extended_perm[0]] = o[0];
+      i[extended_perm[1]] = o[1];
       i[extended_perm[2]] = o[2];
-      for (o[1] = 0; o[1] < out_sizes[1]; o[1]++)
+      T *output_row = output_data + static_cast<int64_t>(row) * inner_size;
+      for (o[3] = 0; o[3] < inner_size; o[3]++)
       {
-        i[extended_perm[1]] = o[1];
-        for (o[0] = 0; o[0] < out_sizes[0]; o[0]++)
-        {
-          i[extended_perm[0]] = o[0];
-          output_data[Offset(output_shape, o)] = input_data[Offset(input_shape, i)];
-        }
+        i[extended_perm[3]] = o[3];
+        output_row[o[3]] = input_data[Offset(input_shape, i)];
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(num_rows, inner_size, ruy_context, transpose_range);
 }
 
 template <typename T>
 void Transpose(const TransposeParams &params, const Shape &unextended_input_shape,
-               const T *input_data, const Shape &unextended_output_shape, T *output_data)
+               const T *input_data, const Shape &unextended_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   // Transpose kernel only does rearranging values not numeric evaluations on
   // each cell. It's safe to implement per size of scalar type and this trick
@@ -96,23 +104,23 @@ void Transpose(const TransposeParams &params, const Shape &unextended_input_shap
     case 1:
       TransposeImpl<int8_t>(params, unextended_input_shape,
                             reinterpret_cast<const int8_t *>(input_data), unextended_output_shape,
-                            reinterpret_cast<int8_t *>(output_data));
+                            reinterpret_cast<int8_t *>(output_data), ruy_context);
       break;
     case 2:
       TransposeImpl<int16_t>(params, unextended_input_shape,
                              reinterpret_cast<const int16_t *>(input_data), unextended_output_shape,
-                             reinterpret_cast<int16_t *>(output_data));
+                             reinterpret_cast<int16_t *>(output_data), ruy_context);
       break;
 
     case 4:
       TransposeImpl<int32_t>(params, unextended_input_shape,
                              reinterpret_cast<const int32_t *>(input_data), unextended_output_shape,
-                             reinterpret_cast<int32_t *>(output_data));
+                             reinterpret_cast<int32_t *>(output_data), ruy_context);
       break;
     case 8:
       TransposeImpl<int64_t>(params, unextended_input_shape,
                              reinterpret_cast<const int64_t *>(input_data), unextended_output_shape,
-                             reinterpret_cast<int64_t *>(output_data));
+                             reinterpret_cast<int64_t *>(output_data), ruy_context);
       break;
   }
 }
@@ -295,7 +303,7 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 // left to right (down the rows) of the input, and then from top to bottom.
 template <typename T>
 inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+                        T *output_data, ruy::Context *ruy_context = nullptr)
 {
   assert(input_shape.DimensionsCount() == 2);
   assert(output_shape.DimensionsCount() == 2);
@@ -306,105 +314,110 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
   const int kLines = 4;
   const int kSkipSize = (kLines - 1) * d1;
 
-  const T *input = input_data;
+  // Threads are split along input rows, which are output columns
+  const auto transpose_rows = [&](int start, int end) {
+    const T *input = input_data + start * d1;
 
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
-  {
-    T *output = output_data + i;
-
-    const T *input_ptr = input;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-
-    int j = 0;
-    for (; j <= d1 - kLines; j += kLines)
+    int i = start;
+    for (; i <= end - kLines; i += kLines)
     {
-      input_ptr = input;
-      const T a00 = input_ptr[0];
-      const T a01 = input_ptr[1];
-      const T a02 = input_ptr[2];
-      const T a03 = input_ptr[3];
+      T *output = output_data + i;
+
+      const T *input_ptr = input;
+      optimized_ops_preload_l1_keep(input_ptr);
       input_ptr += d1;
-      const T a10 = input_ptr[0];
-      const T a11 = input_ptr[1];
-      const T a12 = input_ptr[2];
-      const T a13 = input_ptr[3];
+      optimized_ops_preload_l1_keep(input_ptr);
       input_ptr += d1;
-      const T a20 = input_ptr[0];
-      const T a21 = input_ptr[1];
-      const T a22 = input_ptr[2];
-      const T a23 = input_ptr[3];
+      optimized_ops_preload_l1_keep(input_ptr);
       input_ptr += d1;
-      const T a30 = input_ptr[0];
-      const T a31 = input_ptr[1];
-      const T a32 = input_ptr[2];
-      const T a33 = input_ptr[3];
-
-      output[0] = a00;
-      output[1] = a10;
-      output[2] = a20;
-      output[3] = a30;
-      output += d0;
-
-      output[0] = a01;
-      output[1] = a11;
-      output[2] = a21;
-      output[3] = a31;
-      output += d0;
-
-      output[0] = a02;
-      output[1] = a12;
-      output[2] = a22;
-      output[3] = a32;
-      output += d0;
-
-      output[0] = a03;
-      output[1] = a13;
-      output[2] = a23;
-      output[3] = a33;
-      output += d0;
-
-      input += kLines;
-    }
-    if (j == d1)
-    {
-      input += kSkipSize;
-    }
-    else
-    {
-      for (int p = 0; p < kLines; ++p)
+      optimized_ops_preload_l1_keep(input_ptr);
+
+      int j = 0;
+      for (; j <= d1 - kLines; j += kLines)
+      {
+        input_ptr = input;
+        const T a00 = input_ptr[0];
+        const T a01 = input_ptr[1];
+        const T a02 = input_ptr[2];
+        const T a03 = input_ptr[3];
+        input_ptr += d1;
+        const T a10 = input_ptr[0];
+        const T a11 = input_ptr[1];
+        const T a12 = input_ptr[2];
+        const T a13 = input_ptr[3];
+        input_ptr += d1;
+        const T a20 = input_ptr[0];
+        const T a21 = input_ptr[1];
+        const T a22 = input_ptr[2];
+        const T a23 = input_ptr[3];
+        input_ptr += d1;
+        const T a30 = input_ptr[0];
+        const T a31 = input_ptr[1];
+        const T a32 = input_ptr[2];
+        const T a33 = input_ptr[3];
+
+        output[0] = a00;
+        output[1] = a10;
+        output[2] = a20;
+        output[3] = a30;
+        output += d0;
+
+        output[0] = a01;
+        output[1] = a11;
+        output[2] = a21;
+        output[3] = a31;
+        output += d0;
+
+        output[0] = a02;
+        output[1] = a12;
+        output[2] = a22;
+        output[3] = a32;
+        output += d0;
+
+        output[0] = a03;
+        output[1] = a13;
+        output[2] = a23;
+        output[3] = a33;
+        output += d0;
+
+        input += kLines;
+      }
+      if (j == d1)
+      {
+        input += kSkipSize;
+      }
+      else
       {
-        for (int q = 0; q < d1 - j; ++q)
+        for (int p = 0; p < kLines; ++p)
         {
-          *(output + q * d0 + p) = *(input + p * d1 + q);
+          for (int q = 0; q < d1 - j; ++q)
+          {
+            *(output + q * d0 + p) = *(input + p * d1 + q);
+          }
         }
+        input += (d1 - j) + kSkipSize;
       }
-      input += (d1 - j) + kSkipSize;
     }
-  }
-  for (; i < d0; ++i)
-  {
-    T *output = output_data + i;
-    for (int j = 0; j < d1; ++j)
+    for (; i < end; ++i)
     {
-      *output = *input;
-      output += d0;
-      ++input;
+      T *output = output_data + i;
+      for (int j = 0; j < d1; ++j)
+      {
+        *output = *input;
+        output += d0;
+        ++input;
+      }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(d0, d1, ruy_context, transpose_rows);
 }
 
 // TODO(alanchiao): see if we can reduce the number
 // of lines of code in branching without affecting latency.
 template <typename T>
 inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+                        const T *input_data, const Shape &, T *output_data,
+                        ruy::Context *ruy_context = nullptr)
 {
   int s2, s3;
   s2 = input_shape.Dims(1);
@@ -458,30 +471,34 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
   o_s[1] = input_shape.Dims(params.perm[1]);
   o_s[2] = input_shape.Dims(params.perm[2]);
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  // Threads are split along the outermost output dimension
+  const auto transpose_range = [&](int start, int end) {
+    for (int i1 = start; i1 < end; ++i1)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+      for (int i2 = 0; i2 < o_s[1]; ++i2)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        for (int i3 = 0; i3 < o_s[2]; ++i3)
+        {
+          const int i = i1 * p1 + i2 * p2 + i3 * p3;
+          const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
+          output_data[o] = input_data[i];
+        }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(o_s[0], o_s[1] * o_s[2], ruy_context, transpose_range);
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int dims_cnt = input_shape.DimensionsCount();
 
   int dim0, dim1;
   if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data, ruy_context);
     return;
   }
 
@@ -497,18 +514,19 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
   // Consider tradeoffs.
   if (dims_cnt == 3)
   {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
+    Transpose3D(params, input_shape, input_data, output_shape, output_data, ruy_context);
     return;
   }
 
   // Reroute to the reference version if an optimized method for the given data
   // is not available.
-  reference::Transpose(params, input_shape, input_data, output_shape, output_data);
+  reference::Transpose(params, input_shape, input_data, output_shape, output_data, ruy_context);
 }
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 4);
@@ -560,10 +578,30 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
-    for (int i = 0; i < total_size; i += non_flatten_size)
+    // Split threads along flattened dimensions if there are enough of them, otherwise split
+    // inside of each transpose
+    const int num_blocks = total_size / non_flatten_size;
+    const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+    if (num_blocks >= max_threads)
+    {
+      const auto transpose_blocks = [&](int start, int end) {
+        for (int b = start; b < end; ++b)
+        {
+          TransposeImpl(non_flatten_params, non_flatten_input_shape,
+                        input_data + b * non_flatten_size, non_flatten_output_shape,
+                        output_data + b * non_flatten_size);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(num_blocks, non_flatten_size, ruy_context,
+                                          transpose_blocks);
+    }
+    else
     {
-      TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+      for (int i = 0; i < total_size; i += non_flatten_size)
+      {
+        TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
+                      non_flatten_output_shape, output_data + i, ruy_context);
+      }
     }
     return;
   }
@@ -571,7 +609,7 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
   // Call non-flattened case.
   TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
 
-                output_data);
+                output_data, ruy_context);
 }
 
 } // namespace cker
@@ -18,20 +18,25 @@
 #ifndef __NNFW_CKER_TRANSPOSE_CONV_H__
 #define __NNFW_CKER_TRANSPOSE_CONV_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
 {
 
+// Each output row gathers the input pixels and filter taps which contribute to it, so that rows
+// are computed independently by threads and the input channels are summed over contiguous memory.
 inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
                           const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+                          const float *filter_data, const Shape &output_shape, float *output_data,
+                          ruy::Context *ruy_context = nullptr)
 {
-
   const int stride_width = params.stride_width;
   const int stride_height = params.stride_height;
   const int pad_width = params.padding_values.width;
@@ -51,58 +56,60 @@ inline void TransposeConv(const TransposeConvParams &params, const Shape &input_
   const int output_height = output_shape.Dims(1);
   const int output_width = output_shape.Dims(2);
 
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
-  {
-    output_data[i] = 0.0f;
-  }
-
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
-  {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+  // An input pixel (in_y, in_x) is scattered to (in_y * stride - pad + filter_y, ...) in the
+  // output, so an output pixel gathers the input pixels whose distance is a multiple of stride.
+  auto compute_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
       {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+        float *out = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+          out[out_channel] = 0.0f;
+
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
         {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          const int y = out_y + pad_height - filter_y;
+          if (y < 0)
+            break;
+          if (y % stride_height != 0 || y / stride_height >= input_height)
+            continue;
+          const int in_y = y / stride_height;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
           {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            const int x = out_x + pad_width - filter_x;
+            if (x < 0)
+              break;
+            if (x % stride_width != 0 || x / stride_width >= input_width)
+              continue;
+            const int in_x = x / stride_width;
+
+            const float *in = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            for (int out_channel = 0; out_channel < output_depth; ++out_channel)
             {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
-              {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                    input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value =
-                    filter_data[Offset(filter_shape, out_channel, filter_y, filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                    input_value * filter_value;
-                }
-              }
+              const float *filter =
+                filter_data + Offset(filter_shape, out_channel, filter_y, filter_x, 0);
+              float sum = 0.0f;
+              for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+                sum += in[in_channel] * filter[in_channel];
+              out[out_channel] += sum;
             }
           }
         }
       }
     }
-  }
+  };
+
+  // Each output pixel gathers about (filter_height / stride_height) * (filter_width /
+  // stride_width) input pixels
+  const int taps = std::max(1, filter_height / std::max(1, stride_height)) *
+                   std::max(1, filter_width / std::max(1, stride_width));
+  const int64_t cost_per_row =
+    static_cast<int64_t>(output_width) * output_depth * input_depth * taps;
+  cpu_backend_threadpool::ParallelFor(batches * output_height, cost_per_row, ruy_context,
+                                      compute_rows);
 }
 
 } // namespace cker
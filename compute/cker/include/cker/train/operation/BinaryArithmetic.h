@@ -42,39 +42,52 @@ void BinaryArithmeticGrad(const Shape &lhs_shape, const T *lhs_data, const Shape
                           const Shape &rhs_grad_shape, T *rhs_grad_data,
                           ArithmeticType arithmetic_type)
 {
-  if (!(lhs_shape == rhs_shape && rhs_shape == incoming_shape && incoming_shape == lhs_grad_shape &&
-        lhs_grad_shape == rhs_grad_shape))
+  // NOTE Gradient of an input is not calculated if its data is nullptr
+  if (!(lhs_shape == rhs_shape && rhs_shape == incoming_shape) ||
+      (lhs_grad_data != nullptr && !(incoming_shape == lhs_grad_shape)) ||
+      (rhs_grad_data != nullptr && !(incoming_shape == rhs_grad_shape)))
     throw std::runtime_error{"Shape of lhs, rhs, incoming, lhs_grad, and rhs_grad must match"};
 
   switch (arithmetic_type)
   {
     case ArithmeticType::kAdd:
     {
-      BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), lhs_grad_shape, lhs_grad_data);
-      BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), rhs_grad_shape, rhs_grad_data);
+      if (lhs_grad_data != nullptr)
+        BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), lhs_grad_shape, lhs_grad_data);
+      if (rhs_grad_data != nullptr)
+        BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), rhs_grad_shape, rhs_grad_data);
     }
     break;
 
     case ArithmeticType::kSub:
     {
-      BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), lhs_grad_shape, lhs_grad_data);
+      if (lhs_grad_data != nullptr)
+        BroadcastTo(incoming_shape, const_cast<T *>(incoming_data), lhs_grad_shape, lhs_grad_data);
 
-      auto const in_map = MapAsVector(incoming_data, incoming_shape);
-      auto rhs_grad_map = MapAsVector(rhs_grad_data, rhs_grad_shape);
-      rhs_grad_map = -in_map;
+      if (rhs_grad_data != nullptr)
+      {
+        auto const in_map = MapAsVector(incoming_data, incoming_shape);
+        auto rhs_grad_map = MapAsVector(rhs_grad_data, rhs_grad_shape);
+        rhs_grad_map = -in_map;
+      }
     }
     break;
 
     case ArithmeticType::kMul:
     {
       auto const in_map = MapAsVector(incoming_data, incoming_shape);
-      auto const lhs_map = MapAsVector(lhs_data, lhs_shape);
-      auto const rhs_map = MapAsVector(rhs_data, rhs_shape);
-      auto lhs_grad_map = MapAsVector(lhs_grad_data, lhs_grad_shape);
-      auto rhs_grad_map = MapAsVector(rhs_grad_data, rhs_grad_shape);
-
-      lhs_grad_map = in_map.array() * rhs_map.array();
-      rhs_grad_map = in_map.array() * lhs_map.array();
+      if (lhs_grad_data != nullptr)
+      {
+        auto const rhs_map = MapAsVector(rhs_data, rhs_shape);
+        auto lhs_grad_map = MapAsVector(lhs_grad_data, lhs_grad_shape);
+        lhs_grad_map = in_map.array() * rhs_map.array();
+      }
+      if (rhs_grad_data != nullptr)
+      {
+        auto const lhs_map = MapAsVector(lhs_data, lhs_shape);
+        auto rhs_grad_map = MapAsVector(rhs_grad_data, rhs_grad_shape);
+        rhs_grad_map = in_map.array() * lhs_map.array();
+      }
     }
     break;
 
@@ -20,7 +20,9 @@
 
 #include "cker/eigen/training_ops.h"
 #include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/MultiTensor.h"
 
+#include <cmath>
 #include <vector>
 
 namespace nnfw
@@ -94,6 +96,55 @@ inline void Adam(const Shape &trainable_shape, float *trainable_data, const Shap
     use_nesterov);
 }
 
+// Buffers of a trainable tensor updated by MultiTensorAdam
+struct AdamBuffers
+{
+  float *trainable;
+  const float *grad;
+  float *m;
+  float *v;
+  int64_t size;
+};
+
+/**
+ * @brief Apply Adam to all trainable tensors at once
+ *
+ * Tensors are treated as a flat view of parameters split into chunks, so that small tensors do
+ * not pay for dispatching threads one by one. m, v and trainable of a chunk are updated while the
+ * chunk is in cache.
+ */
+inline void MultiTensorAdam(const MultiTensor<AdamBuffers> &tensors, float beta1_power,
+                            float beta2_power, float learning_rate, float beta1, float beta2,
+                            float epsilon, bool use_nesterov)
+{
+  using UnalignedTensor = TTypes<float>::UnalignedTensor;
+  using UnalignedConstTensor = TTypes<float>::UnalignedConstTensor;
+
+  const float alpha = learning_rate * std::sqrt(1.0f - beta2_power) / (1.0f - beta1_power);
+
+  // Input data: var, v, m, grad.
+  // Output data: var, v, m.
+  const Eigen::TensorOpCost cost(sizeof(float) * 4, sizeof(float) * 3,
+                                 Eigen::TensorOpCost::AddCost<float>() * 10 +
+                                   Eigen::TensorOpCost::MulCost<float>() * 6 +
+                                   Eigen::TensorOpCost::DivCost<float>());
+
+  applyMultiTensor(tensors.chunks, cost, [&](const MultiTensorChunk &chunk) {
+    const auto &tensor = tensors.tensors[chunk.tensor];
+    auto var = UnalignedTensor(tensor.trainable + chunk.offset, chunk.size);
+    auto m = UnalignedTensor(tensor.m + chunk.offset, chunk.size);
+    auto v = UnalignedTensor(tensor.v + chunk.offset, chunk.size);
+    auto g = UnalignedConstTensor(tensor.grad + chunk.offset, chunk.size);
+
+    m += (g - m) * (1.0f - beta1);
+    v += (g.square() - v) * (1.0f - beta2);
+    if (use_nesterov)
+      var -= ((g * (1.0f - beta1) + beta1 * m) * alpha) / (v.sqrt() + epsilon);
+    else
+      var -= (m * alpha) / (v.sqrt() + epsilon);
+  });
+}
+
 } // namespace train
 } // namespace cker
 } // namespace nnfw
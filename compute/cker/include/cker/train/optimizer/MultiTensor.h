@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_H__
+#define __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_H__
+
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+// A contiguous part of a tensor updated by a thread at once
+struct MultiTensorChunk
+{
+  uint32_t tensor;
+  int64_t offset;
+  int64_t size;
+};
+
+// Number of elements in a chunk. Buffers of a chunk stay in cache while all variables of an
+// optimizer are updated, so each buffer is read from memory only once.
+constexpr int64_t kMultiTensorChunkSize = 4096;
+
+/**
+ * @brief Split tensors into chunks so that a flat view of all tensors is shared by threads
+ * @param tensors Buffers of each tensor, which have the number of elements as size
+ */
+template <typename Buffers>
+std::vector<MultiTensorChunk> splitMultiTensor(const std::vector<Buffers> &tensors)
+{
+  std::vector<MultiTensorChunk> chunks;
+  for (uint32_t tensor = 0; tensor < tensors.size(); ++tensor)
+  {
+    const int64_t tensor_size = tensors[tensor].size;
+    for (int64_t offset = 0; offset < tensor_size; offset += kMultiTensorChunkSize)
+    {
+      const auto size = std::min(kMultiTensorChunkSize, tensor_size - offset);
+      chunks.emplace_back(MultiTensorChunk{tensor, offset, size});
+    }
+  }
+  return chunks;
+}
+
+/**
+ * @brief Flat view of tensors split into chunks
+ *
+ * Buffers and chunks do not change between training steps, so they are built once and reused by
+ * every step.
+ */
+template <typename Buffers> struct MultiTensor
+{
+  MultiTensor() = default;
+  explicit MultiTensor(std::vector<Buffers> &&buffers)
+    : tensors{std::move(buffers)}, chunks{splitMultiTensor(tensors)}
+  {
+  }
+
+  std::vector<Buffers> tensors;
+  std::vector<MultiTensorChunk> chunks;
+};
+
+/**
+ * @brief Run fn on every chunk of tensors with the thread pool of Eigen
+ * @param chunks Chunks of tensors
+ * @param cost_per_element Cost of updating an element
+ * @param fn Function called with a chunk
+ */
+template <typename Fn>
+void applyMultiTensor(const std::vector<MultiTensorChunk> &chunks,
+                      const Eigen::TensorOpCost &cost_per_element, Fn &&fn)
+{
+  if (chunks.empty())
+    return;
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(static_cast<Eigen::Index>(chunks.size()),
+                     cost_per_element * static_cast<double>(kMultiTensorChunkSize),
+                     [&](Eigen::Index begin, Eigen::Index end) {
+                       for (auto i = begin; i < end; ++i)
+                         fn(chunks[i]);
+                     });
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_H__
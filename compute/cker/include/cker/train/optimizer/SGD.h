@@ -20,6 +20,7 @@
 
 #include "cker/eigen/training_ops.h"
 #include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/MultiTensor.h"
 
 #include <vector>
 
@@ -56,6 +57,38 @@ inline void GradientDescent(const Shape &output_shape, float *output_data, const
     static_cast<const Tensor &>(grad_tensor).flat<float>());
 }
 
+// Buffers of a trainable tensor updated by MultiTensorGradientDescent
+struct GradientDescentBuffers
+{
+  float *trainable;
+  const float *grad;
+  int64_t size;
+};
+
+/**
+ * @brief Apply gradient descent to all trainable tensors at once
+ *
+ * Tensors are treated as a flat view of parameters split into chunks, so that small tensors do
+ * not pay for dispatching threads one by one.
+ */
+inline void MultiTensorGradientDescent(const MultiTensor<GradientDescentBuffers> &tensors,
+                                       float learning_rate)
+{
+  using UnalignedTensor = TTypes<float>::UnalignedTensor;
+  using UnalignedConstTensor = TTypes<float>::UnalignedConstTensor;
+
+  const Eigen::TensorOpCost cost(sizeof(float) * 2, sizeof(float),
+                                 Eigen::TensorOpCost::AddCost<float>() +
+                                   Eigen::TensorOpCost::MulCost<float>());
+
+  applyMultiTensor(tensors.chunks, cost, [&](const MultiTensorChunk &chunk) {
+    const auto &tensor = tensors.tensors[chunk.tensor];
+    auto var = UnalignedTensor(tensor.trainable + chunk.offset, chunk.size);
+    auto g = UnalignedConstTensor(tensor.grad + chunk.offset, chunk.size);
+    var -= g * learning_rate;
+  });
+}
+
 } // namespace train
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Attention.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// softmax(q * k^T * scale + mask) * v with separate passes
+std::vector<float> referenceAttention(const std::vector<float> &q, const std::vector<float> &k,
+                                      const std::vector<float> &v, const std::vector<float> &mask,
+                                      int query_len, int key_len, int depth, float scale)
+{
+  std::vector<float> out(query_len * depth, 0.f);
+  for (int i = 0; i < query_len; ++i)
+  {
+    std::vector<float> scores(key_len);
+    float max_score = -std::numeric_limits<float>::infinity();
+    for (int j = 0; j < key_len; ++j)
+    {
+      float dot = 0.f;
+      for (int d = 0; d < depth; ++d)
+        dot += q[i * depth + d] * k[j * depth + d];
+      scores[j] = dot * scale + (mask.empty() ? 0.f : mask[i * key_len + j]);
+      max_score = std::max(max_score, scores[j]);
+    }
+    float sum = 0.f;
+    for (auto &&s : scores)
+    {
+      s = std::exp(s - max_score);
+      sum += s;
+    }
+    for (int j = 0; j < key_len; ++j)
+      for (int d = 0; d < depth; ++d)
+        out[i * depth + d] += scores[j] / sum * v[j * depth + d];
+  }
+  return out;
+}
+
+std::vector<float> sequence(int size, float step)
+{
+  std::vector<float> v(size);
+  for (int i = 0; i < size; ++i)
+    v[i] = std::sin(i * step);
+  return v;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Attention)
+{
+  const int query_len = 3, key_len = 4, depth = 2;
+  const auto q = sequence(query_len * depth, 0.7f);
+  const auto k = sequence(key_len * depth, 1.3f);
+  const auto v = sequence(key_len * depth, 0.4f);
+  std::vector<float> output(query_len * depth);
+
+  AttentionParams params{0.f, false};
+  ScaledDotProductAttention(params, Shape{query_len, depth}, q.data(), Shape{key_len, depth},
+                            k.data(), Shape{key_len, depth}, v.data(), Shape{}, nullptr,
+                            Shape{query_len, depth}, output.data());
+
+  const auto expected =
+    referenceAttention(q, k, v, {}, query_len, key_len, depth, 1 / std::sqrt(2.f));
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f);
+}
+
+TEST(CKer_Operation, AttentionCausalMask)
+{
+  // The last query is aligned to the last key
+  const int query_len = 2, key_len = 3, depth = 2;
+  const auto q = sequence(query_len * depth, 0.5f);
+  const auto k = sequence(key_len * depth, 0.9f);
+  const auto v = sequence(key_len * depth, 0.3f);
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> mask{0.f, 0.f, -inf, 0.f, 0.f, 0.f};
+  std::vector<float> output(query_len * depth);
+
+  AttentionParams params{0.5f, true};
+  ScaledDotProductAttention(params, Shape{query_len, depth}, q.data(), Shape{key_len, depth},
+                            k.data(), Shape{key_len, depth}, v.data(), Shape{}, nullptr,
+                            Shape{query_len, depth}, output.data());
+
+  const auto expected = referenceAttention(q, k, v, mask, query_len, key_len, depth, 0.5f);
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f);
+}
+
+TEST(CKer_Operation, AttentionGroupedHeads)
+{
+  // 4 query heads share 2 key/value heads, and mask is broadcast to all heads
+  const int heads = 4, kv_heads = 2, query_len = 2, key_len = 3, depth = 4;
+  const auto q = sequence(heads * query_len * depth, 0.37f);
+  const auto k = sequence(kv_heads * key_len * depth, 0.71f);
+  const auto v = sequence(kv_heads * key_len * depth, 0.23f);
+  const std::vector<float> mask{0.f, -1.f, 0.f, 0.f, 0.f, -2.f};
+  std::vector<float> output(heads * query_len * depth);
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  AttentionParams params{0.f, false};
+  ScaledDotProductAttention(params, Shape{1, heads, query_len, depth}, q.data(),
+                            Shape{1, kv_heads, key_len, depth}, k.data(),
+                            Shape{1, kv_heads, key_len, depth}, v.data(), Shape{query_len, key_len},
+                            mask.data(), Shape{1, heads, query_len, depth}, output.data(), &ctx);
+
+  for (int h = 0; h < heads; ++h)
+  {
+    const int kv = h / 2;
+    std::vector<float> q_h(q.begin() + h * query_len * depth,
+                           q.begin() + (h + 1) * query_len * depth);
+    std::vector<float> k_h(k.begin() + kv * key_len * depth,
+                           k.begin() + (kv + 1) * key_len * depth);
+    std::vector<float> v_h(v.begin() + kv * key_len * depth,
+                           v.begin() + (kv + 1) * key_len * depth);
+    const auto expected = referenceAttention(q_h, k_h, v_h, mask, query_len, key_len, depth, 0.5f);
+    for (int i = 0; i < query_len * depth; ++i)
+      EXPECT_NEAR(output[h * query_len * depth + i], expected[i], 1e-5f);
+  }
+}
+
+TEST(CKer_Operation, AttentionMultipleBlocks)
+{
+  // Queries and keys span several blocks, and the last blocks are partial
+  const int query_len = 70, key_len = 150, depth = 8;
+  const auto q = sequence(query_len * depth, 0.37f);
+  const auto k = sequence(key_len * depth, 0.71f);
+  const auto v = sequence(key_len * depth, 0.23f);
+  std::vector<float> mask(query_len * key_len);
+  for (int i = 0; i < query_len; ++i)
+    for (int j = 0; j < key_len; ++j)
+      mask[i * key_len + j] = std::cos(i * 0.3f + j * 0.11f);
+  std::vector<float> output(query_len * depth);
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  AttentionParams params{0.f, true};
+  ScaledDotProductAttention(params, Shape{query_len, depth}, q.data(), Shape{key_len, depth},
+                            k.data(), Shape{key_len, depth}, v.data(), Shape{query_len, key_len},
+                            mask.data(), Shape{query_len, depth}, output.data(), &ctx);
+
+  // Causal attention masks keys after the query, aligning the last query to the last key
+  auto causal_mask = mask;
+  for (int i = 0; i < query_len; ++i)
+    for (int j = i + key_len - query_len + 1; j < key_len; ++j)
+      causal_mask[i * key_len + j] = -std::numeric_limits<float>::infinity();
+  const auto expected =
+    referenceAttention(q, k, v, causal_mask, query_len, key_len, depth, 1 / std::sqrt(8.f));
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f);
+}
+
+TEST(CKer_Operation, neg_Attention)
+{
+  std::vector<float> data(24);
+
+  // Query heads are not a multiple of key heads
+  EXPECT_ANY_THROW(ScaledDotProductAttention(
+    AttentionParams{0.f, false}, Shape{1, 3, 2, 2}, data.data(), Shape{1, 2, 2, 2}, data.data(),
+    Shape{1, 2, 2, 2}, data.data(), Shape{}, nullptr, Shape{1, 3, 2, 2}, data.data()));
+
+  // Mask is not broadcastable
+  EXPECT_ANY_THROW(ScaledDotProductAttention(
+    AttentionParams{0.f, false}, Shape{2, 2}, data.data(), Shape{3, 2}, data.data(), Shape{3, 2},
+    data.data(), Shape{2, 2}, data.data(), Shape{2, 2}, data.data()));
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Gelu.h>
+#include <cker/operation/InstanceNorm.h>
+#include <cker/operation/LayerNorm.h>
+#include <cker/operation/LocalResponseNormalization.h>
+#include <cker/operation/RmsNorm.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, LayerNorm)
+{
+  const std::vector<float> input{1.f, 2.f, 3.f, 4.f, -1.f, 0.f, 1.f, 2.f};
+  const std::vector<float> gamma{1.f, 2.f, 1.f, 0.5f};
+  const std::vector<float> beta{0.f, 1.f, 0.f, -1.f};
+  std::vector<float> output(input.size());
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  nnfw::cker::LayerNorm(nnfw::cker::LayerNormParams{1e-5f}, nnfw::cker::Shape{2, 4}, input.data(),
+                        nnfw::cker::Shape{4}, gamma.data(), nnfw::cker::Shape{4}, beta.data(),
+                        nnfw::cker::Shape{2, 4}, output.data(), &ctx);
+
+  // Both rows have variance 1.25
+  const float inv_std = 1.f / std::sqrt(1.25f + 1e-5f);
+  const std::vector<float> normalized{-1.5f, -0.5f, 0.5f, 1.5f};
+  for (int row = 0; row < 2; ++row)
+    for (int i = 0; i < 4; ++i)
+      EXPECT_NEAR(output[row * 4 + i], normalized[i] * inv_std * gamma[i] + beta[i], 1e-5f);
+}
+
+TEST(CKer_Operation, RmsNorm)
+{
+  const std::vector<float> input{3.f, -4.f, 0.f, 0.f, 1.f, 1.f};
+  const std::vector<float> gamma{2.f, 1.f};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::RmsNorm(nnfw::cker::RmsNormParams{0.f}, nnfw::cker::Shape{3, 2}, input.data(),
+                      nnfw::cker::Shape{2}, gamma.data(), nnfw::cker::Shape{3, 2}, output.data());
+
+  const float rms = std::sqrt(12.5f);
+  EXPECT_NEAR(output[0], 3.f / rms * 2.f, 1e-5f);
+  EXPECT_NEAR(output[1], -4.f / rms, 1e-5f);
+  // 0 / sqrt(0 + epsilon) with zero epsilon
+  EXPECT_TRUE(std::isnan(output[2]));
+  EXPECT_NEAR(output[4], 2.f, 1e-5f);
+  EXPECT_NEAR(output[5], 1.f, 1e-5f);
+}
+
+TEST(CKer_Operation, Gelu)
+{
+  const std::vector<float> input{-2.f, -0.5f, 0.f, 0.5f, 2.f};
+  std::vector<float> exact(input.size());
+  std::vector<float> approximate(input.size());
+
+  nnfw::cker::GELU(nnfw::cker::GeluParams{false}, nnfw::cker::Shape{5}, input.data(),
+                   nnfw::cker::Shape{5}, exact.data());
+  nnfw::cker::GELU(nnfw::cker::GeluParams{true}, nnfw::cker::Shape{5}, input.data(),
+                   nnfw::cker::Shape{5}, approximate.data());
+
+  const std::vector<float> expected{-0.04550026f, -0.15426877f, 0.f, 0.34573123f, 1.95449974f};
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    EXPECT_NEAR(exact[i], expected[i], 1e-5f);
+    EXPECT_NEAR(approximate[i], expected[i], 1e-3f);
+  }
+}
+
+TEST(CKer_Operation, InstanceNorm)
+{
+  // [1, 2, 2, 20]: channel c of pixel p is (p + 1) * (c + 1)
+  const int channels = 20;
+  std::vector<float> input(4 * channels);
+  for (int p = 0; p < 4; ++p)
+    for (int c = 0; c < channels; ++c)
+      input[p * channels + c] = static_cast<float>((p + 1) * (c + 1));
+  std::vector<float> gamma(channels, 2.f);
+  std::vector<float> beta(channels, 1.f);
+  std::vector<float> output(input.size());
+
+  nnfw::cker::InstanceNormParams params{0.f, -100.f, 100.f};
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  nnfw::cker::InstanceNorm(params, nnfw::cker::Shape{1, 2, 2, channels}, input.data(),
+                           nnfw::cker::Shape{channels}, gamma.data(), nnfw::cker::Shape{channels},
+                           beta.data(), nnfw::cker::Shape{1, 2, 2, channels}, output.data(), &ctx);
+
+  // Every channel normalizes {1, 2, 3, 4} * (c + 1) to the same values
+  const float inv_std = 1.f / std::sqrt(1.25f);
+  const std::vector<float> normalized{-1.5f, -0.5f, 0.5f, 1.5f};
+  for (int p = 0; p < 4; ++p)
+    for (int c = 0; c < channels; ++c)
+      EXPECT_NEAR(output[p * channels + c], normalized[p] * inv_std * 2.f + 1.f, 1e-4f);
+}
+
+TEST(CKer_Operation, LocalResponseNormalization)
+{
+  const std::vector<float> input{1.f, 2.f, 3.f, 4.f};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::LocalResponseNormalizationParams params{1, 1.f, 0.5f, 0.5f};
+  nnfw::cker::LocalResponseNormalization(params, nnfw::cker::Shape{1, 1, 1, 4}, input.data(),
+                                         nnfw::cker::Shape{1, 1, 1, 4}, output.data());
+
+  const std::vector<float> square_sums{5.f, 14.f, 29.f, 25.f};
+  for (int i = 0; i < 4; ++i)
+    EXPECT_NEAR(output[i], input[i] / std::sqrt(1.f + 0.5f * square_sums[i]), 1e-5f);
+}
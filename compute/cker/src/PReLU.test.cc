@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/PReLU.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, PReLU)
+{
+  // Per-channel alpha
+  const std::vector<float> input{-1.f, 2.f, -3.f, -4.f, 5.f, -6.f};
+  const std::vector<float> alpha{0.5f, 0.f, 2.f};
+  std::vector<float> output(input.size());
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  nnfw::cker::PReLU(nnfw::cker::Shape{1, 2, 3}, input.data(), nnfw::cker::Shape{1, 1, 3},
+                    alpha.data(), nnfw::cker::Shape{1, 2, 3}, output.data(), &ctx);
+
+  EXPECT_EQ(output, (std::vector<float>{-0.5f, 2.f, -6.f, -2.f, 5.f, -12.f}));
+}
+
+TEST(CKer_Operation, PReLU_broadcast)
+{
+  // Alpha broadcast along the last axis
+  const std::vector<float> input{-1.f, -2.f, 3.f, -4.f};
+  const std::vector<float> alpha{0.5f, 2.f};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::PReLU(nnfw::cker::Shape{2, 2}, input.data(), nnfw::cker::Shape{2, 1}, alpha.data(),
+                    nnfw::cker::Shape{2, 2}, output.data());
+
+  EXPECT_EQ(output, (std::vector<float>{-0.5f, -1.f, 3.f, -8.f}));
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Tile.h>
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> iotaVector(int size)
+{
+  std::vector<float> v(size);
+  std::iota(v.begin(), v.end(), 0.f);
+  return v;
+}
+
+} // namespace
+
+TEST(CKer_ParallelFor, coverAllIndices)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  const int size = 1000;
+  std::vector<std::atomic<int>> visited(size);
+  for (auto &&v : visited)
+    v = 0;
+
+  cpu_backend_threadpool::ParallelFor(size, cpu_backend_threadpool::kMinCostPerThread, &ctx,
+                                      [&](int start, int end) {
+                                        for (int i = start; i < end; ++i)
+                                          visited[i]++;
+                                      });
+
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(visited[i], 1);
+}
+
+TEST(CKer_ParallelFor, howManyThreads)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  // Small work runs on one thread
+  EXPECT_EQ(cpu_backend_threadpool::HowManyThreads(16, 1, &ctx), 1);
+  // Not more threads than indices
+  EXPECT_EQ(cpu_backend_threadpool::HowManyThreads(2, 1 << 20, &ctx), 2);
+  EXPECT_EQ(cpu_backend_threadpool::HowManyThreads(1024, 1 << 20, &ctx), 4);
+  EXPECT_EQ(cpu_backend_threadpool::HowManyThreads(1024, 1 << 20, nullptr), 1);
+}
+
+TEST(CKer_ParallelFor, sameResultOnThreads)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  // Transpose
+  {
+    const Shape input_shape{4, 64, 32, 32};
+    const Shape output_shape{4, 32, 32, 64};
+    const auto input = iotaVector(input_shape.FlatSize());
+    TransposeParams params;
+    params.perm_count = 4;
+    params.perm[0] = 0;
+    params.perm[1] = 3;
+    params.perm[2] = 2;
+    params.perm[3] = 1;
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Transpose(params, input_shape, input.data(), output_shape, expected.data());
+    Transpose(params, input_shape, input.data(), output_shape, actual.data(), &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // Tile
+  {
+    const Shape input_shape{8, 64, 64};
+    const Shape output_shape{16, 128, 64};
+    const auto input = iotaVector(input_shape.FlatSize());
+    const int32_t multipliers[] = {2, 2, 1};
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Tile(input_shape, input.data(), multipliers, expected.data());
+    Tile(input_shape, input.data(), multipliers, actual.data(), &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // Pad
+  {
+    const Shape input_shape{2, 64, 64, 16};
+    const Shape output_shape{4, 66, 68, 17};
+    const auto input = iotaVector(input_shape.FlatSize());
+    const int32_t padding[] = {1, 1, 1, 1, 2, 2, 0, 1};
+    const float constant = -1.f;
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Pad(padding, 4, input_shape, input.data(), output_shape, expected.data(), &constant);
+    Pad(padding, 4, input_shape, input.data(), output_shape, actual.data(), &constant, &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // Gather
+  {
+    const Shape input_shape{256, 512};
+    const Shape coords_shape{128};
+    const Shape output_shape{128, 512};
+    const auto input = iotaVector(input_shape.FlatSize());
+    std::vector<int32_t> coords(128);
+    for (int i = 0; i < 128; ++i)
+      coords[i] = (i * 7) % 256;
+    GatherParams params;
+    params.axis = 0;
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Gather(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+           expected.data());
+    Gather(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+           actual.data(), &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // StridedSlice
+  {
+    const Shape input_shape{2, 128, 128, 8};
+    const Shape output_shape{2, 64, 126, 8};
+    const auto input = iotaVector(input_shape.FlatSize());
+    StridedSliceParams params{};
+    params.start_indices_count = params.stop_indices_count = params.strides_count = 4;
+    const int16_t start[] = {0, 0, 1, 0};
+    const int16_t stop[] = {2, 128, 127, 8};
+    const int16_t strides[] = {1, 2, 1, 1};
+    for (int i = 0; i < 4; ++i)
+    {
+      params.start_indices[i] = start[i];
+      params.stop_indices[i] = stop[i];
+      params.strides[i] = strides[i];
+    }
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    StridedSlice(params, input_shape, input.data(), output_shape, expected.data());
+    StridedSlice(params, input_shape, input.data(), output_shape, actual.data(), &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // ResizeBilinear
+  {
+    const Shape input_shape{2, 32, 32, 16};
+    const Shape output_shape{2, 80, 72, 16};
+    const auto input = iotaVector(input_shape.FlatSize());
+    ResizeBilinearParams params{80, 72, false, true};
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    ResizeBilinear(params, input_shape, input.data(), output_shape, expected.data());
+    ResizeBilinear(params, input_shape, input.data(), output_shape, actual.data(), &ctx);
+    ASSERT_EQ(expected, actual);
+  }
+
+  // Reduce
+  {
+    const Shape input_shape{8, 64, 128};
+    const Shape output_shape{8, 1, 128};
+    const auto input = iotaVector(input_shape.FlatSize());
+    const std::vector<int> axes{1};
+    const auto reducer = [](const float current, const float in) -> float { return current + in; };
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> actual(output_shape.FlatSize());
+    Reduce reduce_single;
+    reduce_single.prepare(input_shape.DimensionsCount(), axes.size());
+    ASSERT_TRUE(reduce_single.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                                   expected.data(), axes, true, 0.f, reducer));
+    Reduce reduce_multi;
+    reduce_multi.prepare(input_shape.DimensionsCount(), axes.size());
+    ASSERT_TRUE(reduce_multi.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                                  actual.data(), axes, true, 0.f, reducer, &ctx));
+    ASSERT_EQ(expected, actual);
+  }
+}
+
+TEST(CKer_ParallelFor, referenceTransposeRows)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  // 3D permutation, so the reference kernel sees an extended leading dimension of 1
+  const Shape input_shape{16, 8, 24};
+  const Shape output_shape{24, 16, 8};
+  const auto input = iotaVector(input_shape.FlatSize());
+  TransposeParams params;
+  params.perm_count = 3;
+  params.perm[0] = 2;
+  params.perm[1] = 0;
+  params.perm[2] = 1;
+
+  std::vector<float> actual(output_shape.FlatSize());
+  reference::Transpose(params, input_shape, input.data(), output_shape, actual.data(), &ctx);
+
+  for (int a = 0; a < 24; ++a)
+    for (int b = 0; b < 16; ++b)
+      for (int c = 0; c < 8; ++c)
+        ASSERT_EQ(actual[(a * 16 + b) * 8 + c], input[(b * 8 + c) * 24 + a]);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/ResizeNearestNeighbor.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, ResizeNearestNeighbor)
+{
+  // 2x2 image with 2 channels resized to 3x4
+  const std::vector<float> input{1, 10, 2, 20, 3, 30, 4, 40};
+  std::vector<float> output(3 * 4 * 2);
+
+  nnfw::cker::ResizeNearestNeighborParams params{3, 4, false};
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  nnfw::cker::ResizeNearestNeighbor(params, nnfw::cker::Shape{1, 2, 2, 2}, input.data(),
+                                    nnfw::cker::Shape{1, 3, 4, 2}, output.data(), &ctx);
+
+  // Source rows {0, 0, 1}, source columns {0, 0, 1, 1}
+  const std::vector<float> expected{1, 10, 1, 10, 2, 20, 2, 20, 1, 10, 1, 10,
+                                    2, 20, 2, 20, 3, 30, 3, 30, 4, 40, 4, 40};
+  EXPECT_EQ(output, expected);
+}
+
+TEST(CKer_Operation, ResizeNearestNeighbor_alignCorners)
+{
+  const std::vector<uint8_t> input{1, 2, 3};
+  std::vector<uint8_t> output(5);
+
+  nnfw::cker::ResizeNearestNeighborParams params{1, 5, true};
+  nnfw::cker::ResizeNearestNeighbor(params, nnfw::cker::Shape{1, 1, 3, 1}, input.data(),
+                                    nnfw::cker::Shape{1, 1, 5, 1}, output.data());
+
+  // Scale is (3 - 1) / (5 - 1), and source columns are rounded
+  EXPECT_EQ(output, (std::vector<uint8_t>{1, 2, 2, 3, 3}));
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/TopKV2.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, TopKV2)
+{
+  const std::vector<float> input{1.f, 5.f, 3.f, 5.f, -2.f, 0.f, 7.f, 7.f, 7.f, 1.f};
+  std::vector<float> values(4);
+  std::vector<int32_t> indices(4);
+
+  ruy::Context ctx;
+  ctx.set_max_num_threads(2);
+  nnfw::cker::TopKV2(nnfw::cker::Shape{2, 5}, input.data(), 2, nnfw::cker::Shape{2, 2},
+                     values.data(), nnfw::cker::Shape{2, 2}, indices.data(), &ctx);
+
+  // The smaller index comes first among equal values
+  EXPECT_EQ(values, (std::vector<float>{5.f, 5.f, 7.f, 7.f}));
+  EXPECT_EQ(indices, (std::vector<int32_t>{1, 3, 1, 2}));
+}
+
+TEST(CKer_Operation, TopKV2_int)
+{
+  const std::vector<int32_t> input{4, -1, 9, 2};
+  std::vector<int32_t> values(4);
+  std::vector<int32_t> indices(4);
+
+  nnfw::cker::TopKV2(nnfw::cker::Shape{4}, input.data(), 4, nnfw::cker::Shape{4}, values.data(),
+                     nnfw::cker::Shape{4}, indices.data());
+
+  EXPECT_EQ(values, (std::vector<int32_t>{9, 4, 2, -1}));
+  EXPECT_EQ(indices, (std::vector<int32_t>{2, 0, 3, 1}));
+}
+
+TEST(CKer_Operation, neg_TopKV2)
+{
+  const std::vector<float> input{1.f, 2.f};
+  std::vector<float> values(3);
+  std::vector<int32_t> indices(3);
+
+  EXPECT_ANY_THROW(nnfw::cker::TopKV2(nnfw::cker::Shape{2}, input.data(), 3,
+                                      nnfw::cker::Shape{3}, values.data(), nnfw::cker::Shape{3},
+                                      indices.data()));
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+// Scatter each input element to the outputs it influences
+std::vector<float> referenceTransposeConv(const nnfw::cker::TransposeConvParams &params,
+                                          const nnfw::cker::Shape &input_shape,
+                                          const std::vector<float> &input,
+                                          const nnfw::cker::Shape &filter_shape,
+                                          const std::vector<float> &filter,
+                                          const nnfw::cker::Shape &output_shape)
+{
+  std::vector<float> output(output_shape.FlatSize(), 0.f);
+  for (int b = 0; b < input_shape.Dims(0); ++b)
+    for (int iy = 0; iy < input_shape.Dims(1); ++iy)
+      for (int ix = 0; ix < input_shape.Dims(2); ++ix)
+        for (int ic = 0; ic < input_shape.Dims(3); ++ic)
+          for (int fy = 0; fy < filter_shape.Dims(1); ++fy)
+            for (int fx = 0; fx < filter_shape.Dims(2); ++fx)
+              for (int oc = 0; oc < filter_shape.Dims(0); ++oc)
+              {
+                const int oy = iy * params.stride_height - params.padding_values.height + fy;
+                const int ox = ix * params.stride_width - params.padding_values.width + fx;
+                if (oy < 0 || oy >= output_shape.Dims(1) || ox < 0 || ox >= output_shape.Dims(2))
+                  continue;
+                output[nnfw::cker::Offset(output_shape, b, oy, ox, oc)] +=
+                  input[nnfw::cker::Offset(input_shape, b, iy, ix, ic)] *
+                  filter[nnfw::cker::Offset(filter_shape, oc, fy, fx, ic)];
+              }
+  return output;
+}
+
+void verifyTransposeConv(int stride, int pad, int filter_size)
+{
+  nnfw::cker::TransposeConvParams params{};
+  params.stride_height = stride;
+  params.stride_width = stride;
+  params.padding_values.height = pad;
+  params.padding_values.width = pad;
+
+  const nnfw::cker::Shape input_shape{2, 3, 4, 3};
+  const nnfw::cker::Shape filter_shape{5, filter_size, filter_size, 3};
+  const int output_height = (3 - 1) * stride + filter_size - 2 * pad;
+  const int output_width = (4 - 1) * stride + filter_size - 2 * pad;
+  const nnfw::cker::Shape output_shape{2, output_height, output_width, 5};
+
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 7) - 3.f;
+  std::vector<float> filter(filter_shape.FlatSize());
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = static_cast<float>(i % 5) * 0.5f - 1.f;
+
+  const auto expected =
+    referenceTransposeConv(params, input_shape, input, filter_shape, filter, output_shape);
+
+  std::vector<float> output(output_shape.FlatSize(), 100.f);
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+  nnfw::cker::TransposeConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                            output_shape, output.data(), &ctx);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConv)
+{
+  verifyTransposeConv(1, 0, 3);
+  verifyTransposeConv(2, 0, 3);
+  verifyTransposeConv(2, 1, 3);
+  verifyTransposeConv(3, 1, 2);
+}
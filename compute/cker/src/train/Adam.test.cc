@@ -151,6 +151,78 @@ TEST(CKer_Optimizer, AdamSteps1e5)
   }
 }
 
+TEST(CKer_Optimizer, MultiTensorAdam)
+{
+  // Sizes across chunk boundaries
+  const std::vector<int> sizes{1, 7, 4096, 10000};
+  for (bool use_nesterov : {false, true})
+  {
+    std::vector<std::vector<float>> trainables, gradients, ms, vs;
+    for (const auto size : sizes)
+    {
+      std::vector<float> trainable(size), gradient(size);
+      for (int i = 0; i < size; ++i)
+      {
+        trainable[i] = static_cast<float>(i % 17) - 8.0f;
+        gradient[i] = static_cast<float>(i % 13) * 0.1f - 0.6f;
+      }
+      trainables.emplace_back(trainable);
+      gradients.emplace_back(gradient);
+      ms.emplace_back(size, 0.f);
+      vs.emplace_back(size, 0.f);
+    }
+    auto expected_trainables = trainables;
+    auto expected_ms = ms;
+    auto expected_vs = vs;
+
+    // Buffers are built once and reused by every step
+    std::vector<nnfw::cker::train::AdamBuffers> buffers;
+    for (size_t t = 0; t < sizes.size(); ++t)
+    {
+      buffers.emplace_back(nnfw::cker::train::AdamBuffers{
+        trainables[t].data(), gradients[t].data(), ms[t].data(), vs[t].data(), sizes[t]});
+    }
+    const nnfw::cker::train::MultiTensor<nnfw::cker::train::AdamBuffers> tensors{
+      std::move(buffers)};
+
+    const float lr = 0.001;
+    const float beta1 = 0.9;
+    const float beta2 = 0.999;
+    const float epsilon = 1e-07;
+    for (uint32_t step = 0; step < 3; ++step)
+    {
+      const float beta1_power = std::pow(beta1, step + 1);
+      const float beta2_power = std::pow(beta2, step + 1);
+
+      for (size_t t = 0; t < sizes.size(); ++t)
+      {
+        const nnfw::cker::Shape shape{sizes[t]};
+        nnfw::cker::train::Adam(shape, expected_trainables[t].data(), shape, gradients[t].data(),
+                                shape, expected_ms[t].data(), shape, expected_vs[t].data(),
+                                beta1_power, beta2_power, lr, beta1, beta2, epsilon, use_nesterov);
+      }
+      nnfw::cker::train::MultiTensorAdam(tensors, beta1_power, beta2_power, lr, beta1, beta2,
+                                         epsilon, use_nesterov);
+
+      for (size_t t = 0; t < sizes.size(); ++t)
+      {
+        for (int i = 0; i < sizes[t]; ++i)
+        {
+          EXPECT_NEAR(trainables[t][i], expected_trainables[t][i], 1e-5f);
+          EXPECT_NEAR(ms[t][i], expected_ms[t][i], 1e-5f);
+          EXPECT_NEAR(vs[t][i], expected_vs[t][i], 1e-5f);
+        }
+      }
+    }
+  }
+}
+
+TEST(CKer_Optimizer, MultiTensorAdamEmpty)
+{
+  EXPECT_NO_THROW(
+    nnfw::cker::train::MultiTensorAdam({}, 0.9f, 0.999f, 0.001f, 0.9f, 0.999f, 1e-07f, false));
+}
+
 TEST(CKer_Optimizer, neg_AdamUnmatchedGradientShape)
 {
   // Unmatched shape
@@ -217,6 +217,29 @@ TEST(CKer_Operation, MulGrad)
   }
 }
 
+TEST(CKer_Operation, MulGradWithoutLhsGrad)
+{
+  // Shape: {2, 3}
+  std::vector<float> lhs = {-8, 9, -10, 11, -12, 13};
+  std::vector<float> rhs = {-14, 15, -16, 17, -18, 19};
+  std::vector<float> incoming_backward = {-2, 3, -4, 5, -6, 7};
+  std::vector<float> expected_rhs_backward(6);
+  std::vector<float> rhs_backward(6);
+
+  for (uint32_t i = 0; i < 6; ++i)
+    expected_rhs_backward[i] = incoming_backward[i] * lhs[i];
+
+  // Gradient of lhs is not calculated
+  float *lhs_backward = nullptr;
+  nnfw::cker::train::BinaryArithmeticGrad(
+    nnfw::cker::Shape{2, 3}, lhs.data(), nnfw::cker::Shape{2, 3}, rhs.data(),
+    nnfw::cker::Shape{2, 3}, incoming_backward.data(), nnfw::cker::Shape{}, lhs_backward,
+    nnfw::cker::Shape{2, 3}, rhs_backward.data(), nnfw::cker::train::ArithmeticType::kMul);
+
+  for (size_t i = 0; i < rhs_backward.size(); ++i)
+    EXPECT_FLOAT_EQ(rhs_backward[i], expected_rhs_backward[i]);
+}
+
 TEST(CKer_Operation, neg_BinaryArithmeticDistinctShape)
 {
   {
@@ -86,6 +86,47 @@ TEST(CKer_Optimizer, SGDSimple)
   }
 }
 
+TEST(CKer_Optimizer, MultiTensorSGD)
+{
+  // Sizes across chunk boundaries
+  const std::vector<int> sizes{1, 7, 4096, 10000};
+  std::vector<std::vector<float>> trainables, gradients;
+  for (const auto size : sizes)
+  {
+    std::vector<float> trainable(size), gradient(size);
+    for (int i = 0; i < size; ++i)
+    {
+      trainable[i] = static_cast<float>(i % 17) - 8.0f;
+      gradient[i] = static_cast<float>(i % 13) * 0.1f - 0.6f;
+    }
+    trainables.emplace_back(trainable);
+    gradients.emplace_back(gradient);
+  }
+  auto expected_trainables = trainables;
+
+  const float lr = 0.001;
+  std::vector<nnfw::cker::train::GradientDescentBuffers> buffers;
+  for (size_t t = 0; t < sizes.size(); ++t)
+  {
+    const nnfw::cker::Shape shape{sizes[t]};
+    nnfw::cker::train::GradientDescent(shape, expected_trainables[t].data(), shape,
+                                       gradients[t].data(), lr);
+    buffers.emplace_back(nnfw::cker::train::GradientDescentBuffers{
+      trainables[t].data(), gradients[t].data(), sizes[t]});
+  }
+  const nnfw::cker::train::MultiTensor<nnfw::cker::train::GradientDescentBuffers> tensors{
+    std::move(buffers)};
+  // 1 + 1 + 1 + 3 chunks of kMultiTensorChunkSize
+  EXPECT_EQ(tensors.chunks.size(), 6u);
+  nnfw::cker::train::MultiTensorGradientDescent(tensors, lr);
+
+  for (size_t t = 0; t < sizes.size(); ++t)
+  {
+    for (int i = 0; i < sizes[t]; ++i)
+      EXPECT_NEAR(trainables[t][i], expected_trainables[t][i], 1e-5f);
+  }
+}
+
 TEST(CKer_Optimizer, neg_SGDUnmatchedGradientShape)
 {
   // Unmatched shape
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Executor benchmark on a branchy graph
+ *
+ * Compares executors which run independent operations in parallel. The graph has BRANCHES
+ * chains of DEPTH elementwise Add operations, and the chains are summed into one output.
+ * Operations are assigned to backends by the usual configuration (e.g. BACKENDS, OP_BACKEND_MAP
+ * environment variables), so use several backends to see parallel execution.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/BinaryArithmetic.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BRANCHES, 8);
+NONIUS_PARAM(DEPTH, 16);
+NONIUS_PARAM(LEN, 4096);
+
+//
+// Helpers
+//
+namespace
+{
+
+using namespace onert::ir;
+
+OperandIndex addAdd(Graph &graph, const OperandIndex &lhs, const OperandIndex &rhs,
+                    const Shape &shape)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+
+  auto result = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{result}, param));
+  return result;
+}
+
+class BranchyModel
+{
+public:
+  BranchyModel(const std::string &executor, int branches, int depth, int len)
+  {
+    Shape shape{1, len};
+    auto graph = std::make_shared<Graph>();
+
+    auto input = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+    auto constant = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+    std::vector<float> const_data(len, 1.0f);
+    graph->operands().at(constant).data(std::make_unique<CachedData>(
+      reinterpret_cast<const uint8_t *>(const_data.data()), len * sizeof(float)));
+
+    std::vector<OperandIndex> tails;
+    for (int b = 0; b < branches; ++b)
+    {
+      auto tail = input;
+      for (int d = 0; d < depth; ++d)
+        tail = addAdd(*graph, tail, constant, shape);
+      tails.emplace_back(tail);
+    }
+
+    auto output = tails.front();
+    for (size_t b = 1; b < tails.size(); ++b)
+      output = addAdd(*graph, output, tails[b], shape);
+
+    graph->addInput(input);
+    graph->addOutput(output);
+    graph->verify();
+
+    auto model = std::make_shared<Model>();
+    model->push(SubgraphIndex{0}, graph);
+    auto coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+    coptions->executor = executor;
+    onert::compiler::Compiler compiler{model, *coptions};
+    _artifact = compiler.compile();
+  }
+
+  const std::shared_ptr<onert::exec::IExecutors> &executors() const
+  {
+    return _artifact->_executors;
+  }
+
+private:
+  std::shared_ptr<onert::compiler::CompilerArtifact> _artifact;
+};
+
+void run(nonius::chronometer meter, const std::string &executor)
+{
+  auto len = meter.param<LEN>();
+  BranchyModel model{executor, meter.param<BRANCHES>(), meter.param<DEPTH>(), len};
+
+  std::vector<float> input(len);
+  std::vector<float> output(len);
+
+  onert::exec::Execution execution{model.executors()};
+  execution.setInput(IOIndex{0}, input.data(), len * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), len * sizeof(float));
+
+  meter.measure([&](int) {
+    // Run!
+    execution.execute();
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Executor(Parallel)", [](nonius::chronometer meter) { run(meter, "Parallel"); })
+
+NONIUS_BENCHMARK("Executor(WorkStealing)",
+                 [](nonius::chronometer meter) { run(meter, "WorkStealing"); })
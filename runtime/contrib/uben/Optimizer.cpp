@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Optimizer benchmark
+ *
+ * Compares applying Adam and SGD to TENSORS trainable tensors one by one with applying them to
+ * all tensors at once through a flat view of chunks. Tensors have MIN_LEN ~ MAX_LEN elements, and
+ * the flat view is built once before measuring as the train backend does at configure time.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/train/optimizer/Adam.h>
+#include <cker/train/optimizer/SGD.h>
+
+#include <cmath>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(TENSORS, 300);
+NONIUS_PARAM(MIN_LEN, 64);
+NONIUS_PARAM(MAX_LEN, 575);
+
+//
+// Helpers
+//
+namespace
+{
+
+constexpr float LR = 0.001f;
+constexpr float BETA1 = 0.9f;
+constexpr float BETA2 = 0.999f;
+constexpr float EPSILON = 1e-07f;
+
+struct Variables
+{
+  Variables(int tensors, int min_len, int max_len)
+  {
+    const int range = max_len - min_len + 1;
+    for (int t = 0; t < tensors; ++t)
+    {
+      // Spread sizes over [min_len, max_len]
+      const int len = min_len + (t * 97) % range;
+      trainables.emplace_back(len, 1.0f);
+      grads.emplace_back(len, 0.1f);
+      ms.emplace_back(len, 0.0f);
+      vs.emplace_back(len, 0.0f);
+    }
+  }
+
+  std::vector<std::vector<float>> trainables;
+  std::vector<std::vector<float>> grads;
+  std::vector<std::vector<float>> ms;
+  std::vector<std::vector<float>> vs;
+};
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("PerTensor(Adam)", [](nonius::chronometer meter) {
+  Variables vars{meter.param<TENSORS>(), meter.param<MIN_LEN>(), meter.param<MAX_LEN>()};
+
+  meter.measure([&](int i) {
+    const float beta1_power = std::pow(BETA1, i + 1);
+    const float beta2_power = std::pow(BETA2, i + 1);
+    for (size_t t = 0; t < vars.trainables.size(); ++t)
+    {
+      const nnfw::cker::Shape shape{static_cast<int>(vars.trainables[t].size())};
+      nnfw::cker::train::Adam(shape, vars.trainables[t].data(), shape, vars.grads[t].data(), shape,
+                              vars.ms[t].data(), shape, vars.vs[t].data(), beta1_power,
+                              beta2_power, LR, BETA1, BETA2, EPSILON, false);
+    }
+  });
+})
+
+NONIUS_BENCHMARK("MultiTensor(Adam)", [](nonius::chronometer meter) {
+  Variables vars{meter.param<TENSORS>(), meter.param<MIN_LEN>(), meter.param<MAX_LEN>()};
+
+  std::vector<nnfw::cker::train::AdamBuffers> buffers;
+  for (size_t t = 0; t < vars.trainables.size(); ++t)
+  {
+    buffers.emplace_back(nnfw::cker::train::AdamBuffers{
+      vars.trainables[t].data(), vars.grads[t].data(), vars.ms[t].data(), vars.vs[t].data(),
+      static_cast<int64_t>(vars.trainables[t].size())});
+  }
+  const nnfw::cker::train::MultiTensor<nnfw::cker::train::AdamBuffers> tensors{std::move(buffers)};
+
+  meter.measure([&](int i) {
+    const float beta1_power = std::pow(BETA1, i + 1);
+    const float beta2_power = std::pow(BETA2, i + 1);
+    nnfw::cker::train::MultiTensorAdam(tensors, beta1_power, beta2_power, LR, BETA1, BETA2,
+                                       EPSILON, false);
+  });
+})
+
+NONIUS_BENCHMARK("PerTensor(SGD)", [](nonius::chronometer meter) {
+  Variables vars{meter.param<TENSORS>(), meter.param<MIN_LEN>(), meter.param<MAX_LEN>()};
+
+  meter.measure([&](int) {
+    for (size_t t = 0; t < vars.trainables.size(); ++t)
+    {
+      const nnfw::cker::Shape shape{static_cast<int>(vars.trainables[t].size())};
+      nnfw::cker::train::GradientDescent(shape, vars.trainables[t].data(), shape,
+                                         vars.grads[t].data(), LR);
+    }
+  });
+})
+
+NONIUS_BENCHMARK("MultiTensor(SGD)", [](nonius::chronometer meter) {
+  Variables vars{meter.param<TENSORS>(), meter.param<MIN_LEN>(), meter.param<MAX_LEN>()};
+
+  std::vector<nnfw::cker::train::GradientDescentBuffers> buffers;
+  for (size_t t = 0; t < vars.trainables.size(); ++t)
+  {
+    buffers.emplace_back(nnfw::cker::train::GradientDescentBuffers{
+      vars.trainables[t].data(), vars.grads[t].data(),
+      static_cast<int64_t>(vars.trainables[t].size())});
+  }
+  const nnfw::cker::train::MultiTensor<nnfw::cker::train::GradientDescentBuffers> tensors{
+    std::move(buffers)};
+
+  meter.measure([&](int) { nnfw::cker::train::MultiTensorGradientDescent(tensors, LR); });
+})
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Pipeline execution benchmark on a multi-model package
+ *
+ * Compares running requests one by one through all models of a 3-model package with streaming
+ * them through PipelineExecution, where each model runs on its own worker. Each model has a chain
+ * of DEPTH elementwise Add operations on LEN elements, and REQUESTS requests are run per sample.
+ * With balanced stages, pipelined throughput is expected to approach 3x of sequential one.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/CompilerFactory.h>
+#include <exec/Execution.h>
+#include <exec/PipelineExecution.h>
+#include <ir/Graph.h>
+#include <ir/NNPkg.h>
+#include <ir/operation/BinaryArithmetic.h>
+
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(DEPTH, 16);
+NONIUS_PARAM(LEN, 4096);
+NONIUS_PARAM(REQUESTS, 32);
+
+//
+// Helpers
+//
+namespace
+{
+
+using namespace onert::ir;
+
+constexpr uint16_t STAGES = 3;
+
+std::shared_ptr<Graph> createChain(int depth, int len)
+{
+  Shape shape{1, len};
+  auto graph = std::make_shared<Graph>();
+
+  auto input = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+  auto constant = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+  std::vector<float> const_data(len, 1.0f);
+  graph->operands().at(constant).data(std::make_unique<CachedData>(
+    reinterpret_cast<const uint8_t *>(const_data.data()), len * sizeof(float)));
+
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+
+  auto tail = input;
+  for (int d = 0; d < depth; ++d)
+  {
+    auto result = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{tail, constant}, OperandIndexSequence{result}, param));
+    tail = result;
+  }
+
+  graph->addInput(input);
+  graph->addOutput(tail);
+  graph->verify();
+  return graph;
+}
+
+class ChainPackage
+{
+public:
+  ChainPackage(int depth, int len)
+  {
+    auto nnpkg = std::make_shared<NNPkg>();
+    std::vector<std::unique_ptr<onert::compiler::CompilerOptions>> coptions;
+    for (uint16_t i = 0; i < STAGES; ++i)
+    {
+      auto model = std::make_shared<Model>();
+      model->push(SubgraphIndex{0}, createChain(depth, len));
+      nnpkg->push(ModelIndex{i}, model);
+      coptions.emplace_back(onert::compiler::CompilerOptions::fromGlobalConfig());
+      if (i > 0)
+        nnpkg->addEdge(IODesc{ModelIndex{static_cast<uint16_t>(i - 1)}, SubgraphIndex{0},
+                              IOIndex{0}},
+                       IODesc{ModelIndex{i}, SubgraphIndex{0}, IOIndex{0}});
+    }
+    nnpkg->addInput(IODesc{ModelIndex{0}, SubgraphIndex{0}, IOIndex{0}});
+    nnpkg->addOutput(IODesc{ModelIndex{STAGES - 1}, SubgraphIndex{0}, IOIndex{0}});
+
+    auto compiler = onert::compiler::CompilerFactory::get().create(nnpkg, coptions);
+    _artifact = compiler->compile();
+  }
+
+  const std::shared_ptr<onert::exec::IExecutors> &executors() const
+  {
+    return _artifact->_executors;
+  }
+
+private:
+  std::shared_ptr<onert::compiler::CompilerArtifact> _artifact;
+};
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Sequential", [](nonius::chronometer meter) {
+  auto len = meter.param<LEN>();
+  auto requests = meter.param<REQUESTS>();
+  ChainPackage package{meter.param<DEPTH>(), len};
+
+  std::vector<float> input(len);
+  std::vector<float> output(len);
+
+  onert::exec::Execution execution{package.executors()};
+  execution.setInput(IOIndex{0}, input.data(), len * sizeof(float));
+  execution.setOutput(IOIndex{0}, output.data(), len * sizeof(float));
+
+  meter.measure([&](int) {
+    for (int n = 0; n < requests; ++n)
+      execution.execute();
+  });
+})
+
+NONIUS_BENCHMARK("Pipeline", [](nonius::chronometer meter) {
+  auto len = meter.param<LEN>();
+  auto requests = meter.param<REQUESTS>();
+  ChainPackage package{meter.param<DEPTH>(), len};
+
+  std::vector<float> input(len);
+  const size_t size = len * sizeof(float);
+
+  onert::exec::PipelineExecution pipeline{package.executors(), 2};
+
+  meter.measure([&](int) {
+    // Push on another thread as queues are bounded
+    std::thread pusher{[&]() {
+      for (int n = 0; n < requests; ++n)
+        pipeline.push({input.data()}, {size});
+    }};
+
+    std::vector<void *> outputs;
+    for (int n = 0; n < requests; ++n)
+    {
+      pipeline.pop(outputs);
+      for (auto &&output : outputs)
+        std::free(output);
+      outputs.clear();
+    }
+    pusher.join();
+  });
+})
@@ -116,9 +116,67 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
  */
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
+/**
+ * @brief Callback to be called when asynchronous inference is finished
+ *
+ * It is called on one of the runtime's asynchronous worker threads. Session functions must not be
+ * called in the callback, as the session is still running until the callback returns.
+ *
+ * @param[in] session   The session which finished the inference
+ * @param[in] status    @c NNFW_STATUS_NO_ERROR if the inference was successful
+ * @param[in] user_data User data given to {@link nnfw_run_async_cb}
+ */
+typedef void (*nnfw_run_callback)(nnfw_session *session, NNFW_STATUS status, void *user_data);
+
+/**
+ * @brief     Run inference asynchronously with completion callback
+ *
+ * It works like {@link nnfw_run_async}, and \p callback is called when the inference is finished.
+ * {@link nnfw_await} must be still called to get the session back to finished state, but it
+ * returns without waiting when called after \p callback.
+ *
+ * @param[in] session   The session to run inference
+ * @param[in] callback  Function to be called when inference is finished (nullable)
+ * @param[in] user_data User data to be passed to \p callback
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_async_cb(nnfw_session *session, nnfw_run_callback callback, void *user_data);
+
+/**
+ * @brief     Check whether asynchronous inference is finished without waiting
+ *
+ * This function must be called after {@link nnfw_run_async} or {@link nnfw_run_async_cb}.
+ * If \p finished is true, {@link nnfw_await} returns without waiting.
+ *
+ * @param[in]  session  The session running inference
+ * @param[out] finished @c true if the inference is finished
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_poll(nnfw_session *session, bool *finished);
+
+/**
+ * @brief Create a new session which shares the compiled model of a prepared session
+ *
+ * The new session is created in prepared state. It has its own input and output setting,
+ * so {@link nnfw_run} can be called on each session from different threads.
+ *
+ * Runs on sessions sharing one compiled model are serialized unless the model was prepared
+ * with several execution contexts. Set "EXECUTION_CONTEXTS" to N by {@link nnfw_set_config}
+ * before {@link nnfw_prepare}, then up to N runs are executed in parallel. Each execution
+ * context has its own activation memory, and constant data is shared by all contexts.
+ *
+ * @param[in]  prepared The session which is prepared for inference
+ * @param[out] session  The session to be created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_shared_session(nnfw_session *prepared, nnfw_session **session);
+
 /*
- * Prepare session to be ready for inference
- * This phase may finalize model compilation, scheduling, and additional settings.
+ * Prepare session to be ready for pipelined inference
+ * This phase compiles models and starts one worker for each model of package. Models are
+ * connected by bounded queues whose size is PIPELINE_QUEUE_SIZE configuration, and tensors
+ * between models are passed to next model without copy.
+ * \p map_file_path is not used, partitioned models and their connections are read from package.
  *
  * @param session the session to be prepared
  * @return NNFW_STATUS_NO_ERROR if successful
@@ -129,8 +187,10 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
  * @brief     Set input buffer
  *
  * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
- * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
+ * function are copied, so they can be reused for many inferences. \p lengths must be greater or
+ * equal than the operand requires. It blocks while the queue of first model is full.
+ * if you give empty \p inputs to this function, then the pipeline stops accepting inputs and
+ * workers exit after pushed inputs are finished.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -145,8 +205,10 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
 /**
  * @brief       Get last outputs of partitioned model in session
  *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
+ * This function must be called after {@link nnfw_prepare_pipeline}. It blocks until outputs of
+ * the oldest pushed input are ready. Buffers appended to \p outputs are allocated by \p malloc
+ * and must be released by \p free. Nothing is appended if all pushed inputs are already popped
+ * after empty inputs are pushed.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
@@ -156,6 +218,121 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
  */
 NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs);
 
+/**
+ * @brief Statistics of batched inference
+ *
+ * Batch occupancy is num_requests / (num_batches * max_batch_size).
+ */
+typedef struct nnfw_batching_stats
+{
+  /** Number of batches run */
+  uint64_t num_batches;
+  /** Number of requests run */
+  uint64_t num_requests;
+  /** Sum of time from request submission to the start of its batch */
+  uint64_t total_queue_time_us;
+  /** Maximum time from request submission to the start of its batch */
+  uint64_t max_queue_time_us;
+} nnfw_batching_stats;
+
+/**
+ * @brief     Prepare session to coalesce independent requests into batches
+ *
+ * This function must be called after {@link nnfw_prepare}. Requests given by
+ * {@link nnfw_run_batched} are gathered until there are \p max_batch_size requests or the
+ * oldest request waits for \p timeout_us. Then the first dimension of all inputs is resized to
+ * the number of gathered requests and the model runs once. The first dimension of model inputs and
+ * outputs must be the batch dimension.
+ *
+ * @param[in] session         The session which is prepared for inference
+ * @param[in] max_batch_size  Maximum number of requests in a batch
+ * @param[in] timeout_us      Maximum time in microseconds to wait for other requests
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, uint32_t max_batch_size,
+                                  uint32_t timeout_us);
+
+/**
+ * @brief     Run a single request in batch
+ *
+ * This function must be called after {@link nnfw_prepare_batching}, and it can be called by
+ * multiple threads at the same time. It blocks until outputs of the request are written.
+ * Buffer sizes are the sizes of model inputs and outputs.
+ * It should not be used together with {@link nnfw_run} on the same session.
+ *
+ * @param[in] session Session which is prepared for batching
+ * @param[in] inputs  Input buffers, the number of buffers is the number of model inputs
+ * @param[in] outputs Output buffers, the number of buffers is the number of model outputs
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_batched(nnfw_session *session, const void **inputs, void **outputs);
+
+/**
+ * @brief      Get statistics of batched inference
+ *
+ * @param[in]  session Session which is prepared for batching
+ * @param[out] stats   Statistics
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats);
+
+/**
+ * @brief How a model output is written into a state
+ */
+typedef enum
+{
+  /** Output has the same shape as state and replaces it */
+  NNFW_STATE_UPDATE_REPLACE = 0,
+  /** Output is appended along axis, and run fails if the state is full */
+  NNFW_STATE_UPDATE_APPEND = 1,
+  /**
+   * Output is appended along axis, overwriting the oldest entries if the state is full.
+   * Entries along axis are not in time order after the state wraps around.
+   */
+  NNFW_STATE_UPDATE_ROTATE = 2,
+} NNFW_STATE_UPDATE;
+
+/**
+ * @brief     Keep a model input as persistent session state
+ *
+ * This function must be called after {@link nnfw_prepare}. The input stays in a runtime-owned
+ * buffer between runs, and after each run the output of \p output_index is written into it.
+ * For example, key/value caches of a decoder can be bound to the key/value outputs of new tokens
+ * with {@link NNFW_STATE_UPDATE_APPEND}, so that the cost of an update is proportional to the new
+ * tokens, not to the context length.
+ * The state is zero at first, and buffers of the input and the output cannot be set by
+ * {@link nnfw_set_input} or {@link nnfw_set_output}.
+ *
+ * @param[in] session       The session which is prepared for inference
+ * @param[in] input_index   Index of the model input kept as state
+ * @param[in] output_index  Index of the model output written into the state
+ * @param[in] update        How the state is updated
+ * @param[in] axis          Axis along which the output is written, ignored for
+ *                          {@link NNFW_STATE_UPDATE_REPLACE}
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_bind_state(nnfw_session *session, uint32_t input_index, uint32_t output_index,
+                            NNFW_STATE_UPDATE update, int32_t axis);
+
+/**
+ * @brief     Clear all states bound by {@link nnfw_bind_state} to zero
+ *
+ * @param[in] session The session whose states are cleared
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_states(nnfw_session *session);
+
+/**
+ * @brief      Get the number of valid entries along the axis of a state
+ *
+ * @param[in]  session      The session which has the state
+ * @param[in]  input_index  Index of the model input bound as state
+ * @param[out] length       Number of entries written since the state is cleared, which is at
+ *                          most the dimension of the axis
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_state_length(nnfw_session *session, uint32_t input_index, uint32_t *length);
+
 /**
  *  Training C APIs
  *
@@ -249,6 +426,23 @@ NNFW_STATUS nnfw_train_get_traininfo(nnfw_session *session, nnfw_train_info *inf
  */
 NNFW_STATUS nnfw_train_set_traininfo(nnfw_session *session, const nnfw_train_info *info);
 
+/**
+ * @brief Set the number of batches whose gradients are accumulated before updating weights
+ * @note  This function should be called after calling {@link nnfw_load_model_from_file}
+ *        and before calling {@link nnfw_train_prepare}
+ *
+ *        Weights are updated once every \p steps calls of {@link nnfw_train} which update
+ *        weights, counted from {@link nnfw_train_prepare}. Gradients after the last update are
+ *        kept until the window is filled, so the number of batches in an epoch should be a
+ *        multiple of \p steps. Otherwise a window crosses the end of an epoch.
+ *
+ * @param[in] session The session to be set the number of steps
+ * @param[in] steps   The number of batches, which is 1 by default
+ *
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_train_set_accumulation_steps(nnfw_session *session, uint32_t steps);
+
 /**
  * @brief Prepare session to be ready for training
  * @note  The session will be entered into training mode
@@ -60,6 +60,12 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_INFO_ID_VERSION, 0);
  */
 NNFW_STATUS nnfw_create_session(nnfw_session **session) { return nnfw_session::create(session); }
 
+NNFW_STATUS nnfw_create_shared_session(nnfw_session *prepared, nnfw_session **session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(prepared);
+  return nnfw_session::create_shared(prepared, session);
+}
+
 /*
  * Close a session instance
  *
@@ -123,6 +129,18 @@ NNFW_STATUS nnfw_await(nnfw_session *session)
   return session->await();
 }
 
+NNFW_STATUS nnfw_run_async_cb(nnfw_session *session, nnfw_run_callback callback, void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_async(callback, user_data);
+}
+
+NNFW_STATUS nnfw_poll(nnfw_session *session, bool *finished)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->poll(finished);
+}
+
 /*
  * Set input
  *
@@ -384,6 +402,44 @@ NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
   return session->pop_pipeline_output((std::vector<void *> *)outputs);
 }
 
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, uint32_t max_batch_size,
+                                  uint32_t timeout_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_batching(max_batch_size, timeout_us);
+}
+
+NNFW_STATUS nnfw_run_batched(nnfw_session *session, const void **inputs, void **outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_batched(inputs, outputs);
+}
+
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_batching_stats(stats);
+}
+
+NNFW_STATUS nnfw_bind_state(nnfw_session *session, uint32_t input_index, uint32_t output_index,
+                            NNFW_STATE_UPDATE update, int32_t axis)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->bind_state(input_index, output_index, update, axis);
+}
+
+NNFW_STATUS nnfw_reset_states(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_states();
+}
+
+NNFW_STATUS nnfw_get_state_length(nnfw_session *session, uint32_t input_index, uint32_t *length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_state_length(input_index, length);
+}
+
 // Training
 
 NNFW_STATUS nnfw_train_get_traininfo(nnfw_session *session, nnfw_train_info *info)
@@ -398,6 +454,12 @@ NNFW_STATUS nnfw_train_set_traininfo(nnfw_session *session, const nnfw_train_inf
   return session->train_set_traininfo(info);
 }
 
+NNFW_STATUS nnfw_train_set_accumulation_steps(nnfw_session *session, uint32_t steps)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->train_set_accumulation_steps(steps);
+}
+
 NNFW_STATUS nnfw_train_prepare(nnfw_session *session)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
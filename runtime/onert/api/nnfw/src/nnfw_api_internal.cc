@@ -20,7 +20,9 @@
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
 #include "util/logging.h"
+#include "exec/BatchExecution.h"
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
 #include "loader/CircleLoader.h"
 #include "loader/ModelLoader.h"
 #include "loader/TFLiteLoader.h"
@@ -34,6 +36,7 @@
 #include "odc/CodegenManager.h"
 #include "circle_schema_generated.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -222,6 +225,34 @@ loadTrainingInfo(const std::shared_ptr<onert::ir::Model> &model)
   return std::make_unique<onert::ir::train::TrainingInfo>();
 }
 
+// Convert exception thrown by execution into status
+NNFW_STATUS toStatus(std::exception_ptr error, const char *where)
+{
+  if (!error)
+    return NNFW_STATUS_NO_ERROR;
+
+  try
+  {
+    std::rethrow_exception(error);
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    // Currently insufficient buffer always means output buffer.
+    std::cerr << "Error during " << where << " : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during " << where << " : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  catch (...)
+  {
+    std::cerr << "Error during " << where << " : unknown error" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+}
+
 uint64_t getBufSize(const nnfw_tensorinfo *info)
 {
   static int elmsize[] = {
@@ -278,6 +309,48 @@ NNFW_STATUS nnfw_session::create(nnfw_session **session)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::create_shared(const nnfw_session *prepared, nnfw_session **session)
+{
+  if (prepared == nullptr || session == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (prepared->_state != State::PREPARED && prepared->_state != State::FINISHED_RUN &&
+      prepared->_state != State::RUNNING)
+  {
+    std::cerr << "Error during shared session creation : "
+              << "source session should be prepared for inference" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    auto new_session = std::unique_ptr<nnfw_session>(new nnfw_session());
+    new_session->_kernel_registry = prepared->_kernel_registry;
+    for (const auto &coptions : prepared->_coptions)
+      new_session->_coptions.push_back(
+        std::make_unique<onert::compiler::CompilerOptions>(*coptions));
+    new_session->_compiler_artifact = prepared->_compiler_artifact;
+    new_session->_execution =
+      std::make_unique<onert::exec::Execution>(new_session->_compiler_artifact->_executors);
+    new_session->_model_path = prepared->_model_path;
+    new_session->_state = State::PREPARED;
+    *session = new_session.release();
+  }
+  catch (const std::bad_alloc &e)
+  {
+    std::cerr << "Error during shared session creation" << std::endl;
+    *session = nullptr;
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during shared session creation : " << e.what() << std::endl;
+    *session = nullptr;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 nnfw_session::~nnfw_session() = default;
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
@@ -505,10 +578,27 @@ NNFW_STATUS nnfw_session::prepare()
   return NNFW_STATUS_NO_ERROR;
 }
 
+// NOTE map_file_path is not used. Models of package and edges between them (e.g. generated by
+//      circle-partitioner) are used as stages of pipeline.
 NNFW_STATUS nnfw_session::prepare_pipeline(const char *)
 {
-  std::cerr << "Pipeline prepare_pipeline: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  auto status = prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  try
+  {
+    auto queue_size = onert::util::getConfigInt(onert::util::config::PIPELINE_QUEUE_SIZE);
+    _pipeline = std::make_unique<onert::exec::PipelineExecution>(
+      _compiler_artifact->_executors, static_cast<uint32_t>(std::max(queue_size, 1)));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::run()
@@ -540,7 +630,7 @@ NNFW_STATUS nnfw_session::run()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::run_async()
+NNFW_STATUS nnfw_session::run_async(nnfw_run_callback callback, void *user_data)
 {
   if (!isStatePreparedOrFinishedRun())
   {
@@ -549,7 +639,24 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
-  _execution->startExecute();
+  try
+  {
+    if (callback == nullptr)
+    {
+      _execution->startExecute();
+    }
+    else
+    {
+      _execution->startExecute([this, callback, user_data](std::exception_ptr error) {
+        callback(this, toStatus(error, "nnfw_session::run_async"), user_data);
+      });
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::RUNNING;
   return NNFW_STATUS_NO_ERROR;
@@ -564,9 +671,33 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
+  std::exception_ptr error = nullptr;
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
 
   _state = State::FINISHED_RUN;
+  return toStatus(error, "nnfw_session::run_await");
+}
+
+NNFW_STATUS nnfw_session::poll(bool *finished)
+{
+  if (finished == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::poll : "
+              << "poll should be run after run_async" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  *finished = _execution->isFinished();
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -864,16 +995,213 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *, std::vector<uint32_t> *)
+NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
+                                              std::vector<uint32_t> *lengths)
 {
-  std::cerr << "Pipeline push_pipeline_input: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  if (_pipeline == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : "
+              << "push_pipeline_input should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Empty inputs mean the end of input stream
+    if (inputs == nullptr || inputs->empty())
+    {
+      _pipeline->finish();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    if (lengths == nullptr)
+      return NNFW_STATUS_UNEXPECTED_NULL;
+
+    std::vector<const void *> input_buffers{inputs->begin(), inputs->end()};
+    std::vector<size_t> input_lengths{lengths->begin(), lengths->end()};
+    _pipeline->push(input_buffers, input_lengths);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *)
+NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
 {
-  std::cerr << "Pipeline pop_pipeline_output: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  if (_pipeline == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+              << "pop_pipeline_output should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (outputs == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    // outputs stays empty if all pushed inputs are already popped after end of input stream
+    _pipeline->pop(*outputs);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::prepare_batching(uint32_t max_batch_size, uint32_t timeout_us)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : "
+              << "prepare_batching should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    _batch_execution = std::make_unique<onert::exec::BatchExecution>(
+      _compiler_artifact->_executors, max_batch_size, std::chrono::microseconds{timeout_us});
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::run_batched(const void **inputs, void **outputs)
+{
+  if (_batch_execution == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::run_batched : "
+              << "run_batched should be run after prepare_batching" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  uint32_t input_size = _compiler_artifact->_executors->inputSize();
+  uint32_t output_size = _compiler_artifact->_executors->outputSize();
+  if ((input_size > 0 && inputs == nullptr) || (output_size > 0 && outputs == nullptr))
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    _batch_execution->run(std::vector<const void *>(inputs, inputs + input_size),
+                          std::vector<void *>(outputs, outputs + output_size));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_batched : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_batching_stats(nnfw_batching_stats *stats)
+{
+  if (_batch_execution == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_batching_stats : "
+              << "get_batching_stats should be run after prepare_batching" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  const auto batch_stats = _batch_execution->stats();
+  stats->num_batches = batch_stats.num_batches;
+  stats->num_requests = batch_stats.num_requests;
+  stats->total_queue_time_us = batch_stats.total_queue_time_us;
+  stats->max_queue_time_us = batch_stats.max_queue_time_us;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::bind_state(uint32_t input_index, uint32_t output_index,
+                                     NNFW_STATE_UPDATE update, int32_t axis)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::bind_state : "
+              << "bind_state should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  onert::exec::StateUpdate state_update;
+  switch (update)
+  {
+    case NNFW_STATE_UPDATE_REPLACE:
+      state_update = onert::exec::StateUpdate::REPLACE;
+      break;
+    case NNFW_STATE_UPDATE_APPEND:
+      state_update = onert::exec::StateUpdate::APPEND;
+      break;
+    case NNFW_STATE_UPDATE_ROTATE:
+      state_update = onert::exec::StateUpdate::ROTATE;
+      break;
+    default:
+      std::cerr << "Error during nnfw_session::bind_state : Invalid update type" << std::endl;
+      return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->bindState(onert::ir::IOIndex{input_index}, onert::ir::IOIndex{output_index},
+                          state_update, axis);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::bind_state : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_states()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::reset_states : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _execution->resetStates();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_state_length(uint32_t input_index, uint32_t *length)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::get_state_length : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (length == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    *length = static_cast<uint32_t>(_execution->getStateLength(onert::ir::IOIndex{input_index}));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::get_state_length : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::register_custom_operation(const std::string &id,
@@ -1001,6 +1329,33 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.he_profiling_mode = toBool(value);
   }
+  else if (skey == config::EXECUTION_CONTEXTS)
+  {
+    const auto contexts = toInt(value);
+    if (contexts < 1)
+      return NNFW_STATUS_ERROR;
+    for (auto &&coptions : _coptions)
+      coptions->execution_contexts = static_cast<uint32_t>(contexts);
+  }
+  else if (skey == config::TRAINING_REPLICAS)
+  {
+    const auto replicas = toInt(value);
+    if (replicas < 1)
+      return NNFW_STATUS_ERROR;
+    options.train_replicas = static_cast<uint32_t>(replicas);
+  }
+  else if (skey == config::TRAINING_CHECKPOINTS)
+  {
+    options.train_checkpoints = value;
+  }
+  else if (skey == config::TRAINING_MEMORY_BUDGET)
+  {
+    const auto budget = toInt(value);
+    if (budget < 0)
+      return NNFW_STATUS_ERROR;
+    // Budget is given in KB as the environment variable
+    options.train_memory_budget = static_cast<uint64_t>(budget) * 1024;
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1347,6 +1702,30 @@ NNFW_STATUS nnfw_session::train_set_traininfo(const nnfw_train_info *info)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::train_set_accumulation_steps(uint32_t steps)
+{
+  if (not isStateModelLoaded())
+  {
+    std::cerr << "Error during nnfw_session::train_set_accumulation_steps : invalid state"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (steps == 0)
+  {
+    std::cerr << "Error during nnfw_session::train_set_accumulation_steps : steps should be "
+                 "positive"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  // after model loaded, it ensures that _train_info is not nullptr
+  assert(_train_info != nullptr);
+  _train_info->setAccumulationSteps(steps);
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::train_prepare()
 {
   // We may need different state to represent training model is loaded
@@ -35,7 +35,9 @@ class CustomKernelRegistry;
 } // namespace api
 namespace exec
 {
+class BatchExecution;
 class Execution;
+class PipelineExecution;
 } // namespace exec
 namespace ir
 {
@@ -116,6 +118,13 @@ public:
    */
   static NNFW_STATUS create(nnfw_session **session);
 
+  /**
+   * @brief Factory method. It creates nnfw_session which shares compiled model with other session
+   *
+   * @note  Created session is in prepared state and has its own input/output setting
+   */
+  static NNFW_STATUS create_shared(const nnfw_session *prepared, nnfw_session **session);
+
 private:
   nnfw_session();
 
@@ -126,8 +135,9 @@ public:
   NNFW_STATUS prepare_pipeline(const char *map_file_path);
   NNFW_STATUS run();
 
-  NNFW_STATUS run_async();
+  NNFW_STATUS run_async(nnfw_run_callback callback = nullptr, void *user_data = nullptr);
   NNFW_STATUS await();
+  NNFW_STATUS poll(bool *finished);
 
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
@@ -161,6 +171,15 @@ public:
   NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
   NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
 
+  NNFW_STATUS prepare_batching(uint32_t max_batch_size, uint32_t timeout_us);
+  NNFW_STATUS run_batched(const void **inputs, void **outputs);
+  NNFW_STATUS get_batching_stats(nnfw_batching_stats *stats);
+
+  NNFW_STATUS bind_state(uint32_t input_index, uint32_t output_index, NNFW_STATE_UPDATE update,
+                         int32_t axis);
+  NNFW_STATUS reset_states();
+  NNFW_STATUS get_state_length(uint32_t input_index, uint32_t *length);
+
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS output_tensorindex(const char *tensorname, uint32_t *index);
@@ -172,6 +191,7 @@ public:
 
   NNFW_STATUS train_get_traininfo(nnfw_train_info *info);
   NNFW_STATUS train_set_traininfo(const nnfw_train_info *info);
+  NNFW_STATUS train_set_accumulation_steps(uint32_t steps);
   NNFW_STATUS train_prepare();
   NNFW_STATUS train_input_tensorinfo(uint32_t index, nnfw_tensorinfo *ti);
   NNFW_STATUS train_expected_tensorinfo(uint32_t index, nnfw_tensorinfo *ti);
@@ -212,6 +232,8 @@ private:
   std::vector<std::unique_ptr<onert::compiler::CompilerOptions>> _coptions;
   std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
   std::unique_ptr<onert::exec::Execution> _execution;
+  std::unique_ptr<onert::exec::PipelineExecution> _pipeline;
+  std::unique_ptr<onert::exec::BatchExecution> _batch_execution;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::vector<std::thread> _threads;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
@@ -18,6 +18,7 @@
 
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
@@ -31,7 +32,14 @@ namespace backend
 namespace cpu
 {
 
-ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
+ITensorRegistry *BackendContext::genTensors()
+{
+  // Kernels of cpu backend for in-place operations handle aliased input and output
+  const bool inplace = util::getConfigString(util::config::CPU_MEMORY_PLANNER) == "InPlace";
+  if (_data.memory_plan)
+    tensor_builder->useMemoryPlan(_data.memory_plan);
+  return basic::genTensors(*this, inplace);
+}
 
 FunctionMap BackendContext::genKernels()
 {
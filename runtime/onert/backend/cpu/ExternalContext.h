@@ -20,7 +20,13 @@
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -34,8 +40,53 @@ class ExternalContext
 private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
+  // Ruy contexts of the threads that run kernels of an ExternalContext. It is shared with the
+  // threads, so a thread can remove its context on exit even after the ExternalContext is gone.
+  struct RuyContexts
+  {
+    std::mutex mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ruy::Context>> contexts;
+    int max_num_threads = kDefaultNumThreadpoolThreads;
+    // Increased whenever the share of threads of each context changes
+    std::atomic<uint32_t> generation{0};
+  };
+
+  // Ruy context last used by the calling thread and the ExternalContexts it has used
+  struct ThreadCache
+  {
+    uint64_t owner_id = 0;
+    uint32_t generation = 0;
+    ruy::Context *ruy_context = nullptr;
+    std::vector<std::weak_ptr<RuyContexts>> used;
+
+    ~ThreadCache()
+    {
+      for (auto &&weak : used)
+      {
+        if (auto contexts = weak.lock())
+        {
+          std::lock_guard<std::mutex> lock{contexts->mutex};
+          contexts->contexts.erase(std::this_thread::get_id());
+          contexts->generation++;
+        }
+      }
+    }
+  };
+
+  static ThreadCache &threadCache()
+  {
+    thread_local ThreadCache cache;
+    return cache;
+  }
+
+  static uint64_t nextId()
+  {
+    static std::atomic<uint64_t> id{0};
+    return ++id;
+  }
+
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
+  ExternalContext() : _id{nextId()}, _ruy_contexts{std::make_shared<RuyContexts>()}
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
   }
@@ -44,13 +95,51 @@ public:
   {
     const int target_num_threads =
       max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    std::lock_guard<std::mutex> lock{_ruy_contexts->mutex};
+    _ruy_contexts->max_num_threads = target_num_threads;
+    _ruy_contexts->generation++;
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  /**
+   * @brief Return ruy context of the calling thread
+   * @note  ruy::Context is not thread-safe, so kernels running at the same time on different
+   *        threads get different contexts. The threads share the thread budget, and each
+   *        thread applies its share to its own context. The context of the thread that called
+   *        last is cached in a thread-local, so repeated calls do not lock.
+   */
+  ruy::Context *ruy_context() const
+  {
+    auto &cache = threadCache();
+    if (cache.owner_id == _id &&
+        cache.generation == _ruy_contexts->generation.load(std::memory_order_acquire))
+      return cache.ruy_context;
+
+    std::lock_guard<std::mutex> lock{_ruy_contexts->mutex};
+    auto &ctx = _ruy_contexts->contexts[std::this_thread::get_id()];
+    if (!ctx)
+    {
+      ctx = std::make_unique<ruy::Context>();
+      _ruy_contexts->generation++;
+      cache.used.erase(std::remove_if(cache.used.begin(), cache.used.end(),
+                                      [](const std::weak_ptr<RuyContexts> &weak) {
+                                        return weak.expired();
+                                      }),
+                       cache.used.end());
+      cache.used.emplace_back(_ruy_contexts);
+    }
+    const int num_contexts = static_cast<int>(_ruy_contexts->contexts.size());
+    ctx->set_max_num_threads(std::max(1, _ruy_contexts->max_num_threads / num_contexts));
+
+    cache.owner_id = _id;
+    cache.generation = _ruy_contexts->generation.load(std::memory_order_relaxed);
+    cache.ruy_context = ctx.get();
+    return ctx.get();
+  }
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  // Identifies this context in thread caches, it is never reused unlike the address
+  const uint64_t _id;
+  std::shared_ptr<RuyContexts> _ruy_contexts;
 };
 
 } // namespace cpu
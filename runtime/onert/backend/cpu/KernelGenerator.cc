@@ -18,6 +18,7 @@
 
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/AttentionLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
@@ -29,10 +30,14 @@
 #include "ops/ElementwiseActivationLayer.h"
 #include "ops/ElementwiseBinaryLayer.h"
 #include "ops/ElementwiseUnaryLayer.h"
+#include "ops/EmbeddingLookupLayer.h"
 #include "ops/ExpandDimsLayer.h"
 #include "ops/FillLayer.h"
 #include "ops/FullyConnectedLayer.h"
 #include "ops/GatherLayer.h"
+#include "ops/InstanceNormLayer.h"
+#include "ops/LayerNormLayer.h"
+#include "ops/LocalResponseNormalizationLayer.h"
 #include "ops/LSTMLayer.h"
 #include "ops/MeanLayer.h"
 #include "ops/DetectionPostProcessLayer.h"
@@ -42,13 +47,17 @@
 #include "ops/PadLayer.h"
 #include "ops/PoolLayer.h"
 #include "ops/PowLayer.h"
+#include "ops/PReLULayer.h"
 #include "ops/QuantizeLayer.h"
 #include "ops/RangeLayer.h"
 #include "ops/RankLayer.h"
 #include "ops/ReduceLayer.h"
 #include "ops/ReshapeLayer.h"
 #include "ops/ResizeBilinearLayer.h"
+#include "ops/ResizeNearestNeighborLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RNNLayer.h"
+#include "ops/RmsNormLayer.h"
 #include "ops/SelectLayer.h"
 #include "ops/ShapeLayer.h"
 #include "ops/SliceLayer.h"
@@ -59,7 +68,9 @@
 #include "ops/SplitLayer.h"
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
+#include "ops/TopKV2Layer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
@@ -121,6 +132,8 @@ convertElementwiseActivationType(ir::operation::ElementwiseActivation::Type type
       return ops::ElementwiseActivationType::kTanh;
     case ir::operation::ElementwiseActivation::Type::LEAKY_RELU:
       return ops::ElementwiseActivationType::kLeakyReLU;
+    case ir::operation::ElementwiseActivation::Type::GELU:
+      return ops::ElementwiseActivationType::kGELU;
     default:
       throw std::runtime_error("cpu KernelGenerator : Not supported operation yet");
   }
@@ -594,7 +607,27 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::InstanceNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::InstanceNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::InstanceNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::InstanceNorm::Input::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::InstanceNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, output_tensor, node.param().epsilon,
+                node.param().activation, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -727,6 +760,23 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   }
 }
 
+void KernelGenerator::visit(const ir::operation::EmbeddingLookup &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lookups_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto values_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto lookups_tensor = _tensor_reg->getPortableTensor(lookups_index);
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+
+  auto fn = std::make_unique<ops::EmbeddingLookupLayer>();
+
+  fn->configure(lookups_tensor, values_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::ExpandDims &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -808,7 +858,7 @@ void KernelGenerator::visit(const ir::operation::Pad &node)
     value = _tensor_reg->getPortableTensor(value_index);
   }
 
-  fn->configure(input, pad, value, output);
+  fn->configure(input, pad, value, output, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -824,7 +874,27 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  fn->configure(ifm_tensor, ker_tensor, ofm_tensor, node.param().padding, node.param().stride,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -853,7 +923,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -918,7 +989,7 @@ void KernelGenerator::visit(const ir::operation::StridedSlice &node)
   auto fn = std::make_unique<ops::StridedSliceLayer>();
 
   fn->configure(input_tensor, starts_tensor, ends_tensor, strides_tensor, output_tensor, begin_mask,
-                end_mask, shrink_axis_mask);
+                end_mask, shrink_axis_mask, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -976,7 +1047,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -989,11 +1060,51 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
+    }
+  }
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::INPUT)};
+
+  auto align_corners = node.param().align_corners;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::ResizeNearestNeighborLayer>();
+
+  if (node.getInputs().size() == 1)
+  {
+    fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
+                  align_corners, _external_context);
+  }
+  else
+  {
+    assert(node.getInputs().size() == 2);
+    const auto size_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::SIZE)};
+    auto size_tensor = _tensor_reg->getPortableTensor(size_index);
+    if (size_tensor->is_constant())
+    {
+      auto size_vec = _ctx.at(size_index).asVector<int32_t>();
+      const auto height_out = size_vec[0];
+      const auto width_out = size_vec[1];
+      fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
+                    _external_context);
+    }
+    else
+    {
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, _external_context);
     }
   }
 
@@ -1017,6 +1128,35 @@ void KernelGenerator::visit(const ir::operation::Reverse &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  using ir::operation::RNN;
+
+  const auto output_index{node.getOutputs().at(RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{node.getOutputs().at(RNN::Output::HIDDEN_STATE_OUT)};
+  const auto input_index{node.getInputs().at(RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{node.getInputs().at(RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(RNN::Input::HIDDEN_STATE_IN)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto hidden_state_out_tensor = _tensor_reg->getPortableTensor(hidden_state_out_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto weights_tensor = _tensor_reg->getPortableTensor(weights_index);
+  auto recurrent_weights_tensor = _tensor_reg->getPortableTensor(recurrent_weights_index);
+  auto bias_tensor = _tensor_reg->getPortableTensor(bias_index);
+  auto hidden_state_in_tensor = _tensor_reg->getPortableTensor(hidden_state_in_index);
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  fn->configure(input_tensor, weights_tensor, recurrent_weights_tensor, bias_tensor,
+                hidden_state_in_tensor, output_tensor, hidden_state_out_tensor,
+                node.param().activation, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::ArgMinMax &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1077,6 +1217,23 @@ void KernelGenerator::visit(const ir::operation::Pow &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::PReLU &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::PReLU::Input::INPUT)};
+  const auto alpha_index{node.getInputs().at(ir::operation::PReLU::Input::ALPHA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto alpha_tensor = _tensor_reg->getPortableTensor(alpha_index);
+
+  auto fn = std::make_unique<ops::PReLULayer>();
+
+  fn->configure(input_tensor, alpha_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::L2Normalization &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1092,6 +1249,90 @@ void KernelGenerator::visit(const ir::operation::L2Normalization &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::LayerNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::LayerNorm::Input::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::LayerNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, output_tensor, node.param().epsilon,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::LocalResponseNormalization &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{
+    node.getInputs().at(ir::operation::LocalResponseNormalization::Input::INPUT)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  const auto &param = node.param();
+  auto fn = std::make_unique<ops::LocalResponseNormalizationLayer>();
+
+  fn->configure(input_tensor, output_tensor, param.radius, param.bias, param.alpha, param.beta,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::Input::GAMMA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+
+  auto fn = std::make_unique<ops::RmsNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, output_tensor, node.param().epsilon, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::Attention &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto query_index{node.getInputs().at(ir::operation::Attention::Input::QUERY)};
+  const auto key_index{node.getInputs().at(ir::operation::Attention::Input::KEY)};
+  const auto value_index{node.getInputs().at(ir::operation::Attention::Input::VALUE)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto query_tensor = _tensor_reg->getPortableTensor(query_index);
+  auto key_tensor = _tensor_reg->getPortableTensor(key_index);
+  auto value_tensor = _tensor_reg->getPortableTensor(value_index);
+
+  // Mask is optional
+  const IPortableTensor *mask_tensor = nullptr;
+  if (node.getInputs().size() > ir::operation::Attention::Input::MASK)
+  {
+    const auto mask_index{node.getInputs().at(ir::operation::Attention::Input::MASK)};
+    if (mask_index.valid())
+      mask_tensor = _tensor_reg->getPortableTensor(mask_index);
+  }
+
+  auto fn = std::make_unique<ops::AttentionLayer>();
+
+  fn->configure(query_tensor, key_tensor, value_tensor, mask_tensor, output_tensor,
+                node.param().scale, node.param().causal, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Range &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1153,7 +1394,24 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
 
   auto fn = std::make_unique<ops::TileLayer>();
 
-  fn->configure(input_tensor, multiples_tensor, output_tensor);
+  fn->configure(input_tensor, multiples_tensor, output_tensor, _external_context);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TopKV2 &node)
+{
+  const auto values_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES)};
+  const auto indices_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES)};
+  const auto input_index{node.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::TopKV2Layer>();
+
+  fn->configure(input_tensor, values_tensor, indices_tensor, node.param().k, _external_context);
+
   _return_fn = std::move(fn);
 }
 
@@ -1251,7 +1509,7 @@ void KernelGenerator::visit(const ir::operation::BroadcastTo &node)
 
   auto fn = std::make_unique<ops::BroadcastToLayer>();
 
-  fn->configure(input_tensor, shape_tensor, output_tensor);
+  fn->configure(input_tensor, shape_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -46,6 +46,7 @@ public:
 
   void visit(const ir::operation::AddN &) override;
   void visit(const ir::operation::ArgMinMax &) override;
+  void visit(const ir::operation::Attention &) override;
   void visit(const ir::operation::BatchMatMul &) override;
   void visit(const ir::operation::BatchToSpaceND &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
@@ -57,6 +58,7 @@ public:
   void visit(const ir::operation::DepthToSpace &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
   void visit(const ir::operation::Einsum &) override;
+  void visit(const ir::operation::EmbeddingLookup &) override;
   void visit(const ir::operation::ElementwiseActivation &) override;
   void visit(const ir::operation::ElementwiseBinary &) override;
   void visit(const ir::operation::ElementwiseUnary &) override;
@@ -65,7 +67,10 @@ public:
   void visit(const ir::operation::FullyConnected &) override;
   void visit(const ir::operation::FusedBatchNorm &) override;
   void visit(const ir::operation::Gather &) override;
+  void visit(const ir::operation::InstanceNorm &) override;
   void visit(const ir::operation::L2Normalization &) override;
+  void visit(const ir::operation::LayerNorm &) override;
+  void visit(const ir::operation::LocalResponseNormalization &) override;
   void visit(const ir::operation::LogSoftmax &) override;
   void visit(const ir::operation::LSTM &) override;
   void visit(const ir::operation::MatrixBandPart &) override;
@@ -75,12 +80,16 @@ public:
   void visit(const ir::operation::Pad &) override;
   void visit(const ir::operation::Pool2D &) override;
   void visit(const ir::operation::Pow &) override;
+  void visit(const ir::operation::PReLU &) override;
   void visit(const ir::operation::Range &) override;
   void visit(const ir::operation::Rank &) override;
   void visit(const ir::operation::Reduce &) override;
   void visit(const ir::operation::Reshape &) override;
   void visit(const ir::operation::ResizeBilinear &node) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &) override;
   void visit(const ir::operation::Reverse &) override;
+  void visit(const ir::operation::RNN &) override;
+  void visit(const ir::operation::RmsNorm &) override;
   void visit(const ir::operation::Select &) override;
   void visit(const ir::operation::Shape &) override;
   void visit(const ir::operation::Slice &) override;
@@ -94,7 +103,9 @@ public:
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
+  void visit(const ir::operation::TopKV2 &) override;
   void visit(const ir::operation::Transpose &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Unpack &) override;
 
 private:
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AttentionLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/Attention.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void AttentionLayer::configure(const IPortableTensor *query, const IPortableTensor *key,
+                               const IPortableTensor *value, const IPortableTensor *mask,
+                               IPortableTensor *output, float scale, bool causal,
+                               const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(query != nullptr);
+  assert(key != nullptr);
+  assert(value != nullptr);
+  assert(output != nullptr);
+
+  _query = query;
+  _key = key;
+  _value = value;
+  _mask = mask;
+  _output = output;
+  _scale = scale;
+  _causal = causal;
+  _external_context = external_context;
+}
+
+void AttentionLayer::run()
+{
+  if (_query->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"Attention: Unsupported data type"};
+
+  nnfw::cker::AttentionParams params;
+  params.scale = _scale;
+  params.causal = _causal;
+  nnfw::cker::ScaledDotProductAttention(
+    params, getShape(_query), getBuffer<float>(_query), getShape(_key), getBuffer<float>(_key),
+    getShape(_value), getBuffer<float>(_value), getShape(_mask),
+    _mask == nullptr ? nullptr : getBuffer<float>(_mask), getShape(_output),
+    getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
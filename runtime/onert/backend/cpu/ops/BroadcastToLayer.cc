@@ -27,17 +27,20 @@ namespace cpu
 namespace ops
 {
 
-BroadcastToLayer::BroadcastToLayer() : _input(nullptr), _shape(nullptr), _output(nullptr)
+BroadcastToLayer::BroadcastToLayer()
+  : _input(nullptr), _shape(nullptr), _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void BroadcastToLayer::configure(const IPortableTensor *input, const IPortableTensor *shape,
-                                 IPortableTensor *output)
+                                 IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _shape = shape;
   _output = output;
+  _external_context = external_context;
 }
 
 void BroadcastToLayer::run()
@@ -50,17 +53,20 @@ void BroadcastToLayer::run()
     // ToDo : It need to support INT8 and UINT8 also when will be applied quantization.
     case OperandType::FLOAT32:
       nnfw::cker::BroadcastTo<float>(getShape(_input), reinterpret_cast<float *>(_input->buffer()),
-                                     getShape(_output), getBuffer<float>(_output));
+                                     getShape(_output), getBuffer<float>(_output),
+                                     _external_context->ruy_context());
       break;
     case OperandType::INT32:
       nnfw::cker::BroadcastTo<int32_t>(getShape(_input),
                                        reinterpret_cast<int32_t *>(_input->buffer()),
-                                       getShape(_output), getBuffer<int32_t>(_output));
+                                       getShape(_output), getBuffer<int32_t>(_output),
+                                       _external_context->ruy_context());
       break;
     case OperandType::UINT32:
       nnfw::cker::BroadcastTo<uint32_t>(getShape(_input),
                                         reinterpret_cast<uint32_t *>(_input->buffer()),
-                                        getShape(_output), getBuffer<uint32_t>(_output));
+                                        getShape(_output), getBuffer<uint32_t>(_output),
+                                        _external_context->ruy_context());
       break;
     default:
       throw std::runtime_error{"BroadcastToLayer: unsupported data type"};
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_BROADCASTLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -38,7 +39,7 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *shape,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -46,6 +47,7 @@ private:
   const IPortableTensor *_input;
   const IPortableTensor *_shape;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
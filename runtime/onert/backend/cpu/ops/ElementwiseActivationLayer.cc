@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/ELU.h>
+#include <cker/operation/Gelu.h>
 #include <cker/operation/LeakyReLU.h>
 #include <cker/operation/Logistic.h>
 #include <cker/operation/ReLU.h>
@@ -185,6 +186,21 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         throw std::runtime_error{"ElementwiseActivationLayer(LeakyReLU): unsupported data type"};
       }
       break;
+    case ElementwiseActivationType::kGELU:
+      if (_input->data_type() == OperandType::FLOAT32)
+      {
+        // Use tanh approximation if alpha is not 0
+        const bool approximate = alpha != 0.f;
+        _kernel = [approximate](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::GELU(nnfw::cker::GeluParams{approximate}, getShape(input),
+                           getBuffer<float>(input), getShape(output), getBuffer<float>(output));
+        };
+      }
+      else
+      {
+        throw std::runtime_error{"ElementwiseActivationLayer(GELU): unsupported data type"};
+      }
+      break;
     default:
       throw std::runtime_error("ElementwiseActivationLayer: unsupported op type");
   }
@@ -36,7 +36,8 @@ enum class ElementwiseActivationType
   kLogistic,
   kReLU,
   kTanh,
-  kLeakyReLU
+  kLeakyReLU,
+  kGELU
 };
 
 class ElementwiseActivationLayer : public ::onert::exec::IFunction
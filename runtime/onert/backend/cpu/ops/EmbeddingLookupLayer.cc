@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EmbeddingLookupLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/EmbeddingLookup.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void EmbeddingLookupLayer::configure(const IPortableTensor *lookups, const IPortableTensor *values,
+                                     IPortableTensor *output,
+                                     const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(lookups != nullptr);
+  assert(values != nullptr);
+  assert(output != nullptr);
+
+  _lookups = lookups;
+  _values = values;
+  _output = output;
+  _external_context = external_context;
+}
+
+template <typename T> void EmbeddingLookupLayer::lookup()
+{
+  nnfw::cker::EmbeddingLookup(getShape(_lookups), getBuffer<int32_t>(_lookups), getShape(_values),
+                              getBuffer<T>(_values), getShape(_output), getBuffer<T>(_output),
+                              _external_context->ruy_context());
+}
+
+void EmbeddingLookupLayer::run()
+{
+  // Rows are copied as bytes, so any data type of values is supported
+  switch (ir::sizeOfDataType(_values->data_type()))
+  {
+    case 1:
+      lookup<uint8_t>();
+      break;
+    case 2:
+      lookup<uint16_t>();
+      break;
+    case 4:
+      lookup<uint32_t>();
+      break;
+    case 8:
+      lookup<uint64_t>();
+      break;
+    default:
+      throw std::runtime_error{"EmbeddingLookup: Unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_GATHERLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -33,14 +34,16 @@ namespace ops
 class GatherLayer : public ::onert::exec::IFunction
 {
 public:
-  GatherLayer() : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}
+  GatherLayer()
+    : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}, _external_context{nullptr}
   {
     // DO NOTHING
   }
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *indices,
-                 IPortableTensor *output, int32_t axis);
+                 IPortableTensor *output, int32_t axis,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -53,6 +56,7 @@ private:
   IPortableTensor *_output;
 
   int32_t _axis;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
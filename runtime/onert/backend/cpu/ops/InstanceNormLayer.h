@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_INSTANCE_NORM_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_INSTANCE_NORM_LAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <exec/IFunction.h>
+#include <ir/InternalType.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class InstanceNormLayer : public ::onert::exec::IFunction
+{
+public:
+  InstanceNormLayer()
+    : _input(nullptr), _gamma(nullptr), _beta(nullptr), _output(nullptr), _epsilon(0.f),
+      _activation(ir::Activation::NONE), _external_context(nullptr)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *gamma,
+                 const IPortableTensor *beta, IPortableTensor *output, float epsilon,
+                 ir::Activation activation,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_gamma;
+  const IPortableTensor *_beta;
+  IPortableTensor *_output;
+
+  float _epsilon;
+  ir::Activation _activation;
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_INSTANCE_NORM_LAYER_H__
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PReLULayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/PReLU.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void PReLULayer::configure(const IPortableTensor *input, const IPortableTensor *alpha,
+                           IPortableTensor *output,
+                           const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(alpha != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _alpha = alpha;
+  _output = output;
+  _external_context = external_context;
+}
+
+void PReLULayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"PReLU: Unsupported data type"};
+
+  nnfw::cker::PReLU(getShape(_input), getBuffer<float>(_input), getShape(_alpha),
+                    getBuffer<float>(_alpha), getShape(_output), getBuffer<float>(_output),
+                    _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -28,7 +28,8 @@ namespace ops
 {
 
 PadLayer::PadLayer()
-  : _input(nullptr), _pad(nullptr), _value(nullptr), _output(nullptr), _constantValueData()
+  : _input(nullptr), _pad(nullptr), _value(nullptr), _output(nullptr), _constantValueData(),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -40,16 +41,19 @@ template <typename T> void PadLayer::padImpl(const T *constant_value_data)
   const auto pad_data = reinterpret_cast<const int32_t *>(_pad->buffer());
   auto pad_rank = _pad->getShape().dim(0);
   nnfw::cker::Pad<T>(pad_data, pad_rank, getShape(_input), getBuffer<T>(_input), getShape(_output),
-                     getBuffer<T>(_output), constant_value_data);
+                     getBuffer<T>(_output), constant_value_data,
+                     _external_context->ruy_context());
 }
 
 void PadLayer::configure(const IPortableTensor *input, const IPortableTensor *pad,
-                         const IPortableTensor *value, IPortableTensor *output)
+                         const IPortableTensor *value, IPortableTensor *output,
+                         const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _pad = pad;
   _value = value;
   _output = output;
+  _external_context = external_context;
 }
 
 void PadLayer::run()
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void RNNLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
+                         const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                         const IPortableTensor *hidden_state_in, IPortableTensor *output,
+                         IPortableTensor *hidden_state_out, ir::Activation activation,
+                         const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(weights != nullptr);
+  assert(recurrent_weights != nullptr);
+  assert(bias != nullptr);
+  assert(hidden_state_in != nullptr);
+  assert(output != nullptr);
+  assert(hidden_state_out != nullptr);
+
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+  _activation = activation;
+  _external_context = external_context;
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"RNN: Unsupported data type"};
+
+  nnfw::cker::RNNParams params;
+  params.activation = convertActivationType(_activation);
+  nnfw::cker::RNN(params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+                  getBuffer<float>(_weights), getShape(_recurrent_weights),
+                  getBuffer<float>(_recurrent_weights), getShape(_bias), getBuffer<float>(_bias),
+                  getShape(_hidden_state_in), getBuffer<float>(_hidden_state_in),
+                  getShape(_output), getBuffer<float>(_output),
+                  getBuffer<float>(_hidden_state_out), _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_RNN_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_RNN_LAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <exec/IFunction.h>
+#include <ir/InternalType.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class RNNLayer : public ::onert::exec::IFunction
+{
+public:
+  RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE), _external_context(nullptr)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *weights,
+                 const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                 const IPortableTensor *hidden_state_in, IPortableTensor *output,
+                 IPortableTensor *hidden_state_out, ir::Activation activation,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_weights;
+  const IPortableTensor *_recurrent_weights;
+  const IPortableTensor *_bias;
+  const IPortableTensor *_hidden_state_in;
+  IPortableTensor *_output;
+  IPortableTensor *_hidden_state_out;
+
+  ir::Activation _activation;
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_RNN_LAYER_H__
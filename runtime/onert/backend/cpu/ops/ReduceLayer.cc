@@ -36,12 +36,12 @@ namespace
 template <typename T>
 void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
                bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               T reducer(const T current, const T in), ruy::Context *ruy_context)
 {
   reduce_kernel.prepare(input->getShape().rank(), axes.size());
-  bool result =
-    reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input), getShape(output),
-                                   getBuffer<T>(output), axes, keep_dims, init_value, reducer);
+  bool result = reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input),
+                                               getShape(output), getBuffer<T>(output), axes,
+                                               keep_dims, init_value, reducer, ruy_context);
 
   if (!result)
   {
@@ -51,31 +51,36 @@ void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std:
 
 template <typename T>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+         ruy::Context *ruy_context)
 {
   switch (reduce_type)
   {
     case ReduceType::kSum:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, static_cast<T>(0), reduce_kernel,
-                       [](const T current, const T in) -> T { return in + current; });
+                       [](const T current, const T in) -> T { return in + current; },
+                       ruy_context);
       break;
     case ReduceType::kProd:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, static_cast<T>(1), reduce_kernel,
-                       [](const T current, const T in) -> T { return in * current; });
+                       [](const T current, const T in) -> T { return in * current; },
+                       ruy_context);
       break;
     case ReduceType::kMax:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
         keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
-        [](const T current, const T in) -> T { return (in > current) ? in : current; });
+        [](const T current, const T in) -> T { return (in > current) ? in : current; },
+        ruy_context);
       break;
     case ReduceType::kMin:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
         keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
-        [](const T current, const T in) -> T { return (in < current) ? in : current; });
+        [](const T current, const T in) -> T { return (in < current) ? in : current; },
+        ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -85,7 +90,8 @@ evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_ty
 // Template specialization for bool type
 template <>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+               ruy::Context *ruy_context)
 {
   static_assert(sizeof(bool) == 1, "cpu backend supports bool type which is 1 byte");
   switch (reduce_type)
@@ -93,12 +99,14 @@ evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType red
     case ReduceType::kAny:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, false, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in || current; });
+                       [](const bool current, const bool in) -> bool { return in || current; },
+                       ruy_context);
       break;
     case ReduceType::kAll:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, true, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in && current; });
+                       [](const bool current, const bool in) -> bool { return in && current; },
+                       ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -107,16 +115,17 @@ evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType red
 
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
 generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+                      ruy::Context *ruy_context)
 {
   switch (input->data_type())
   {
     case OperandType::FLOAT32:
-      return evalType<float>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<float>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     case OperandType::INT32:
-      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     case OperandType::BOOL8:
-      return evalType<bool>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<bool>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     default:
       throw std::runtime_error{"Reduce(generic): unsupported data type"};
   }
@@ -125,7 +134,7 @@ generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
 // TODO Refine this function
 void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
                       const std::vector<int> &axes, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel)
+                      nnfw::cker::Reduce &reduce_kernel, ruy::Context *ruy_context)
 {
   const bool same_scale = (input->data_scale() == output->data_scale() &&
                            input->data_zero_point() == output->data_zero_point());
@@ -142,7 +151,8 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
       [](const int32_t current, const uint8_t in) -> int32_t {
         const int32_t actual_in = static_cast<int32_t>(in);
         return current + actual_in;
-      });
+      },
+      ruy_context);
 
     if (!result)
     {
@@ -152,7 +162,8 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
     return;
   }
 
-  const auto kernel = generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum);
+  const auto kernel =
+    generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum, ruy_context);
   kernel(input, output, axes);
 }
 
@@ -160,7 +171,7 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
 
 ReduceLayer::ReduceLayer()
   : _input(nullptr), _axes(nullptr), _output(nullptr), _reduce_kernel(new nnfw::cker::Reduce()),
-    _kernel(), _reduceType(ReduceType::kInvalid)
+    _kernel(), _reduceType(ReduceType::kInvalid), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -168,12 +179,16 @@ ReduceLayer::ReduceLayer()
 ReduceLayer::~ReduceLayer() = default;
 
 void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                            IPortableTensor *output, ReduceType reduceType, bool keep_dims)
+                            IPortableTensor *output, ReduceType reduceType, bool keep_dims,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _reduceType = reduceType;
+  _external_context = external_context;
+
+  const auto ruy_context = _external_context->ruy_context();
 
   switch (_reduceType)
   {
@@ -181,25 +196,31 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
       if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         _kernel = std::bind(&evalSumQuantized, std::placeholders::_1, std::placeholders::_2,
-                            std::placeholders::_3, keep_dims, *_reduce_kernel);
+                            std::placeholders::_3, keep_dims, *_reduce_kernel, ruy_context);
         return;
       }
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum, ruy_context);
       break;
     case ReduceType::kProd:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd, ruy_context);
       break;
     case ReduceType::kMax:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax, ruy_context);
       break;
     case ReduceType::kMin:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin, ruy_context);
       break;
     case ReduceType::kAny:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny, ruy_context);
       break;
     case ReduceType::kAll:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll, ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -214,7 +235,8 @@ void ReduceLayer::run()
   if (_input->data_type() == ir::DataType::FLOAT32 && _reduceType == ReduceType::kSum &&
       axes.size() == 1 && (axes[0] == -1 || axes[0] == rank - 1))
   {
-    OptimizedReduceSum(getBuffer<float>(_input), getShape(_input), getBuffer<float>(_output));
+    OptimizedReduceSum(getBuffer<float>(_input), getShape(_input), getBuffer<float>(_output),
+                       _external_context->ruy_context());
     return;
   }
 #endif // NEON
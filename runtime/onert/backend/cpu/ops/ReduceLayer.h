@@ -20,6 +20,7 @@
 #include "cker/neon/neon_check.h"
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <memory>
@@ -60,7 +61,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 ReduceType reduceType, bool keep_dims);
+                 ReduceType reduceType, bool keep_dims,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -75,6 +77,7 @@ private:
     _kernel;
 
   ReduceType _reduceType;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_RESIZEBILINEAR_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -37,10 +38,12 @@ public:
 
 public:
   void configure(const IPortableTensor *input1, IPortableTensor *output,
-                 const IPortableTensor *size, bool align_corners, bool half_pixel_centers);
+                 const IPortableTensor *size, bool align_corners, bool half_pixel_centers,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void configure(const IPortableTensor *input, IPortableTensor *output, int32_t output_height,
-                 int32_t output_width, bool align_corners, bool half_pixel_centers);
+                 int32_t output_width, bool align_corners, bool half_pixel_centers,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -52,6 +55,7 @@ private:
   int32_t _output_width;
   bool _align_corners;
   bool _half_pixel_centers;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
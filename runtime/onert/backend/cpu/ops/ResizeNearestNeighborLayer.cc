@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResizeNearestNeighborLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/ResizeNearestNeighbor.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void ResizeNearestNeighborLayer::configure(
+  const IPortableTensor *input, IPortableTensor *output, const IPortableTensor *size,
+  bool align_corners, const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(!size->is_constant());
+  _input = input;
+  _output = output;
+  _size = size;
+  _align_corners = align_corners;
+  _external_context = external_context;
+}
+
+void ResizeNearestNeighborLayer::configure(
+  const IPortableTensor *input, IPortableTensor *output, int32_t output_height,
+  int32_t output_width, bool align_corners,
+  const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(_size == nullptr);
+  if (output_height < 0 || output_width < 0)
+  {
+    throw std::runtime_error{"ResizeNearestNeighbor: size value must be positive value, size = " +
+                             std::to_string(output_height) + "x" + std::to_string(output_width)};
+  }
+  _input = input;
+  _output = output;
+  _output_height = output_height;
+  _output_width = output_width;
+  _align_corners = align_corners;
+  _external_context = external_context;
+}
+
+template <typename T>
+void ResizeNearestNeighborLayer::resize(const nnfw::cker::ResizeNearestNeighborParams &params)
+{
+  nnfw::cker::ResizeNearestNeighbor(params, getShape(_input), getBuffer<T>(_input),
+                                    getShape(_output), getBuffer<T>(_output),
+                                    _external_context->ruy_context());
+}
+
+void ResizeNearestNeighborLayer::run()
+{
+  nnfw::cker::ResizeNearestNeighborParams params;
+  if (_size == nullptr)
+  {
+    params.output_height = _output_height;
+    params.output_width = _output_width;
+  }
+  else
+  {
+    const auto size_buf = getBuffer<int32_t>(_size);
+    params.output_height = size_buf[0];
+    params.output_width = size_buf[1];
+  }
+  params.align_corners = _align_corners;
+
+  // Output must have been resized to the size given at runtime before writing to it
+  const auto output_shape = getShape(_output);
+  if (output_shape.DimensionsCount() != 4 || output_shape.Dims(1) != params.output_height ||
+      output_shape.Dims(2) != params.output_width)
+  {
+    throw std::runtime_error{"ResizeNearestNeighbor: output shape does not match size " +
+                             std::to_string(params.output_height) + "x" +
+                             std::to_string(params.output_width)};
+  }
+
+  // Pixels are copied without arithmetic, so quantized types share the same kernel
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      resize<float>(params);
+      break;
+    case OperandType::INT32:
+      resize<int32_t>(params);
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      resize<uint8_t>(params);
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      resize<int8_t>(params);
+      break;
+    default:
+      throw std::runtime_error{"ResizeNearestNeighbor: Unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -31,7 +31,8 @@ namespace ops
 
 StridedSliceLayer::StridedSliceLayer()
   : _input(nullptr), _begin(nullptr), _end(nullptr), _strides(nullptr), _output(nullptr),
-    _begin_mask(0), _ellipsis_mask(0), _end_mask(0), _new_axis_mask(0), _shrink_axis_mask(0)
+    _begin_mask(0), _ellipsis_mask(0), _end_mask(0), _new_axis_mask(0), _shrink_axis_mask(0),
+    _external_context(nullptr)
 {
 }
 
@@ -46,13 +47,14 @@ template <typename T> void StridedSliceLayer::stridedSliceImpl()
   nnfw::cker::checkOutputSize(op_params, input_shape, output_shape, input_shape.DimensionsCount());
 
   nnfw::cker::StridedSlice(op_params, input_shape, getBuffer<T>(_input), output_shape,
-                           getBuffer<T>(_output));
+                           getBuffer<T>(_output), _external_context->ruy_context());
 }
 
 void StridedSliceLayer::configure(const IPortableTensor *input, const IPortableTensor *begin,
                                   const IPortableTensor *end, const IPortableTensor *strides,
                                   IPortableTensor *output, const int32_t begin_mask,
-                                  const int32_t end_mask, const int32_t shrink_axis_mask)
+                                  const int32_t end_mask, const int32_t shrink_axis_mask,
+                                  const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _begin = begin;
@@ -65,6 +67,8 @@ void StridedSliceLayer::configure(const IPortableTensor *input, const IPortableT
   _end_mask = end_mask;
   _new_axis_mask = 0;
   _shrink_axis_mask = shrink_axis_mask;
+
+  _external_context = external_context;
 }
 
 void StridedSliceLayer::run()
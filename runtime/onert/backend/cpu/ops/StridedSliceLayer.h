@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_STRIDEDSLICELAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -40,7 +41,8 @@ public:
   void configure(const IPortableTensor *input, const IPortableTensor *begin,
                  const IPortableTensor *end, const IPortableTensor *strides,
                  IPortableTensor *output, const int32_t begin_mask, const int32_t end_mask,
-                 const int32_t shrink_axis_mask);
+                 const int32_t shrink_axis_mask,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void run() override;
 
 private:
@@ -58,6 +60,8 @@ private:
   int32_t _end_mask;
   int32_t _new_axis_mask;
   int32_t _shrink_axis_mask;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
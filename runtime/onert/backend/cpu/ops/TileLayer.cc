@@ -29,15 +29,16 @@ namespace cpu
 namespace ops
 {
 
-TileLayer::TileLayer() : _input(nullptr), _multipliers(nullptr), _output(nullptr)
+TileLayer::TileLayer()
+  : _input(nullptr), _multipliers(nullptr), _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void TileLayer::tileFloat32()
 {
-  TileOneDimension(getShape(_input), getBuffer<float>(_input), getBuffer<int>(_multipliers),
-                   getBuffer<float>(_output), 0);
+  nnfw::cker::Tile(getShape(_input), getBuffer<float>(_input), getBuffer<int>(_multipliers),
+                   getBuffer<float>(_output), _external_context->ruy_context());
 }
 
 void TileLayer::tileQuant8()
@@ -47,11 +48,13 @@ void TileLayer::tileQuant8()
 }
 
 void TileLayer::configure(const IPortableTensor *input, const IPortableTensor *multipliers,
-                          IPortableTensor *output)
+                          IPortableTensor *output,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _multipliers = multipliers;
   _output = output;
+  _external_context = external_context;
 }
 
 void TileLayer::run()
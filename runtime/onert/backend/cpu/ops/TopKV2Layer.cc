@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TopKV2Layer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/TopKV2.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void TopKV2Layer::configure(const IPortableTensor *input, IPortableTensor *values,
+                            IPortableTensor *indices, int32_t k,
+                            const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(values != nullptr);
+  assert(indices != nullptr);
+
+  _input = input;
+  _values = values;
+  _indices = indices;
+  _k = k;
+  _external_context = external_context;
+}
+
+template <typename T> void TopKV2Layer::topK()
+{
+  nnfw::cker::TopKV2(getShape(_input), getBuffer<T>(_input), _k, getShape(_values),
+                     getBuffer<T>(_values), getShape(_indices), getBuffer<int32_t>(_indices),
+                     _external_context->ruy_context());
+}
+
+void TopKV2Layer::run()
+{
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      topK<float>();
+      break;
+    case OperandType::INT32:
+      topK<int32_t>();
+      break;
+    case OperandType::INT64:
+      topK<int64_t>();
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      topK<uint8_t>();
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      topK<int8_t>();
+      break;
+    default:
+      throw std::runtime_error{"TopKV2: Unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
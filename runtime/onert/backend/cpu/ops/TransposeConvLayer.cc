@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/TransposeConv.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   IPortableTensor *output, const ir::Padding &padding,
+                                   const ir::Stride &stride,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(kernel != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _kernel = kernel;
+  _output = output;
+  _padding = padding;
+  _stride = stride;
+  _external_context = external_context;
+}
+
+void TransposeConvLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"TransposeConv: Unsupported data type"};
+
+  // Output shape may be given at runtime, so padding is computed with the current shapes.
+  // Transpose convolution is the backward of convolution from output to input.
+  const auto ifm_shape = _input->getShape().asFeature(_input->layout());
+  const auto ofm_shape = _output->getShape().asFeature(_output->layout());
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _kernel->getShape();
+  const auto padding = ir::calculatePadding(_padding, ofm_shape, ifm_shape, _stride,
+                                            ker_shape.dim(2), ker_shape.dim(1));
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_type = getPaddingType(_padding.type);
+  op_params.padding_values.width = padding.left;
+  op_params.padding_values.height = padding.top;
+  op_params.stride_width = _stride.horizontal;
+  op_params.stride_height = _stride.vertical;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+
+  nnfw::cker::TransposeConv(op_params, getShape(_input), getBuffer<float>(_input),
+                            getShape(_kernel), getBuffer<float>(_kernel), getShape(_output),
+                            getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
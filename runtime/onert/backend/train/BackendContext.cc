@@ -23,6 +23,7 @@
 #include <backend/basic/train/TrainableBackendContextHelpers.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace onert
@@ -41,6 +42,40 @@ ir::OperandInfo createBackwardTensorInfo(const ir::Operand &operand)
                          operand.isConstant()};
 }
 
+// Operations that are not required for backwarding(e.g. frozen layers before the earliest
+// trainable layer) are pruned
+std::vector<ir::OperationIndex> getBackwardOrder(const ir::train::TrainableGraph &tgraph)
+{
+  auto ret = tgraph.btopolSortOperations();
+  ret.erase(std::remove_if(ret.begin(), ret.end(),
+                           [&](const ir::OperationIndex &index) {
+                             return !tgraph.operation(index).isRequiredForBackward();
+                           }),
+            ret.end());
+  return ret;
+}
+
+// Check if gradients are back-propagated to the operand, that is, it is defined by an operation
+// required for backwarding
+bool isBackPropagated(const ir::train::TrainableGraph &tgraph, const ir::OperandIndex &index)
+{
+  const auto &def = tgraph.operands().at(index).getDef();
+  return def.valid() && tgraph.operations().exist(def) &&
+         tgraph.operation(def).isRequiredForBackward();
+}
+
+// Check if the constant operand is updated by an operation whose weights update is enabled
+bool isUpdated(const ir::train::TrainableGraph &tgraph, const ir::OperandIndex &index)
+{
+  const auto &uses = tgraph.operands().at(index).getUses();
+  return std::any_of(uses.begin(), uses.end(), [&](const ir::OperationIndex &use) {
+    if (!tgraph.operations().exist(use))
+      return false;
+    const auto &op = tgraph.operation(use);
+    return op.isRequiredForBackward() && op.isWeightsUpdateEnabled();
+  });
+}
+
 // NOTE Even if there are duplicate indices, the duplicate back-propagated tensors may need
 //      to be updated respectively. So we use a sequence instead of a set.
 ir::OperandIndexSequence getBackPropSeq(const ir::train::TrainableGraph &tgraph,
@@ -52,8 +87,7 @@ ir::OperandIndexSequence getBackPropSeq(const ir::train::TrainableGraph &tgraph,
   for (const auto &input : (op.getInputs() | ir::Remove::UNDEFINED))
   {
     const auto &operand = tgraph.operands().at(input);
-    // TODO Remove other inputs that are not back-propagated
-    if (!operand.isConstant() && !tgraph.getInputs().contains(input))
+    if (!operand.isConstant() && isBackPropagated(tgraph, input))
       ret.append(input);
   }
 
@@ -65,13 +99,11 @@ void AddBackPropInitializers(const ir::train::TrainableGraph &tgraph, TensorRegi
 {
   util::Set<ir::OperandIndex> unvisited;
   tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
-    // TODO Consider not adding BackPropInitializer if the coresponding BackPropTensors don't
-    //      require initilization (i.g. BackPropTensors that are not back-propagated)
-    if (!tgraph.getInputs().contains(index) && !operand.isConstant())
+    if (!operand.isConstant() && tensor_reg.getBackPropTensor(index) != nullptr)
       unvisited.add(index);
   });
 
-  for (const auto &op_index : tgraph.btopolSortOperations())
+  for (const auto &op_index : getBackwardOrder(tgraph))
   {
     assert(fn_map.find(op_index) != fn_map.end());
 
@@ -103,7 +135,51 @@ void AddBackPropInitializers(const ir::train::TrainableGraph &tgraph, TensorRegi
 
 backend::ITensorRegistry *BackendContext::genTensors()
 {
-  return basic::train::genTensors(*this, _tensor_builder);
+  const auto &recomputed_operands = _tdata->recomputed_operands;
+  if (recomputed_operands.empty())
+    return basic::train::genTensors(*this, _tensor_builder);
+
+  const ir::train::TrainableGraph &tgraph = *trainable_graph();
+  auto tensor_builder = _tensor_builder;
+
+  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (external_operands().contains(ind))
+      return;
+    // NOTE Assuming there is no layout changes (Always assume NHWC or UNKNOWN)
+    assert(tgraph.layout() != ir::Layout::NCHW);
+    tensor_builder->registerTensorInfo(ind, obj.info(), ir::Layout::NHWC);
+  });
+
+  auto is_recomputed = [&](const ir::OperandIndex &ind) {
+    return std::any_of(
+      recomputed_operands.begin(), recomputed_operands.end(),
+      [&](const util::Set<ir::OperandIndex> &group) { return group.contains(ind); });
+  };
+
+  // Kept tensors are never deallocated
+  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &) {
+    if (tensor_builder->isRegistered(ind) && !is_recomputed(ind))
+      tensor_builder->notifyFirstUse(ind);
+  });
+
+  // Recomputed tensors of different groups share memory
+  for (const auto &group : recomputed_operands)
+  {
+    for (const auto &ind : group)
+    {
+      if (tensor_builder->isRegistered(ind))
+        tensor_builder->notifyFirstUse(ind);
+    }
+    for (const auto &ind : group)
+    {
+      if (tensor_builder->isRegistered(ind))
+        tensor_builder->notifyLastUse(ind);
+    }
+  }
+
+  tensor_builder->allocate();
+
+  return _tensor_registry.get();
 }
 
 backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
@@ -117,6 +193,10 @@ backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
     // NOTE Assuming there is no layout changes (Always assume NHWC or UNKNOWN)
     assert(tgraph.layout() != ir::Layout::NCHW);
 
+    // Neither back-propagated tensors nor gradients are needed for pruned or frozen operations
+    if (obj.isConstant() ? !isUpdated(tgraph, ind) : !isBackPropagated(tgraph, ind))
+      return;
+
     tensor_builder->registerBackwardTensorInfo(ind, createBackwardTensorInfo(obj),
                                                ir::Layout::NHWC);
   });
@@ -127,7 +207,7 @@ backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
       tensor_builder->notifyBackwardFirstUse(ind);
   });
 
-  for (const auto &op_index : tgraph.btopolSortOperations())
+  for (const auto &op_index : getBackwardOrder(tgraph))
   {
     const auto back_prop_seq = getBackPropSeq(tgraph, op_index);
     for (const auto &back_prop_index : back_prop_seq)
@@ -152,7 +232,7 @@ void BackendContext::planDisposableBackPropTensors()
   auto tensor_builder = _tensor_builder;
 
   std::vector<DisposableTensorIndex> prev_seq;
-  for (const auto &op_index : tgraph.btopolSortOperations())
+  for (const auto &op_index : getBackwardOrder(tgraph))
   {
     for (const auto &index : prev_seq)
     {
@@ -223,8 +303,22 @@ FunctionMap BackendContext::generateFunctionMap()
     ret.emplace(op_ind, std::move(fn_seq));
   }
 
-  // NOTE Each BackPropInitializer should be called first in each op node during backwarding
   const auto &tgraph = *_tdata->tgraph;
+
+  // NOTE Gradients of all trainable tensors are applied at once after the last op node of this
+  //      backend is backwarded, so that they are updated in a single pass
+  auto gradient_applier = kernel_gen->releaseGradientApplier();
+  if (gradient_applier)
+  {
+    const auto backward_order = getBackwardOrder(tgraph);
+    auto last_it =
+      std::find_if(backward_order.rbegin(), backward_order.rend(),
+                   [&](const ir::OperationIndex &op_ind) { return ret.count(op_ind) > 0; });
+    if (last_it != backward_order.rend())
+      ret.at(*last_it)->append(std::move(gradient_applier));
+  }
+
+  // NOTE Each BackPropInitializer should be called first in each op node during backwarding
   auto tensor_reg = nnfw::misc::polymorphic_downcast<TensorRegistry *>(_tensor_registry.get());
   AddBackPropInitializers(tgraph, *tensor_reg, ret);
 
@@ -95,15 +95,6 @@ void appendBackPropAccumulator(const ir::train::ITrainableOperation &op,
     }
   }
 }
-
-std::unique_ptr<ops::GradientApplier>
-generateGradientApplier(const exec::train::optimizer::Optimizer *optimizer,
-                        const IPortableTensor *gradient, ITrainableTensor *trainable)
-{
-  auto update_fn = std::make_unique<ops::GradientApplier>();
-  update_fn->configure(optimizer, gradient, trainable);
-  return update_fn;
-}
 } // namespace
 
 std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::OperationIndex idx)
@@ -120,10 +111,6 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
   assert(_return_fn);
   ret->append(std::move(_return_fn));
 
-  for (auto &&update_fn : _update_funcs)
-    ret->append(std::move(update_fn));
-  _update_funcs.clear();
-
   for (auto &&ind : (op.getInputs() | ir::Remove::UNDEFINED) + op.getOutputs())
   {
     auto portable_tensor = _tensor_reg->getPortableTensor(ind);
@@ -140,14 +127,29 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
   return ret;
 }
 
+std::unique_ptr<exec::train::IGradientApplier> KernelGenerator::releaseGradientApplier()
+{
+  if (_gradient_applier->empty())
+    return nullptr;
+
+  // Tensors are allocated before generating kernels
+  _gradient_applier->prepare();
+  auto applier = std::move(_gradient_applier);
+  _gradient_applier = std::make_unique<ops::GradientApplier>();
+  _gradient_applier->configure(_optimizer);
+  return applier;
+}
+
 KernelGenerator::KernelGenerator(const ir::train::TrainableGraph &tgraph,
                                  const std::shared_ptr<TensorRegistry> &tensor_reg,
                                  const std::shared_ptr<ExternalContext> &external_context,
                                  const exec::train::optimizer::Optimizer *optimizer)
   : backend::train::KernelGeneratorBase{tgraph}, _current_layout{tgraph.layout()},
     _tensor_reg{tensor_reg}, _external_context(external_context), _optimizer{optimizer},
-    _update_funcs{}, _node_to_idx{}
+    _gradient_applier{std::make_unique<ops::GradientApplier>()}, _node_to_idx{}
 {
+  _gradient_applier->configure(optimizer);
+
   tgraph.operations().iterate(
     [&](const onert::ir::OperationIndex &idx, const onert::ir::IOperation &op) {
       assert(_node_to_idx.find(&op) == _node_to_idx.end());
@@ -226,10 +228,11 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
 
   _return_fn = std::move(fn);
 
-  // Generate GradientApplier
-  if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+  // Append to GradientApplier. Weights of frozen operations have no gradients.
+  if (bias_grad_tensor)
+    _gradient_applier->append(bias_grad_tensor, bias_tensor);
+  if (ker_grad_tensor)
+    _gradient_applier->append(ker_grad_tensor, ker_tensor);
 }
 
 void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
@@ -275,10 +278,11 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
 
   _return_fn = std::move(fn);
 
-  // Generate GradientApplier
-  if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+  // Append to GradientApplier. Weights of frozen operations have no gradients.
+  if (bias_grad_tensor)
+    _gradient_applier->append(bias_grad_tensor, bias_tensor);
+  if (ker_grad_tensor)
+    _gradient_applier->append(ker_grad_tensor, ker_tensor);
 }
 
 void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &node)
@@ -334,11 +338,11 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
 
   _return_fn = std::move(fn);
 
-  // Generate GradientAppliers
-  if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(
-    generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor));
+  // Append to GradientApplier. Weights of frozen operations have no gradients.
+  if (bias_grad_tensor)
+    _gradient_applier->append(bias_grad_tensor, bias_tensor);
+  if (weights_grad_tensor)
+    _gradient_applier->append(weights_grad_tensor, weights_tensor);
 }
 
 void KernelGenerator::visit(const ir::train::operation::Loss &node)
@@ -405,7 +409,8 @@ void KernelGenerator::visit(const ir::train::operation::Pad &node)
   auto out_back_prop_tensor = getBackPropOut(output_index);
   auto in_back_prop_tensor = getBackPropIn(node, input_index);
 
-  fn->configure(input, pad, value, output, in_back_prop_tensor, out_back_prop_tensor);
+  fn->configure(input, pad, value, output, in_back_prop_tensor, out_back_prop_tensor,
+                _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -21,6 +21,7 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "Tensor.h"
+#include "ops/GradientApplier.h"
 
 #include <backend/train/KernelGeneratorBase.h>
 #include <exec/train/IGradientApplier.h>
@@ -46,6 +47,12 @@ public:
 
   std::unique_ptr<exec::train::TrainableFnSequence> generate(ir::OperationIndex op_ind) override;
 
+  /**
+   * @brief Release the applier of gradients of all trainable tensors in generated kernels
+   * @return Null if there is no trainable tensor
+   */
+  std::unique_ptr<exec::train::IGradientApplier> releaseGradientApplier();
+
   void visit(const ir::train::operation::BinaryArithmetic &) override;
   void visit(const ir::train::operation::Conv2D &) override;
   void visit(const ir::train::operation::DepthwiseConv2D &) override;
@@ -68,7 +75,7 @@ private:
   std::shared_ptr<TensorRegistry> _tensor_reg;
   const std::shared_ptr<ExternalContext> _external_context;
   const exec::train::optimizer::Optimizer *_optimizer;
-  std::vector<std::unique_ptr<exec::train::IGradientApplier>> _update_funcs;
+  std::unique_ptr<ops::GradientApplier> _gradient_applier;
   std::unordered_map<const ir::IOperation *, ir::OperationIndex> _node_to_idx;
 };
 
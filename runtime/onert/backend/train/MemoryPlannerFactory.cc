@@ -43,6 +43,11 @@ basic::IMemoryPlanner<DisposableTensorIndex> *MemoryPlannerFactory::create(const
   {
     return new WICPlanner;
   }
+  else if (key == "InPlace")
+  {
+    // In-place sharing is not applied to training tensors
+    return new WICPlanner;
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
@@ -117,9 +117,13 @@ void TensorBuilder::notifyFirstUse(const ir::OperandIndex &index)
   }
 }
 
-void TensorBuilder::notifyLastUse(const ir::OperandIndex &)
+void TensorBuilder::notifyLastUse(const ir::OperandIndex &index)
 {
-  // TODO Support momory plan
+  // Trainable tensors are alive during training
+  if (!_as_constants[index])
+  {
+    _tensor_mgr->releaseNonConstPlan(index);
+  }
 }
 
 void TensorBuilder::notifyBackwardFirstUse(const ir::OperandIndex &index)
@@ -88,19 +88,29 @@ void ConvolutionLayer::configure(
   if (_dilationHeightFactor != 1 || _dilationWidthFactor != 1)
     throw std::runtime_error("train ConvolutionLayer: Unsupported dilation yet");
 
+  // Buffers for backwarding are unnecessary if this layer is not backwarded
+  if (back_prop_output == nullptr)
+    return;
+
   // TODO Optimize transposed tensors
-  _transposed_weights = createTransposedWeights<Tensor>(weights);
-  _transposed_weights->setBuffer(
-    std::make_shared<basic::Allocator>(_transposed_weights->total_size()));
+  if (back_prop_input != nullptr)
+  {
+    _transposed_weights = createTransposedWeights<Tensor>(weights);
+    _transposed_weights->setBuffer(
+      std::make_shared<basic::Allocator>(_transposed_weights->total_size()));
+  }
 
   _conv_back_prop_output =
     std::make_unique<BackPropTensor>(back_prop_output->get_info(), back_prop_output->layout());
   _conv_back_prop_output->setBuffer(
     std::make_shared<basic::Allocator>(_conv_back_prop_output->total_size()));
 
-  _transposed_grad_weights = createTransposedWeights<GradientTensor>(weights);
-  _transposed_grad_weights->setBuffer(
-    std::make_shared<basic::Allocator>(_transposed_grad_weights->total_size()));
+  if (grad_weights != nullptr)
+  {
+    _transposed_grad_weights = createTransposedWeights<GradientTensor>(weights);
+    _transposed_grad_weights->setBuffer(
+      std::make_shared<basic::Allocator>(_transposed_grad_weights->total_size()));
+  }
 
   if (activation != ir::Activation::NONE)
   {
@@ -120,7 +130,7 @@ void ConvolutionLayer::backward()
   {
     case OperandType::FLOAT32:
     {
-      assert(data_type == _grad_bias->data_type());
+      assert(_grad_bias == nullptr || data_type == _grad_bias->data_type());
       backwardFloat32();
       break;
     }
@@ -154,50 +164,53 @@ void ConvolutionLayer::backwardFloat32()
   conv_train_params.dilation_width_factor = _dilationWidthFactor;
   conv_train_params.dilation_height_factor = _dilationHeightFactor;
 
-  // Transpose weights from OHWI to HWIO
-  auto transposed_weights = _transposed_weights.get();
-  assert(transposed_weights->getShape().rank() == 4);
-  nnfw::cker::TransposeParams transpose_param;
-  transpose_param.perm_count = transposed_weights->getShape().rank();
-  transpose_param.perm[0] = 1;
-  transpose_param.perm[1] = 2;
-  transpose_param.perm[2] = 3;
-  transpose_param.perm[3] = 0;
-  nnfw::cker::Transpose(transpose_param, getShape(_kernel), getBuffer<float>(_kernel),
-                        getShape(transposed_weights), getBuffer<float>(transposed_weights));
-
-  // Calculate gradient for input
-  nnfw::cker::train::ConvInputGrad(
-    conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act),
-    getShape(transposed_weights), getBuffer<float>(transposed_weights), _paddingBottom,
-    _paddingRight, getShape(_back_prop_input), getBuffer<float>(_back_prop_input));
-
-  // Calculate gradient for weights
-  auto transposed_grad_weights = _transposed_grad_weights.get();
-  assert(_grad_weights->getShape().rank() == 4);
-  assert(transposed_grad_weights->getShape().rank() == 4);
-  nnfw::cker::train::ConvFilterGrad(
-    conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
-    getBuffer<float>(_input), _paddingBottom, _paddingRight, getShape(transposed_grad_weights),
-    getBuffer<float>(transposed_grad_weights));
-
-  // Transpose weights'gradient from HWIO to OHWI
-  nnfw::cker::TransposeParams transpose_grad_param;
-  transpose_grad_param.perm_count = transposed_grad_weights->getShape().rank();
-  transpose_grad_param.perm[0] = 3;
-  transpose_grad_param.perm[1] = 0;
-  transpose_grad_param.perm[2] = 1;
-  transpose_grad_param.perm[3] = 2;
-  nnfw::cker::Transpose(transpose_grad_param, getShape(transposed_grad_weights),
-                        getBuffer<float>(transposed_grad_weights), getShape(_grad_weights),
-                        getBuffer<float>(_grad_weights));
+  // Calculate gradient for input if it is back-propagated
+  if (_back_prop_input != nullptr)
+  {
+    // Transpose weights from OHWI to HWIO
+    auto transposed_weights = _transposed_weights.get();
+    assert(transposed_weights->getShape().rank() == 4);
+    nnfw::cker::TransposeParams transpose_param;
+    transpose_param.perm_count = transposed_weights->getShape().rank();
+    transpose_param.perm[0] = 1;
+    transpose_param.perm[1] = 2;
+    transpose_param.perm[2] = 3;
+    transpose_param.perm[3] = 0;
+    nnfw::cker::Transpose(transpose_param, getShape(_kernel), getBuffer<float>(_kernel),
+                          getShape(transposed_weights), getBuffer<float>(transposed_weights));
+
+    nnfw::cker::train::ConvInputGrad(
+      conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act),
+      getShape(transposed_weights), getBuffer<float>(transposed_weights), _paddingBottom,
+      _paddingRight, getShape(_back_prop_input), getBuffer<float>(_back_prop_input));
+  }
+
+  // Calculate gradient for weights if they are updated
+  if (_grad_weights != nullptr)
+  {
+    auto transposed_grad_weights = _transposed_grad_weights.get();
+    assert(_grad_weights->getShape().rank() == 4);
+    assert(transposed_grad_weights->getShape().rank() == 4);
+    nnfw::cker::train::ConvFilterGrad(
+      conv_train_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
+      getBuffer<float>(_input), _paddingBottom, _paddingRight, getShape(transposed_grad_weights),
+      getBuffer<float>(transposed_grad_weights));
+
+    // Transpose weights'gradient from HWIO to OHWI
+    nnfw::cker::TransposeParams transpose_grad_param;
+    transpose_grad_param.perm_count = transposed_grad_weights->getShape().rank();
+    transpose_grad_param.perm[0] = 3;
+    transpose_grad_param.perm[1] = 0;
+    transpose_grad_param.perm[2] = 1;
+    transpose_grad_param.perm[3] = 2;
+    nnfw::cker::Transpose(transpose_grad_param, getShape(transposed_grad_weights),
+                          getBuffer<float>(transposed_grad_weights), getShape(_grad_weights),
+                          getBuffer<float>(_grad_weights));
+  }
 
   // Calculate gradient for bias
-  if (_bias)
-  {
-    assert(_grad_bias);
+  if (_bias && _grad_bias)
     biasGrad(backprop_act, _grad_bias);
-  }
 }
 
 } // namespace ops
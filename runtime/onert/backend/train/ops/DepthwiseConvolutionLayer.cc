@@ -56,6 +56,10 @@ void DepthwiseConvolutionLayer::configure(
   _grad_weights = grad_weights;
   _grad_bias = grad_bias;
 
+  // Buffers for backwarding are unnecessary if this layer is not backwarded
+  if (back_prop_output == nullptr)
+    return;
+
   if (activation != ir::Activation::NONE)
   {
     _act_back_prop_output =
@@ -104,10 +108,9 @@ void DepthwiseConvolutionLayer::configure(
   _filter_buffers = std::make_unique<Tensor>(filter_buffers_info, _kernel->layout());
   _filter_buffers->setBuffer(std::make_shared<basic::Allocator>(_filter_buffers->total_size()));
 
-  auto filter_dim_buffers_info = ir::OperandInfo(_back_prop_input->get_info());
+  auto filter_dim_buffers_info = ir::OperandInfo(_input->get_info());
   filter_dim_buffers_info.shape({thread_count, padded_filter_inner_dim_size});
-  _filter_dim_buffers =
-    std::make_unique<Tensor>(filter_dim_buffers_info, _back_prop_input->layout());
+  _filter_dim_buffers = std::make_unique<Tensor>(filter_dim_buffers_info, _input->layout());
   _filter_dim_buffers->setBuffer(
     std::make_shared<basic::Allocator>(_filter_dim_buffers->total_size()));
 }
@@ -122,7 +125,7 @@ void DepthwiseConvolutionLayer::backward()
   {
     case OperandType::FLOAT32:
     {
-      assert(data_type == _grad_bias->data_type());
+      assert(_grad_bias == nullptr || data_type == _grad_bias->data_type());
       backwardFloat32();
       break;
     }
@@ -153,25 +156,28 @@ void DepthwiseConvolutionLayer::backwardFloat32()
   dconv_params.padding_values.height = _paddingTop;
   dconv_params.depth_multiplier = _multiplier;
 
-  // Calculate gradient for input
-  _dconv_kernel->backpropInput(
-    dconv_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_kernel),
-    getBuffer<float>(_kernel), getBuffer<float>(_padded_filter.get()), getShape(_back_prop_input),
-    getBuffer<float>(_back_prop_input), _use_padded_filter, getBuffer<float>(_filter_buffers.get()),
-    getBuffer<float>(_filter_dim_buffers.get()));
+  // Calculate gradient for input if it is back-propagated
+  if (_back_prop_input != nullptr)
+  {
+    _dconv_kernel->backpropInput(
+      dconv_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_kernel),
+      getBuffer<float>(_kernel), getBuffer<float>(_padded_filter.get()),
+      getShape(_back_prop_input), getBuffer<float>(_back_prop_input), _use_padded_filter,
+      getBuffer<float>(_filter_buffers.get()), getBuffer<float>(_filter_dim_buffers.get()));
+  }
 
-  // Calculate gradient for weights
-  _dconv_kernel->backpropFilter(
-    dconv_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
-    getBuffer<float>(_input), getShape(_grad_weights), getBuffer<float>(_grad_weights),
-    getBuffer<float>(_padded_filter.get()), getBuffer<float>(_filter_buffers.get()));
+  // Calculate gradient for weights if they are updated
+  if (_grad_weights != nullptr)
+  {
+    _dconv_kernel->backpropFilter(
+      dconv_params, getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
+      getBuffer<float>(_input), getShape(_grad_weights), getBuffer<float>(_grad_weights),
+      getBuffer<float>(_padded_filter.get()), getBuffer<float>(_filter_buffers.get()));
+  }
 
   // Calculate gradient for bias
-  if (_bias)
-  {
-    assert(_grad_bias);
+  if (_bias && _grad_bias)
     biasGrad(backprop_act, _grad_bias);
-  }
 }
 
 } // namespace ops
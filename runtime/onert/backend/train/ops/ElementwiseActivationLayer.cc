@@ -42,8 +42,8 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
 {
   assert(input != nullptr);
   assert(output != nullptr);
-  assert(back_prop_input != nullptr);
-  assert(back_prop_output != nullptr);
+  // NOTE Back-propagated tensors are nullptr if this layer is not backwarded
+  assert((back_prop_input == nullptr) == (back_prop_output == nullptr));
 
   _back_prop_input = back_prop_input;
   _back_prop_output = back_prop_output;
@@ -85,21 +85,30 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
       "train FullyConnectedLayer: Weight formats other than default are not supported."};
 
   if (input->get_info().shape().rank() != 2 || weights->get_info().shape().rank() != 2 ||
-      output->get_info().shape().rank() != 2 || back_prop_input->get_info().shape().rank() != 2 ||
-      grad_weights->get_info().shape().rank() != 2 ||
-      back_prop_output->get_info().shape().rank() != 2)
+      output->get_info().shape().rank() != 2)
     throw std::runtime_error{
       "train FullyConnectedLayer: Input other ranks than 2 are not supported."};
 
-  _transposed_weights = createTransposedTensor(weights);
-  _transposed_weights->setBuffer(std::make_shared<basic::Allocator>(weights->total_size()));
+  // Buffers for backwarding are unnecessary if this layer is not backwarded
+  if (back_prop_output == nullptr)
+    return;
 
-  _transposed_input = createTransposedTensor(input);
-  _transposed_input->setBuffer(std::make_shared<basic::Allocator>(input->total_size()));
 
-  _transposed_back_prop_output = createTransposedTensor(back_prop_output);
-  _transposed_back_prop_output->setBuffer(
-    std::make_shared<basic::Allocator>(back_prop_output->total_size()));
+  if (back_prop_input != nullptr)
+  {
+    _transposed_weights = createTransposedTensor(weights);
+    _transposed_weights->setBuffer(std::make_shared<basic::Allocator>(weights->total_size()));
+  }
+
+  if (grad_weights != nullptr)
+  {
+    _transposed_input = createTransposedTensor(input);
+    _transposed_input->setBuffer(std::make_shared<basic::Allocator>(input->total_size()));
+
+    _transposed_back_prop_output = createTransposedTensor(back_prop_output);
+    _transposed_back_prop_output->setBuffer(
+      std::make_shared<basic::Allocator>(back_prop_output->total_size()));
+  }
 
   if (activation != ir::Activation::NONE)
   {
@@ -120,7 +129,7 @@ void FullyConnectedLayer::backward()
   {
     case OperandType::FLOAT32:
     {
-      assert(data_type == _grad_weights->data_type());
+      assert(_grad_weights == nullptr || data_type == _grad_weights->data_type());
       assert(_grad_bias == nullptr || data_type == _grad_bias->data_type());
       backwardFloat32();
       break;
@@ -162,40 +171,46 @@ void FullyConnectedLayer::backwardFloat32()
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
 
-  // Transpose and compute gradient for input
+  // Transpose and compute gradient for input if it is back-propagated
   // ∂L/∂X = fc(Incoming gradient, transposed W)
-  auto transposed_weights = _transposed_weights.get();
-  assert(transposed_weights->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_weights), getBuffer<float>(_weights),
-                        getShape(transposed_weights), getBuffer<float>(transposed_weights));
-
-  nnfw::cker::FullyConnected(op_params, getShape(backprop_act), getBuffer<float>(backprop_act),
-                             getShape(transposed_weights), getBuffer<float>(transposed_weights),
-                             getShape(nullptr), nullptr, getShape(_back_prop_input),
-                             getBuffer<float>(_back_prop_input));
+  if (_back_prop_input != nullptr)
+  {
+    auto transposed_weights = _transposed_weights.get();
+    assert(transposed_weights->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(_weights), getBuffer<float>(_weights),
+                          getShape(transposed_weights), getBuffer<float>(transposed_weights));
+
+    nnfw::cker::FullyConnected(op_params, getShape(backprop_act), getBuffer<float>(backprop_act),
+                               getShape(transposed_weights), getBuffer<float>(transposed_weights),
+                               getShape(nullptr), nullptr, getShape(_back_prop_input),
+                               getBuffer<float>(_back_prop_input));
+  }
 
-  // Transpose and compute gradient for weights
+  // Transpose and compute gradient for weights if they are updated
   // ∂L/∂W = fc(transposed incomming gradient, transposed X)
-  auto transposed_input = _transposed_input.get();
-  assert(transposed_input->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_input), getBuffer<float>(_input),
-                        getShape(transposed_input), getBuffer<float>(transposed_input));
-
-  auto transposed_back_prop_output = _transposed_back_prop_output.get();
-  assert(transposed_back_prop_output->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(backprop_act), getBuffer<float>(backprop_act),
-                        getShape(transposed_back_prop_output),
-                        getBuffer<float>(transposed_back_prop_output));
-
-  nnfw::cker::FullyConnected(
-    op_params, getShape(transposed_back_prop_output), getBuffer<float>(transposed_back_prop_output),
-    getShape(transposed_input), getBuffer<float>(transposed_input), getShape(nullptr), nullptr,
-    getShape(_grad_weights), getBuffer<float>(_grad_weights));
+  if (_grad_weights != nullptr)
+  {
+    auto transposed_input = _transposed_input.get();
+    assert(transposed_input->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(_input), getBuffer<float>(_input),
+                          getShape(transposed_input), getBuffer<float>(transposed_input));
+
+    auto transposed_back_prop_output = _transposed_back_prop_output.get();
+    assert(transposed_back_prop_output->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(backprop_act), getBuffer<float>(backprop_act),
+                          getShape(transposed_back_prop_output),
+                          getBuffer<float>(transposed_back_prop_output));
+
+    nnfw::cker::FullyConnected(op_params, getShape(transposed_back_prop_output),
+                               getBuffer<float>(transposed_back_prop_output),
+                               getShape(transposed_input), getBuffer<float>(transposed_input),
+                               getShape(nullptr), nullptr, getShape(_grad_weights),
+                               getBuffer<float>(_grad_weights));
+  }
 
   // Compute gradient for bias
-  if (_bias)
+  if (_bias && _grad_bias)
   {
-    assert(_grad_bias);
     nnfw::cker::train::FullyConnectedBiasGrad(getShape(backprop_act),
                                               getBuffer<float>(backprop_act), getShape(_grad_bias),
                                               getBuffer<float>(_grad_bias));
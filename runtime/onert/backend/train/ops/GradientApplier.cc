@@ -27,23 +27,28 @@ namespace train
 namespace ops
 {
 
-GradientApplier::GradientApplier() : _optimizer{nullptr}, _gradient_tensor{}, _trainable_tensor{}
+GradientApplier::GradientApplier() : _optimizer{nullptr}, _tensors{}, _apply_gradients{}
 {
   // DO NOTHING
 }
 
-void GradientApplier::configure(const exec::train::optimizer::Optimizer *optimizer,
-                                const IPortableTensor *gradient, ITrainableTensor *trainable)
+void GradientApplier::configure(const exec::train::optimizer::Optimizer *optimizer)
 {
   _optimizer = optimizer;
-  _gradient_tensor = gradient;
-  _trainable_tensor = trainable;
 }
 
+void GradientApplier::append(const IPortableTensor *gradient, ITrainableTensor *trainable)
+{
+  assert(gradient != nullptr && trainable != nullptr);
+  _tensors.emplace_back(gradient, trainable);
+}
+
+void GradientApplier::prepare() { _apply_gradients = _optimizer->prepareGradients(_tensors); }
+
 void GradientApplier::applyGradient(uint32_t training_step)
 {
-  _optimizer->applyGradient(
-    std::forward_as_tuple(*_gradient_tensor, *_trainable_tensor, training_step));
+  assert(_apply_gradients);
+  _apply_gradients(training_step);
 }
 
 } // namespace ops
@@ -21,6 +21,8 @@
 
 #include <exec/train/optimizer/Optimizer.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -30,20 +32,28 @@ namespace train
 namespace ops
 {
 
+/**
+ * @brief Apply gradients to trainable tensors with an optimizer
+ *
+ * All trainable tensors are updated at once, so that optimizers can update them in a single pass.
+ * The optimizer prepares the update once in @c prepare after tensors are allocated.
+ */
 class GradientApplier : public ::onert::exec::train::IGradientApplier
 {
 public:
   GradientApplier();
   ~GradientApplier() = default;
 
-  void configure(const exec::train::optimizer::Optimizer *optimizer,
-                 const IPortableTensor *gradient, ITrainableTensor *trainable);
+  void configure(const exec::train::optimizer::Optimizer *optimizer);
+  void append(const IPortableTensor *gradient, ITrainableTensor *trainable);
+  bool empty() const { return _tensors.empty(); }
+  void prepare();
   void applyGradient(uint32_t training_step) override;
 
 private:
   const exec::train::optimizer::Optimizer *_optimizer;
-  const IPortableTensor *_gradient_tensor;
-  ITrainableTensor *_trainable_tensor;
+  std::vector<exec::train::optimizer::GradientPair> _tensors;
+  exec::train::optimizer::ApplyGradientsFn _apply_gradients;
 };
 
 } // namespace ops
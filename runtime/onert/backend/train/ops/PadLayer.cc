@@ -45,9 +45,10 @@ template <typename T> void PadLayer::depad()
 
 void PadLayer::configure(const IPortableTensor *input, const IPortableTensor *pad,
                          const IPortableTensor *value, IPortableTensor *output,
-                         IPortableTensor *back_prop_input, const IPortableTensor *back_prop_output)
+                         IPortableTensor *back_prop_input, const IPortableTensor *back_prop_output,
+                         const std::shared_ptr<ExternalContext> &external_context)
 {
-  cpu::ops::PadLayer::configure(input, pad, value, output);
+  cpu::ops::PadLayer::configure(input, pad, value, output, external_context);
   _back_prop_input = back_prop_input;
   _back_prop_output = back_prop_output;
 }
@@ -19,6 +19,7 @@
 
 #include <ops/PadLayer.h>
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/train/ITrainableFunction.h>
@@ -44,7 +45,8 @@ public:
 
   void configure(const IPortableTensor *input, const IPortableTensor *pad,
                  const IPortableTensor *value, IPortableTensor *output,
-                 IPortableTensor *back_prop_input, const IPortableTensor *back_prop_output);
+                 IPortableTensor *back_prop_input, const IPortableTensor *back_prop_output,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void forward(bool training) override;
   void backward() override;
 
@@ -74,6 +74,50 @@ void Adam::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+exec::train::optimizer::ApplyGradientsFn
+Adam::prepareGradients(const std::vector<exec::train::optimizer::GradientPair> &tensors) const
+{
+  std::vector<nnfw::cker::train::AdamBuffers> buffers;
+  for (const auto &pair : tensors)
+  {
+    const auto &grad_tensor = *pair.first;
+    auto &trainable_tensor = *pair.second;
+    const auto opt_vars = trainable_tensor.optVars();
+    assert(opt_vars.size() == 2);
+    auto m_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(0));
+    auto v_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(1));
+
+    if (trainable_tensor.getShape() != grad_tensor.getShape() ||
+        trainable_tensor.getShape() != m_tensor->getShape() ||
+        trainable_tensor.getShape() != v_tensor->getShape())
+    {
+      throw std::runtime_error("Adam: Invalid gradient tensor");
+    }
+
+    if (grad_tensor.data_type() != ir::DataType::FLOAT32 ||
+        trainable_tensor.data_type() != ir::DataType::FLOAT32)
+      throw std::runtime_error("Adam: Not supported data type");
+
+    buffers.emplace_back(nnfw::cker::train::AdamBuffers{
+      ops::getBuffer<float>(&trainable_tensor), ops::getBuffer<float>(&grad_tensor),
+      ops::getBuffer<float>(m_tensor), ops::getBuffer<float>(v_tensor),
+      static_cast<int64_t>(trainable_tensor.getShape().num_elements())});
+  }
+
+  auto multi_tensor =
+    std::make_shared<nnfw::cker::train::MultiTensor<nnfw::cker::train::AdamBuffers>>(
+      std::move(buffers));
+  return [this, multi_tensor](size_t training_step) {
+    const auto beta1_power = std::pow(_props.beta1, training_step + 1);
+    const auto beta2_power = std::pow(_props.beta2, training_step + 1);
+    // TODO Support nesterov
+    const bool use_nesterov = false;
+
+    nnfw::cker::train::MultiTensorAdam(*multi_tensor, beta1_power, beta2_power, _learning_rate,
+                                       _props.beta1, _props.beta2, _props.epsilon, use_nesterov);
+  };
+}
+
 } // namespace optimizer
 } // namespace train
 } // namespace backend
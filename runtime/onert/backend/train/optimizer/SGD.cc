@@ -59,6 +59,37 @@ void SGD::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+exec::train::optimizer::ApplyGradientsFn
+SGD::prepareGradients(const std::vector<exec::train::optimizer::GradientPair> &tensors) const
+{
+  std::vector<nnfw::cker::train::GradientDescentBuffers> buffers;
+  for (const auto &pair : tensors)
+  {
+    const auto &grad_tensor = *pair.first;
+    auto &trainable_tensor = *pair.second;
+
+    if (trainable_tensor.getShape() != grad_tensor.getShape())
+    {
+      throw std::runtime_error("SGD: Invalid gradient tensor");
+    }
+
+    if (grad_tensor.data_type() != ir::DataType::FLOAT32 ||
+        trainable_tensor.data_type() != ir::DataType::FLOAT32)
+      throw std::runtime_error("SGD: Not supported data type");
+
+    buffers.emplace_back(nnfw::cker::train::GradientDescentBuffers{
+      ops::getBuffer<float>(&trainable_tensor), ops::getBuffer<float>(&grad_tensor),
+      static_cast<int64_t>(trainable_tensor.getShape().num_elements())});
+  }
+
+  auto multi_tensor =
+    std::make_shared<nnfw::cker::train::MultiTensor<nnfw::cker::train::GradientDescentBuffers>>(
+      std::move(buffers));
+  return [this, multi_tensor](size_t training_step) {
+    nnfw::cker::train::MultiTensorGradientDescent(*multi_tensor, getLearningRate(training_step));
+  };
+}
+
 } // namespace optimizer
 } // namespace train
 } // namespace backend
@@ -80,6 +80,15 @@ public:
    */
   void applyGradient(const UpdateFactors &factors) const override;
 
+  /**
+   * @brief Prepare applying gradients to trainable tensors in a single pass over all of them
+   *
+   * @param tensors GradientPair of each trainable tensor
+   * @return Function applying gradients of a training step
+   */
+  exec::train::optimizer::ApplyGradientsFn
+  prepareGradients(const std::vector<exec::train::optimizer::GradientPair> &tensors) const override;
+
 private:
   Property _props;
   double _learning_rate;
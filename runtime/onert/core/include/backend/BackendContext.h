@@ -32,6 +32,11 @@ namespace backend
 class Backend;
 struct ITensorRegistry;
 
+namespace basic
+{
+struct StaticMemoryPlan;
+} // namespace basic
+
 using FunctionMap = std::unordered_map<ir::OperationIndex, std::unique_ptr<exec::FunctionSequence>>;
 
 struct ContextData
@@ -48,6 +53,8 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Memory plan of static tensors to reuse, nullptr if it is not cached */
+  std::shared_ptr<basic::StaticMemoryPlan> memory_plan;
 };
 
 class BackendContext
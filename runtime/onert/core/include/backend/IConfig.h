@@ -66,6 +66,14 @@ struct IConfig
    */
   virtual std::unique_ptr<util::ITimer> timer() { return nullptr; }
 
+  /**
+   * @brief Returns whether kernels of this backend can run at the same time on different threads
+   *
+   * @return true  Independent kernels can run concurrently
+   * @return false Kernels must run one at a time
+   */
+  virtual bool supportConcurrentExecution() { return false; }
+
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
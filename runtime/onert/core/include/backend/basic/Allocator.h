@@ -22,6 +22,8 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include "MemoryPool.h"
+
 #include <memory>
 
 namespace onert
@@ -38,15 +40,26 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct Allocator whose memory is taken from pool and given back to it on release
+   */
+  Allocator(uint32_t capacity, const std::shared_ptr<MemoryPool> &pool);
+  ~Allocator() { release(); }
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
   uint8_t *base() const { return _base.get(); }
-  void release() { _base.reset(); }
+  void release();
+  /**
+   * @brief Take memory again from pool after release
+   */
+  void reallocate(uint32_t capacity);
 
 private:
   std::unique_ptr<uint8_t[]> _base;
+  uint32_t _capacity = 0;
+  std::weak_ptr<MemoryPool> _pool;
 };
 
 } // namespace basic
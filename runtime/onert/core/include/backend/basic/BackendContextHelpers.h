@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "ir/Index.h"
+#include "ir/operation/ElementwiseUnary.h"
 #include "compiler/GraphLowerInfo.h"
 #include "util/logging.h"
 #include "backend/ITensorRegistry.h"
@@ -33,8 +34,41 @@ namespace backend
 namespace basic
 {
 
+/**
+ * @brief   Check if the output of operation can be written on the memory of its input
+ * @note    Kernels of these operations read each input element before writing the output element
+ *          at the same position, so the output may overwrite an input that is not used anymore
+ */
+inline bool isInplaceOperation(const ir::IOperation &op)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+      return true;
+    case ir::OpCode::ElementwiseUnary:
+    {
+      // Cast may write a wider element than it reads, clobbering input elements not read yet
+      using Type = ir::operation::ElementwiseUnary::Type;
+      const auto &unary = dynamic_cast<const ir::operation::ElementwiseUnary &>(op);
+      return unary.param().op_type != Type::CAST;
+    }
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Plan memory of tensors along the operation order of the backend context
+ * @param inplace Let outputs of in-place operations reuse memory of their inputs. Only backends
+ *                whose kernels of such operations handle aliased input and output may set it
+ */
 // TODO Remove the template param BackendContext once unification of cpu backend context is done
-template <typename T_BackendContext> void planTensors(const T_BackendContext &ctx)
+template <typename T_BackendContext>
+void planTensors(const T_BackendContext &ctx, bool inplace = false)
 {
   const ir::Graph &graph = *ctx.graph();
   const auto &order = ctx.data().op_order;
@@ -103,8 +137,36 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       operands_last_until_end.push_back(ind);
   }
 
+  // Find an input whose memory can be reused by the output, i.e. the input is not used after
+  // the operation and has the same size with the output
+  auto find_inplace_input = [&](const ir::IOperation &op, const ir::OperandIndex &output) {
+    const auto &output_info = graph.operands().at(output).info();
+    if (!isInplaceOperation(op) || op.getOutputs().size() != 1 || model_io.contains(output) ||
+        output_info.isDynamic())
+      return ir::OperandIndex{};
+
+    // Only the first input is the data input except binary operations, e.g. shape of Reshape
+    auto inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+    if (op.opcode() != ir::OpCode::BinaryArithmetic)
+      inputs = ir::OperandIndexSequence{op.getInputs().at(0)};
+
+    for (const auto &ind : inputs)
+    {
+      if (ctx.external_operands().contains(ind) || !tensor_builder->isRegistered(ind) ||
+          model_io.contains(ind))
+        continue;
+      const auto &input_info = graph.operands().at(ind).info();
+      if (input_info.isConstant() || input_info.isVariable() || input_info.isDynamic())
+        continue;
+      if (uses_map[ind] == 1 && def_map[ind] == 0 &&
+          input_info.total_size() == output_info.total_size())
+        return ind;
+    }
+    return ir::OperandIndex{};
+  };
+
   // At each operation,
-  // 1. Scan DEF of outputs. If the DEF, allocate it
+  // 1. Scan DEF of outputs. If the DEF, allocate it or reuse memory of an input on in-place mode
   // 2. Scan DEF of inputs. If variable tensor, allocate it
   // 3. Scan USE of inputs. Decrease the USE and deallocate if the USE is 0
   for (const auto &op_ind : order)
@@ -124,7 +186,17 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       if (def_map[ind])
       {
         def_map[ind] = 0;
-        tensor_builder->notifyFirstUse(ind);
+        const auto inplace_input = inplace ? find_inplace_input(op, ind) : ir::OperandIndex{};
+        if (inplace_input.valid())
+        {
+          VERBOSE(planTensors) << "In-place " << op.name() << " : " << ind << " on "
+                               << inplace_input << std::endl;
+          tensor_builder->notifyInplaceUse(ind, inplace_input);
+        }
+        else
+        {
+          tensor_builder->notifyFirstUse(ind);
+        }
       }
     }
 
@@ -189,7 +261,8 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
                 [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
 }
 
-template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContext &ctx)
+template <typename T_BackendContext>
+ITensorRegistry *genTensors(T_BackendContext &ctx, bool inplace = false)
 {
   const ir::Graph &graph = *ctx.graph();
   auto tensor_builder = ctx.tensor_builder;
@@ -207,7 +280,7 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
   // TODO Get compiler options from compiler, and use it rather than getting it from Env
   if (util::getConfigString(util::config::EXECUTOR) == "Linear")
   {
-    basic::planTensors(ctx);
+    basic::planTensors(ctx, inplace);
   }
   else
   {
@@ -55,8 +55,7 @@ private:
 
 private:
   /**
-   * @brief Memory manager for dynamic tensor.
-   * @todo  DynamicMemoryManager is not optimized. Optimized one is needed
+   * @brief Memory manager for dynamic tensor, which reuses memory across runs
    */
   std::shared_ptr<DynamicMemoryManager> _dynamic_mem_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
@@ -19,8 +19,13 @@
 
 #include "Allocator.h"
 #include "ir/Index.h"
+#include "ir/OperandIndexMap.h"
 #include "IMemoryPlanner.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -31,6 +36,17 @@ class ITensor;
 namespace basic
 {
 
+/**
+ * @brief Memory plan of static tensors to reuse over compilations
+ */
+struct StaticMemoryPlan
+{
+  uint64_t key = 0; //< Hash of planner and claims/releases which made the plan, 0 if not planned
+  uint32_t capacity = 0;
+  std::unordered_map<ir::OperandIndex, Block> blocks;
+  bool updated = false; //< Whether plan is updated by this compilation
+};
+
 class MemoryManager
 {
 public:
@@ -44,28 +60,81 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  /**
+   * @brief     Claim memory for operand on the memory block of another operand
+   * @param[in] ind   Operand index to claim memory for
+   * @param[in] base  Operand index that owns the memory block, it must be claimed already
+   * @param[in] size  Size of operand, it must not be bigger than size of base
+   * @note      The block is released to planner when all operands sharing it are released
+   */
+  void sharePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base, uint32_t size);
+  /**
+   * @brief     Reuse memory plan made by previous compilation
+   * @param[in] plan  Plan to reuse if claims and releases are same as the ones which made it.
+   *                  Otherwise, memory is planned on allocation and the plan is updated.
+   * @note      It should be called before claiming any plan
+   */
+  void usePlan(const std::shared_ptr<StaticMemoryPlan> &plan);
 
 private:
-  IMemoryPlanner<ir::OperandIndex> *createMemoryPlanner();
   IMemoryPlanner<ir::OperandIndex> *createMemoryPlanner(const std::string);
 
+  const ir::OperandIndex &blockOwner(const ir::OperandIndex &ind) const;
+  void replayPlans(IMemoryPlanner<ir::OperandIndex> &planner, bool share) const;
+  uint32_t replayPlans(const std::string &planner_id, bool share) const;
+  uint64_t planKey() const;
+  void reportPeakMemory() const;
+
 private:
+  struct PlanRecord
+  {
+    ir::OperandIndex ind;
+    uint32_t size;
+    bool claim;
+  };
+
   std::unordered_map<ir::OperandIndex, Block> _tensor_mem_map;
+  std::string _planner_id;
   std::shared_ptr<IMemoryPlanner<ir::OperandIndex>> _mem_planner;
   std::shared_ptr<Allocator> _mem_alloc;
+  // Operand to the operand owning the memory block it shares
+  ir::OperandIndexMap<ir::OperandIndex> _block_owners;
+  // Owner operand to the number of live operands on its memory block
+  ir::OperandIndexMap<uint32_t> _block_users;
+  // Claim and release history of each operand, to report peak memory of other planners
+  std::vector<PlanRecord> _plan_history;
+  // Plan of previous compilation, planner is not used until allocation if it is set
+  std::shared_ptr<StaticMemoryPlan> _reused_plan;
 };
 
+/**
+ * @brief Memory manager for dynamic tensors
+ *
+ * Released memory is kept in a pool, and allocators of deallocated tensors are kept to be reused,
+ * so that runs with shapes seen before do not allocate memory from heap.
+ */
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  DynamicMemoryManager();
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
+  /**
+   * @brief Deallocate memory of tensor
+   * @note  Allocator of tensor is kept for next allocation unless it is still referred by others.
+   *        So tensor should drop its allocator before it unless it is a temporary tensor.
+   */
   void deallocate(const ITensor *tensor);
+  /**
+   * @brief Deallocate memory of all tensors, and free memory kept in the pool
+   */
   void deallocate(void);
 
+  const MemoryPool::Counters &counters() const { return _pool->counters(); }
+
 private:
+  std::shared_ptr<MemoryPool> _pool;
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
 };
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file        MemoryPool.h
+ * @brief       This file contains MemoryPool class
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
+#define __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Class to keep released memory blocks for reuse
+ *
+ * Capacities are rounded up to size classes, which are 4 classes per power of two, so a block
+ * can be reused for similar capacities with at most 25% of waste. Blocks are freed only when
+ * the pool is cleared or destroyed. Taken blocks are zero-initialized up to the capacity,
+ * whether they are allocated or reused.
+ */
+class MemoryPool
+{
+public:
+  struct Counters
+  {
+    uint64_t allocations = 0;  //< Number of blocks allocated from heap
+    uint64_t reuses = 0;       //< Number of blocks taken from the pool
+    uint64_t cached_bytes = 0; //< Size of blocks kept in the pool
+  };
+
+public:
+  /**
+   * @brief Take a block whose size is at least capacity
+   */
+  std::unique_ptr<uint8_t[]> take(uint32_t capacity);
+  /**
+   * @brief Give back a block taken with capacity
+   */
+  void give(std::unique_ptr<uint8_t[]> &&block, uint32_t capacity);
+  /**
+   * @brief Free all blocks kept in the pool
+   */
+  void clear();
+
+  const Counters &counters() const { return _counters; }
+
+  static uint64_t sizeClass(uint32_t capacity);
+
+private:
+  std::unordered_map<uint64_t, std::vector<std::unique_ptr<uint8_t[]>>> _blocks;
+  Counters _counters;
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
@@ -50,6 +50,8 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  void sharePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base, uint32_t size);
+  void usePlan(const std::shared_ptr<StaticMemoryPlan> &plan);
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
@@ -51,9 +51,22 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
+  /**
+   * @brief     Notify first use of a tensor that is written in-place on the memory of base
+   * @param[in] ind   Operand index of the tensor
+   * @param[in] base  Operand index of the tensor whose memory is reused, it must be in use
+   */
+  void notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &base);
 
   bool isRegistered(const ir::OperandIndex &) const;
 
+  /**
+   * @brief     Reuse memory plan of static tensors made by previous compilation
+   * @param[in] plan  Plan to reuse, it is updated if it does not match with tensors
+   * @note      It should be called before notifying any use of tensors
+   */
+  void useMemoryPlan(const std::shared_ptr<StaticMemoryPlan> &plan);
+
   void allocate(void);
 
   DynamicTensorManager *dynamicTensorManager(void) { return _dynamic_tensor_mgr.get(); }
@@ -52,6 +52,9 @@ struct TrainableContextData
   bool is_linear_executor;
   /* Optimizer information */
   ir::train::OptimizerInfo optim_info;
+  /* Groups of activations recomputed during backwarding instead of being kept.
+     Activations of different groups are never alive at the same time */
+  std::vector<util::Set<ir::OperandIndex>> recomputed_operands;
 };
 
 class TrainableBackendContext
@@ -75,6 +75,12 @@ public:
   // GENERAL OPTIONS
   std::vector<std::string> backend_list;
   std::string minmax_filepath; //< File path to save minmax
+  uint32_t execution_contexts; //< Number of execution contexts that can run in parallel
+  std::string compile_cache_dir; //< Directory to cache compilation result, disabled if empty
+  // Operations whose outputs are kept for backwarding("0;3;7"), "auto" or empty to keep all
+  std::string train_checkpoints;
+  uint64_t train_memory_budget; //< Activation memory budget in bytes of "auto" checkpoints
+  uint32_t train_replicas;      //< Number of data-parallel replicas of trainable graph
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
@@ -28,6 +28,16 @@ namespace onert
 namespace compiler
 {
 
+/**
+ * @brief Backend assignment of operations decided by scheduler
+ *        It can be given to LoweredGraph to skip scheduling
+ */
+struct LoweringSchedule
+{
+  ir::OperationIndexMap<std::string> backends;
+  ir::OperationIndexMap<int64_t> ranks; //< Ranks of operations given by HEScheduler
+};
+
 /**
  * @brief Class that contains lowering information on graph.
  *        In addition, after lowering, operands in graph will be set to "dynamic"
@@ -36,13 +46,22 @@ namespace compiler
 class LoweredGraph : public ILoweredGraph
 {
 public:
-  LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @brief     Construct a new LoweredGraph object
+   * @param[in] graph     Graph to lower
+   * @param[in] options   Compiler options
+   * @param[in] schedule  Backend assignment to use instead of running scheduler (optional)
+   *                      It is ignored if it does not match with graph or backends.
+   */
+  LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options,
+               const LoweringSchedule *schedule = nullptr);
 
   ir::Graph &graph() override { return _graph; }
   const ir::Graph &graph() const override { return _graph; }
   const compiler::GraphLowerInfo &lower_info() const override { return _lower_info_map; }
   compiler::GraphLowerInfo &lower_info() override { return _lower_info_map; }
   std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks() { return _indexed_ranks; }
+  const LoweringSchedule &schedule() const { return _schedule; }
 
   void setHasDynamicTensor(ir::OperationIndex ind, bool val) override
   {
@@ -57,7 +76,8 @@ public:
 private:
   void makeLowerInfo(const compiler::BackendResolver &backend_resolver);
   void dumpLowerInfo();
-  void lowerGraph(const compiler::CompilerOptions &options);
+  void lowerGraph(const compiler::CompilerOptions &options, const LoweringSchedule *schedule);
+  std::unique_ptr<BackendResolver> resolveSchedule(const LoweringSchedule &schedule) const;
 
 private:
   /**
@@ -67,6 +87,7 @@ private:
    */
   ir::Graph _graph;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
+  LoweringSchedule _schedule;
   compiler::GraphLowerInfo _lower_info_map;
   ir::OperationIndexMap<bool> _has_dynamic_tensor_map;
 };
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  BatchExecution.h
+ * @brief This file defines execution which coalesces independent requests into a batch
+ */
+#ifndef __ONERT_EXEC_BATCH_EXECUTION_H__
+#define __ONERT_EXEC_BATCH_EXECUTION_H__
+
+#include "exec/Execution.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Statistics of batched execution
+ * @note  Batch occupancy is num_requests / (num_batches * max batch size)
+ */
+struct BatchStats
+{
+  uint64_t num_batches = 0;
+  uint64_t num_requests = 0;
+  // Time from request submission to the start of its batch
+  uint64_t total_queue_time_us = 0;
+  uint64_t max_queue_time_us = 0;
+};
+
+/**
+ * @brief Class to gather independent requests and run them as one batch
+ *
+ * A dispatcher thread waits until requests fill the maximum batch size or the oldest request
+ * waits for the timeout. Then the first dimension of all inputs is resized to the number of
+ * gathered requests through dynamic shape inference, the model runs once, and outputs are split
+ * back to each request.
+ * Each request has the same shape as model inputs/outputs, and the first dimension of model
+ * inputs/outputs should be the batch dimension.
+ */
+class BatchExecution
+{
+public:
+  /**
+   * @brief     Construct a new BatchExecution object and start dispatcher
+   * @param[in] executors       Model executors
+   * @param[in] max_batch_size  Maximum number of requests in a batch
+   * @param[in] timeout         Maximum time for the oldest request to wait for other requests
+   */
+  BatchExecution(const std::shared_ptr<IExecutors> &executors, uint32_t max_batch_size,
+                 std::chrono::microseconds timeout);
+  BatchExecution(const BatchExecution &) = delete;
+  BatchExecution &operator=(const BatchExecution &) = delete;
+
+  /**
+   * @brief Destroy the BatchExecution object
+   * @note  Submitted requests are finished before dispatcher is joined
+   */
+  ~BatchExecution();
+
+public:
+  /**
+   * @brief     Run a request, it blocks until outputs of the request are written
+   * @param[in] inputs  Input buffers, whose sizes are the sizes of model inputs
+   * @param[in] outputs Output buffers, whose sizes are the sizes of model outputs
+   * @note      This method is thread-safe. If batch execution fails, the exception is rethrown
+   *            to all requests in the batch.
+   */
+  void run(const std::vector<const void *> &inputs, const std::vector<void *> &outputs);
+
+  BatchStats stats() const;
+  uint32_t maxBatchSize() const { return _max_batch_size; }
+
+private:
+  struct Request;
+
+  void dispatch();
+  void runBatch(const std::vector<std::shared_ptr<Request>> &batch);
+
+private:
+  const uint32_t _max_batch_size;
+  const std::chrono::microseconds _timeout;
+  Execution _execution;
+  // Shapes and sizes of a request
+  std::vector<ir::Shape> _input_shapes;
+  std::vector<ir::Shape> _output_shapes;
+  std::vector<size_t> _input_sizes;
+  std::vector<size_t> _output_sizes;
+  // Buffers of batched inputs/outputs, reused over batches
+  std::vector<std::vector<uint8_t>> _input_buffers;
+  std::vector<std::vector<uint8_t>> _output_buffers;
+
+  bool _terminating;
+  std::deque<std::shared_ptr<Request>> _requests;
+  BatchStats _stats;
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::thread _dispatcher;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_BATCH_EXECUTION_H__
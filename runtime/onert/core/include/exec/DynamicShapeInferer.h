@@ -23,6 +23,7 @@
 #include "backend/ITensorRegistry.h"
 
 #include <map>
+#include <vector>
 
 namespace onert
 {
@@ -44,10 +45,20 @@ public:
     UNUSED_RELEASE(_tensor_registry);
   }
 
+public:
+  /**
+   * @brief Infer shapes of outputs of op. Output shapes inferred before with the same input
+   *        shapes are reused without visiting op.
+   * @return false if op is not visited and outputs already have the reused shapes
+   * @note  An inferer caches shapes of only one operation, i.e. the last one passed to it
+   */
+  bool infer(const ir::IOperation &op);
+
 public:
   // TODO Define visitors for operations. List them in alphabetic order.
   // Remove TODO when any op starting from the alphabet is added
   void visit(const ir::operation::ArgMinMax &op) override;
+  void visit(const ir::operation::Attention &op) override;
   void visit(const ir::operation::BatchMatMul &op) override;
   void visit(const ir::operation::BCQFullyConnected &op) override;
   void visit(const ir::operation::BCQGather &op) override;
@@ -59,12 +70,16 @@ public:
   void visit(const ir::operation::ElementwiseActivation &op) override;
   void visit(const ir::operation::ElementwiseBinary &op) override;
   void visit(const ir::operation::ElementwiseUnary &op) override;
+  void visit(const ir::operation::EmbeddingLookup &op) override;
   void visit(const ir::operation::ExpandDims &op) override;
   void visit(const ir::operation::Fill &op) override;
   void visit(const ir::operation::FullyConnected &op) override;
   void visit(const ir::operation::FusedBatchNorm &op) override;
   void visit(const ir::operation::Gather &op) override;
+  void visit(const ir::operation::InstanceNorm &op) override;
   void visit(const ir::operation::L2Normalization &op) override;
+  void visit(const ir::operation::LayerNorm &op) override;
+  void visit(const ir::operation::LocalResponseNormalization &op) override;
   void visit(const ir::operation::LSTM &op) override;
   void visit(const ir::operation::MatrixBandPart &op) override;
   void visit(const ir::operation::DetectionPostProcess &op) override;
@@ -74,12 +89,16 @@ public:
   void visit(const ir::operation::Permute &op) override;
   void visit(const ir::operation::Pool2D &op) override;
   void visit(const ir::operation::Pow &op) override;
+  void visit(const ir::operation::PReLU &op) override;
   // TODO write op starting from Q
   void visit(const ir::operation::Range &op) override;
   void visit(const ir::operation::Reduce &op) override;
   void visit(const ir::operation::Reshape &op) override;
   void visit(const ir::operation::ResizeBilinear &op) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &op) override;
   void visit(const ir::operation::Reverse &op) override;
+  void visit(const ir::operation::RmsNorm &op) override;
+  void visit(const ir::operation::RNN &op) override;
   void visit(const ir::operation::Select &op) override;
   void visit(const ir::operation::Shape &op) override;
   void visit(const ir::operation::Slice &op) override;
@@ -90,7 +109,9 @@ public:
   void visit(const ir::operation::StridedSlice &op) override;
   void visit(const ir::operation::SquaredDifference &op) override;
   void visit(const ir::operation::Tile &op) override;
+  void visit(const ir::operation::TopKV2 &op) override;
   void visit(const ir::operation::Transpose &op) override;
+  void visit(const ir::operation::TransposeConv &op) override;
   void visit(const ir::operation::Unpack &op) override;
   // TODO write op starting from V
 
@@ -119,6 +140,13 @@ private:
   // That's why it is called `currently_static`
   bool currently_static(backend::ITensor *op_input) { return !op_input->is_dynamic(); }
 
+  /**
+   * @brief Make key of shape cache from shapes of inputs and values of inputs which decide
+   *        output shapes
+   * @return false if the key cannot be made
+   */
+  bool makeCacheKey(const ir::IOperation &op);
+
 private:
   /**
    * @brief To get operand-level info, e.g., ir::Operand::isConstant()
@@ -128,6 +156,20 @@ private:
    * @brief To get tensor object and access tensor-level info, e.g., ITensor::buffer()
    */
   std::shared_ptr<backend::ITensorRegistry> _tensor_registry;
+
+  struct CachedOutput
+  {
+    bool dynamic;
+    ir::Shape shape;
+  };
+
+  // Shapes of outputs of _cache_op for each key
+  std::map<std::vector<int64_t>, std::vector<CachedOutput>> _shape_cache;
+  const ir::IOperation *_cache_op = nullptr;
+  bool _cacheable_op = false;
+  // Input positions whose values decide output shapes of _cache_op
+  std::vector<uint32_t> _value_inputs;
+  std::vector<int64_t> _cache_key;
 };
 
 } // namespace exec
@@ -24,11 +24,15 @@
 #include "backend/train/ITrainableTensor.h"
 #include "ir/Layout.h"
 #include "exec/IExecutors.h"
+#include "exec/StateTensor.h"
 #include "IODescription.h"
 
-#include <thread>
-#include <deque>
-#include <semaphore.h>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace onert
 {
@@ -41,6 +45,13 @@ namespace exec
  */
 class Execution
 {
+public:
+  /**
+   * @brief Callback to be called when asynchronous execution is finished
+   * @note  It is called on a worker thread. The argument is the exception thrown by execution,
+   *        or @c nullptr if execution succeeded.
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr)>;
 
 public:
   /**
@@ -49,6 +60,12 @@ public:
    */
   Execution(const std::shared_ptr<IExecutors> &executors);
 
+  /**
+   * @brief Destroy the Execution object
+   * @note  It waits until asynchronous execution is finished
+   */
+  ~Execution();
+
 public:
   /**
    * @brief   Returns primary graph object
@@ -121,6 +138,26 @@ public:
    * @param[in] typeInfo  Output type information
    */
   void setOutputType(const ir::IOIndex &index, const ir::TypeInfo &typeInfo);
+  /**
+   * @brief     Keep an input as a state in a runtime-owned buffer between executions
+   * @param[in] input   Input index of the state
+   * @param[in] output  Output index whose value is written into the state after each execution
+   * @param[in] update  How the state is updated
+   * @param[in] axis    Axis along which the output is written, ignored for REPLACE
+   * @note      Buffers of the input and the output are owned by this execution, so they cannot
+   *            be set by user. The state is zero at first.
+   */
+  void bindState(const ir::IOIndex &input, const ir::IOIndex &output, StateUpdate update,
+                 int32_t axis);
+  /**
+   * @brief Clear all states to zero
+   */
+  void resetStates();
+  /**
+   * @brief     Get the number of valid entries along the axis of a state
+   * @param[in] input Input index of the state
+   */
+  int32_t getStateLength(const ir::IOIndex &input) const;
   /**
    * @brief  Execution
    * @note   It should be called after setting input and output buffer
@@ -128,15 +165,17 @@ public:
   void execute();
 
   /**
-   * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
-   *        It should be called after setting input and output buffer
+   * @brief     Start asynchronous execution
+   * @param[in] callback  Function to be called when execution is finished (optional)
+   * @note      It returns after execution is queued to asynchronous execution engine
+   *            It should be called after setting input and output buffer
    */
-  void startExecute(void);
+  void startExecute(const CompletionCallback &callback = nullptr);
 
   /**
    * @brief Return when execution is finished
    * @note  It waits until execution is finished
+   *        It throws exception if asynchronous execution failed
    */
   void waitFinish(void);
 
@@ -177,14 +216,31 @@ public:
   size_t getOutputTotalSize(ir::IOIndex ind) const;
 
 private:
+  struct BoundState
+  {
+    ir::IOIndex output;
+    std::unique_ptr<StateTensor> tensor;
+  };
+
+private:
+  /**
+   * @brief Run executors and update states without marking execution finished
+   */
+  void run();
   const IExecutor *entryExecutor() const { return _executors->entryExecutor(); };
   IExecutor *entryExecutor() { return _executors->entryExecutor(); };
 
 private:
   const std::shared_ptr<IExecutors> _executors;
   IODescription _io_desc;
-  std::unique_ptr<std::thread> _exec_thread;
+  // Bound states by input index
+  std::unordered_map<ir::IOIndex, BoundState> _states;
   bool finished{false};
+  // For asynchronous execution
+  bool _async_running{false};
+  std::exception_ptr _async_error;
+  mutable std::mutex _async_mutex;
+  std::condition_variable _async_cv;
 };
 
 } // namespace exec
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PipelineExecution.h
+ * @brief This file defines streaming pipeline execution of multi-model package
+ */
+#ifndef __ONERT_EXEC_PIPELINE_EXECUTION_H__
+#define __ONERT_EXEC_PIPELINE_EXECUTION_H__
+
+#include "exec/IExecutors.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run requests through models of package in pipelined manner
+ *
+ * Each model of package is a stage which runs on its own worker thread. Stages are connected
+ * by bounded queues, so different requests are executed on different stages at the same time.
+ * Buffers of edges between models are taken from a pool for each request and handed over to the
+ * next stage without copy. Package output which is also an edge is read from the output buffer.
+ */
+class PipelineExecution
+{
+public:
+  /**
+   * @brief     Construct a new PipelineExecution object and start workers
+   * @param[in] executors   Executors of compiled package
+   * @param[in] queue_size  Maximum number of requests waiting in front of each stage
+   */
+  PipelineExecution(const std::shared_ptr<IExecutors> &executors, uint32_t queue_size);
+  PipelineExecution(const PipelineExecution &) = delete;
+  PipelineExecution &operator=(const PipelineExecution &) = delete;
+
+  /**
+   * @brief Destroy the PipelineExecution object
+   * @note  Pushed requests are finished before workers are joined
+   */
+  ~PipelineExecution();
+
+public:
+  /**
+   * @brief     Push a request into pipeline
+   * @param[in] inputs  Buffers of package inputs
+   * @param[in] lengths Lengths of package input buffers
+   * @note      Input buffers are copied, so they can be reused after return.
+   *            It blocks while the first stage queue is full.
+   */
+  void push(const std::vector<const void *> &inputs, const std::vector<size_t> &lengths);
+
+  /**
+   * @brief      Pop outputs of the oldest request
+   * @param[out] outputs  Buffers of package outputs allocated by @c malloc.
+   *                      Caller should release them by @c free.
+   * @return     @c false if pipeline is finished and there is no remaining request
+   * @note       It blocks until the oldest request passes all stages.
+   *             If a stage failed to execute the request, the exception is rethrown.
+   */
+  bool pop(std::vector<void *> &outputs);
+
+  /**
+   * @brief Stop accepting requests
+   * @note  Workers exit after pushed requests are finished
+   */
+  void finish();
+
+  uint32_t stageCount() const { return _stages.size(); }
+
+private:
+  struct Request;
+  struct Stage;
+  class BufferPool;
+  class RequestQueue;
+
+  void work(uint32_t stage_index);
+  void runStage(Stage &stage, Request &request);
+
+private:
+  std::shared_ptr<IExecutors> _executors;
+  std::vector<size_t> _input_sizes;
+  std::vector<size_t> _output_sizes;
+  std::vector<std::unique_ptr<Stage>> _stages;
+  std::unique_ptr<BufferPool> _edge_pool;
+  // _queues[i] is input queue of i-th stage, and the last one holds finished requests
+  std::vector<std::unique_ptr<RequestQueue>> _queues;
+  std::vector<std::thread> _workers;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PIPELINE_EXECUTION_H__
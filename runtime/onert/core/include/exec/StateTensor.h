@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  StateTensor.h
+ * @brief This file defines state tensor kept between executions
+ */
+#ifndef __ONERT_EXEC_STATE_TENSOR_H__
+#define __ONERT_EXEC_STATE_TENSOR_H__
+
+#include "ir/OperandInfo.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief How an output of an execution is written into a state
+ */
+enum class StateUpdate
+{
+  REPLACE, //< Output has the same shape as state and replaces it
+  APPEND,  //< Output is appended along axis, and execution fails if state is full
+  ROTATE,  //< Output is appended along axis, overwriting the oldest entries if state is full
+};
+
+/**
+ * @brief Class for a model input kept in a runtime-owned buffer between executions
+ *
+ * The buffer is bound to a model input. After each execution, a model output(e.g. key/value of
+ * new tokens) is written into the buffer along the axis, so the cost of an update is
+ * proportional to the output, not to the whole state.
+ * For ROTATE, the buffer is used as a ring and entries along the axis are not in time order
+ * after it wraps around.
+ */
+class StateTensor
+{
+public:
+  /**
+   * @param[in] info    Information of the model input
+   * @param[in] update  How the state is updated
+   * @param[in] axis    Axis along which outputs are written, ignored for REPLACE
+   */
+  StateTensor(const ir::OperandInfo &info, StateUpdate update, int32_t axis);
+
+public:
+  const ir::OperandInfo &info() const { return _info; }
+  const void *buffer() const { return _state.data(); }
+  size_t size() const { return _state.size(); }
+  /**
+   * @brief Buffer for the model output, which can hold as many entries as the state
+   */
+  void *outputBuffer() { return _output.data(); }
+  size_t outputSize() const { return _output.size(); }
+  /**
+   * @brief Number of valid entries along the axis
+   */
+  int32_t length() const { return _length; }
+
+  /**
+   * @brief     Write the model output into the state
+   * @param[in] shape Shape of the model output of the last execution
+   */
+  void update(const ir::Shape &shape);
+  /**
+   * @brief Clear the state to zero
+   */
+  void reset();
+
+private:
+  ir::OperandInfo _info;
+  StateUpdate _update;
+  int32_t _axis;
+  std::vector<uint8_t> _state;
+  std::vector<uint8_t> _output;
+  int32_t _length = 0;
+  // Position along the axis where the next entry is written
+  int32_t _pos = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_STATE_TENSOR_H__
@@ -34,7 +34,13 @@ class TrainableFnSequence
 {
 public:
   void forward(bool training);
-  void backward(uint32_t training_step);
+  /**
+   * @brief Run backwarding
+   * @param weight_update_enabled If false, gradients are not applied, and @c applyGradients
+   *                              should be called later
+   */
+  void backward(uint32_t training_step, bool weight_update_enabled = true);
+  void applyGradients(uint32_t training_step);
 
   void append(std::unique_ptr<ITrainableFunction> &&fn);
   void append(std::unique_ptr<IGradientApplier> &&applier);
@@ -20,7 +20,9 @@
 #include "backend/IPortableTensor.h"
 #include "backend/train/ITrainableTensor.h"
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace onert
 {
@@ -35,6 +37,13 @@ namespace optimizer
 using UpdateFactors =
   std::tuple<const backend::IPortableTensor &, backend::train::ITrainableTensor &, size_t>;
 
+// Gradient tensor, Trainable tensor
+using GradientPair =
+  std::pair<const backend::IPortableTensor *, backend::train::ITrainableTensor *>;
+
+// Function applying gradients of a training step
+using ApplyGradientsFn = std::function<void(size_t)>;
+
 /**
  * @class   Optimizer Base class for optimizers
  * @brief   Base class for all optimizers
@@ -73,6 +82,22 @@ public:
    */
   virtual void applyGradient(const UpdateFactors &factors) const = 0;
 
+  /**
+   * @brief Prepare applying gradients to trainable tensors at once
+   *
+   * Buffers of tensors should be allocated and should not be changed after this call.
+   *
+   * @param tensors GradientPair of each trainable tensor
+   * @return Function applying gradients of a training step to all of the tensors
+   */
+  virtual ApplyGradientsFn prepareGradients(const std::vector<GradientPair> &tensors) const
+  {
+    return [this, tensors](size_t training_step) {
+      for (const auto &pair : tensors)
+        applyGradient(UpdateFactors{*pair.first, *pair.second, training_step});
+    };
+  }
+
   // TODO Add member functions for exporting optimizer information
 };
 
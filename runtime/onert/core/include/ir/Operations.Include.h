@@ -18,6 +18,7 @@
 
 #include "ir/operation/AddN.h"
 #include "ir/operation/ArgMinMax.h"
+#include "ir/operation/Attention.h"
 #include "ir/operation/BatchMatMul.h"
 #include "ir/operation/BatchToSpaceND.h"
 #include "ir/operation/BCQFullyConnected.h"
@@ -47,6 +48,7 @@
 #include "ir/operation/If.h"
 #include "ir/operation/InstanceNorm.h"
 #include "ir/operation/L2Normalization.h"
+#include "ir/operation/LayerNorm.h"
 #include "ir/operation/LocalResponseNormalization.h"
 #include "ir/operation/LogSoftmax.h"
 #include "ir/operation/Loss.h"
@@ -67,6 +69,7 @@
 #include "ir/operation/ResizeBilinear.h"
 #include "ir/operation/ResizeNearestNeighbor.h"
 #include "ir/operation/Reverse.h"
+#include "ir/operation/RmsNorm.h"
 #include "ir/operation/RNN.h"
 #include "ir/operation/Select.h"
 #include "ir/operation/Shape.h"
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OPERATION_ATTENTION_H__
+#define __ONERT_IR_OPERATION_ATTENTION_H__
+
+#include "ir/Operation.h"
+
+namespace onert
+{
+namespace ir
+{
+namespace operation
+{
+
+/**
+ * @brief Scaled dot-product attention, softmax(scale * QUERY * KEY^T + MASK) * VALUE
+ *
+ * QUERY is [..., query_len, depth], KEY is [..., key_len, depth] and VALUE is [..., key_len,
+ * value_depth]. Heads of QUERY may be a multiple of heads of KEY and VALUE. MASK is optional and
+ * broadcastable to [..., query_len, key_len].
+ */
+class Attention : public Operation
+{
+public:
+  enum Input
+  {
+    QUERY = 0,
+    KEY,
+    VALUE,
+    MASK
+  };
+
+  struct Param
+  {
+    float scale; //< Scale of query-key products. 1/sqrt(depth) is used if it is 0.
+    bool causal;  //< Mask keys after each query
+  };
+
+public:
+  Attention(const OperandIndexSequence &inputs, const OperandIndexSequence &outputs,
+            const Param &param);
+
+public:
+  void accept(OperationVisitor &v) const override;
+  OpCode opcode() const final { return OpCode::Attention; }
+
+public:
+  const Param &param() const { return _param; }
+
+private:
+  Param _param;
+};
+
+} // namespace operation
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OPERATION_ATTENTION_H__
@@ -40,12 +40,14 @@ public:
     LOGISTIC,
     RELU,
     TANH,
-    LEAKY_RELU
+    LEAKY_RELU,
+    GELU
   };
 
   struct Param
   {
     Type op_type;
+    // GELU uses tanh approximation if alpha is not 0
     float alpha;
     float beta;
     Param() : op_type(Type::ELU), alpha(0.0f), beta(0.0f) {}
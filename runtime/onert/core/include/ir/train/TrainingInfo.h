@@ -36,7 +36,8 @@ class TrainingInfo final
 {
 public:
   TrainingInfo()
-    : _loss_info(), _optimizer_info(), _batch_size(0), _training_step{0}, _trainable_ops{}
+    : _loss_info(), _optimizer_info(), _batch_size(0), _accumulation_steps(1), _training_step{0},
+      _trainable_ops{}
   {
   }
   TrainingInfo(const TrainingInfo &) = default;
@@ -49,11 +50,13 @@ public:
   const LossInfo &lossInfo() const { return _loss_info; }
   const OptimizerInfo &optimizerInfo() const { return _optimizer_info; }
   uint32_t batchSize() const { return _batch_size; }
+  uint32_t accumulationSteps() const { return _accumulation_steps; }
   const uint32_t &trainingStep() const { return _training_step; }
   const std::set<OperationIndex> &getTrainableOps() const { return _trainable_ops; }
 
   // setter
   void setBatchSize(const uint32_t batch_size) { _batch_size = batch_size; }
+  void setAccumulationSteps(const uint32_t steps) { _accumulation_steps = steps; }
   void setLossInfo(const LossInfo &loss_info) { _loss_info = loss_info; }
   void setOptimizerInfo(const OptimizerInfo &optimizer_info) { _optimizer_info = optimizer_info; }
   uint32_t &trainingStep() { return _training_step; }
@@ -68,6 +71,7 @@ private:
   LossInfo _loss_info;
   OptimizerInfo _optimizer_info;
   uint32_t _batch_size;
+  uint32_t _accumulation_steps; //< Number of batches whose gradients are accumulated
   uint32_t _training_step;
   std::set<OperationIndex> _trainable_ops;
 };
@@ -43,6 +43,8 @@ using Shapes = std::vector<ir::Shape>;
 
 ir::Shape inferArgMinMaxShape(const ir::Shape &input_shape, int axis, int rank);
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &value_shape);
+
 ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
                                 const ir::operation::BatchMatMul::Param &param);
 
@@ -67,6 +69,8 @@ ir::Shape inferDepthwiseConv2DShape(const ir::Shape &in_shape, const ir::Shape &
 
 ir::Shape inferEltwiseShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape);
 
+ir::Shape inferEmbeddingLookupShape(const ir::Shape &lookups_shape, const ir::Shape &values_shape);
+
 ir::Shape inferExpandDimsShape(const ir::Shape &in_shape, int32_t axis);
 
 template <typename T> ir::Shape inferFillShape(const ir::Shape &fill_shape, const T *shape_buf);
@@ -100,6 +104,11 @@ template <typename T> ir::Shape inferRangeShape(T start_val, T limit_val, T delt
 ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, const int32_t output_height,
                                    const int32_t output_width);
 
+ir::Shape inferResizeNearestNeighborShape(const ir::Shape &in_shape, const int32_t output_height,
+                                          const int32_t output_width);
+
+ir::Shape inferRNNShape(const ir::Shape &input_shape, const ir::Shape &weights_shape);
+
 ir::Shape inferSelectShape(const ir::Shape &input_cond_shape, const ir::Shape &input_true_shape,
                            const ir::Shape &input_false_shape);
 
@@ -141,9 +150,14 @@ ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSlic
 ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_buf,
                          const int32_t multiplier_size);
 
+ir::Shape inferTopKV2Shape(const ir::Shape &input_shape, int32_t k);
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t rank);
 
+ir::Shape inferTransposeConvShape(const ir::Shape &output_shape_shape,
+                                  const int32_t *output_shape_buf);
+
 ir::Shape inferUnpackShape(const ir::Shape &input_shape, int axis, int rank);
 
 } // namespace shape_inference
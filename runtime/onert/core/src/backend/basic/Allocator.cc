@@ -18,6 +18,9 @@
 
 #include "util/logging.h"
 
+#include <cassert>
+#include <stdexcept>
+
 namespace onert
 {
 namespace backend
@@ -33,6 +36,31 @@ Allocator::Allocator(uint32_t capacity)
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
+Allocator::Allocator(uint32_t capacity, const std::shared_ptr<MemoryPool> &pool) : _pool{pool}
+{
+  assert(pool);
+  reallocate(capacity);
+}
+
+void Allocator::release()
+{
+  // Memory goes back to the pool if the pool is still alive
+  if (auto pool = _pool.lock())
+    pool->give(std::move(_base), _capacity);
+  _base.reset();
+}
+
+void Allocator::reallocate(uint32_t capacity)
+{
+  assert(_base == nullptr);
+  auto pool = _pool.lock();
+  if (!pool)
+    throw std::runtime_error("Allocator: Memory pool is already destroyed");
+
+  _base = pool->take(capacity);
+  _capacity = capacity;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
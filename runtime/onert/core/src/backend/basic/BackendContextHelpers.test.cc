@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <backend/basic/BackendContextHelpers.h>
+#include <backend/basic/TensorBuilder.h>
+#include <backend/basic/TensorRegistry.h>
+#include <ir/operation/ElementwiseActivation.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend;
+
+namespace
+{
+
+// Minimal backend context that planTensors and genTensors need
+struct TestBackendContext
+{
+  ContextData _data;
+  std::shared_ptr<basic::TensorRegistry> tensor_registry;
+  std::shared_ptr<basic::TensorBuilder> tensor_builder;
+
+  const ir::Graph *graph() const { return _data.graph.get(); }
+  const ContextData &data() const { return _data; }
+  const util::Set<ir::OperandIndex> &external_operands() const { return _data.external_operands; }
+  const ir::OperandIndexMap<ir::Layout> &operand_layouts() const { return _data.operand_layouts; }
+};
+
+// x -> Relu -> a -> Relu -> b -> Relu -> y
+struct ReluChain
+{
+  ir::OperandIndex x, a, b, y;
+  TestBackendContext ctx;
+
+  ReluChain()
+  {
+    auto graph = std::make_unique<ir::Graph>();
+    ir::Shape shape{1, 4};
+    ir::TypeInfo type{ir::DataType::FLOAT32};
+    x = graph->addOperand(shape, type);
+    a = graph->addOperand(shape, type);
+    b = graph->addOperand(shape, type);
+    y = graph->addOperand(shape, type);
+    graph->addInput(x);
+    graph->addOutput(y);
+
+    ir::operation::ElementwiseActivation::Param param;
+    param.op_type = ir::operation::ElementwiseActivation::Type::RELU;
+    const std::vector<std::pair<ir::OperandIndex, ir::OperandIndex>> ops{{x, a}, {a, b}, {b, y}};
+    for (const auto &io : ops)
+    {
+      auto ind = graph->addOperation(std::make_unique<ir::operation::ElementwiseActivation>(
+        ir::OperandIndexSequence{io.first}, ir::OperandIndexSequence{io.second}, param));
+      ctx._data.op_order.push_back(ind);
+    }
+
+    graph->operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &) {
+      ctx._data.operand_layouts[ind] = ir::Layout::NHWC;
+    });
+    ctx._data.graph = std::move(graph);
+    ctx._data.is_linear_executor = true;
+    ctx.tensor_registry = std::make_shared<basic::TensorRegistry>();
+    ctx.tensor_builder = std::make_shared<basic::TensorBuilder>(ctx.tensor_registry, "WIC");
+  }
+
+  uint8_t *buffer(const ir::OperandIndex &ind)
+  {
+    return ctx.tensor_registry->getNativeTensor(ind)->buffer();
+  }
+};
+
+} // namespace
+
+TEST(BackendContextHelpers, planTensorsInplace)
+{
+  ReluChain chain;
+  basic::genTensors(chain.ctx, true);
+
+  // b is written on a, which is not used after b is defined
+  EXPECT_EQ(chain.buffer(chain.a), chain.buffer(chain.b));
+  // Model inputs and outputs are never shared
+  EXPECT_NE(chain.buffer(chain.x), chain.buffer(chain.a));
+  EXPECT_NE(chain.buffer(chain.b), chain.buffer(chain.y));
+}
+
+TEST(BackendContextHelpers, planTensorsNotInplace)
+{
+  ReluChain chain;
+  basic::genTensors(chain.ctx);
+
+  EXPECT_NE(chain.buffer(chain.a), chain.buffer(chain.b));
+}
@@ -17,7 +17,9 @@
 #include <backend/basic/MemoryManager.h>
 
 #include <cassert>
+#include <memory>
 
+#include "MemoryPlanner.h"
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
@@ -29,23 +31,19 @@ namespace backend
 namespace basic
 {
 
-MemoryManager::MemoryManager() : _mem_planner{createMemoryPlanner()}
+MemoryManager::MemoryManager()
+  : _planner_id{util::getConfigString(util::config::CPU_MEMORY_PLANNER)},
+    _mem_planner{createMemoryPlanner(_planner_id)}
 {
   // DO NOTHING
 }
 
 MemoryManager::MemoryManager(const std::string planner_id)
-  : _mem_planner{createMemoryPlanner(planner_id)}
+  : _planner_id{planner_id}, _mem_planner{createMemoryPlanner(planner_id)}
 {
   // DO NOTHING
 }
 
-basic::IMemoryPlanner<ir::OperandIndex> *MemoryManager::createMemoryPlanner()
-{
-  auto planner_id = util::getConfigString(util::config::CPU_MEMORY_PLANNER);
-  return basic::MemoryPlannerFactory::get().create(planner_id);
-}
-
 basic::IMemoryPlanner<ir::OperandIndex> *
 MemoryManager::createMemoryPlanner(const std::string planner_id)
 {
@@ -54,33 +52,167 @@ MemoryManager::createMemoryPlanner(const std::string planner_id)
 
 void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
 {
-  _mem_planner->claim(ind, size);
+  if (!_reused_plan)
+    _mem_planner->claim(ind, size);
+  _block_users[ind] = 1;
+  _plan_history.push_back({ind, size, true});
+}
+
+void MemoryManager::releasePlan(const ir::OperandIndex &ind)
+{
+  _plan_history.push_back({ind, 0, false});
+
+  const auto &owner = blockOwner(ind);
+  auto users = _block_users.find(owner);
+  if ((users == _block_users.end() || --users->second == 0) && !_reused_plan)
+    _mem_planner->release(owner);
+}
+
+void MemoryManager::sharePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base,
+                              uint32_t size)
+{
+  const auto &owner = blockOwner(base);
+  assert(_block_users.find(owner) != _block_users.end() && _block_users.at(owner) > 0);
+  assert(_block_owners.find(ind) == _block_owners.end());
+  _block_owners.emplace(ind, owner);
+  _block_users[owner]++;
+  _plan_history.push_back({ind, size, true});
+
+  VERBOSE(MemoryManager) << "Share memory of " << owner << " with " << ind << std::endl;
+}
+
+const ir::OperandIndex &MemoryManager::blockOwner(const ir::OperandIndex &ind) const
+{
+  auto owner = _block_owners.find(ind);
+  return owner == _block_owners.end() ? ind : owner->second;
 }
 
-void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->release(ind); }
+void MemoryManager::usePlan(const std::shared_ptr<StaticMemoryPlan> &plan)
+{
+  assert(_plan_history.empty());
+  _reused_plan = plan;
+}
 
 void MemoryManager::allocate(void)
 {
+  if (_reused_plan)
+  {
+    const auto key = planKey();
+    if (_reused_plan->key == key)
+    {
+      VERBOSE(MemoryManager) << "Reuse memory plan of previous compilation" << std::endl;
+      _mem_planner =
+        std::make_shared<FixedPlanner>(_reused_plan->blocks, _reused_plan->capacity);
+    }
+    else
+    {
+      // Planning is deferred until now, as the plan was expected to be reused
+      replayPlans(*_mem_planner, true);
+      _reused_plan->key = key;
+      _reused_plan->capacity = _mem_planner->capacity();
+      _reused_plan->blocks = _mem_planner->memory_plans();
+      _reused_plan->updated = true;
+    }
+  }
+
   _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
   assert(_mem_alloc->base());
+
+  WHEN_LOG_ENABLED(reportPeakMemory());
 }
 
 uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 {
-  assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
-  const auto &mem_blk = _mem_planner->memory_plans().at(ind);
+  const auto &owner = blockOwner(ind);
+  assert(_mem_planner->memory_plans().find(owner) != _mem_planner->memory_plans().end());
+  const auto &mem_blk = _mem_planner->memory_plans().at(owner);
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+uint32_t MemoryManager::replayPlans(const std::string &planner_id, bool share) const
+{
+  std::unique_ptr<IMemoryPlanner<ir::OperandIndex>> planner{
+    MemoryPlannerFactory::get().create(planner_id)};
+  replayPlans(*planner, share);
+  return planner->capacity();
+}
+
+void MemoryManager::replayPlans(IMemoryPlanner<ir::OperandIndex> &planner, bool share) const
+{
+  ir::OperandIndexMap<uint32_t> users;
+  for (const auto &record : _plan_history)
+  {
+    const auto &ind = share ? blockOwner(record.ind) : record.ind;
+    auto &count = users[ind];
+    if (record.claim)
+    {
+      if (count++ == 0)
+        planner.claim(ind, record.size);
+    }
+    else if (count > 0 && --count == 0)
+    {
+      planner.release(ind);
+    }
+  }
+}
+
+uint64_t MemoryManager::planKey() const
+{
+  // 64-bit FNV-1a of planner id and plan history
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&](uint64_t value) {
+    for (int i = 0; i < 8; ++i, value >>= 8)
+    {
+      hash ^= value & 0xff;
+      hash *= 1099511628211ULL;
+    }
+  };
+  for (const auto c : _planner_id)
+    mix(static_cast<uint8_t>(c));
+  for (const auto &record : _plan_history)
+  {
+    mix(record.ind.value());
+    mix(blockOwner(record.ind).value());
+    mix(record.size);
+    mix(record.claim);
+  }
+  return hash;
+}
+
+void MemoryManager::reportPeakMemory() const
+{
+  VERBOSE(MemoryManager) << "Peak memory: " << _mem_planner->capacity() << " bytes, "
+                         << _block_owners.size() << " operand(s) share memory in-place"
+                         << std::endl;
+  for (const auto &planner_id : {"Bump", "FirstFit", "WIC"})
+  {
+    VERBOSE(MemoryManager) << "  " << planner_id << " planner: " << replayPlans(planner_id, false)
+                           << " bytes, " << replayPlans(planner_id, true)
+                           << " bytes with in-place sharing" << std::endl;
+  }
+}
+
+DynamicMemoryManager::DynamicMemoryManager() : _pool{std::make_shared<MemoryPool>()}
+{
+  // DO NOTHING
+}
+
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
   auto find = _mem_alloc_map.find(tensor);
-  if (find != _mem_alloc_map.end())
-    throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
+  if (find == _mem_alloc_map.end())
+  {
+    auto alloc = std::make_shared<basic::Allocator>(capacity, _pool);
+    _mem_alloc_map.emplace(tensor, alloc);
+    return alloc;
+  }
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  // Reuse the allocator deallocated before
+  if (find->second->base() != nullptr)
+    throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
+  find->second->reallocate(capacity);
+  return find->second;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
@@ -89,8 +221,10 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
-  _mem_alloc_map.erase(find); // remove tensor and alloc
+  find->second->release(); // explicitly erase memory
+  // Allocator still referred by others(e.g. temporary tensor) is not reused
+  if (find->second.use_count() > 1)
+    _mem_alloc_map.erase(find); // remove tensor and alloc
 }
 
 void DynamicMemoryManager::deallocate(void)
@@ -102,6 +236,7 @@ void DynamicMemoryManager::deallocate(void)
   }
 
   _mem_alloc_map.clear();
+  _pool->clear();
 }
 
 } // namespace basic
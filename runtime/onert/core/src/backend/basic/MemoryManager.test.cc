@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <backend/basic/MemoryManager.h>
+#include <backend/basic/Tensor.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert::backend::basic;
+using onert::ir::OperandIndex;
+using onert::ir::OperandInfo;
+using onert::ir::Shape;
+
+namespace
+{
+
+OperandInfo floatInfo()
+{
+  return OperandInfo::createStaticInfo(Shape{1}, onert::ir::TypeInfo{onert::ir::DataType::FLOAT32});
+}
+
+} // namespace
+
+TEST(MemoryManager, sharePlan)
+{
+  MemoryManager mgr{"FirstFit"};
+
+  // 0 : input, 1 : in-place output of 0, 2 : output of 1
+  mgr.claimPlan(OperandIndex{0}, 16);
+  mgr.sharePlan(OperandIndex{1}, OperandIndex{0}, 16);
+  mgr.releasePlan(OperandIndex{0});
+  // Memory of 0 is still used by 1
+  mgr.claimPlan(OperandIndex{2}, 16);
+  mgr.releasePlan(OperandIndex{1});
+  // Memory of 0 and 1 can be reused from now
+  mgr.claimPlan(OperandIndex{3}, 16);
+  mgr.releasePlan(OperandIndex{2});
+  mgr.releasePlan(OperandIndex{3});
+  mgr.allocate();
+
+  EXPECT_EQ(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{1}));
+  EXPECT_NE(mgr.getBuffer(OperandIndex{1}), mgr.getBuffer(OperandIndex{2}));
+  EXPECT_EQ(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{3}));
+  mgr.deallocate();
+}
+
+TEST(MemoryManager, sharePlanChain)
+{
+  MemoryManager mgr{"WIC"};
+
+  // 0 -> 1 -> 2 are run in-place on the same memory
+  mgr.claimPlan(OperandIndex{0}, 32);
+  mgr.sharePlan(OperandIndex{1}, OperandIndex{0}, 32);
+  mgr.releasePlan(OperandIndex{0});
+  mgr.sharePlan(OperandIndex{2}, OperandIndex{1}, 32);
+  mgr.releasePlan(OperandIndex{1});
+  mgr.claimPlan(OperandIndex{3}, 32);
+  mgr.releasePlan(OperandIndex{2});
+  mgr.releasePlan(OperandIndex{3});
+  mgr.allocate();
+
+  EXPECT_EQ(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{1}));
+  EXPECT_EQ(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{2}));
+  EXPECT_NE(mgr.getBuffer(OperandIndex{2}), mgr.getBuffer(OperandIndex{3}));
+  mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, reuseMemory)
+{
+  DynamicMemoryManager mgr;
+  const auto info = floatInfo();
+  Tensor a{info, onert::ir::Layout::NHWC, &mgr};
+  Tensor b{info, onert::ir::Layout::NHWC, &mgr};
+
+  auto run = [&](int32_t length) {
+    a.applyShape(Shape{length, 4});
+    b.applyShape(Shape{length, 8});
+    ASSERT_NE(a.buffer(), nullptr);
+    ASSERT_NE(b.buffer(), nullptr);
+    a.deallocBuffer();
+    b.deallocBuffer();
+  };
+
+  run(10);
+  EXPECT_EQ(mgr.counters().allocations, 2);
+
+  // Steady state does not allocate from heap
+  run(10);
+  run(9);
+  EXPECT_EQ(mgr.counters().allocations, 2);
+  EXPECT_EQ(mgr.counters().reuses, 4);
+
+  // Larger shape needs larger memory
+  run(100);
+  EXPECT_EQ(mgr.counters().allocations, 4);
+
+  mgr.deallocate();
+  EXPECT_EQ(mgr.counters().cached_bytes, 0);
+}
+
+TEST(DynamicMemoryManager, resizeAllocated)
+{
+  DynamicMemoryManager mgr;
+  const auto info = floatInfo();
+  Tensor a{info, onert::ir::Layout::NHWC, &mgr};
+
+  a.applyShape(Shape{64});
+  a.applyShape(Shape{1});
+  a.applyShape(Shape{64});
+  EXPECT_EQ(mgr.counters().allocations, 2);
+  EXPECT_EQ(mgr.counters().reuses, 1);
+  a.deallocBuffer();
+}
+
+TEST(DynamicMemoryManager, neg_allocateTwice)
+{
+  DynamicMemoryManager mgr;
+  const auto info = floatInfo();
+  Tensor a{info, onert::ir::Layout::NHWC, &mgr};
+
+  auto alloc = mgr.allocate(&a, 16);
+  EXPECT_ANY_THROW(mgr.allocate(&a, 16));
+  alloc.reset();
+  mgr.deallocate(&a);
+  EXPECT_ANY_THROW(mgr.deallocate(nullptr));
+}
+
+TEST(MemoryManager, usePlan)
+{
+  auto plan = std::make_shared<StaticMemoryPlan>();
+  auto run = [&](uint32_t size) {
+    MemoryManager mgr{"FirstFit"};
+    mgr.usePlan(plan);
+    mgr.claimPlan(OperandIndex{0}, size);
+    mgr.claimPlan(OperandIndex{1}, 16);
+    mgr.releasePlan(OperandIndex{0});
+    mgr.claimPlan(OperandIndex{2}, 16);
+    mgr.releasePlan(OperandIndex{1});
+    mgr.releasePlan(OperandIndex{2});
+    mgr.allocate();
+    EXPECT_NE(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{1}));
+    EXPECT_EQ(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{2}));
+    mgr.deallocate();
+  };
+
+  // The first compilation plans memory
+  run(16);
+  EXPECT_TRUE(plan->updated);
+  EXPECT_EQ(plan->capacity, 32u);
+  EXPECT_EQ(plan->blocks.size(), 3u);
+
+  // Same claims and releases reuse the plan
+  plan->updated = false;
+  const auto key = plan->key;
+  run(16);
+  EXPECT_FALSE(plan->updated);
+  EXPECT_EQ(plan->key, key);
+}
+
+TEST(MemoryManager, neg_usePlanMismatch)
+{
+  auto plan = std::make_shared<StaticMemoryPlan>();
+  plan->key = 1;
+  plan->capacity = 4;
+  plan->blocks[OperandIndex{0}] = Block{0, 4};
+
+  MemoryManager mgr{"Bump"};
+  mgr.usePlan(plan);
+  mgr.claimPlan(OperandIndex{0}, 16);
+  mgr.claimPlan(OperandIndex{1}, 16);
+  mgr.releasePlan(OperandIndex{0});
+  mgr.releasePlan(OperandIndex{1});
+  mgr.allocate();
+
+  // Plan which does not match is replaced
+  EXPECT_TRUE(plan->updated);
+  EXPECT_NE(plan->key, 1u);
+  EXPECT_EQ(plan->capacity, 32u);
+  EXPECT_EQ(plan->blocks.size(), 2u);
+  EXPECT_NE(mgr.getBuffer(OperandIndex{0}), mgr.getBuffer(OperandIndex{1}));
+  mgr.deallocate();
+}
@@ -153,6 +153,28 @@ private:
   std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
 };
 
+/**
+ * @brief Class to give memory plans made before
+ * @note  All plans are given on construction, so claim and release do nothing
+ */
+class FixedPlanner : public IMemoryPlanner<ir::OperandIndex>
+{
+public:
+  FixedPlanner(const MemoryPlans &mem_plans, uint32_t capacity)
+    : _capacity{capacity}, _mem_plans{mem_plans}
+  {
+  }
+
+  void claim(const ir::OperandIndex &, size_t) override {}
+  void release(const ir::OperandIndex &) override {}
+  uint32_t capacity() override { return _capacity; }
+  MemoryPlans &memory_plans() override { return _mem_plans; }
+
+private:
+  uint32_t _capacity;
+  MemoryPlans _mem_plans;
+};
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
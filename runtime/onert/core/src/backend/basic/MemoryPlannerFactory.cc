@@ -45,6 +45,11 @@ IMemoryPlanner<ir::OperandIndex> *MemoryPlannerFactory::create(const std::string
   {
     return new WICPlanner;
   }
+  else if (key == "InPlace")
+  {
+    // In-place sharing is decided on planning tensors, and shared blocks are packed by WIC
+    return new WICPlanner;
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryPool.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+uint64_t MemoryPool::sizeClass(uint32_t capacity)
+{
+  constexpr uint64_t min_size = 64;
+  if (capacity <= min_size)
+    return min_size;
+
+  // Round up to a multiple of a quarter of the power of two below capacity
+  // NOTE Capacities above 0xE0000000 are rounded up to 2^32, which does not fit in uint32_t
+  uint32_t msb = 31;
+  while (((capacity - 1) >> msb) == 0)
+    msb--;
+  const uint64_t step = uint64_t{1} << (msb - 2);
+  return (capacity + step - 1) / step * step;
+}
+
+std::unique_ptr<uint8_t[]> MemoryPool::take(uint32_t capacity)
+{
+  const auto size = sizeClass(capacity);
+  if (size > std::numeric_limits<size_t>::max())
+    throw std::runtime_error{"MemoryPool: Too large capacity " + std::to_string(capacity)};
+
+  auto it = _blocks.find(size);
+  if (it == _blocks.end() || it->second.empty())
+  {
+    _counters.allocations++;
+    return std::make_unique<uint8_t[]>(size);
+  }
+
+  auto block = std::move(it->second.back());
+  it->second.pop_back();
+  _counters.reuses++;
+  _counters.cached_bytes -= size;
+  // Clear the previous contents, as a new block is zero-initialized
+  std::memset(block.get(), 0, capacity);
+  return block;
+}
+
+void MemoryPool::give(std::unique_ptr<uint8_t[]> &&block, uint32_t capacity)
+{
+  if (block == nullptr)
+    return;
+
+  const auto size = sizeClass(capacity);
+  _blocks[size].emplace_back(std::move(block));
+  _counters.cached_bytes += size;
+}
+
+void MemoryPool::clear()
+{
+  _blocks.clear();
+  _counters.cached_bytes = 0;
+}
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <backend/basic/Allocator.h>
+#include <backend/basic/MemoryPool.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace onert::backend::basic;
+
+TEST(MemoryPool, sizeClass)
+{
+  EXPECT_EQ(MemoryPool::sizeClass(0), 64);
+  EXPECT_EQ(MemoryPool::sizeClass(64), 64);
+  EXPECT_EQ(MemoryPool::sizeClass(65), 80);
+  EXPECT_EQ(MemoryPool::sizeClass(100), 112);
+  EXPECT_EQ(MemoryPool::sizeClass(128), 128);
+  EXPECT_EQ(MemoryPool::sizeClass(1000), 1024);
+  EXPECT_EQ(MemoryPool::sizeClass(1025), 1280);
+  EXPECT_EQ(MemoryPool::sizeClass(0xE0000000u), 0xE0000000u);
+  EXPECT_EQ(MemoryPool::sizeClass(0xF0000000u), 0x100000000u);
+  EXPECT_EQ(MemoryPool::sizeClass(0xFFFFFFFFu), 0x100000000u);
+}
+
+TEST(MemoryPool, reuseZeroed)
+{
+  MemoryPool pool;
+
+  auto block = pool.take(100);
+  std::fill_n(block.get(), 100, 0xFF);
+  pool.give(std::move(block), 100);
+
+  block = pool.take(100);
+  EXPECT_EQ(pool.counters().reuses, 1);
+  for (uint32_t i = 0; i < 100; ++i)
+    EXPECT_EQ(block[i], 0);
+}
+
+TEST(MemoryPool, reuse)
+{
+  MemoryPool pool;
+
+  auto block = pool.take(100);
+  auto *ptr = block.get();
+  pool.give(std::move(block), 100);
+  EXPECT_EQ(pool.counters().cached_bytes, 112);
+
+  // Capacity of the same size class reuses the block
+  block = pool.take(110);
+  EXPECT_EQ(block.get(), ptr);
+  EXPECT_EQ(pool.counters().allocations, 1);
+  EXPECT_EQ(pool.counters().reuses, 1);
+  EXPECT_EQ(pool.counters().cached_bytes, 0);
+
+  auto other = pool.take(200);
+  EXPECT_NE(other.get(), ptr);
+  EXPECT_EQ(pool.counters().allocations, 2);
+
+  pool.give(std::move(block), 110);
+  pool.give(std::move(other), 200);
+  pool.clear();
+  EXPECT_EQ(pool.counters().cached_bytes, 0);
+}
+
+TEST(MemoryPool, allocatorOutlivesPool)
+{
+  auto pool = std::make_shared<MemoryPool>();
+  Allocator alloc{16, pool};
+  EXPECT_NE(alloc.base(), nullptr);
+
+  pool.reset();
+  alloc.release();
+  EXPECT_EQ(alloc.base(), nullptr);
+  EXPECT_ANY_THROW(alloc.reallocate(16));
+}
@@ -106,6 +106,26 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
     _nonconst_mgr->releasePlan(ind);
 }
 
+void StaticTensorManager::sharePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base,
+                                    uint32_t size)
+{
+  assert(_tensors->getNativeTensor(ind) && _tensors->getNativeTensor(base));
+
+  // This method is called only when both tensors have proper shape
+  assert(!_tensors->getNativeTensor(ind)->is_dynamic());
+  assert(!_tensors->getNativeTensor(base)->is_dynamic());
+
+  // Constant tensors have their own data
+  assert(!_as_constants[ind] && !_as_constants[base]);
+
+  _nonconst_mgr->sharePlan(ind, base, size);
+}
+
+void StaticTensorManager::usePlan(const std::shared_ptr<StaticMemoryPlan> &plan)
+{
+  _nonconst_mgr->usePlan(plan);
+}
+
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
 {
   for (const auto &it : _tensors->native_tensors())
@@ -69,8 +69,8 @@ bool Tensor::applyShape(const ir::Shape &new_shape)
     auto new_size = new_shape.num_elements() * ir::sizeOfDataType(data_type());
     if (previous_size != new_size)
     {
-      assert(_dynamic_mem_mgr);
-      _dynamic_mem_mgr->deallocate(this);
+      // Drop the allocator first, so that the manager can reuse it
+      deallocBuffer();
 
       setShape(new_shape);
       set_dynamic();
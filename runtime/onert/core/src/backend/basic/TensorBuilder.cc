@@ -71,6 +71,16 @@ void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &base)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  const auto &tensor_info = _tensor_info_map.at(ind);
+
+  assert(!_tensor_reg->getNativeTensor(ind)->is_dynamic());
+  assert(!_tensor_reg->getNativeTensor(base)->is_dynamic());
+  _static_tensor_mgr->sharePlan(ind, base, tensor_info.total_size());
+}
+
 void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
 {
   if (!_tensor_reg->getNativeTensor(ind)->is_dynamic())
@@ -84,6 +94,11 @@ bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
 }
 
+void TensorBuilder::useMemoryPlan(const std::shared_ptr<StaticMemoryPlan> &plan)
+{
+  _static_tensor_mgr->usePlan(plan);
+}
+
 void TensorBuilder::allocate(void) { _static_tensor_mgr->allocateNonconsts(); }
 
 } // namespace basic
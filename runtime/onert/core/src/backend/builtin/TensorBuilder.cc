@@ -66,6 +66,12 @@ void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &)
+{
+  // Builtin operations are not run in-place, so the tensor gets its own memory
+  notifyFirstUse(ind);
+}
+
 void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
 {
   // TODO Enhance the way of checking user tensors
@@ -50,6 +50,7 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
+  void notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &base);
 
   bool isRegistered(const ir::OperandIndex &) const;
 
@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompilationCache.h"
+
+#include "ir/Graph.h"
+#include "util/logging.h"
+
+#include <misc/polymorphic_downcast.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+// Cache file layout (host byte order)
+//   header : magic[8], version(u32), key(u64), number of subgraphs(u32)
+//   subgraph : index(u16), number of operations(u32)
+//   operation : index(u32), has rank(u8), rank(i64), backend id length(u16), backend id
+//   number of subgraphs with memory plans(u32)
+//   subgraph : index(u16), number of plans(u32)
+//   plan : backend id length(u16), backend id, key(u64), capacity(u32), number of blocks(u32)
+//   block : operand index(u32), offset(u32), size(u64)
+constexpr char kMagic[8] = {'O', 'N', 'E', 'R', 'T', 'C', 'C', '\0'};
+constexpr uint32_t kVersion = 2;
+// Execution time data file of HEScheduler, which is read by exec::JSON
+constexpr char kExecTimeFile[] = "exec_time.json";
+
+// 64-bit FNV-1a
+class Hasher
+{
+public:
+  void bytes(const void *data, size_t size)
+  {
+    const auto p = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      _hash ^= p[i];
+      _hash *= 1099511628211ULL;
+    }
+  }
+  template <typename T> void value(const T &v) { bytes(&v, sizeof(T)); }
+  void str(const std::string &s)
+  {
+    value<uint64_t>(s.size());
+    bytes(s.data(), s.size());
+  }
+  uint64_t hash() const { return _hash; }
+
+private:
+  uint64_t _hash = 14695981039346656037ULL;
+};
+
+template <typename Index> std::vector<Index> sortedIndices(const std::vector<Index> &indices)
+{
+  auto sorted = indices;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Index &a, const Index &b) { return a.value() < b.value(); });
+  return sorted;
+}
+
+void hashGraph(Hasher &hasher, const ir::Graph &graph)
+{
+  // Objects of graph are unordered, so visit them in index order
+  std::vector<ir::OperandIndex> operands;
+  graph.operands().iterate(
+    [&](const ir::OperandIndex &index, const ir::Operand &) { operands.emplace_back(index); });
+  for (const auto &index : sortedIndices(operands))
+  {
+    const auto &operand = graph.operands().at(index);
+    hasher.value(index.value());
+    hasher.value<int32_t>(operand.shape().rank());
+    for (int i = 0; i < operand.shape().rank(); ++i)
+      hasher.value(operand.shape().dim(i));
+    hasher.value(operand.typeInfo().type());
+    for (const auto scale : operand.typeInfo().scales())
+      hasher.value(scale);
+    for (const auto zero_point : operand.typeInfo().zero_points())
+      hasher.value(zero_point);
+    hasher.value(operand.isConstant());
+  }
+
+  std::vector<ir::OperationIndex> operations;
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    operations.emplace_back(index);
+  });
+  for (const auto &index : sortedIndices(operations))
+  {
+    const auto &op = graph.operations().at(index);
+    hasher.value(index.value());
+    hasher.value(op.opcode());
+    hasher.str(op.name());
+    hasher.value<uint32_t>(op.getInputs().size());
+    for (const auto &input : op.getInputs())
+      hasher.value(input.value());
+    hasher.value<uint32_t>(op.getOutputs().size());
+    for (const auto &output : op.getOutputs())
+      hasher.value(output.value());
+  }
+
+  for (const auto &input : graph.getInputs())
+    hasher.value(input.value());
+  for (const auto &output : graph.getOutputs())
+    hasher.value(output.value());
+}
+
+uint64_t hashModel(const ir::Model &model, const compiler::CompilerOptions &options)
+{
+  Hasher hasher;
+  hasher.value(kVersion);
+
+  // Options which affect scheduling
+  hasher.value<uint32_t>(options.backend_list.size());
+  for (const auto &backend : options.backend_list)
+    hasher.str(backend);
+  hasher.str(options.executor);
+  hasher.value(options.he_scheduler);
+  hasher.value(options.fp16_enable);
+  const auto &ms_options = options.manual_scheduler_options;
+  hasher.str(ms_options.backend_for_all);
+  std::map<int, std::string> opcode_to_backend;
+  for (const auto &pair : ms_options.opcode_to_backend)
+    opcode_to_backend.emplace(static_cast<int>(pair.first), pair.second);
+  for (const auto &pair : opcode_to_backend)
+  {
+    hasher.value(pair.first);
+    hasher.str(pair.second);
+  }
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &pair : ms_options.index_to_backend)
+    index_to_backend.emplace(pair.first.value(), pair.second);
+  for (const auto &pair : index_to_backend)
+  {
+    hasher.value(pair.first);
+    hasher.str(pair.second);
+  }
+
+  // HEScheduler schedules by execution time data, so updated data makes a new key
+  if (options.he_scheduler)
+  {
+    std::ifstream file(kExecTimeFile, std::ios::binary);
+    const std::string content{std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>()};
+    hasher.str(content);
+  }
+
+  std::vector<ir::SubgraphIndex> subgraphs;
+  model.iterate(
+    [&](const ir::SubgraphIndex &index, const ir::IGraph &) { subgraphs.emplace_back(index); });
+  for (const auto &index : sortedIndices(subgraphs))
+  {
+    hasher.value(index.value());
+    hashGraph(hasher, nnfw::misc::polymorphic_downcast<const ir::Graph &>(*model.at(index)));
+  }
+
+  return hasher.hash();
+}
+
+class Writer
+{
+public:
+  template <typename T> void value(const T &v)
+  {
+    _buffer.append(reinterpret_cast<const char *>(&v), sizeof(T));
+  }
+  void bytes(const void *data, size_t size)
+  {
+    _buffer.append(static_cast<const char *>(data), size);
+  }
+  const std::string &buffer() const { return _buffer; }
+
+private:
+  std::string _buffer;
+};
+
+// Reader which checks bounds of every read
+class Reader
+{
+public:
+  Reader(const uint8_t *data, size_t size) : _data{data}, _size{size}, _offset{0} {}
+
+  template <typename T> bool value(T &v) { return bytes(&v, sizeof(T)); }
+  bool bytes(void *out, size_t size)
+  {
+    if (size > _size - _offset)
+      return false;
+    std::memcpy(out, _data + _offset, size);
+    _offset += size;
+    return true;
+  }
+  bool done() const { return _offset == _size; }
+
+private:
+  const uint8_t *_data;
+  size_t _size;
+  size_t _offset;
+};
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+CompilationCache::CompilationCache(const ir::Model &model, const CompilerOptions &options)
+  : _key{hashModel(model, options)}, _path{}, _schedules{}, _memory_plans{}, _dirty{false}
+{
+  if (options.compile_cache_dir.empty() || options.he_profiling_mode)
+    return;
+
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.cache", static_cast<unsigned long long>(_key));
+  _path = options.compile_cache_dir + "/" + name;
+
+  if (load())
+  {
+    VERBOSE(CompilationCache) << "Loaded compilation results from " << _path << std::endl;
+  }
+  else
+  {
+    VERBOSE(CompilationCache) << "No valid cache file " << _path << std::endl;
+    _schedules.clear();
+    _memory_plans.clear();
+  }
+}
+
+const LoweringSchedule *CompilationCache::schedule(const ir::SubgraphIndex &index) const
+{
+  auto it = _schedules.find(index);
+  return it == _schedules.end() ? nullptr : &it->second;
+}
+
+void CompilationCache::record(const ir::SubgraphIndex &index, const LoweringSchedule &schedule)
+{
+  _schedules[index] = schedule;
+  _dirty = true;
+}
+
+bool CompilationCache::load()
+{
+  int fd = open(_path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  auto base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+    return false;
+
+  auto parse = [&]() {
+    Reader reader{static_cast<const uint8_t *>(base), size};
+
+    char magic[sizeof(kMagic)];
+    uint32_t version = 0;
+    uint64_t key = 0;
+    uint32_t num_subgraphs = 0;
+    if (!reader.bytes(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !reader.value(version) || version != kVersion || !reader.value(key) || key != _key ||
+        !reader.value(num_subgraphs))
+      return false;
+
+    for (uint32_t s = 0; s < num_subgraphs; ++s)
+    {
+      uint16_t subg_index = 0;
+      uint32_t num_operations = 0;
+      if (!reader.value(subg_index) || !reader.value(num_operations))
+        return false;
+
+      auto &schedule = _schedules[ir::SubgraphIndex{subg_index}];
+      for (uint32_t o = 0; o < num_operations; ++o)
+      {
+        uint32_t op_index = 0;
+        uint8_t has_rank = 0;
+        int64_t rank = 0;
+        uint16_t id_length = 0;
+        if (!reader.value(op_index) || !reader.value(has_rank) || !reader.value(rank) ||
+            !reader.value(id_length))
+          return false;
+        std::string id(id_length, '\0');
+        if (!reader.bytes(&id[0], id_length))
+          return false;
+
+        const auto index = ir::OperationIndex{op_index};
+        schedule.backends[index] = id;
+        if (has_rank)
+          schedule.ranks[index] = rank;
+      }
+    }
+
+    uint32_t num_plan_subgraphs = 0;
+    if (!reader.value(num_plan_subgraphs))
+      return false;
+    for (uint32_t s = 0; s < num_plan_subgraphs; ++s)
+    {
+      uint16_t subg_index = 0;
+      uint32_t num_plans = 0;
+      if (!reader.value(subg_index) || !reader.value(num_plans))
+        return false;
+
+      auto &plans = _memory_plans[ir::SubgraphIndex{subg_index}];
+      for (uint32_t p = 0; p < num_plans; ++p)
+      {
+        uint16_t id_length = 0;
+        if (!reader.value(id_length))
+          return false;
+        std::string id(id_length, '\0');
+        auto plan = std::make_shared<backend::basic::StaticMemoryPlan>();
+        uint32_t num_blocks = 0;
+        if (!reader.bytes(&id[0], id_length) || !reader.value(plan->key) ||
+            !reader.value(plan->capacity) || !reader.value(num_blocks))
+          return false;
+        for (uint32_t b = 0; b < num_blocks; ++b)
+        {
+          uint32_t operand_index = 0;
+          uint32_t offset = 0;
+          uint64_t size = 0;
+          if (!reader.value(operand_index) || !reader.value(offset) || !reader.value(size))
+            return false;
+          plan->blocks[ir::OperandIndex{operand_index}] =
+            backend::basic::Block{offset, static_cast<size_t>(size)};
+        }
+        plans[id] = plan;
+      }
+    }
+    return reader.done();
+  };
+
+  const bool loaded = parse();
+  munmap(base, size);
+  return loaded;
+}
+
+void CompilationCache::store()
+{
+  bool dirty = _dirty;
+  for (const auto &pair : _memory_plans)
+    for (const auto &plan_pair : pair.second)
+      dirty = dirty || (plan_pair.second && plan_pair.second->updated);
+  if (_path.empty() || !dirty)
+    return;
+
+  Writer writer;
+  writer.bytes(kMagic, sizeof(kMagic));
+  writer.value(kVersion);
+  writer.value(_key);
+  writer.value<uint32_t>(_schedules.size());
+  for (const auto &pair : _schedules)
+  {
+    const auto &schedule = pair.second;
+    writer.value<uint16_t>(pair.first.value());
+    writer.value<uint32_t>(schedule.backends.size());
+    for (const auto &op_pair : schedule.backends)
+    {
+      const auto &id = op_pair.second;
+      const auto rank_it = schedule.ranks.find(op_pair.first);
+      const bool has_rank = rank_it != schedule.ranks.end();
+      writer.value<uint32_t>(op_pair.first.value());
+      writer.value<uint8_t>(has_rank);
+      writer.value<int64_t>(has_rank ? rank_it->second : 0);
+      writer.value<uint16_t>(id.size());
+      writer.bytes(id.data(), id.size());
+    }
+  }
+
+  writer.value<uint32_t>(_memory_plans.size());
+  for (const auto &pair : _memory_plans)
+  {
+    // Backend which does not plan memory leaves its plan empty
+    std::vector<std::pair<std::string, const backend::basic::StaticMemoryPlan *>> plans;
+    for (const auto &plan_pair : pair.second)
+      if (plan_pair.second && plan_pair.second->key != 0)
+        plans.emplace_back(plan_pair.first, plan_pair.second.get());
+
+    writer.value<uint16_t>(pair.first.value());
+    writer.value<uint32_t>(plans.size());
+    for (const auto &plan_pair : plans)
+    {
+      const auto &id = plan_pair.first;
+      const auto &plan = *plan_pair.second;
+      writer.value<uint16_t>(id.size());
+      writer.bytes(id.data(), id.size());
+      writer.value<uint64_t>(plan.key);
+      writer.value<uint32_t>(plan.capacity);
+      writer.value<uint32_t>(plan.blocks.size());
+      for (const auto &block : plan.blocks)
+      {
+        writer.value<uint32_t>(block.first.value());
+        writer.value<uint32_t>(block.second.offset);
+        writer.value<uint64_t>(block.second.size);
+      }
+    }
+  }
+
+  // Write to temporary file and rename it, so readers never see partially written file
+  const auto tmp_path = _path + "." + std::to_string(getpid()) + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    file.write(writer.buffer().data(), writer.buffer().size());
+    if (!file)
+    {
+      VERBOSE(CompilationCache) << "Failed to write " << tmp_path << std::endl;
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), _path.c_str()) != 0)
+  {
+    VERBOSE(CompilationCache) << "Failed to rename " << tmp_path << std::endl;
+    std::remove(tmp_path.c_str());
+    return;
+  }
+
+  VERBOSE(CompilationCache) << "Stored compilation results to " << _path << std::endl;
+  _dirty = false;
+  for (auto &&pair : _memory_plans)
+    for (auto &&plan_pair : pair.second)
+      if (plan_pair.second)
+        plan_pair.second->updated = false;
+}
+
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_COMPILATION_CACHE_H__
+#define __ONERT_COMPILER_COMPILATION_CACHE_H__
+
+#include "backend/basic/MemoryManager.h"
+#include "compiler/CompilerOptions.h"
+#include "compiler/LoweredGraph.h"
+#include "ir/Model.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Memory plans of static tensors of a subgraph, Key: backend id
+ */
+using BackendMemoryPlans =
+  std::unordered_map<std::string, std::shared_ptr<backend::basic::StaticMemoryPlan>>;
+
+/**
+ * @brief Class to reuse compilation results of subgraphs over compilations
+ *
+ * Two results are cached.
+ * - HEScheduler results: backend assignment and ranks of operations
+ * - Memory plans of static tensors given by backends which support it (e.g. cpu)
+ *
+ * Lowering and kernel generation including weight prepacking still run on every compilation,
+ * because their results are backend objects which cannot be serialized.
+ *
+ * Results are kept in memory, so execution contexts lowered from the same model share them.
+ * If @c CompilerOptions::compile_cache_dir is set, they are also stored in a file whose name is
+ * the hash of model, options and HEScheduler execution time data, and next compilation of the
+ * same model loads them instead of running scheduler and memory planner.
+ * @note  Cache file is not used on HEScheduler profiling mode, because profiling should run
+ *        scheduler.
+ */
+class CompilationCache
+{
+public:
+  /**
+   * @brief     Construct a new CompilationCache object and load cache file if exists
+   * @param[in] model   Model to compile, after mandatory passes
+   * @param[in] options Compiler options
+   */
+  CompilationCache(const ir::Model &model, const CompilerOptions &options);
+
+public:
+  /**
+   * @brief     Get schedule of subgraph
+   * @return    Schedule, or @c nullptr if there is no schedule of subgraph
+   */
+  const LoweringSchedule *schedule(const ir::SubgraphIndex &index) const;
+  /**
+   * @brief     Record schedule of subgraph
+   */
+  void record(const ir::SubgraphIndex &index, const LoweringSchedule &schedule);
+  /**
+   * @brief     Get memory plans of subgraph
+   * @note      Backend reuses the plan of its own if it matches, and updates it otherwise
+   */
+  BackendMemoryPlans &memoryPlans(const ir::SubgraphIndex &index) { return _memory_plans[index]; }
+  /**
+   * @brief     Store recorded schedules into cache file
+   * @note      It does nothing if there is no new result or cache file is not used.
+   *            Failure to write is not an error.
+   */
+  void store();
+
+  uint64_t key() const { return _key; }
+  const std::string &path() const { return _path; }
+
+private:
+  bool load();
+
+private:
+  uint64_t _key;
+  std::string _path; //< Cache file path, empty if cache file is not used
+  std::unordered_map<ir::SubgraphIndex, LoweringSchedule> _schedules;
+  std::unordered_map<ir::SubgraphIndex, BackendMemoryPlans> _memory_plans;
+  bool _dirty;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COMPILATION_CACHE_H__
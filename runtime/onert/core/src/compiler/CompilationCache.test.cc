@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompilationCache.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+
+class CompilationCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/compilation_cache_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    _dir = dir;
+
+    // model input: lhs, rhs
+    // model output: out
+    // operation: Add
+    auto graph = std::make_shared<Graph>();
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+    auto lhs = graph->addOperand(shape, type);
+    auto rhs = graph->addOperand(shape, type);
+    auto out = graph->addOperand(shape, type);
+
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = Activation::NONE;
+    _op = graph->addOperation(
+      std::make_unique<operation::BinaryArithmetic>(OperandIndexSequence{lhs, rhs},
+                                                    OperandIndexSequence{out}, param));
+    graph->addInput(lhs);
+    graph->addInput(rhs);
+    graph->addOutput(out);
+
+    _model = std::make_shared<Model>();
+    _model->push(SubgraphIndex{0}, graph);
+
+    _options = compiler::CompilerOptions::fromGlobalConfig();
+    _options->compile_cache_dir = _dir;
+
+    _schedule.backends[_op] = "cpu";
+    _schedule.ranks[_op] = 42;
+  }
+
+  void TearDown() override
+  {
+    compiler::CompilationCache cache{*_model, *_options};
+    std::remove(cache.path().c_str());
+    rmdir(_dir.c_str());
+  }
+
+  std::string _dir;
+  std::shared_ptr<Model> _model;
+  std::unique_ptr<compiler::CompilerOptions> _options;
+  OperationIndex _op;
+  compiler::LoweringSchedule _schedule;
+};
+
+} // namespace
+
+TEST_F(CompilationCacheTest, storeAndLoad)
+{
+  {
+    compiler::CompilationCache cache{*_model, *_options};
+    ASSERT_EQ(cache.schedule(SubgraphIndex{0}), nullptr);
+    cache.record(SubgraphIndex{0}, _schedule);
+    ASSERT_NE(cache.schedule(SubgraphIndex{0}), nullptr);
+    cache.store();
+  }
+
+  compiler::CompilationCache cache{*_model, *_options};
+  auto schedule = cache.schedule(SubgraphIndex{0});
+  ASSERT_NE(schedule, nullptr);
+  ASSERT_EQ(schedule->backends, _schedule.backends);
+  ASSERT_EQ(schedule->ranks, _schedule.ranks);
+}
+
+TEST_F(CompilationCacheTest, inMemoryOnly)
+{
+  _options->compile_cache_dir = "";
+
+  compiler::CompilationCache cache{*_model, *_options};
+  ASSERT_TRUE(cache.path().empty());
+  cache.record(SubgraphIndex{0}, _schedule);
+  cache.store();
+  ASSERT_NE(cache.schedule(SubgraphIndex{0}), nullptr);
+}
+
+TEST_F(CompilationCacheTest, neg_differentOptions)
+{
+  compiler::CompilationCache cache{*_model, *_options};
+  cache.record(SubgraphIndex{0}, _schedule);
+  cache.store();
+
+  auto options = compiler::CompilerOptions::fromGlobalConfig();
+  options->compile_cache_dir = _dir;
+  options->backend_list = {"cpu", "ruy"};
+  compiler::CompilationCache other{*_model, *options};
+  ASSERT_NE(other.key(), cache.key());
+  ASSERT_EQ(other.schedule(SubgraphIndex{0}), nullptr);
+}
+
+TEST_F(CompilationCacheTest, neg_corruptedFile)
+{
+  std::string path;
+  {
+    compiler::CompilationCache cache{*_model, *_options};
+    cache.record(SubgraphIndex{0}, _schedule);
+    cache.store();
+    path = cache.path();
+  }
+
+  // Truncate the last byte
+  std::string content;
+  {
+    std::ifstream file(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  ASSERT_GT(content.size(), 1u);
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size() - 1);
+  }
+
+  compiler::CompilationCache cache{*_model, *_options};
+  ASSERT_EQ(cache.schedule(SubgraphIndex{0}), nullptr);
+}
+
+TEST_F(CompilationCacheTest, storeAndLoadMemoryPlan)
+{
+  {
+    compiler::CompilationCache cache{*_model, *_options};
+    auto &plan = cache.memoryPlans(SubgraphIndex{0})["cpu"];
+    ASSERT_EQ(plan, nullptr);
+    plan = std::make_shared<backend::basic::StaticMemoryPlan>();
+    plan->key = 7;
+    plan->capacity = 32;
+    plan->blocks[OperandIndex{2}] = backend::basic::Block{16, 16};
+    plan->updated = true;
+    // Backend which has not planned memory is not stored
+    cache.memoryPlans(SubgraphIndex{0})["builtin"] =
+      std::make_shared<backend::basic::StaticMemoryPlan>();
+    cache.store();
+    EXPECT_FALSE(plan->updated);
+  }
+
+  compiler::CompilationCache cache{*_model, *_options};
+  auto &plans = cache.memoryPlans(SubgraphIndex{0});
+  ASSERT_EQ(plans.size(), 1u);
+  const auto &plan = plans.at("cpu");
+  ASSERT_NE(plan, nullptr);
+  EXPECT_EQ(plan->key, 7u);
+  EXPECT_EQ(plan->capacity, 32u);
+  ASSERT_EQ(plan->blocks.size(), 1u);
+  EXPECT_EQ(plan->blocks.at(OperandIndex{2}).offset, 16u);
+  EXPECT_EQ(plan->blocks.at(OperandIndex{2}).size, 16u);
+  EXPECT_FALSE(plan->updated);
+}
+
+TEST_F(CompilationCacheTest, neg_updatedExecTime)
+{
+  _options->he_scheduler = true;
+
+  // HEScheduler reads execution time data from working directory
+  char cwd[4096];
+  ASSERT_NE(getcwd(cwd, sizeof(cwd)), nullptr);
+  ASSERT_EQ(chdir(_dir.c_str()), 0);
+
+  const auto key = compiler::CompilationCache{*_model, *_options}.key();
+  {
+    std::ofstream file("exec_time.json");
+    file << "{\"cpu\": {}}";
+  }
+  const auto updated_key = compiler::CompilationCache{*_model, *_options}.key();
+  std::remove("exec_time.json");
+
+  ASSERT_EQ(chdir(cwd), 0);
+  ASSERT_NE(key, updated_key);
+}
@@ -16,6 +16,7 @@
 
 #include "compiler/Compiler.h"
 
+#include "CompilationCache.h"
 #include "CompilerHelpers.h"
 #include "ExecutorFactory.h"
 #include "ShapeValidator.h"
@@ -24,6 +25,7 @@
 #include "pass/PassRunner.h"
 #include "pass/UnusedOperandEliminationPass.h"
 #include "../dumper/dot/DotDumper.h"
+#include "../exec/MultiContextExecutors.h"
 #include "../exec/SingleModelExecutors.h"
 #include "../ir/OperationDumper.h"
 #include "../ir/verifier/Verifier.h"
@@ -77,6 +79,17 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
       throw std::runtime_error("Recording minmax works only with Linear executor");
   }
 
+  if (_options->execution_contexts == 0)
+    throw std::runtime_error("The number of execution contexts should be positive");
+
+  if (_options->execution_contexts > 1)
+  {
+    // Recorders and profilers of each context would write to the same file concurrently
+    if (!_options->minmax_filepath.empty() || _options->he_profiling_mode)
+      throw std::runtime_error(
+        "Recording minmax or profiling works only with single execution context");
+  }
+
   if (!_model->hasOnly<ir::Graph>())
   {
     throw std::runtime_error("Compiler can only compile models for inference.");
@@ -110,85 +123,117 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
   // Tracing context
   auto tracing_ctx = std::make_unique<util::TracingCtx>();
 
-  // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
+  // HEScheduler results and memory plans are reused by all execution contexts, and by next
+  // compilation if cache directory is given
+  CompilationCache cache{*_model, *_options};
+
+  // Each execution context is lowered from the same model. Lowering copies the graph, and
+  // the copies share constant operand data, so only activations are allocated per context.
+  std::vector<std::shared_ptr<exec::IExecutors>> contexts;
+  for (uint32_t context_index = 0; context_index < _options->execution_contexts; ++context_index)
   {
-    _model->iterate([&](const ir::SubgraphIndex &subg_index, ir::IGraph &graph) {
-      auto &subg = nnfw::misc::polymorphic_downcast<ir::Graph &>(graph);
-
-      // Lower: Assign backend
-      lowered_subgs[subg_index] = std::make_unique<compiler::LoweredGraph>(subg, *_options);
-      // Set tracing_ctx for copied graph
-      if (tracing_ctx != nullptr)
-        tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
-    });
-  }
+    // Lower: Assign backend
+    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
+    {
+      _model->iterate([&](const ir::SubgraphIndex &subg_index, ir::IGraph &graph) {
+        auto &subg = nnfw::misc::polymorphic_downcast<ir::Graph &>(graph);
+
+        // Lower: Assign backend
+        // ManualScheduler is cheap enough to rerun, so only HEScheduler results are reused
+        const auto schedule = _options->he_scheduler ? cache.schedule(subg_index) : nullptr;
+        lowered_subgs[subg_index] =
+          std::make_unique<compiler::LoweredGraph>(subg, *_options, schedule);
+        // Given schedule is not used if it does not match with graph or backends
+        if (_options->he_scheduler &&
+            (schedule == nullptr ||
+             schedule->backends != lowered_subgs[subg_index]->schedule().backends))
+          cache.record(subg_index, lowered_subgs[subg_index]->schedule());
+        // Set tracing_ctx for copied graph
+        if (tracing_ctx != nullptr)
+          tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()),
+                                        subg_index.value());
+      });
+    }
 
-  _model.reset();
+    // The model is not needed after the last context is lowered
+    if (context_index + 1 == _options->execution_contexts)
+      _model.reset();
 
-  for (const auto &pair : lowered_subgs)
-  {
-    const auto &subg_index = pair.first;
-    const auto &lowered_subg = pair.second;
-    dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
-  }
+    for (const auto &pair : lowered_subgs)
+    {
+      const auto &subg_index = pair.first;
+      const auto &lowered_subg = pair.second;
+      dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
+    }
 
-  // Shape inference.
-  {
-    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
-    // recursively
-    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
-      createStaticShapeInferers(lowered_subgs);
+    // Shape inference.
+    {
+      // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
+      // recursively
+      std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
+        createStaticShapeInferers(lowered_subgs);
+
+      const auto primary_subg_idx = ir::SubgraphIndex{0};
+      inferers.at(primary_subg_idx)->infer();
+
+      for (const auto &pair_inferer : inferers)
+      {
+        const auto inferer = pair_inferer.second.get();
+        inferer->dump();
+      }
+    }
 
-    const auto primary_subg_idx = ir::SubgraphIndex{0};
-    inferers.at(primary_subg_idx)->infer();
+    // Shape validation
+    // TODO Move shape independent feature check from ShapeValidator to OperationValidator
+    // TODO Move ShapeValidator into shape inference
+    //      - Check input tensor shape validation
+    //      - Check parameter value validation which valid value is depend on input tensor shape
+    //      - Output tensor shape validation check is needless because
+    //        static/dynamic shape inferer will make valid output shape
+    for (const auto &pair : lowered_subgs)
+    {
+      auto &lowered_subg = pair.second;
+      compiler::ShapeValidator{lowered_subg->graph()}();
+    }
 
-    for (const auto &pair_inferer : inferers)
+    /*************************************************************
+     *  Backend independent analysis & optimization phase finished
+     *************************************************************/
+    auto executors = std::make_shared<exec::SingleModelExecutors>();
+    for (auto &&pair : lowered_subgs)
     {
-      const auto inferer = pair_inferer.second.get();
-      inferer->dump();
+      auto const model_index = ir::ModelIndex{0};
+      auto const subg_index = pair.first;
+      auto &lowered_subg = pair.second;
+      auto const indexed_ranks = lowered_subg->indexed_ranks();
+
+      ir::OperationDumper dumper("Executor generation of Subgraph " +
+                                 std::to_string(subg_index.value()));
+      lowered_subg->graph().operations().iterate(
+        [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
+
+      ExecutorFactoryArgs args;
+      args.tracing_ctx = tracing_ctx.get();
+      args.options = _options;
+      args.model_index = model_index;
+      args.custom_kernel_builder = custom_kernel_builder;
+      args.memory_plans = &cache.memoryPlans(subg_index);
+      auto executor = std::unique_ptr<exec::IExecutor>{
+        ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
+      executor->setIndexedRanks(indexed_ranks);
+      executors->emplace(model_index, subg_index, std::move(executor));
     }
-  }
 
-  // Shape validation
-  // TODO Move shape independent feature check from ShapeValidator to OperationValidator
-  // TODO Move ShapeValidator into shape inference
-  //      - Check input tensor shape validation
-  //      - Check parameter value validation which valid value is depend on input tensor shape
-  //      - Output tensor shape validation check is needless because
-  //        static/dynamic shape inferer will make valid output shape
-  for (const auto &pair : lowered_subgs)
-  {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
+    contexts.emplace_back(std::move(executors));
   }
 
-  /*************************************************************
-   *  Backend independent analysis & optimization phase finished
-   *************************************************************/
-  auto executors = std::make_shared<exec::SingleModelExecutors>();
-  for (auto &&pair : lowered_subgs)
-  {
-    auto const model_index = ir::ModelIndex{0};
-    auto const subg_index = pair.first;
-    auto &lowered_subg = pair.second;
-    auto const indexed_ranks = lowered_subg->indexed_ranks();
-
-    ir::OperationDumper dumper("Executor generation of Subgraph " +
-                               std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
-
-    ExecutorFactoryArgs args;
-    args.tracing_ctx = tracing_ctx.get();
-    args.options = _options;
-    args.model_index = model_index;
-    args.custom_kernel_builder = custom_kernel_builder;
-    auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
-    executor->setIndexedRanks(indexed_ranks);
-    executors->emplace(model_index, subg_index, std::move(executor));
-  }
+  cache.store();
+
+  std::shared_ptr<exec::IExecutors> executors;
+  if (contexts.size() == 1)
+    executors = std::move(contexts.front());
+  else
+    executors = std::make_shared<exec::MultiContextExecutors>(std::move(contexts));
 
   /********************************
    * Code generation phase finished
@@ -23,6 +23,8 @@
 
 #include <misc/string_helpers.h>
 
+#include <algorithm>
+
 namespace
 {
 
@@ -76,6 +78,15 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   auto o = std::make_unique<CompilerOptions>();
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   o->minmax_filepath = util::getConfigString(util::config::MINMAX_FILEPATH);
+  o->execution_contexts =
+    static_cast<uint32_t>(std::max(1, util::getConfigInt(util::config::EXECUTION_CONTEXTS)));
+  o->compile_cache_dir = util::getConfigString(util::config::COMPILE_CACHE_DIR);
+  o->train_checkpoints = util::getConfigString(util::config::TRAINING_CHECKPOINTS);
+  o->train_memory_budget =
+    static_cast<uint64_t>(std::max(0, util::getConfigInt(util::config::TRAINING_MEMORY_BUDGET))) *
+    1024;
+  o->train_replicas =
+    static_cast<uint32_t>(std::max(1, util::getConfigInt(util::config::TRAINING_REPLICAS)));
   o->trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
@@ -129,6 +140,11 @@ void CompilerOptions::verboseOptions()
   VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
   VERBOSE(Compiler) << "backend_list             : "
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
+  VERBOSE(Compiler) << "execution_contexts       : " << execution_contexts << std::endl;
+  VERBOSE(Compiler) << "compile_cache_dir        : " << compile_cache_dir << std::endl;
+  VERBOSE(Compiler) << "train_checkpoints        : " << train_checkpoints << std::endl;
+  VERBOSE(Compiler) << "train_memory_budget      : " << train_memory_budget << std::endl;
+  VERBOSE(Compiler) << "train_replicas           : " << train_replicas << std::endl;
   VERBOSE(Compiler) << "trace_filepath           : " << trace_filepath << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
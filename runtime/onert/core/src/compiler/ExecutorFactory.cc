@@ -17,6 +17,7 @@
 #include "ExecutorFactory.h"
 
 #include "Linear.h"
+#include "train/CheckpointPlanner.h"
 #include "../backend/builtin/BackendContext.h"
 #include "../backend/builtin/Config.h"
 #include "../backend/builtin/UserTensor.h"
@@ -30,6 +31,7 @@
 #include "../exec/MinMaxRecorder.h"
 #endif
 #include "../exec/ParallelExecutor.h"
+#include "../exec/WorkStealingExecutor.h"
 #include "../exec/train/TrainableExecutor.h"
 #include "../ir/OperationCloner.h"
 
@@ -40,6 +42,7 @@
 #include <compiler/ExecutionBuilder.h>
 #include <util/TracingCtx.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 
@@ -157,7 +160,8 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
+                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder,
+                      compiler::BackendMemoryPlans *memory_plans = nullptr)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -263,6 +267,13 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
                  [&](const auto &ind) { return data.graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
     data.custom_kernel_builder = custom_kernel_builder;
+    if (memory_plans)
+    {
+      auto &plan = (*memory_plans)[backend->config()->id()];
+      if (!plan)
+        plan = std::make_shared<backend::basic::StaticMemoryPlan>();
+      data.memory_plan = plan;
+    }
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
   return contexts;
@@ -310,6 +321,8 @@ ExecutorFactory::ExecutorFactory()
                                std::placeholders::_3, false);
   _map["Parallel"] = std::bind(createDataflowExecutor, std::placeholders::_1, std::placeholders::_2,
                                std::placeholders::_3, true);
+  _map["WorkStealing"] = std::bind(createDataflowExecutor, std::placeholders::_1,
+                                   std::placeholders::_2, std::placeholders::_3, true);
 }
 
 exec::IExecutor *ExecutorFactory::create(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
@@ -395,7 +408,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto &graph = lowered_graph->graph();
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          args.memory_plans);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -529,7 +543,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto custom_kernel_builder = args.custom_kernel_builder;
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          args.memory_plans);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -572,7 +587,12 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto code_map = builder.releaseCodeMap();
 
   exec::ExecutorBase *exec = nullptr;
-  if (parallel)
+  if (parallel && options->executor == "WorkStealing")
+  {
+    exec = new exec::WorkStealingExecutor{std::move(lowered_graph), std::move(backend_contexts),
+                                          tensor_regs, std::move(code_map), tracing_ctx};
+  }
+  else if (parallel)
   {
     exec = new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts),
                                       tensor_regs, std::move(code_map), tracing_ctx};
@@ -672,6 +692,34 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     }
   });
 
+  // linearize for forwarding
+  auto order = Linear::linearize(*lowered_graph);
+  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
+  Linear::dump(*lowered_graph, order);
+
+  // linearize for backwarding
+  auto backward_order = lowered_graph->trainable_graph().btopolSortOperations();
+  // get rid of all nodes not reachable from a node with trainable parameters
+  backward_order = lowered_graph->trainable_graph().truncateBackwardOrder(backward_order);
+  VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
+  Linear::dump(*lowered_graph, backward_order);
+
+  // Choose activations to be recomputed during backwarding
+  train::CheckpointPlan checkpoint_plan;
+  if (!options->train_checkpoints.empty())
+  {
+    train::CheckpointPlanner planner{graph, order, backward_order};
+    const auto checkpoints = train::CheckpointPlanner::parse(options->train_checkpoints);
+    checkpoint_plan = checkpoints.empty() ? planner.planAuto(options->train_memory_budget)
+                                          : planner.plan(checkpoints);
+    VERBOSE(ExecutorFactory) << "Checkpointing: " << checkpoint_plan.segments.size()
+                             << " segments, activations " << planner.fullSize() << " -> "
+                             << checkpoint_plan.peak_size << " bytes(kept "
+                             << checkpoint_plan.kept_size << "), recomputes "
+                             << checkpoint_plan.recomputed_ops << "/" << order.size()
+                             << " operations per step" << std::endl;
+  }
+
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
   backend::BackendContexts base_backend_contexts =
@@ -689,7 +737,12 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
       [&](const onert::ir::OperationIndex &op_index, const onert::ir::IOperation &) {
         const auto &orig_tgraph = lowered_graph->trainable_graph();
         const auto &trainable_op = orig_tgraph.operation(op_index);
-        auto gen_index = tgraph->replaceOperation(op_index, trainable_op.clone());
+        auto new_op = trainable_op.clone();
+        // Backends allocate and run backwarding only for operations in backward order
+        if (std::find(backward_order.begin(), backward_order.end(), op_index) !=
+            backward_order.end())
+          new_op->enableBackward();
+        auto gen_index = tgraph->replaceOperation(op_index, std::move(new_op));
         UNUSED_RELEASE(gen_index);
         assert(gen_index == op_index);
       });
@@ -722,6 +775,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     tdata.custom_kernel_builder = std::move(data.custom_kernel_builder);
     tdata.is_linear_executor = data.is_linear_executor;
     tdata.optim_info = training_info.optimizerInfo();
+    if (checkpoint_plan.enabled())
+      tdata.recomputed_operands = checkpoint_plan.recomputed_operands;
 
     // TODO Remove dynamic_cast
     const auto backend = pair.first;
@@ -742,18 +797,6 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize for forwarding
-  auto order = Linear::linearize(*lowered_graph);
-  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
-  Linear::dump(*lowered_graph, order);
-
-  // linearize for backwarding
-  auto backward_order = lowered_graph->trainable_graph().btopolSortOperations();
-  // get rid of all nodes not reachable from a node with trainable parameters
-  backward_order = lowered_graph->trainable_graph().truncateBackwardOrder(backward_order);
-  VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
-  Linear::dump(*lowered_graph, backward_order);
-
   for (auto &&pair : tbackend_contexts)
   {
     pair.second->genTensors();
@@ -887,6 +930,9 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
                                                  std::move(code_map),
                                                  order,
                                                  backward_order,
+                                                 checkpoint_plan.enabled()
+                                                   ? checkpoint_plan.segments
+                                                   : std::vector<std::vector<ir::OperationIndex>>{},
                                                  tracing_ctx,
                                                  training_info.lossInfo()};
 
@@ -17,6 +17,7 @@
 #ifndef __ONERT_COMPILER_EXECUTOR_FACTORY_H__
 #define __ONERT_COMPILER_EXECUTOR_FACTORY_H__
 
+#include "CompilationCache.h"
 #include "TensorRegistries.h"
 
 #include "backend/ITensor.h"
@@ -41,6 +42,8 @@ struct ExecutorFactoryArgs
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
+  // Memory plans of subgraph to reuse, nullptr if they are not cached
+  BackendMemoryPlans *memory_plans = nullptr;
 };
 
 class ExecutorFactory
@@ -39,12 +39,14 @@ namespace onert
 namespace compiler
 {
 
-LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &options) : _graph{graph}
+LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &options,
+                           const LoweringSchedule *schedule)
+  : _graph{graph}
 {
-  lowerGraph(options);
+  lowerGraph(options, schedule);
 }
 
-void LoweredGraph::lowerGraph(const CompilerOptions &options)
+void LoweredGraph::lowerGraph(const CompilerOptions &options, const LoweringSchedule *schedule)
 {
   // Build backend contexts
   auto &backend_manager = BackendManager::get();
@@ -70,7 +72,13 @@ void LoweredGraph::lowerGraph(const CompilerOptions &options)
   // Schedule
   std::unique_ptr<BackendResolver> backend_resolver;
   auto all_backends = backend_manager.getAll();
-  if (options.he_scheduler)
+  if (schedule != nullptr && (backend_resolver = resolveSchedule(*schedule)) != nullptr)
+  {
+    VERBOSE(LoweredGraph) << "Use given schedule instead of running scheduler" << std::endl;
+    if (!schedule->ranks.empty())
+      _indexed_ranks = std::make_shared<ir::OperationIndexMap<int64_t>>(schedule->ranks);
+  }
+  else if (options.he_scheduler)
   {
     auto scheduler = HEScheduler(all_backends, options);
     backend_resolver = scheduler.schedule(_graph);
@@ -82,6 +90,13 @@ void LoweredGraph::lowerGraph(const CompilerOptions &options)
     backend_resolver = scheduler.schedule(_graph);
   }
 
+  // Keep schedule to reuse it for the same graph
+  backend_resolver->iterate([&](const ir::OperationIndex &index, const backend::Backend &backend) {
+    _schedule.backends[index] = backend.config()->id();
+  });
+  if (_indexed_ranks)
+    _schedule.ranks = *_indexed_ranks;
+
   makeLowerInfo(*backend_resolver);
   VERBOSE(LoweredGraph) << "dump before mandatory passes" << std::endl;
   dumper::text::dumpLoweredGraph(*this);
@@ -114,6 +129,34 @@ void LoweredGraph::lowerGraph(const CompilerOptions &options)
   }
 }
 
+std::unique_ptr<BackendResolver>
+LoweredGraph::resolveSchedule(const LoweringSchedule &schedule) const
+{
+  if (schedule.backends.size() != _graph.operations().size())
+    return nullptr;
+
+  auto &backend_manager = BackendManager::get();
+  auto backend_resolver = std::make_unique<BackendResolver>();
+  bool valid = true;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    auto it = schedule.backends.find(index);
+    const auto backend = it == schedule.backends.end() ? nullptr : backend_manager.get(it->second);
+    if (backend == nullptr)
+    {
+      valid = false;
+      return;
+    }
+    backend_resolver->setBackend(index, backend);
+  });
+
+  if (!valid)
+  {
+    VERBOSE(LoweredGraph) << "Given schedule does not match with graph or backends" << std::endl;
+    return nullptr;
+  }
+  return backend_resolver;
+}
+
 void LoweredGraph::makeLowerInfo(const compiler::BackendResolver &backend_resolver)
 {
   _graph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &) {
@@ -20,6 +20,7 @@
 
 #include "ir/Graph.h"
 #include "util/logging.h"
+#include "util/ShapeInference.h"
 #include "util/Utils.h"
 
 #define OP_REQUIRES(EXP)                                                                     \
@@ -55,6 +56,36 @@ void ShapeValidator::operator()()
     [&](const ir::OperationIndex &, const ir::IOperation &node) { node.accept(*this); });
 }
 
+void ShapeValidator::visit(const ir::operation::Attention &node)
+{
+  const auto &operands = _graph.operands();
+  const auto query_index{node.getInputs().at(ir::operation::Attention::Input::QUERY)};
+  const auto key_index{node.getInputs().at(ir::operation::Attention::Input::KEY)};
+  const auto value_index{node.getInputs().at(ir::operation::Attention::Input::VALUE)};
+  const auto out_index{node.getOutputs().at(0)};
+
+  if (operands.at(out_index).info().isDynamic())
+    return;
+
+  const auto &query_shape = operands.at(query_index).shape();
+  const auto &key_shape = operands.at(key_index).shape();
+  const auto &value_shape = operands.at(value_index).shape();
+  const auto rank = query_shape.rank();
+
+  OP_REQUIRES(rank >= 2);
+  OP_REQUIRES(key_shape.rank() == rank && value_shape.rank() == rank);
+  OP_REQUIRES(query_shape.dim(rank - 1) == key_shape.dim(rank - 1));
+  OP_REQUIRES(key_shape.dim(rank - 2) == value_shape.dim(rank - 2));
+  OP_REQUIRES(operands.at(out_index).shape() ==
+              shape_inference::inferAttentionShape(query_shape, value_shape));
+
+  if (node.getInputs().size() > ir::operation::Attention::Input::MASK)
+  {
+    const auto mask_index{node.getInputs().at(ir::operation::Attention::Input::MASK)};
+    OP_REQUIRES(!mask_index.valid() || operands.at(mask_index).shape().rank() <= rank);
+  }
+}
+
 void ShapeValidator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto &operands = _graph.operands();
@@ -246,6 +277,40 @@ void ShapeValidator::visit(const ir::operation::InstanceNorm &node)
   OP_REQUIRES(operands.at(beta_index).shape().rank() == 1);
 }
 
+void ShapeValidator::visit(const ir::operation::LayerNorm &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::LayerNorm::Input::BETA)};
+
+  const auto &ifm_shape = operands.at(ifm_index).shape();
+  OP_REQUIRES(ifm_shape.rank() >= 1);
+  OP_REQUIRES(ifm_shape == operands.at(ofm_index).shape());
+  OP_REQUIRES(operands.at(gamma_index).shape() == ir::Shape{ifm_shape.dim(ifm_shape.rank() - 1)});
+  OP_REQUIRES(operands.at(beta_index).shape() == ir::Shape{ifm_shape.dim(ifm_shape.rank() - 1)});
+}
+
+void ShapeValidator::visit(const ir::operation::RmsNorm &node)
+{
+  const auto &operands = _graph.operands();
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (operands.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::RmsNorm::Input::GAMMA)};
+
+  const auto &ifm_shape = operands.at(ifm_index).shape();
+  OP_REQUIRES(ifm_shape.rank() >= 1);
+  OP_REQUIRES(ifm_shape == operands.at(ofm_index).shape());
+  OP_REQUIRES(operands.at(gamma_index).shape() == ir::Shape{ifm_shape.dim(ifm_shape.rank() - 1)});
+}
+
 void ShapeValidator::visit(const ir::operation::Pool2D &node)
 {
   const auto &operands = _graph.operands();
@@ -49,6 +49,7 @@ public:
   void operator()();
 
 public:
+  void visit(const ir::operation::Attention &node) override;
   void visit(const ir::operation::BatchMatMul &node) override;
   void visit(const ir::operation::BatchToSpaceND &node) override;
   void visit(const ir::operation::BCQFullyConnected &node) override;
@@ -59,6 +60,8 @@ public:
   void visit(const ir::operation::FullyConnected &node) override;
   void visit(const ir::operation::Softmax &node) override;
   void visit(const ir::operation::InstanceNorm &node) override;
+  void visit(const ir::operation::LayerNorm &node) override;
+  void visit(const ir::operation::RmsNorm &node) override;
   void visit(const ir::operation::Permute &node) override;
   void visit(const ir::operation::Pool2D &node) override;
   void visit(const ir::operation::Reduce &node) override;
@@ -326,6 +326,20 @@ void StaticShapeInferer::visit(const ir::operation::ArgMinMax &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::Attention &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto query_index = op.getInputs().at(ir::operation::Attention::Input::QUERY);
+  const auto value_index = op.getInputs().at(ir::operation::Attention::Input::VALUE);
+  const auto output_index = op.getOutputs().at(0);
+  const auto &query = operands.at(query_index);
+  const auto &value = operands.at(value_index);
+  auto &output = operands.at(output_index);
+  auto new_shape = shape_inference::inferAttentionShape(query.shape(), value.shape());
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -500,6 +514,25 @@ void StaticShapeInferer::visit(const ir::operation::ElementwiseUnary &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseUnary::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::EmbeddingLookup &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto lookups_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto &lookups = operands.at(lookups_idx);
+
+  const auto values_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+  const auto &values = operands.at(values_idx);
+
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = operands.at(output_idx);
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+    shape_inference::inferEmbeddingLookupShape(lookups.info().shape(), values.info().shape());
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::ExpandDims &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -612,6 +645,11 @@ void StaticShapeInferer::visit(const ir::operation::Gather &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::InstanceNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::InstanceNorm::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::If &op)
 {
   // re-sizing input shapes of then/else subgraph
@@ -636,6 +674,17 @@ void StaticShapeInferer::visit(const ir::operation::L2Normalization &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::LayerNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LayerNorm::Input::INPUT));
+}
+
+void StaticShapeInferer::visit(const ir::operation::LocalResponseNormalization &op)
+{
+  handleSimpleUnaryOp(op,
+                      op.getInputs().at(ir::operation::LocalResponseNormalization::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::Loss &op)
 {
   // TODO Consider SparseCategoricalCrossentropy case
@@ -875,6 +924,12 @@ void StaticShapeInferer::visit(const ir::operation::Pow &op)
                            op.getInputs().at(ir::operation::Pow::Input::RHS));
 }
 
+void StaticShapeInferer::visit(const ir::operation::PReLU &op)
+{
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::PReLU::Input::INPUT),
+                           op.getInputs().at(ir::operation::PReLU::Input::ALPHA));
+}
+
 void StaticShapeInferer::visit(const ir::operation::Range &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -1056,11 +1111,80 @@ void StaticShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   }
 }
 
+void StaticShapeInferer::visit(const ir::operation::ResizeNearestNeighbor &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto input_idx{op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT)};
+  const auto &input = operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = operands.at(output_idx);
+
+  int32_t height_out, width_out;
+  if (op.getInputs().size() == 2)
+  {
+    auto &size = operands.at(op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::SIZE));
+    if (!size.isConstant())
+    {
+      output.info().setDynamic();
+      return;
+    }
+    const auto size_v = size.asVector<std::int32_t>();
+    height_out = size_v[0];
+    width_out = size_v[1];
+  }
+  else
+  {
+    height_out = op.param().height_out;
+    width_out = op.param().width_out;
+  }
+
+  // Shape inferencing logic based on Params
+  ir::Shape new_shape =
+    shape_inference::inferResizeNearestNeighborShape(input.shape(), height_out, width_out);
+
+  // if size_op is from Const, TFLC put the shape of output into tensor
+  if (new_shape != output.shape())
+  {
+    // change on output shape
+    output.info().shape(new_shape);
+  }
+}
+
 void StaticShapeInferer::visit(const ir::operation::Reverse &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::RmsNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RmsNorm::Input::INPUT));
+}
+
+void StaticShapeInferer::visit(const ir::operation::RNN &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto input_idx{op.getInputs().at(ir::operation::RNN::Input::INPUT)};
+  const auto &input = operands.at(input_idx);
+
+  const auto weights_idx{op.getInputs().at(ir::operation::RNN::Input::WEIGHTS)};
+  const auto &weights = operands.at(weights_idx);
+
+  // Output and hidden state are [batch_size, num_units]
+  ir::Shape new_shape =
+    shape_inference::inferRNNShape(input.info().shape(), weights.info().shape());
+
+  const auto output_idx = op.getOutputs().at(ir::operation::RNN::Output::OUTPUT);
+  operands.at(output_idx).info().shape(new_shape);
+
+  const auto hidden_state_out_idx =
+    op.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT);
+  operands.at(hidden_state_out_idx).info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::Select &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -1303,6 +1427,23 @@ void StaticShapeInferer::visit(const ir::operation::Tile &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = operands.at(input_idx);
+
+  // Values and indices have the same shape
+  ir::Shape new_shape = shape_inference::inferTopKV2Shape(input.info().shape(), op.param().k);
+
+  const auto values_idx = op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES);
+  operands.at(values_idx).info().shape(new_shape);
+
+  const auto indices_idx = op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES);
+  operands.at(indices_idx).info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::Transpose &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -1349,6 +1490,31 @@ void StaticShapeInferer::visit(const ir::operation::Transpose &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::TransposeConv &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto output_shape_idx{op.getInputs().at(ir::operation::TransposeConv::Input::OUTPUT_SHAPE)};
+  const auto &output_shape = operands.at(output_shape_idx);
+
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = operands.at(output_idx);
+
+  if (!output_shape.isConstant())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  auto output_shape_buf = reinterpret_cast<const int32_t *>(output_shape.data()->base());
+  assert(output_shape_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+    shape_inference::inferTransposeConvShape(output_shape.info().shape(), output_shape_buf);
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::Unpack &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CheckpointPlanner.h"
+
+#include "util/logging.h"
+
+#include <misc/string_helpers.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+CheckpointPlanner::CheckpointPlanner(const ir::Graph &graph,
+                                     const std::vector<ir::OperationIndex> &forward_order,
+                                     const std::vector<ir::OperationIndex> &backward_order)
+  : _graph{graph}, _forward_order{forward_order}, _backward_order{backward_order}
+{
+}
+
+bool CheckpointPlanner::isActivation(const ir::OperandIndex &ind) const
+{
+  const auto &operand = _graph.operands().at(ind);
+  return !operand.isConstant() && !operand.info().isVariable() && operand.getDef().valid() &&
+         !_graph.getInputs().contains(ind) && !_graph.getOutputs().contains(ind);
+}
+
+uint64_t CheckpointPlanner::fullSize() const
+{
+  uint64_t size = 0;
+  _graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+    if (isActivation(ind))
+      size += operand.info().total_size();
+  });
+  return size;
+}
+
+CheckpointPlan CheckpointPlanner::planSegments(std::vector<uint32_t> seg_of) const
+{
+  assert(seg_of.size() == _forward_order.size());
+
+  std::unordered_map<ir::OperationIndex, uint32_t> pos_of;
+  for (uint32_t pos = 0; pos < _forward_order.size(); ++pos)
+    pos_of[_forward_order[pos]] = pos;
+
+  // Segments should be visited in reverse order during backwarding, so that each segment is
+  // recomputed at most once. Merge segments which are visited back and forth.
+  bool merged = true;
+  while (merged)
+  {
+    merged = false;
+    uint32_t prev = seg_of.empty() ? 0 : seg_of.back();
+    for (const auto &op_ind : _backward_order)
+    {
+      const auto seg = seg_of.at(pos_of.at(op_ind));
+      if (seg > prev)
+      {
+        for (auto &s : seg_of)
+        {
+          if (prev <= s && s <= seg)
+            s = prev;
+        }
+        merged = true;
+        break;
+      }
+      prev = seg;
+    }
+  }
+
+  CheckpointPlan plan;
+  std::unordered_map<ir::OperationIndex, uint32_t> op_seg;
+  for (uint32_t pos = 0; pos < _forward_order.size(); ++pos)
+  {
+    // Renumber segments skipping empty ones
+    if (pos == 0 || seg_of[pos] != seg_of[pos - 1])
+      plan.segments.emplace_back();
+    plan.segments.back().emplace_back(_forward_order[pos]);
+    op_seg[_forward_order[pos]] = plan.segments.size() - 1;
+  }
+
+  if (!plan.enabled())
+  {
+    plan.segments.resize(1);
+    plan.kept_size = fullSize();
+    plan.peak_size = plan.kept_size;
+    return plan;
+  }
+
+  plan.recomputed_operands.resize(plan.segments.size());
+  std::vector<uint64_t> recomputed_sizes(plan.segments.size(), 0);
+  _graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+    if (!isActivation(ind))
+      return;
+
+    const auto size = operand.info().total_size();
+    const auto def_it = op_seg.find(operand.getDef());
+    // Outputs without uses(e.g. loss) can be read after a training step
+    bool local = def_it != op_seg.end() && operand.getUses().size() > 0;
+    for (const auto &use : operand.getUses())
+    {
+      if (!local)
+        break;
+      auto use_it = op_seg.find(use);
+      local = use_it != op_seg.end() && use_it->second == def_it->second;
+    }
+
+    if (local)
+    {
+      plan.recomputed_operands[def_it->second].add(ind);
+      recomputed_sizes[def_it->second] += size;
+    }
+    else
+    {
+      plan.kept_size += size;
+    }
+  });
+
+  plan.peak_size =
+    plan.kept_size + *std::max_element(recomputed_sizes.begin(), recomputed_sizes.end());
+
+  // The last segment is still alive after forwarding, and segments without backwarding are
+  // not recomputed
+  util::Set<uint32_t> backward_segs;
+  for (const auto &op_ind : _backward_order)
+    backward_segs.add(op_seg.at(op_ind));
+  for (uint32_t seg = 0; seg + 1 < plan.segments.size(); ++seg)
+  {
+    if (backward_segs.contains(seg))
+      plan.recomputed_ops += plan.segments[seg].size();
+  }
+
+  return plan;
+}
+
+CheckpointPlan CheckpointPlanner::plan(const std::vector<ir::OperationIndex> &checkpoints) const
+{
+  util::Set<ir::OperationIndex> checkpoint_set;
+  for (const auto &op_ind : checkpoints)
+  {
+    if (std::find(_forward_order.begin(), _forward_order.end(), op_ind) == _forward_order.end())
+      throw std::runtime_error{"CheckpointPlanner: Invalid checkpoint operation " +
+                               std::to_string(op_ind.value())};
+    checkpoint_set.add(op_ind);
+  }
+
+  std::vector<uint32_t> seg_of;
+  uint32_t seg = 0;
+  for (const auto &op_ind : _forward_order)
+  {
+    seg_of.emplace_back(seg);
+    if (checkpoint_set.contains(op_ind))
+      seg++;
+  }
+
+  return planSegments(seg_of);
+}
+
+CheckpointPlan CheckpointPlanner::planAuto(uint64_t budget) const
+{
+  const uint32_t num_ops = _forward_order.size();
+
+  // Split forward order into segments whose outputs have similar sizes
+  std::vector<uint64_t> prev_sizes;
+  uint64_t total_size = 0;
+  for (const auto &op_ind : _forward_order)
+  {
+    prev_sizes.emplace_back(total_size);
+    const auto &op = _graph.operations().at(op_ind);
+    for (const auto &ind : op.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      if (isActivation(ind))
+        total_size += _graph.operands().at(ind).info().total_size();
+    }
+  }
+  auto split = [&](uint32_t num_segs) {
+    std::vector<uint32_t> seg_of;
+    for (uint32_t pos = 0; pos < num_ops; ++pos)
+    {
+      const uint64_t seg = total_size == 0 ? static_cast<uint64_t>(pos) * num_segs / num_ops
+                                           : prev_sizes[pos] * num_segs / total_size;
+      seg_of.emplace_back(std::min<uint64_t>(seg, num_segs - 1));
+    }
+    return seg_of;
+  };
+
+  if (num_ops == 0)
+    return planSegments({});
+
+  if (budget == 0)
+    return planSegments(split(static_cast<uint32_t>(std::ceil(std::sqrt(num_ops)))));
+
+  // The fewer segments, the fewer operations are recomputed
+  CheckpointPlan smallest;
+  for (uint32_t num_segs = 1; num_segs <= num_ops; ++num_segs)
+  {
+    auto plan = planSegments(split(num_segs));
+    if (plan.peak_size <= budget)
+      return plan;
+    if (num_segs == 1 || plan.peak_size < smallest.peak_size)
+      smallest = std::move(plan);
+  }
+
+  VERBOSE(CheckpointPlanner) << "No plan fits in memory budget " << budget << std::endl;
+  return smallest;
+}
+
+std::vector<ir::OperationIndex> CheckpointPlanner::parse(const std::string &str)
+{
+  std::vector<ir::OperationIndex> checkpoints;
+  if (str == "auto")
+    return checkpoints;
+
+  for (const auto &token : nnfw::misc::split(str, ';'))
+  {
+    try
+    {
+      size_t end = 0;
+      const auto value = std::stoul(token, &end);
+      if (end != token.size())
+        throw std::invalid_argument{token};
+      checkpoints.emplace_back(static_cast<uint32_t>(value));
+    }
+    catch (const std::logic_error &)
+    {
+      throw std::runtime_error{"CheckpointPlanner: Invalid checkpoints " + str};
+    }
+  }
+  return checkpoints;
+}
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_TRAIN_CHECKPOINT_PLANNER_H__
+#define __ONERT_COMPILER_TRAIN_CHECKPOINT_PLANNER_H__
+
+#include "ir/Graph.h"
+#include "ir/Index.h"
+#include "util/Set.h"
+
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+/**
+ * @brief Plan of activation checkpointing
+ *
+ * Forward order is split into segments. Activations used out of their segment are kept until
+ * backwarding, and the others are recomputed by running forward of their segment again during
+ * backwarding. Recomputed activations of different segments are never alive at the same time,
+ * so they can share memory.
+ */
+struct CheckpointPlan
+{
+  std::vector<std::vector<ir::OperationIndex>> segments;
+  // Activations recomputed by each segment
+  std::vector<util::Set<ir::OperandIndex>> recomputed_operands;
+  uint64_t kept_size = 0;      //< Size of activations kept during a training step
+  uint64_t peak_size = 0;      //< Estimated peak size of activations
+  uint32_t recomputed_ops = 0; //< Number of operations run again in a training step
+
+  bool enabled() const { return segments.size() > 1; }
+};
+
+/**
+ * @brief Class to choose activations kept for backwarding
+ */
+class CheckpointPlanner
+{
+public:
+  /**
+   * @param graph          Graph whose shapes are inferred
+   * @param forward_order  Order of forwarding
+   * @param backward_order Order of backwarding, which may not include all operations
+   */
+  CheckpointPlanner(const ir::Graph &graph, const std::vector<ir::OperationIndex> &forward_order,
+                    const std::vector<ir::OperationIndex> &backward_order);
+
+public:
+  /**
+   * @brief Plan with checkpoints chosen by user
+   * @param checkpoints Operations whose outputs are kept. Each of them ends a segment.
+   */
+  CheckpointPlan plan(const std::vector<ir::OperationIndex> &checkpoints) const;
+  /**
+   * @brief Plan with the fewest recomputation whose peak size fits in memory budget
+   * @param budget Budget of activations in bytes. If it is 0, segments of square root of the
+   *               number of operations are used. If it is too small, the smallest plan is used.
+   */
+  CheckpointPlan planAuto(uint64_t budget) const;
+  /**
+   * @brief Size of activations when all activations are kept
+   */
+  uint64_t fullSize() const;
+
+public:
+  /**
+   * @brief Parse checkpoints option("auto" or operation indices separated by ';')
+   * @return Operation indices, empty if it is "auto"
+   */
+  static std::vector<ir::OperationIndex> parse(const std::string &str);
+
+private:
+  // Plan with segment indices of operations in forward order
+  CheckpointPlan planSegments(std::vector<uint32_t> seg_of) const;
+  bool isActivation(const ir::OperandIndex &ind) const;
+
+private:
+  const ir::Graph &_graph;
+  std::vector<ir::OperationIndex> _forward_order;
+  std::vector<ir::OperationIndex> _backward_order;
+};
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_TRAIN_CHECKPOINT_PLANNER_H__
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CheckpointPlanner.h"
+
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+
+class CheckpointPlannerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // (input) -[EA]-> (a) -[EA]-> (b) -[EA]-> (c) -[EA]-> (output)
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+    auto input = _graph.addOperand(shape, type);
+    _a = _graph.addOperand(shape, type);
+    _b = _graph.addOperand(shape, type);
+    _c = _graph.addOperand(shape, type);
+    auto output = _graph.addOperand(shape, type);
+
+    OperandIndex prev = input;
+    for (const auto &next : {_a, _b, _c, output})
+    {
+      operation::ElementwiseActivation::Param param;
+      param.op_type = operation::ElementwiseActivation::Type::RELU;
+      _order.emplace_back(_graph.addOperation(
+        std::make_unique<operation::ElementwiseActivation>(OperandIndexSequence{prev},
+                                                           OperandIndexSequence{next}, param)));
+      prev = next;
+    }
+    _graph.addInput(input);
+    _graph.addOutput(output);
+
+    _backward_order = _order;
+    std::reverse(_backward_order.begin(), _backward_order.end());
+    _size = _graph.operands().at(_a).info().total_size();
+  }
+
+  Graph _graph;
+  OperandIndex _a, _b, _c;
+  std::vector<OperationIndex> _order;
+  std::vector<OperationIndex> _backward_order;
+  uint64_t _size = 0;
+};
+
+} // namespace
+
+TEST_F(CheckpointPlannerTest, planCheckpoints)
+{
+  compiler::train::CheckpointPlanner planner{_graph, _order, _backward_order};
+  ASSERT_EQ(planner.fullSize(), 3 * _size);
+
+  auto plan = planner.plan({_order[1]});
+  ASSERT_TRUE(plan.enabled());
+  ASSERT_EQ(plan.segments.size(), 2);
+  ASSERT_EQ(plan.segments[0], (std::vector<OperationIndex>{_order[0], _order[1]}));
+  ASSERT_TRUE(plan.recomputed_operands[0].contains(_a));
+  ASSERT_TRUE(plan.recomputed_operands[1].contains(_c));
+  ASSERT_FALSE(plan.recomputed_operands[0].contains(_b));
+  ASSERT_FALSE(plan.recomputed_operands[1].contains(_b));
+  ASSERT_EQ(plan.kept_size, _size);
+  ASSERT_EQ(plan.peak_size, 2 * _size);
+  ASSERT_EQ(plan.recomputed_ops, 2);
+}
+
+TEST_F(CheckpointPlannerTest, planAuto)
+{
+  compiler::train::CheckpointPlanner planner{_graph, _order, _backward_order};
+
+  // Segments of square root of the number of operations
+  auto plan = planner.planAuto(0);
+  ASSERT_EQ(plan.segments.size(), 2);
+
+  // Budget enough to keep all activations
+  plan = planner.planAuto(3 * _size);
+  ASSERT_FALSE(plan.enabled());
+  ASSERT_EQ(plan.peak_size, 3 * _size);
+
+  plan = planner.planAuto(2 * _size);
+  ASSERT_TRUE(plan.enabled());
+  ASSERT_LE(plan.peak_size, 2 * _size);
+}
+
+TEST_F(CheckpointPlannerTest, mergeInterleavedSegments)
+{
+  // Backwarding which goes back to the last segment
+  std::vector<OperationIndex> backward_order{_order[3], _order[0], _order[2], _order[1]};
+  compiler::train::CheckpointPlanner planner{_graph, _order, backward_order};
+
+  auto plan = planner.plan({_order[1]});
+  ASSERT_FALSE(plan.enabled());
+  ASSERT_EQ(plan.kept_size, 3 * _size);
+}
+
+TEST_F(CheckpointPlannerTest, parse)
+{
+  ASSERT_TRUE(compiler::train::CheckpointPlanner::parse("auto").empty());
+  ASSERT_EQ(compiler::train::CheckpointPlanner::parse("1;3"),
+            (std::vector<OperationIndex>{OperationIndex{1}, OperationIndex{3}}));
+}
+
+TEST_F(CheckpointPlannerTest, neg_invalidCheckpoints)
+{
+  compiler::train::CheckpointPlanner planner{_graph, _order, _backward_order};
+  ASSERT_THROW(planner.plan({OperationIndex{100}}), std::runtime_error);
+  ASSERT_THROW(compiler::train::CheckpointPlanner::parse("1;a"), std::runtime_error);
+  ASSERT_THROW(compiler::train::CheckpointPlanner::parse("1x"), std::runtime_error);
+}
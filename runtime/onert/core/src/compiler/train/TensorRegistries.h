@@ -94,6 +94,17 @@ public:
     return nullptr;
   }
 
+  backend::ITensor *getGradientITensor(ir::OperandIndex index) const
+  {
+    for (const auto &tensor_reg : _tensor_regs)
+    {
+      auto tensor = tensor_reg->getGradientITensor(index);
+      if (tensor)
+        return tensor;
+    }
+    return nullptr;
+  }
+
   void iterateTrainableTensors(
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const
@@ -45,6 +45,131 @@ namespace compiler
 namespace train
 {
 
+namespace
+{
+
+using TrainableSubgraphs =
+  std::unordered_map<ir::SubgraphIndex, std::shared_ptr<ir::train::TrainableGraph>>;
+
+// Lower trainable subgraphs and generate their executors into executors
+void genExecutors(const TrainableSubgraphs &trainable_subgraphs,
+                  const CompilerOptions &options, const ir::train::TrainingInfo &training_info,
+                  const std::shared_ptr<backend::custom::IKernelBuilder> &custom_kernel_builder,
+                  onert::dumper::dot::DotDumper &dot_dumper, util::TracingCtx *tracing_ctx,
+                  const std::shared_ptr<exec::train::TrainableExecutors> &executors, bool replica)
+{
+  /***************************************************
+   * Backend independent analysis & optimization phase
+   ***************************************************/
+  // Lower: Assign backend
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>
+    lowered_subgs;
+  {
+    for (auto &&pair : trainable_subgraphs)
+    {
+      auto &subg_index = pair.first;
+      auto trainable_subg = pair.second;
+
+      // Lower: Assign backend
+      lowered_subgs[subg_index] =
+        std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, options);
+      // Set tracing_ctx for copied graph
+      if (tracing_ctx != nullptr)
+        tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
+    }
+  }
+
+  for (const auto &pair : lowered_subgs)
+  {
+    const auto &subg_index = pair.first;
+    const auto &lowered_subg = pair.second;
+    dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
+  }
+
+  // Set operands' info for back propagation as default tensor info
+  for (const auto &pair : lowered_subgs)
+  {
+    auto lowered_subg = pair.second.get();
+    auto &tgraph = lowered_subg->trainable_graph();
+    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
+      if (!obj.isConstant())
+      {
+        auto bwd_operand = std::make_unique<ir::Operand>(obj);
+        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
+        assert(gen_index == index);
+        UNUSED_RELEASE(gen_index);
+      }
+    });
+  }
+
+  // Shape inference.
+  {
+    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
+    // recursively
+    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
+      createStaticShapeInferers(lowered_subgs);
+
+    const auto primary_subg_idx = ir::SubgraphIndex{0};
+    inferers.at(primary_subg_idx)->infer();
+
+    for (const auto &pair_inferer : inferers)
+    {
+      const auto inferer = pair_inferer.second.get();
+      inferer->dump();
+    }
+
+    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
+    //      so it does not support models that have controlflow operations yet.
+    for (auto &&pair : lowered_subgs)
+    {
+      auto &lowered_subg = pair.second;
+      auto inferer = std::make_unique<StaticBackwardShapeInferer>(lowered_subg.get());
+      inferer->infer();
+      inferer->dump();
+    }
+  }
+
+  // Shape validation
+  for (const auto &pair : lowered_subgs)
+  {
+    auto &lowered_subg = pair.second;
+    compiler::ShapeValidator{lowered_subg->graph()}();
+  }
+
+  // TODO Validate shapes of the tensors for back propagation
+
+  /*************************************************************
+   *  Backend independent analysis & optimization phase finished
+   *************************************************************/
+  for (auto &&pair : lowered_subgs)
+  {
+    auto const model_index = ir::ModelIndex{0};
+    auto const subg_index = pair.first;
+    auto &lowered_subg = pair.second;
+    auto const indexed_ranks = lowered_subg->indexed_ranks();
+
+    ir::OperationDumper dumper("Executor generation of Subgraph " +
+                               std::to_string(subg_index.value()));
+    lowered_subg->graph().operations().iterate(
+      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
+
+    ExecutorFactoryArgs args;
+    args.tracing_ctx = tracing_ctx;
+    args.options = &options;
+    args.model_index = model_index;
+    args.custom_kernel_builder = custom_kernel_builder;
+    auto executor = std::unique_ptr<exec::IExecutor>{
+      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, training_info)};
+    executor->setIndexedRanks(indexed_ranks);
+    if (replica)
+      executors->addReplica(std::move(executor));
+    else
+      executors->emplace(model_index, subg_index, std::move(executor));
+  }
+}
+
+} // namespace
+
 TrainingCompiler::TrainingCompiler(const std::shared_ptr<ir::NNPkg> &nnpkg,
                                    std::vector<std::unique_ptr<CompilerOptions>> &copts,
                                    const ir::train::TrainingInfo &training_info)
@@ -106,6 +231,15 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
 
   if (_model->hasOnly<ir::Graph>())
   {
+    // NOTE If trainable operations are not given, weights of all operations are updated
+    const auto &trainable_ops = _training_info.getTrainableOps();
+    for (const auto &op_index : trainable_ops)
+    {
+      if (!_model->primary_subgraph()->operations().exist(op_index))
+        throw std::runtime_error{"TrainingCompiler: Invalid trainable operation " +
+                                 std::to_string(op_index.value())};
+    }
+
     // Create trainable subgraphs by copy and converting inference model
     _model->iterate([&](const ir::SubgraphIndex &subg_index, const ir::IGraph &graph) {
       const auto &subg = nnfw::misc::polymorphic_downcast<const ir::Graph &>(graph);
@@ -117,6 +251,8 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
       subg.operations().iterate(
         [&](const onert::ir::OperationIndex &op_index, const onert::ir::IOperation &op) {
           auto trainable_op = converter(op);
+          if (trainable_ops.empty() || trainable_ops.find(op_index) != trainable_ops.end())
+            trainable_op->enableWeightsUpdate();
           auto gen_index = trainable_subg->replaceOperation(op_index, std::move(trainable_op));
           UNUSED_RELEASE(gen_index);
           assert(gen_index == op_index);
@@ -165,6 +301,10 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
   }
 
   // Change input shape according to batch_size
+  // Each replica trains a shard of mini-batch
+  if (_training_info.batchSize() % _options->train_replicas != 0)
+    throw std::runtime_error("Batch size is not divisible by the number of replicas");
+  const auto shard_size = _training_info.batchSize() / _options->train_replicas;
   for (auto &&pair : trainable_subgraphs)
   {
     auto trainable_subg = pair.second;
@@ -176,119 +316,24 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
       // TODO Consider batch size index
       if (new_shape.dim(0) != 1)
         throw std::runtime_error("the first dim is not 1. It is not supported yet.");
-      new_shape.dim(0) = _training_info.batchSize();
+      new_shape.dim(0) = shard_size;
       input.info().shape(new_shape);
     }
   }
 
-  /***************************************************
-   * Backend independent analysis & optimization phase
-   ***************************************************/
   // Tracing context
   auto tracing_ctx = std::make_unique<util::TracingCtx>();
 
-  // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::train::LoweredTrainableGraph>>
-    lowered_subgs;
-  {
-    for (auto &&pair : trainable_subgraphs)
-    {
-      auto &subg_index = pair.first;
-      auto trainable_subg = pair.second;
-
-      // Lower: Assign backend
-      lowered_subgs[subg_index] =
-        std::make_unique<compiler::train::LoweredTrainableGraph>(*trainable_subg, *_options);
-      // Set tracing_ctx for copied graph
-      if (tracing_ctx != nullptr)
-        tracing_ctx->setSubgraphIndex(&(lowered_subgs[subg_index]->graph()), subg_index.value());
-    }
-  }
-
-  for (const auto &pair : lowered_subgs)
-  {
-    const auto &subg_index = pair.first;
-    const auto &lowered_subg = pair.second;
-    dot_dumper.dump(*lowered_subg, nnfw::misc::str("after_lower_subg-", subg_index.value()));
-  }
-
-  // Set operands' info for back propagation as default tensor info
-  for (const auto &pair : lowered_subgs)
-  {
-    auto lowered_subg = pair.second.get();
-    auto &tgraph = lowered_subg->trainable_graph();
-    tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
-      if (!obj.isConstant())
-      {
-        auto bwd_operand = std::make_unique<ir::Operand>(obj);
-        const auto gen_index = tgraph.addBackwardOperand(index, std::move(bwd_operand));
-        assert(gen_index == index);
-        UNUSED_RELEASE(gen_index);
-      }
-    });
-  }
+  auto executors =
+    std::make_shared<exec::train::TrainableExecutors>(_training_info.accumulationSteps());
+  genExecutors(trainable_subgraphs, *_options, _training_info, custom_kernel_builder, dot_dumper,
+               tracing_ctx.get(), executors, false);
 
-  // Shape inference.
+  // Replicas train other shards of mini-batch with weights of the primary executors
+  for (uint32_t i = 1; i < _options->train_replicas; ++i)
   {
-    // Run the StaticShapeInfer of primary subg. All child StaticShapeInferers are called
-    // recursively
-    std::unordered_map<ir::SubgraphIndex, std::unique_ptr<StaticShapeInferer>> inferers =
-      createStaticShapeInferers(lowered_subgs);
-
-    const auto primary_subg_idx = ir::SubgraphIndex{0};
-    inferers.at(primary_subg_idx)->infer();
-
-    for (const auto &pair_inferer : inferers)
-    {
-      const auto inferer = pair_inferer.second.get();
-      inferer->dump();
-    }
-
-    // NOTE StaticBackwardShapeInferer is allocated for each subgraph,
-    //      so it does not support models that have controlflow operations yet.
-    for (auto &&pair : lowered_subgs)
-    {
-      auto &lowered_subg = pair.second;
-      auto inferer = std::make_unique<StaticBackwardShapeInferer>(lowered_subg.get());
-      inferer->infer();
-      inferer->dump();
-    }
-  }
-
-  // Shape validation
-  for (const auto &pair : lowered_subgs)
-  {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
-  }
-
-  // TODO Validate shapes of the tensors for back propagation
-
-  /*************************************************************
-   *  Backend independent analysis & optimization phase finished
-   *************************************************************/
-  auto executors = std::make_shared<exec::train::TrainableExecutors>();
-  for (auto &&pair : lowered_subgs)
-  {
-    auto const model_index = ir::ModelIndex{0};
-    auto const subg_index = pair.first;
-    auto &lowered_subg = pair.second;
-    auto const indexed_ranks = lowered_subg->indexed_ranks();
-
-    ir::OperationDumper dumper("Executor generation of Subgraph " +
-                               std::to_string(subg_index.value()));
-    lowered_subg->graph().operations().iterate(
-      [&](const ir::OperationIndex &, const ir::IOperation &op) { op.accept(dumper); });
-
-    ExecutorFactoryArgs args;
-    args.tracing_ctx = tracing_ctx.get();
-    args.options = _options;
-    args.model_index = model_index;
-    args.custom_kernel_builder = custom_kernel_builder;
-    auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
-    executor->setIndexedRanks(indexed_ranks);
-    executors->emplace(model_index, subg_index, std::move(executor));
+    genExecutors(trainable_subgraphs, *_options, _training_info, custom_kernel_builder,
+                 dot_dumper, nullptr, executors, true);
   }
 
   /********************************
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AsyncExecutionEngine.h"
+
+#include "util/ConfigSource.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+AsyncExecutionEngine::AsyncExecutionEngine(uint32_t num_workers, uint32_t capacity)
+  : _capacity{capacity}
+{
+  assert(num_workers >= 1);
+  assert(capacity >= 1);
+
+  for (uint32_t i = 0; i < num_workers; i++)
+  {
+    _workers.emplace_back(&AsyncExecutionEngine::work, this);
+  }
+}
+
+AsyncExecutionEngine::~AsyncExecutionEngine()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _terminating = true;
+  }
+  _cv_jobs.notify_all();
+
+  for (auto &&worker : _workers)
+  {
+    worker.join();
+  }
+}
+
+AsyncExecutionEngine &AsyncExecutionEngine::get()
+{
+  auto num_workers = util::getConfigInt(util::config::ASYNC_THREADS);
+  if (num_workers < 1)
+    num_workers = std::max(1u, std::thread::hardware_concurrency());
+
+  auto capacity = util::getConfigInt(util::config::ASYNC_QUEUE_SIZE);
+  if (capacity < 1)
+    capacity = 1;
+
+  static AsyncExecutionEngine engine{static_cast<uint32_t>(num_workers),
+                                     static_cast<uint32_t>(capacity)};
+  return engine;
+}
+
+void AsyncExecutionEngine::submit(Job &&job)
+{
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv_space.wait(lock, [this] { return _jobs.size() < _capacity; });
+    _jobs.emplace(std::move(job));
+  }
+  _cv_jobs.notify_one();
+}
+
+uint32_t AsyncExecutionEngine::numJobsInQueue()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _jobs.size();
+}
+
+void AsyncExecutionEngine::work()
+{
+  while (true)
+  {
+    Job job;
+
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv_jobs.wait(lock, [this] { return _terminating || !_jobs.empty(); });
+
+      // Finish remaining jobs before terminating
+      if (_jobs.empty())
+      {
+        assert(_terminating);
+        return;
+      }
+
+      job = std::move(_jobs.front());
+      _jobs.pop();
+    }
+    _cv_space.notify_one();
+
+    assert(job);
+    job();
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_ASYNC_EXECUTION_ENGINE_H__
+#define __ONERT_EXEC_ASYNC_EXECUTION_ENGINE_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Persistent worker set to run asynchronous executions
+ *
+ * Jobs are pushed into a bounded queue and run by a fixed number of worker threads,
+ * so asynchronous execution does not create a thread for each request.
+ * When the queue is full, @c submit blocks until a worker takes a job.
+ */
+class AsyncExecutionEngine
+{
+public:
+  using Job = std::function<void()>;
+
+public:
+  /**
+   * @brief     Construct a new AsyncExecutionEngine object
+   * @param[in] num_workers Number of worker threads
+   * @param[in] capacity    Maximum number of jobs waiting in queue
+   */
+  AsyncExecutionEngine(uint32_t num_workers, uint32_t capacity);
+  AsyncExecutionEngine(const AsyncExecutionEngine &) = delete;
+  AsyncExecutionEngine &operator=(const AsyncExecutionEngine &) = delete;
+
+  /**
+   * @brief Destroy the AsyncExecutionEngine object
+   * @note  Jobs in queue are finished before worker threads are joined
+   */
+  ~AsyncExecutionEngine();
+
+  /**
+   * @brief   Get the engine shared by all executions in process
+   * @note    The number of workers and queue capacity are read from ASYNC_THREADS and
+   *          ASYNC_QUEUE_SIZE configuration on first call
+   * @return  Engine object
+   */
+  static AsyncExecutionEngine &get();
+
+public:
+  /**
+   * @brief     Push a job into queue
+   * @param[in] job Job to run on a worker thread
+   */
+  void submit(Job &&job);
+
+  /**
+   * @brief   Get number of jobs waiting in queue
+   * @return  Number of jobs
+   */
+  uint32_t numJobsInQueue();
+
+  uint32_t numWorkers() const { return _workers.size(); }
+  uint32_t capacity() const { return _capacity; }
+
+private:
+  void work();
+
+private:
+  const uint32_t _capacity;
+  bool _terminating{false};
+  std::queue<Job> _jobs;
+  std::mutex _mutex;
+  std::condition_variable _cv_jobs;  //< Notified when a job is pushed or engine is terminating
+  std::condition_variable _cv_space; //< Notified when a job is popped
+  std::vector<std::thread> _workers;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ASYNC_EXECUTION_ENGINE_H__
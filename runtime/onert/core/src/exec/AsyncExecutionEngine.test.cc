@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AsyncExecutionEngine.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace onert::exec;
+
+TEST(AsyncExecutionEngine, runAllJobs)
+{
+  std::atomic<uint32_t> count{0};
+  {
+    AsyncExecutionEngine engine{2, 4};
+    ASSERT_EQ(engine.numWorkers(), 2u);
+    ASSERT_EQ(engine.capacity(), 4u);
+
+    // More jobs than capacity: submit blocks until workers make space
+    for (int i = 0; i < 100; ++i)
+      engine.submit([&count]() { count++; });
+  }
+  // Remaining jobs are finished on destruction
+  ASSERT_EQ(count.load(), 100u);
+}
+
+TEST(AsyncExecutionEngine, sharedEngine)
+{
+  auto &engine = AsyncExecutionEngine::get();
+  ASSERT_GE(engine.numWorkers(), 1u);
+  ASSERT_GE(engine.capacity(), 1u);
+  ASSERT_EQ(&engine, &AsyncExecutionEngine::get());
+}
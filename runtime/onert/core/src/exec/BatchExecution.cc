@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/BatchExecution.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+
+namespace
+{
+
+using namespace onert;
+
+// Size of a request, which is the size of model input/output
+size_t sampleSize(const ir::OperandInfo &info)
+{
+  const auto &shape = info.shape();
+  if (shape.rank() == 0 || shape.dim(0) <= 0 || shape.hasUnspecifiedDims())
+    throw std::runtime_error{"BatchExecution: model input/output should have batch dimension"};
+  return info.total_size();
+}
+
+ir::Shape batchShape(ir::Shape shape, uint32_t batch_size)
+{
+  shape.dim(0) = shape.dim(0) * batch_size;
+  return shape;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+struct BatchExecution::Request
+{
+  std::vector<const void *> inputs;
+  std::vector<void *> outputs;
+  std::chrono::steady_clock::time_point submitted;
+  std::promise<void> done;
+};
+
+BatchExecution::BatchExecution(const std::shared_ptr<IExecutors> &executors,
+                               uint32_t max_batch_size, std::chrono::microseconds timeout)
+  : _max_batch_size{max_batch_size}, _timeout{timeout}, _execution{executors}, _input_shapes{},
+    _output_shapes{}, _input_sizes{}, _output_sizes{}, _input_buffers{}, _output_buffers{},
+    _terminating{false}, _requests{}, _stats{}, _mutex{}, _cv{}
+{
+  if (_max_batch_size < 1)
+    throw std::runtime_error{"BatchExecution: max batch size should be greater than 0"};
+
+  for (uint32_t i = 0; i < executors->inputSize(); i++)
+  {
+    const auto &info = executors->inputInfo(ir::IOIndex{i});
+    _input_sizes.emplace_back(sampleSize(info));
+    _input_shapes.emplace_back(info.shape());
+  }
+  for (uint32_t i = 0; i < executors->outputSize(); i++)
+  {
+    const auto &info = executors->outputInfo(ir::IOIndex{i});
+    _output_sizes.emplace_back(sampleSize(info));
+    _output_shapes.emplace_back(info.shape());
+  }
+  _input_buffers.resize(_input_sizes.size());
+  _output_buffers.resize(_output_sizes.size());
+
+  _dispatcher = std::thread{&BatchExecution::dispatch, this};
+}
+
+BatchExecution::~BatchExecution()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _terminating = true;
+  }
+  _cv.notify_all();
+  _dispatcher.join();
+}
+
+void BatchExecution::run(const std::vector<const void *> &inputs,
+                         const std::vector<void *> &outputs)
+{
+  if (inputs.size() != _input_sizes.size() || outputs.size() != _output_sizes.size())
+    throw std::runtime_error{"BatchExecution: invalid number of inputs/outputs"};
+
+  auto request = std::make_shared<Request>();
+  request->inputs = inputs;
+  request->outputs = outputs;
+  request->submitted = std::chrono::steady_clock::now();
+  auto done = request->done.get_future();
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_terminating)
+      throw std::runtime_error{"BatchExecution: execution is terminating"};
+    _requests.emplace_back(std::move(request));
+  }
+  _cv.notify_all();
+
+  done.get();
+}
+
+BatchStats BatchExecution::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+void BatchExecution::dispatch()
+{
+  while (true)
+  {
+    std::vector<std::shared_ptr<Request>> batch;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [this] { return _terminating || !_requests.empty(); });
+      if (_requests.empty())
+      {
+        assert(_terminating);
+        return;
+      }
+
+      // Wait for other requests until the oldest request times out
+      const auto deadline = _requests.front()->submitted + _timeout;
+      _cv.wait_until(lock, deadline, [this] {
+        return _terminating || _requests.size() >= _max_batch_size;
+      });
+
+      const auto batch_size = std::min<size_t>(_requests.size(), _max_batch_size);
+      batch.assign(_requests.begin(), _requests.begin() + batch_size);
+      _requests.erase(_requests.begin(), _requests.begin() + batch_size);
+
+      const auto now = std::chrono::steady_clock::now();
+      for (const auto &request : batch)
+      {
+        const uint64_t queue_time =
+          std::chrono::duration_cast<std::chrono::microseconds>(now - request->submitted).count();
+        _stats.total_queue_time_us += queue_time;
+        _stats.max_queue_time_us = std::max(_stats.max_queue_time_us, queue_time);
+      }
+      _stats.num_batches++;
+      _stats.num_requests += batch.size();
+    }
+
+    VERBOSE(BatchExecution) << "Run batch of " << batch.size() << " request(s)" << std::endl;
+
+    try
+    {
+      runBatch(batch);
+      for (const auto &request : batch)
+        request->done.set_value();
+    }
+    catch (...)
+    {
+      for (const auto &request : batch)
+        request->done.set_exception(std::current_exception());
+    }
+  }
+}
+
+void BatchExecution::runBatch(const std::vector<std::shared_ptr<Request>> &batch)
+{
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+  assert(batch_size > 0);
+
+  for (uint32_t i = 0; i < _input_sizes.size(); i++)
+  {
+    const auto index = ir::IOIndex{i};
+    _execution.changeInputShape(index, batchShape(_input_shapes[i], batch_size));
+
+    // Single request does not need to be gathered
+    if (batch_size == 1)
+    {
+      _execution.setInput(index, batch[0]->inputs[i], _input_sizes[i]);
+      continue;
+    }
+
+    auto &buffer = _input_buffers[i];
+    buffer.resize(_input_sizes[i] * batch_size);
+    for (uint32_t n = 0; n < batch_size; n++)
+      std::memcpy(buffer.data() + n * _input_sizes[i], batch[n]->inputs[i], _input_sizes[i]);
+    _execution.setInput(index, buffer.data(), buffer.size());
+  }
+
+  for (uint32_t i = 0; i < _output_sizes.size(); i++)
+  {
+    const auto index = ir::IOIndex{i};
+    if (batch_size == 1)
+    {
+      _execution.setOutput(index, batch[0]->outputs[i], _output_sizes[i]);
+      continue;
+    }
+
+    auto &buffer = _output_buffers[i];
+    buffer.resize(_output_sizes[i] * batch_size);
+    _execution.setOutput(index, buffer.data(), buffer.size());
+  }
+
+  _execution.execute();
+
+  for (uint32_t i = 0; i < _output_sizes.size(); i++)
+  {
+    const auto index = ir::IOIndex{i};
+    if (_execution.getOutputShape(index) != batchShape(_output_shapes[i], batch_size))
+      throw std::runtime_error{"BatchExecution: output " + std::to_string(i) +
+                               " is not batched along the first dimension"};
+
+    if (batch_size == 1)
+      continue;
+
+    const auto &buffer = _output_buffers[i];
+    for (uint32_t n = 0; n < batch_size; n++)
+      std::memcpy(batch[n]->outputs[i], buffer.data() + n * _output_sizes[i], _output_sizes[i]);
+  }
+}
+
+} // namespace exec
+} // namespace onert
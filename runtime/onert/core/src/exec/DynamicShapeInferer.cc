@@ -16,13 +16,228 @@
 
 #include "exec/DynamicShapeInferer.h"
 #include "util/ShapeInference.h"
+#include <algorithm>
 #include <assert.h>
+#include <cstring>
 
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+// Number of input signatures cached for an operation. Inputs with other signatures are inferred
+// every time.
+constexpr size_t kMaxShapeCacheSize = 16;
+
+// Get positions of inputs whose values are read to infer output shapes
+// Return false if output shapes of op are not inferred by DynamicShapeInferer
+// NOTE Update this when a visitor is added or starts to read values of inputs
+bool shapeValueInputs(const ir::IOperation &op, std::vector<uint32_t> &value_inputs)
+{
+  using namespace ir::operation;
+  value_inputs.clear();
+  switch (op.opcode())
+  {
+    case ir::OpCode::ArgMinMax:
+      value_inputs = {ArgMinMax::Input::AXIS};
+      return true;
+    case ir::OpCode::BCQFullyConnected:
+      value_inputs = {BCQFullyConnected::Input::WEIGHTS_CLUSTERS};
+      return true;
+    case ir::OpCode::BCQGather:
+      value_inputs = {BCQGather::Input::INPUT_CLUSTERS};
+      return true;
+    case ir::OpCode::BroadcastTo:
+      value_inputs = {BroadcastTo::Input::SHAPE};
+      return true;
+    case ir::OpCode::ExpandDims:
+      value_inputs = {ExpandDims::Input::AXIS};
+      return true;
+    case ir::OpCode::Fill:
+      value_inputs = {Fill::Input::SHAPE};
+      return true;
+    case ir::OpCode::OneHot:
+      value_inputs = {OneHot::Input::DEPTH};
+      return true;
+    case ir::OpCode::Pad:
+      value_inputs = {Pad::Input::PAD};
+      return true;
+    case ir::OpCode::Range:
+      value_inputs = {Range::Input::START, Range::Input::LIMIT, Range::Input::DELTA};
+      return true;
+    case ir::OpCode::Reduce:
+      value_inputs = {Reduce::Input::AXES};
+      return true;
+    case ir::OpCode::Reshape:
+      value_inputs = {Reshape::Input::SHAPE};
+      return true;
+    case ir::OpCode::ResizeBilinear:
+      value_inputs = {ResizeBilinear::Input::SIZE};
+      return true;
+    case ir::OpCode::ResizeNearestNeighbor:
+      value_inputs = {ResizeNearestNeighbor::Input::SIZE};
+      return true;
+    case ir::OpCode::Slice:
+      value_inputs = {Slice::Input::BEGINS, Slice::Input::SIZES};
+      return true;
+    case ir::OpCode::SpaceToBatchND:
+      value_inputs = {SpaceToBatchND::Input::BLOCK_SIZE, SpaceToBatchND::Input::PADDINGS};
+      return true;
+    case ir::OpCode::Split:
+      value_inputs = {Split::Input::AXIS};
+      return true;
+    case ir::OpCode::StridedSlice:
+      value_inputs = {StridedSlice::Input::STARTS, StridedSlice::Input::ENDS,
+                      StridedSlice::Input::STRIDES};
+      return true;
+    case ir::OpCode::Tile:
+      value_inputs = {Tile::Input::MULTIPLES};
+      return true;
+    case ir::OpCode::Transpose:
+      value_inputs = {Transpose::Input::PERMUTATION};
+      return true;
+    case ir::OpCode::TransposeConv:
+      value_inputs = {TransposeConv::Input::OUTPUT_SHAPE};
+      return true;
+    // Output shapes depend on input shapes only
+    case ir::OpCode::Attention:
+    case ir::OpCode::BatchMatMul:
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::Comparison:
+    case ir::OpCode::Concat:
+    case ir::OpCode::Conv2D:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ElementwiseBinary:
+    case ir::OpCode::ElementwiseUnary:
+    case ir::OpCode::EmbeddingLookup:
+    case ir::OpCode::FullyConnected:
+    case ir::OpCode::FusedBatchNorm:
+    case ir::OpCode::Gather:
+    case ir::OpCode::InstanceNorm:
+    case ir::OpCode::L2Normalization:
+    case ir::OpCode::LayerNorm:
+    case ir::OpCode::LocalResponseNormalization:
+    case ir::OpCode::LSTM:
+    case ir::OpCode::MatrixBandPart:
+    case ir::OpCode::Pack:
+    case ir::OpCode::Pool2D:
+    case ir::OpCode::Pow:
+    case ir::OpCode::PReLU:
+    case ir::OpCode::Reverse:
+    case ir::OpCode::RmsNorm:
+    case ir::OpCode::RNN:
+    case ir::OpCode::Select:
+    case ir::OpCode::Shape:
+    case ir::OpCode::Softmax:
+    case ir::OpCode::Squeeze:
+    case ir::OpCode::SquaredDifference:
+    case ir::OpCode::TopKV2:
+    case ir::OpCode::Unpack:
+      return true;
+    // Permute, DetectionPostProcess and others whose shapes are decided by kernels
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+bool DynamicShapeInferer::makeCacheKey(const ir::IOperation &op)
+{
+  _cache_key.clear();
+  for (const auto &ind : op.getInputs())
+  {
+    if (ind.undefined())
+    {
+      _cache_key.emplace_back(-1);
+      continue;
+    }
+    const auto shape = _tensor_registry->getITensor(ind)->getShape();
+    _cache_key.emplace_back(shape.rank());
+    for (int i = 0; i < shape.rank(); ++i)
+      _cache_key.emplace_back(shape.dim(i));
+  }
+
+  // Values of constants never change
+  for (const auto &pos : _value_inputs)
+  {
+    if (pos >= op.getInputs().size() || op.getInputs().at(pos).undefined())
+      continue;
+    const auto tensor = _tensor_registry->getITensor(op.getInputs().at(pos));
+    if (tensor->is_constant())
+      continue;
+    if (tensor->buffer() == nullptr)
+      return false;
+
+    const auto size = tensor->total_size();
+    _cache_key.emplace_back(static_cast<int64_t>(size));
+    for (size_t offset = 0; offset < size; offset += sizeof(int64_t))
+    {
+      int64_t word = 0;
+      std::memcpy(&word, tensor->buffer() + offset, std::min(sizeof(int64_t), size - offset));
+      _cache_key.emplace_back(word);
+    }
+  }
+  return true;
+}
+
+bool DynamicShapeInferer::infer(const ir::IOperation &op)
+{
+  if (_cache_op != &op)
+  {
+    _shape_cache.clear();
+    _cache_op = &op;
+    _cacheable_op = shapeValueInputs(op, _value_inputs);
+  }
+
+  const bool cacheable = _cacheable_op && makeCacheKey(op);
+  if (cacheable)
+  {
+    auto it = _shape_cache.find(_cache_key);
+    if (it != _shape_cache.end())
+    {
+      bool changed = false;
+      uint32_t i = 0;
+      for (const auto &ind : op.getOutputs())
+      {
+        if (ind.undefined())
+          continue;
+        const auto &cached = it->second.at(i++);
+        auto output = _tensor_registry->getITensor(ind);
+        // Output could become dynamic by other input shapes after shapes are cached
+        if (!cached.dynamic && !output->is_dynamic())
+          continue;
+        // Output which already has the shape keeps its buffer
+        if (output->is_dynamic() && output->buffer() != nullptr &&
+            output->getShape() == cached.shape)
+          continue;
+        output->applyShape(cached.shape);
+        changed = true;
+      }
+      return changed;
+    }
+  }
+
+  op.accept(*this);
+
+  if (cacheable && _shape_cache.size() < kMaxShapeCacheSize)
+  {
+    std::vector<CachedOutput> outputs;
+    for (const auto &ind : op.getOutputs())
+    {
+      if (ind.undefined())
+        continue;
+      const auto output = _tensor_registry->getITensor(ind);
+      outputs.emplace_back(CachedOutput{output->is_dynamic(), output->getShape()});
+    }
+    _shape_cache.emplace(_cache_key, std::move(outputs));
+  }
+  return true;
+}
+
 void DynamicShapeInferer::handleBinaryArithmeticOp(const ir::Operation &op,
                                                    const ir::OperandIndex lhs_idx,
                                                    const ir::OperandIndex rhs_idx)
@@ -117,6 +332,23 @@ void DynamicShapeInferer::visit(const ir::operation::ArgMinMax &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::Attention &op)
+{
+  const auto query_index = op.getInputs().at(ir::operation::Attention::Input::QUERY);
+  const auto value_index = op.getInputs().at(ir::operation::Attention::Input::VALUE);
+  auto query = _tensor_registry->getITensor(query_index);
+  auto value = _tensor_registry->getITensor(value_index);
+
+  if (!query->is_dynamic() && !value->is_dynamic())
+    return;
+
+  const auto output_index = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_index);
+
+  auto new_shape = shape_inference::inferAttentionShape(query->getShape(), value->getShape());
+  output->applyShape(new_shape);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   const auto lhs_index = op.getInputs().at(ir::operation::BatchMatMul::Input::LHS);
@@ -355,6 +587,27 @@ void DynamicShapeInferer::visit(const ir::operation::ElementwiseUnary &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseUnary::Input::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::EmbeddingLookup &op)
+{
+  auto lookups_ind = op.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS);
+  auto lookups = _tensor_registry->getITensor(lookups_ind);
+
+  auto values_ind = op.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES);
+  auto values = _tensor_registry->getITensor(values_ind);
+
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  if (currently_static(lookups) && currently_static(values) && previously_static(output))
+    return;
+
+  auto new_shape =
+    shape_inference::inferEmbeddingLookupShape(lookups->getShape(), values->getShape());
+
+  output->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::ExpandDims &op)
 {
   // check if input is not dynamic
@@ -488,11 +741,26 @@ void DynamicShapeInferer::visit(const ir::operation::Gather &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::InstanceNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::InstanceNorm::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::L2Normalization &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::LayerNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LayerNorm::INPUT));
+}
+
+void DynamicShapeInferer::visit(const ir::operation::LocalResponseNormalization &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LocalResponseNormalization::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::LSTM &op)
 {
   const auto output_index{op.getOutputs().at(ir::operation::LSTM::Output::OUTPUT)};
@@ -731,6 +999,12 @@ void DynamicShapeInferer::visit(const ir::operation::Pow &op)
                            op.getInputs().at(ir::operation::Pow::Input::RHS));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::PReLU &op)
+{
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::PReLU::Input::INPUT),
+                           op.getInputs().at(ir::operation::PReLU::Input::ALPHA));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Range &op)
 {
   // check if output is not dynamic
@@ -937,11 +1211,90 @@ void DynamicShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::ResizeNearestNeighbor &op)
+{
+  // check if output is not dynamic
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  auto input_ind = op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_ind);
+
+  if ((!input->is_dynamic()) && (!output->is_dynamic()))
+    return;
+
+  // getting output shape from input shape and Params
+  int32_t height_out, width_out;
+  if (op.getInputs().size() == 2)
+  {
+    auto size_ind = op.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::SIZE);
+    auto size = _tensor_registry->getITensor(size_ind);
+    if (size->data_type() == ir::DataType::INT32)
+    {
+      auto size_buf = reinterpret_cast<const int32_t *>(size->buffer());
+      height_out = size_buf[0];
+      width_out = size_buf[1];
+    }
+    else
+    {
+      throw std::runtime_error("DynamicShapeInferer ResizeNearestNeighbor : Unsupported data type");
+    }
+  }
+  else
+  {
+    height_out = op.param().height_out;
+    width_out = op.param().width_out;
+  }
+  auto output_shape =
+    shape_inference::inferResizeNearestNeighborShape(input->getShape(), height_out, width_out);
+
+  // if shape is changed, change output shape and reallocate output tensor memory
+  if (output_shape != output->getShape() || output->buffer() == nullptr)
+  {
+    // change on output shape
+    output->applyShape(output_shape);
+  }
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Reverse &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Reverse::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::RmsNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::RmsNorm::INPUT));
+}
+
+void DynamicShapeInferer::visit(const ir::operation::RNN &op)
+{
+  const auto input_ind = op.getInputs().at(ir::operation::RNN::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_ind);
+
+  const auto weights_ind = op.getInputs().at(ir::operation::RNN::Input::WEIGHTS);
+  auto weights = _tensor_registry->getITensor(weights_ind);
+
+  const auto output_ind = op.getOutputs().at(ir::operation::RNN::Output::OUTPUT);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  const auto hidden_state_out_ind =
+    op.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT);
+  auto hidden_state_out = _tensor_registry->getITensor(hidden_state_out_ind);
+
+  if (currently_static(input) && currently_static(weights) && previously_static(output) &&
+      previously_static(hidden_state_out))
+    return;
+
+  // Output and hidden state are [batch_size, num_units]
+  auto new_shape = shape_inference::inferRNNShape(input->getShape(), weights->getShape());
+
+  output->applyShape(new_shape);
+  hidden_state_out->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+  assert(hidden_state_out->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Select &op)
 {
   const auto input_cond_idx = op.getInputs().at(ir::operation::Select::Input::CONDITION);
@@ -1190,6 +1543,28 @@ void DynamicShapeInferer::visit(const ir::operation::Tile &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  const auto input_ind = op.getInputs().at(ir::operation::TopKV2::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_ind);
+
+  const auto values_ind = op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES);
+  auto values = _tensor_registry->getITensor(values_ind);
+
+  const auto indices_ind = op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES);
+  auto indices = _tensor_registry->getITensor(indices_ind);
+
+  if (currently_static(input) && previously_static(values) && previously_static(indices))
+    return;
+
+  auto new_shape = shape_inference::inferTopKV2Shape(input->getShape(), op.param().k);
+
+  values->applyShape(new_shape);
+  indices->applyShape(new_shape);
+  assert(values->buffer() != nullptr);
+  assert(indices->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
 {
   // check if output is not dynamic
@@ -1244,6 +1619,32 @@ void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::TransposeConv &op)
+{
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  auto input_ind = op.getInputs().at(ir::operation::TransposeConv::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_ind);
+
+  auto output_shape_ind = op.getInputs().at(ir::operation::TransposeConv::Input::OUTPUT_SHAPE);
+  auto output_shape = _tensor_registry->getITensor(output_shape_ind);
+
+  if ((!input->is_dynamic()) && (!output->is_dynamic()))
+    return;
+
+  if (output_shape->data_type() != ir::DataType::INT32)
+    throw std::runtime_error("DynamicShapeInferer TransposeConv : Unsupported data type");
+
+  // Output shape is given by the value of OUTPUT_SHAPE
+  auto output_shape_buf = reinterpret_cast<const int32_t *>(output_shape->buffer());
+  auto new_shape =
+    shape_inference::inferTransposeConvShape(output_shape->getShape(), output_shape_buf);
+
+  output->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Unpack &op)
 {
   // check if output is not dynamic
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/DynamicShapeInferer.h"
+
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/TensorRegistry.h"
+#include "ir/Operands.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/Reshape.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+
+// DynamicShapeInferer which counts visits
+class CountingInferer : public exec::DynamicShapeInferer
+{
+public:
+  using exec::DynamicShapeInferer::DynamicShapeInferer;
+  using exec::DynamicShapeInferer::visit;
+
+  void visit(const operation::ElementwiseActivation &op) override
+  {
+    visits++;
+    exec::DynamicShapeInferer::visit(op);
+  }
+  void visit(const operation::Reshape &op) override
+  {
+    visits++;
+    exec::DynamicShapeInferer::visit(op);
+  }
+
+  uint32_t visits = 0;
+};
+
+class DynamicShapeInfererTest : public ::testing::Test
+{
+protected:
+  OperandIndex addTensor(const Shape &shape, DataType type)
+  {
+    auto ind = _operands.emplace(shape, TypeInfo{type});
+    _registry->setNativeTensor(ind, std::make_unique<backend::basic::Tensor>(
+                                      _operands.at(ind).info(), Layout::NHWC, &_mem_mgr));
+    return ind;
+  }
+
+  backend::ITensor *tensor(const OperandIndex &ind) { return _registry->getITensor(ind); }
+
+  Operands _operands;
+  backend::basic::DynamicMemoryManager _mem_mgr;
+  std::shared_ptr<backend::basic::TensorRegistry> _registry =
+    std::make_shared<backend::basic::TensorRegistry>();
+};
+
+} // namespace
+
+TEST_F(DynamicShapeInfererTest, cacheShapes)
+{
+  auto input = addTensor(Shape{2, 3}, DataType::FLOAT32);
+  auto output = addTensor(Shape{2, 3}, DataType::FLOAT32);
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  operation::ElementwiseActivation op{OperandIndexSequence{input}, OperandIndexSequence{output},
+                                      param};
+  CountingInferer inferer{_operands, _registry};
+
+  for (const auto &length : {2, 4, 2, 4})
+  {
+    tensor(input)->applyShape(Shape{length, 3});
+    inferer.infer(op);
+    ASSERT_EQ(tensor(output)->getShape(), (Shape{length, 3}));
+    ASSERT_NE(tensor(output)->buffer(), nullptr);
+  }
+  // Shapes of the last two runs are reused
+  EXPECT_EQ(inferer.visits, 2);
+}
+
+TEST_F(DynamicShapeInfererTest, keepOutputsOnCacheHit)
+{
+  auto input = addTensor(Shape{2, 3}, DataType::FLOAT32);
+  auto output = addTensor(Shape{2, 3}, DataType::FLOAT32);
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  operation::ElementwiseActivation op{OperandIndexSequence{input}, OperandIndexSequence{output},
+                                      param};
+  CountingInferer inferer{_operands, _registry};
+
+  uint32_t changes = 0;
+  const uint8_t *buffer = nullptr;
+  for (const auto &length : {2, 2, 4, 4, 4, 2, 2})
+  {
+    tensor(input)->applyShape(Shape{length, 3});
+    const bool changed = inferer.infer(op);
+    ASSERT_EQ(tensor(output)->getShape(), (Shape{length, 3}));
+    // Output keeps its buffer while its shape is reused
+    if (!changed)
+      ASSERT_EQ(tensor(output)->buffer(), buffer);
+    buffer = tensor(output)->buffer();
+    changes += changed ? 1 : 0;
+  }
+  // Visited for new shapes only, and changed only when the length changes
+  EXPECT_EQ(inferer.visits, 2);
+  EXPECT_EQ(changes, 3);
+}
+
+TEST_F(DynamicShapeInfererTest, cacheShapeValues)
+{
+  auto input = addTensor(Shape{2, 3}, DataType::FLOAT32);
+  auto new_shape = addTensor(Shape{2}, DataType::INT32);
+  auto output = addTensor(Shape{3, 2}, DataType::FLOAT32);
+  operation::Reshape op{OperandIndexSequence{input, new_shape}, OperandIndexSequence{output},
+                        operation::Reshape::Param{}};
+  CountingInferer inferer{_operands, _registry};
+
+  tensor(input)->applyShape(Shape{2, 3});
+  tensor(new_shape)->applyShape(Shape{2});
+  auto shape_buf = reinterpret_cast<int32_t *>(tensor(new_shape)->buffer());
+
+  // Output shape depends on values of new_shape with the same input shapes
+  for (const auto &dims : {std::vector<int32_t>{3, 2}, {6, 1}, {3, 2}, {6, 1}})
+  {
+    shape_buf[0] = dims[0];
+    shape_buf[1] = dims[1];
+    inferer.infer(op);
+    ASSERT_EQ(tensor(output)->getShape(), (Shape{dims[0], dims[1]}));
+  }
+  EXPECT_EQ(inferer.visits, 2);
+}
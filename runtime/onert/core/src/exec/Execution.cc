@@ -16,6 +16,7 @@
 
 #include "exec/Execution.h"
 
+#include "AsyncExecutionEngine.h"
 #include "ir/DataType.h"
 #include "train/TrainableExecutors.h"
 #include "util/logging.h"
@@ -41,6 +42,13 @@ Execution::Execution(const std::shared_ptr<IExecutors> &executors) : _executors{
   _io_desc.updated = false;
 }
 
+Execution::~Execution()
+{
+  // Asynchronous execution refers this object, so wait until it is finished
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_running; });
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This will be used later to set input tensor dynamic
@@ -65,6 +73,9 @@ void Execution::setInput(const ir::IOIndex &index, const void *buffer, size_t le
   // check if size enough for input is passed
   // if input_shape_sig is set, input_shape_sig overrides shape in info
   // note: input_shape_sig contains shape passed by nnfw_set_input_tensorinfo()
+  if (_states.find(index) != _states.end())
+    throw std::runtime_error{"Input " + std::to_string(index.value()) + " is bound to a state"};
+
   auto &input_desc = _io_desc.inputs.at(index.value());
   if (length < input_desc->info.total_size())
   {
@@ -84,6 +95,12 @@ void Execution::setInput(const ir::IOIndex &index, const ir::Shape &shape, const
 
 void Execution::setOutput(const ir::IOIndex &index, void *buffer, size_t length)
 {
+  for (const auto &state : _states)
+  {
+    if (state.second.output == index)
+      throw std::runtime_error{"Output " + std::to_string(index.value()) + " is bound to a state"};
+  }
+
   auto &output_desc = _io_desc.outputs.at(index.value());
   // Check lenght when output shape is valid
   if (!_io_desc.updated && length < output_desc->info.total_size())
@@ -126,32 +143,130 @@ void Execution::setOutputType(const ir::IOIndex &index, const ir::TypeInfo &type
   _io_desc.updated = true;
 }
 
+void Execution::bindState(const ir::IOIndex &input, const ir::IOIndex &output,
+                          StateUpdate update, int32_t axis)
+{
+  if (input.value() >= _io_desc.inputs.size() || output.value() >= _io_desc.outputs.size())
+    throw std::runtime_error{"Invalid input or output index of state"};
+  if (_states.find(input) != _states.end())
+    throw std::runtime_error{"Input " + std::to_string(input.value()) + " is already bound"};
+  for (const auto &state : _states)
+  {
+    if (state.second.output == output)
+      throw std::runtime_error{"Output " + std::to_string(output.value()) + " is already bound"};
+  }
+
+  auto &input_desc = _io_desc.inputs.at(input.value());
+  auto &output_desc = _io_desc.outputs.at(output.value());
+  if (input_desc->info.typeInfo().type() != output_desc->info.typeInfo().type())
+    throw std::runtime_error{"Data types of state input and output are different"};
+
+  auto tensor = std::make_unique<StateTensor>(input_desc->info, update, axis);
+  if (!_io_desc.updated && tensor->outputSize() < output_desc->info.total_size())
+    throw std::runtime_error{"Output of state is larger than state"};
+
+  input_desc->buffer = tensor->buffer();
+  input_desc->size = tensor->size();
+  output_desc->buffer = tensor->outputBuffer();
+  output_desc->size = tensor->outputSize();
+  _states.emplace(input, BoundState{output, std::move(tensor)});
+
+  VERBOSE(Execution) << "Input " << input << " is bound to state updated by output " << output
+                     << std::endl;
+}
+
+void Execution::resetStates()
+{
+  for (auto &state : _states)
+    state.second.tensor->reset();
+}
+
+int32_t Execution::getStateLength(const ir::IOIndex &input) const
+{
+  const auto it = _states.find(input);
+  if (it == _states.end())
+    throw std::runtime_error{"Input " + std::to_string(input.value()) + " is not bound"};
+  return it->second.tensor->length();
+}
+
 void Execution::execute()
+{
+  run();
+
+  std::lock_guard<std::mutex> lock{_async_mutex};
+  finished = true;
+}
+
+void Execution::run()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
 
   _executors->execute(_io_desc);
-  finished = true;
+  // Only outputs of this execution are copied, so the cost does not grow with states
+  for (auto &state : _states)
+    state.second.tensor->update(_io_desc.outputs.at(state.second.output.value())->info.shape());
 
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::startExecute()
+void Execution::startExecute(const CompletionCallback &callback)
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    if (_async_running)
+      throw std::runtime_error{"Asynchronous execution is already running"};
+    _async_running = true;
+    _async_error = nullptr;
+    finished = false;
+  }
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
+
+  AsyncExecutionEngine::get().submit([this, callback]() {
+    std::exception_ptr error = nullptr;
+    try
+    {
+      run();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    // Call before notifying waiter, so that execution object is alive during callback
+    if (callback)
+      callback(error);
+
+    // Report finished only here, so that poll does not succeed while callback is running
+    // Notify while holding lock, since waiter may destroy this object right after wake-up
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    _async_error = error;
+    _async_running = false;
+    finished = true;
+    _async_cv.notify_all();
+  });
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
-  finished = true;
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_running; });
+
+  if (_async_error)
+  {
+    auto error = _async_error;
+    _async_error = nullptr;
+    std::rethrow_exception(error);
+  }
 }
 
-bool Execution::isFinished(void) const { return finished; }
+bool Execution::isFinished(void) const
+{
+  std::lock_guard<std::mutex> lock{_async_mutex};
+  return finished;
+}
 
 void Execution::train(uint32_t training_step)
 {
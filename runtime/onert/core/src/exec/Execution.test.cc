@@ -15,6 +15,9 @@
  */
 
 #include "exec/Execution.h"
+#include "exec/BatchExecution.h"
+#include "exec/PipelineExecution.h"
+#include "MultiModelExecutors.h"
 
 #include "compiler/Compiler.h"
 #include "compiler/CompilerFactory.h"
@@ -23,6 +26,8 @@
 #include "util/TracingCtx.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
 #include <thread>
 
 namespace
@@ -33,7 +38,7 @@ using namespace onert::ir;
 class CompiledMockUpModel
 {
 public:
-  CompiledMockUpModel()
+  CompiledMockUpModel(uint32_t execution_contexts = 1, const std::string &executor = "")
   {
     // Model: two elementwise add operation
     // model input: lhs, rhs1
@@ -81,6 +86,9 @@ public:
     auto model = std::make_shared<onert::ir::Model>();
     model->push(onert::ir::SubgraphIndex{0}, graph);
     coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+    coptions->execution_contexts = execution_contexts;
+    if (!executor.empty())
+      coptions->executor = executor;
     onert::compiler::Compiler compiler{model, *coptions};
     artifact = compiler.compile();
   }
@@ -94,13 +102,13 @@ public:
 class CompiledMockUpMultiModel
 {
 public:
-  CompiledMockUpMultiModel()
+  CompiledMockUpMultiModel(DataType model1_type = DataType::QUANT_UINT8_ASYMM)
   {
     // Model0: a float elementwise add operation
     // Model0 input: lhs0, rhs0
     // Model0 output: add result (result0)
 
-    // Model1: a qasymm8 elementwise add operation
+    // Model1: a qasymm8 (or float if model1_type is float) elementwise add operation
     // Model1 input: result0, rhs1
     // Model1 output: add result (result1)
 
@@ -137,7 +145,7 @@ public:
     Shape shape{1, 2, 2, 1};
 
     // Model0's add operands (result1 <= lhs0 + rhs0)
-    DataType types[3] = {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::FLOAT32};
+    DataType types[3] = {DataType::FLOAT32, model1_type, DataType::FLOAT32};
     auto operand_lhs0 = graphs[0]->addOperand(shape, TypeInfo{types[0]});
     auto operand_rhs0 = graphs[0]->addOperand(shape, TypeInfo{types[0]});
     auto operand_result0 = graphs[0]->addOperand(shape, TypeInfo{types[0]});
@@ -158,17 +166,20 @@ public:
     graphs[0]->verify();
 
     // Model1's add operands (result2 <= Model0 result + rhs1)
-    // static float rhs1_data[4] = {3, 1, -1, 5};
+    static float rhs1_float_data[4] = {3, 1, -1, 5};
     static uint8_t rhs1_data[4] = {131, 129, 127, 133};
-    const float scale = 1;
-    const int32_t zero_point = 128;
+    const bool is_float1 = types[1] == DataType::FLOAT32;
+    const float scale = is_float1 ? 0 : 1;
+    const int32_t zero_point = is_float1 ? 0 : 128;
     auto operand_lhs1 = graphs[1]->addOperand(shape, TypeInfo{types[1], scale, zero_point});
     auto operand_rhs1 = graphs[1]->addOperand(shape, TypeInfo{types[1], scale, zero_point});
     auto operand_result1 = graphs[1]->addOperand(shape, TypeInfo{types[1], scale, zero_point});
-    graphs[1]
-      ->operands()
-      .at(operand_rhs1)
-      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs1_data), 4));
+    if (is_float1)
+      graphs[1]->operands().at(operand_rhs1).data(std::make_unique<CachedData>(
+        reinterpret_cast<const uint8_t *>(&rhs1_float_data), 16));
+    else
+      graphs[1]->operands().at(operand_rhs1).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs1_data), 4));
 
     // Model1's add operation
     operation::BinaryArithmetic::Param param1;
@@ -274,6 +285,37 @@ TEST(ExecInstance, simple)
   }
 }
 
+TEST(ExecInstance, workStealingExecutor)
+{
+  auto mockup = CompiledMockUpModel(1, "WorkStealing");
+  auto executors = mockup.artifact->_executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+
+  // Run twice to check that the executor is reusable
+  for (auto n = 0; n < 2; n++)
+  {
+    float output_buffer[4] = {};
+    execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+    execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+    execution.execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+}
+
 TEST(ExecInstance, twoCompile)
 {
   auto mockup = CompiledMockUpModel();
@@ -425,6 +467,151 @@ TEST(ExecInstance, twoThreads)
   }
 }
 
+// Support multi-thread execution on several execution contexts
+TEST(ExecInstance, twoThreadsWithContexts)
+{
+  auto mockup = CompiledMockUpModel(2);
+  auto executors = mockup.artifact->_executors;
+
+  const float exe1_input1_buffer[4] = {1, 0, -1, -2};
+  const float exe1_input2_buffer[4] = {1, -3, 2, -4};
+  float exe1_output_buffer[4] = {};
+  const float exe1_output_expected[4] = {5, -2, 0, -1};
+
+  Inference execution1{exe1_input1_buffer, exe1_input2_buffer, exe1_output_buffer, executors};
+
+  const float exe2_input1_buffer[4] = {2, 1, -2, 0};
+  const float exe2_input2_buffer[4] = {-3, 3, 1, 2};
+  float exe2_output_buffer[4] = {};
+  const float exe2_output_expected[4] = {2, 5, -2, 7};
+
+  Inference execution2{exe2_input1_buffer, exe2_input2_buffer, exe2_output_buffer, executors};
+
+  for (int n = 0; n < 10; ++n)
+  {
+    std::thread t1{&Inference::inference, &execution1};
+    std::thread t2{&Inference::inference, &execution2};
+
+    t1.join();
+    t2.join();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(exe1_output_buffer[i], exe1_output_expected[i]);
+      EXPECT_EQ(exe2_output_buffer[i], exe2_output_expected[i]);
+    }
+  }
+}
+
+TEST(ExecInstance, batchExecution)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const uint32_t num_threads = 8;
+  const uint32_t num_requests = 10;
+  onert::exec::BatchExecution execution{executors, 4, std::chrono::milliseconds{5}};
+  ASSERT_EQ(execution.maxBatchSize(), 4u);
+
+  // result2 = lhs + rhs1 + {3, 1, -1, 5}
+  std::vector<std::thread> threads;
+  std::vector<bool> results(num_threads, true);
+  for (uint32_t t = 0; t < num_threads; t++)
+  {
+    threads.emplace_back([&, t]() {
+      for (uint32_t n = 0; n < num_requests; n++)
+      {
+        const float lhs[4] = {static_cast<float>(t), 0, static_cast<float>(n), 0};
+        const float rhs[4] = {1, -3, 2, -4};
+        float output[4] = {};
+        execution.run({lhs, rhs}, {output});
+
+        const float expected[4] = {t + 4.f, -2, n + 1.f, 1};
+        results[t] = results[t] && std::equal(output, output + 4, expected);
+      }
+    });
+  }
+  for (auto &&thread : threads)
+    thread.join();
+
+  for (uint32_t t = 0; t < num_threads; t++)
+    EXPECT_TRUE(results[t]);
+
+  const auto stats = execution.stats();
+  EXPECT_EQ(stats.num_requests, num_threads * num_requests);
+  EXPECT_LE(stats.num_batches, stats.num_requests);
+  EXPECT_GE(stats.num_batches * execution.maxBatchSize(), stats.num_requests);
+  EXPECT_LE(stats.max_queue_time_us, stats.total_queue_time_us);
+}
+
+TEST(ExecInstance, neg_batchExecution)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  EXPECT_ANY_THROW(onert::exec::BatchExecution(executors, 0, std::chrono::milliseconds{1}));
+
+  onert::exec::BatchExecution execution{executors, 2, std::chrono::milliseconds{1}};
+  const float input[4] = {};
+  float output[4] = {};
+  EXPECT_ANY_THROW(execution.run({input}, {output}));
+}
+
+TEST(ExecInstance, neg_zeroContexts)
+{
+  EXPECT_ANY_THROW(CompiledMockUpModel(0));
+}
+
+TEST(ExecInstance, state)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input2_buffer[4] = {1, -3, 2, -4};
+
+  // Output {1, 2, 2, 1} fills the state along axis 1 at once
+  onert::exec::Execution execution{executors};
+  execution.bindState(IOIndex{0}, IOIndex{0}, onert::exec::StateUpdate::APPEND, 1);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.execute();
+  EXPECT_EQ(execution.getStateLength(IOIndex{0}), 2);
+  EXPECT_ANY_THROW(execution.execute());
+
+  execution.resetStates();
+  EXPECT_EQ(execution.getStateLength(IOIndex{0}), 0);
+  execution.execute();
+  EXPECT_EQ(execution.getStateLength(IOIndex{0}), 2);
+
+  onert::exec::Execution rotation{executors};
+  rotation.bindState(IOIndex{0}, IOIndex{0}, onert::exec::StateUpdate::ROTATE, -3);
+  rotation.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  rotation.execute();
+  rotation.execute();
+  EXPECT_EQ(rotation.getStateLength(IOIndex{0}), 2);
+}
+
+TEST(ExecInstance, neg_state)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input_buffer[4] = {};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+  EXPECT_ANY_THROW(
+    execution.bindState(IOIndex{2}, IOIndex{0}, onert::exec::StateUpdate::REPLACE, 0));
+  EXPECT_ANY_THROW(
+    execution.bindState(IOIndex{0}, IOIndex{0}, onert::exec::StateUpdate::APPEND, 4));
+  EXPECT_ANY_THROW(execution.getStateLength(IOIndex{0}));
+
+  execution.bindState(IOIndex{0}, IOIndex{0}, onert::exec::StateUpdate::REPLACE, 0);
+  EXPECT_ANY_THROW(
+    execution.bindState(IOIndex{1}, IOIndex{0}, onert::exec::StateUpdate::REPLACE, 0));
+  EXPECT_ANY_THROW(execution.setInput(IOIndex{0}, input_buffer, 16));
+  EXPECT_ANY_THROW(execution.setOutput(IOIndex{0}, output_buffer, 16));
+}
+
 // Support asynchronous execution
 TEST(ExecInstance, async)
 {
@@ -455,6 +642,53 @@ TEST(ExecInstance, async)
   }
 }
 
+// Support asynchronous execution with completion callback
+TEST(ExecInstance, asyncCallback)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+
+  // Run several times to reuse persistent worker
+  for (int n = 0; n < 10; ++n)
+  {
+    std::fill(output_buffer, output_buffer + 4, 0.f);
+    bool called = false;
+    bool succeeded = false;
+    bool finished_in_callback = true;
+    execution.startExecute([&](std::exception_ptr error) {
+      called = true;
+      succeeded = (error == nullptr);
+      // Polling must not report finished until callback returns
+      finished_in_callback = execution.isFinished();
+    });
+    execution.waitFinish();
+
+    EXPECT_TRUE(called);
+    EXPECT_TRUE(succeeded);
+    EXPECT_FALSE(finished_in_callback);
+    EXPECT_TRUE(execution.isFinished());
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+}
+
 TEST(ExecInstance, multi_model_simple)
 {
   auto mockup = CompiledMockUpMultiModel();
@@ -597,6 +831,176 @@ TEST(ExecInstance, multi_model_async)
   }
 }
 
+TEST(ExecInstance, multi_model_copiedBytes)
+{
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {7, -5, 1, -7};
+
+  // Model1 is quantized: result0 (float -> uint8, 4 bytes), result1 (uint8 -> float, 16 bytes)
+  // Model1 is float: edges share buffers without copy
+  const std::vector<std::pair<DataType, size_t>> cases = {{DataType::QUANT_UINT8_ASYMM, 20},
+                                                          {DataType::FLOAT32, 0}};
+  for (const auto &c : cases)
+  {
+    auto mockup = CompiledMockUpMultiModel(c.first);
+    auto executors = mockup.artifact->_executors;
+    auto multi_model = std::dynamic_pointer_cast<onert::exec::MultiModelExecutors>(executors);
+    ASSERT_NE(multi_model, nullptr);
+
+    float output_buffer[4] = {};
+    onert::exec::Execution execution{executors};
+    execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+    execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+    execution.execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+    EXPECT_EQ(multi_model->copiedBytes(), c.second);
+  }
+}
+
+TEST(ExecInstance, multi_model_pipeline)
+{
+  auto mockup = CompiledMockUpMultiModel(DataType::FLOAT32);
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float output_expected[4] = {7, -5, 1, -7};
+  const uint32_t num_requests = 50;
+
+  onert::exec::PipelineExecution pipeline{executors, 2};
+  ASSERT_EQ(pipeline.stageCount(), 3u);
+
+  // Push and pop on different threads as the queues are bounded
+  std::thread pusher{[&]() {
+    float input2_buffer[4] = {1, -3, 2, -4};
+    for (uint32_t n = 0; n < num_requests; n++)
+    {
+      // Inputs are copied, so buffer can be updated for next request
+      input2_buffer[0] = 1 + n;
+      pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+    }
+    pipeline.finish();
+  }};
+
+  uint32_t popped = 0;
+  std::vector<void *> outputs;
+  while (pipeline.pop(outputs))
+  {
+    ASSERT_EQ(outputs.size(), 1u);
+    auto output_buffer = reinterpret_cast<float *>(outputs[0]);
+    // Requests are finished in order of push
+    EXPECT_EQ(output_buffer[0], output_expected[0] + 2 * popped);
+    for (auto i = 1; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+    free(outputs[0]);
+    outputs.clear();
+    popped++;
+  }
+  pusher.join();
+
+  ASSERT_EQ(popped, num_requests);
+}
+
+TEST(ExecInstance, multi_model_pipeline_edge_output)
+{
+  // result0 is package output and also read by Model1 and Model2
+  auto mockup = CompiledMockUpMultiModel(DataType::FLOAT32);
+  mockup.edges.pkg_outputs.emplace_back(ModelIndex{0}, SubgraphIndex{0}, IOIndex{0});
+  mockup.compile();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {7, -5, 1, -7};
+  const float result0_expected[4] = {2, -3, 1, -6};
+  const uint32_t num_requests = 8;
+
+  onert::exec::PipelineExecution pipeline{executors, 2};
+  ASSERT_EQ(pipeline.stageCount(), 3u);
+
+  std::thread pusher{[&]() {
+    for (uint32_t n = 0; n < num_requests; n++)
+      pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+    pipeline.finish();
+  }};
+
+  uint32_t popped = 0;
+  std::vector<void *> outputs;
+  while (pipeline.pop(outputs))
+  {
+    ASSERT_EQ(outputs.size(), 2u);
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(reinterpret_cast<float *>(outputs[0])[i], output_expected[i]);
+      EXPECT_EQ(reinterpret_cast<float *>(outputs[1])[i], result0_expected[i]);
+    }
+    for (auto &&output : outputs)
+      free(output);
+    outputs.clear();
+    popped++;
+  }
+  pusher.join();
+
+  ASSERT_EQ(popped, num_requests);
+}
+
+TEST(ExecInstance, pipeline_single_model)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::PipelineExecution pipeline{executors, 4};
+  ASSERT_EQ(pipeline.stageCount(), 1u);
+
+  for (auto n = 0; n < 4; n++)
+    pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+  pipeline.finish();
+  EXPECT_ANY_THROW(pipeline.push({input1_buffer, input2_buffer}, {16, 16}));
+
+  std::vector<void *> outputs;
+  for (auto n = 0; n < 4; n++)
+  {
+    ASSERT_TRUE(pipeline.pop(outputs));
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(reinterpret_cast<float *>(outputs[0])[i], output_expected[i]);
+    }
+    free(outputs[0]);
+    outputs.clear();
+  }
+  ASSERT_FALSE(pipeline.pop(outputs));
+}
+
+TEST(ExecInstance, neg_pipeline_quant_edge)
+{
+  auto mockup = CompiledMockUpMultiModel();
+  auto executors = mockup.artifact->_executors;
+
+  EXPECT_ANY_THROW(onert::exec::PipelineExecution(executors, 2));
+}
+
+TEST(ExecInstance, neg_pipeline_small_input)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input_buffer[4] = {};
+  onert::exec::PipelineExecution pipeline{executors, 2};
+  EXPECT_ANY_THROW(pipeline.push({input_buffer, input_buffer}, {16, 8}));
+  EXPECT_ANY_THROW(pipeline.push({input_buffer}, {16}));
+}
+
 TEST(ExecInstance, multi_model_dequant_input_quant_output)
 {
   auto mockup = CompiledMockUpMultiModel();
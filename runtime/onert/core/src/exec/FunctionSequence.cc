@@ -33,14 +33,16 @@ void FunctionSequence::run()
     // Thus, those two bakends cannot reach here.
 
     // Do dynamic shape inference
-    _dynamic_tensor_ctx->op->accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+    const auto &ctx = _dynamic_tensor_ctx;
+    const bool changed = ctx->dynamic_shape_inferer->infer(*ctx->op);
 
     for (const auto &function : _functions)
     {
       // NOTE the function could be also FunctionSequence so we do this
       // TODO Remove this or do this recursively
       auto *sub_func_seq = dynamic_cast<FunctionSequence *>(function.get());
-      if (sub_func_seq != nullptr)
+      // Nested FunctionSequence keeps the context while output shapes are reused from the cache
+      if (sub_func_seq != nullptr && (changed || sub_func_seq->dynamic_tensor_ctx() != ctx))
       {
         sub_func_seq->enableDynamicShapeInferer(true);
         sub_func_seq->dynamic_tensor_ctx(dynamic_tensor_ctx());
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_HOOK_FUNCTION_H__
+#define __ONERT_EXEC_HOOK_FUNCTION_H__
+
+#include "exec/IFunction.h"
+
+#include <functional>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Function wrapper to run hooks before and after the wrapped function
+ */
+class HookFunction : public IFunction
+{
+public:
+  HookFunction(IFunction *fn, const std::function<void()> &setup,
+               const std::function<void()> &teardown)
+    : _fn{fn}, _setup{setup}, _teardown{teardown}
+  {
+  }
+
+public:
+  void run() override
+  {
+    _setup();
+    _fn->run();
+    _teardown();
+  }
+
+private:
+  IFunction *_fn;
+  std::function<void()> _setup;
+  std::function<void()> _teardown;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_HOOK_FUNCTION_H__
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiContextExecutors.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace onert
+{
+namespace exec
+{
+
+MultiContextExecutors::MultiContextExecutors(std::vector<std::shared_ptr<IExecutors>> &&contexts)
+  : _contexts{std::move(contexts)}, _free_contexts{}, _mutex{}, _cv{}
+{
+  if (_contexts.empty())
+    throw std::runtime_error{"MultiContextExecutors: no execution context"};
+
+  for (const auto &context : _contexts)
+  {
+    assert(context != nullptr);
+    _free_contexts.push_back(context.get());
+  }
+}
+
+void MultiContextExecutors::emplace(const ir::ModelIndex &, const ir::SubgraphIndex &,
+                                    std::unique_ptr<IExecutor>)
+{
+  throw std::runtime_error{"MultiContextExecutors: executor should be emplaced to each context"};
+}
+
+// NOTE Graph and I/O information of all contexts are same, so the first context is used
+IExecutor *MultiContextExecutors::at(const ir::ModelIndex &model_index,
+                                     const ir::SubgraphIndex &subg_index) const
+{
+  return _contexts.front()->at(model_index, subg_index);
+}
+
+uint32_t MultiContextExecutors::inputSize() const { return _contexts.front()->inputSize(); }
+
+uint32_t MultiContextExecutors::outputSize() const { return _contexts.front()->outputSize(); }
+
+const ir::OperandInfo &MultiContextExecutors::inputInfo(const ir::IOIndex &index) const
+{
+  return _contexts.front()->inputInfo(index);
+}
+
+const ir::OperandInfo &MultiContextExecutors::outputInfo(const ir::IOIndex &index) const
+{
+  return _contexts.front()->outputInfo(index);
+}
+
+void MultiContextExecutors::execute(const IODescription &desc)
+{
+  auto context = acquire();
+  try
+  {
+    context->execute(desc);
+  }
+  catch (...)
+  {
+    release(context);
+    throw;
+  }
+  release(context);
+}
+
+IExecutors *MultiContextExecutors::acquire()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [this] { return !_free_contexts.empty(); });
+  auto context = _free_contexts.front();
+  _free_contexts.pop_front();
+  return context;
+}
+
+void MultiContextExecutors::release(IExecutors *context)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _free_contexts.push_back(context);
+  }
+  _cv.notify_one();
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MULTI_CONTEXT_EXECUTORS_H__
+#define __ONERT_EXEC_MULTI_CONTEXT_EXECUTORS_H__
+
+#include "exec/IExecutors.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to gather several execution contexts of one compiled model
+ *
+ * Each context is a complete executor set with its own activation memory and I/O tensors.
+ * Constant operand data is shared between contexts, so only activations are duplicated.
+ * Each execution takes a free context, so up to the number of contexts can run in parallel.
+ */
+class MultiContextExecutors : public IExecutors
+{
+public:
+  /**
+   * @brief     Construct a new MultiContextExecutors object
+   * @param[in] contexts  Executor sets compiled from the same model
+   */
+  MultiContextExecutors(std::vector<std::shared_ptr<IExecutors>> &&contexts);
+  MultiContextExecutors(const MultiContextExecutors &) = delete;
+  MultiContextExecutors(MultiContextExecutors &&) = delete;
+
+  /**
+   * @brief Destroy the MultiContextExecutors object
+   */
+  ~MultiContextExecutors() = default;
+
+public:
+  void emplace(const ir::ModelIndex &model_index, const ir::SubgraphIndex &subg_index,
+               std::unique_ptr<IExecutor> exec) override;
+
+  IExecutor *at(const ir::ModelIndex &model_index,
+                const ir::SubgraphIndex &subg_index) const override;
+
+  uint32_t inputSize() const override;
+
+  uint32_t outputSize() const override;
+
+  const ir::OperandInfo &inputInfo(const ir::IOIndex &index) const override;
+
+  const ir::OperandInfo &outputInfo(const ir::IOIndex &index) const override;
+
+  void execute(const IODescription &desc) override;
+
+  /**
+   * @brief   Return the number of execution contexts
+   * @return  Number of contexts
+   */
+  uint32_t contextSize() const { return _contexts.size(); }
+
+private:
+  IExecutors *acquire();
+  void release(IExecutors *context);
+
+private:
+  std::vector<std::shared_ptr<IExecutors>> _contexts;
+  std::deque<IExecutors *> _free_contexts;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MULTI_CONTEXT_EXECUTORS_H__
@@ -16,7 +16,12 @@
 
 #include "MultiModelExecutors.h"
 
+#include "../backend/basic/MemoryPlannerFactory.h"
 #include "../backend/builtin/IOTensor.h"
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <algorithm>
 
 namespace
 {
@@ -82,6 +87,9 @@ public:
     setUserTensor(_buffer.get(), total_size);
   }
 
+  // Set buffer planned with other edge tensors, which is not managed by reference count
+  void set_buffer(uint8_t *buffer) { setUserTensor(buffer, orig_info().total_size()); }
+
   void increase_ref() { _ref_count++; }
 
   void decrease_ref()
@@ -140,6 +148,22 @@ const ir::OperandInfo &MultiModelExecutors::outputInfo(const ir::IOIndex &index)
 // Allow below edges only
 //  m1 < m2, s1 == 0 and s2 == 0 if m1:s1:o1 -> m2:s2:o2'
 void MultiModelExecutors::checkSupportedMultimodel() const
+{
+  checkSupportedEdges();
+
+  // Check whether nnpkg outputs and Edge `from` are duplicated
+  for (const auto &edge : _model_edges->edges)
+  {
+    if (std::find(_model_edges->pkg_outputs.begin(), _model_edges->pkg_outputs.end(), edge.from) !=
+        _model_edges->pkg_outputs.end())
+    {
+      throw std::runtime_error{"Multi model execution does not support duplicating nnpkg outputs "
+                               "with `from` of edges yet"};
+    }
+  }
+}
+
+void MultiModelExecutors::checkSupportedEdges() const
 {
   // If package includes no-connection model, model_count is less than real model count in package.
   // Then this method will throw exception based on model index
@@ -187,17 +211,6 @@ void MultiModelExecutors::checkSupportedMultimodel() const
         throw std::runtime_error{"Cannot find 1st model's input buffer"};
     }
   }
-
-  // Check whether nnpkg outputs and Edge `from` are duplicated
-  for (const auto &edge : _model_edges->edges)
-  {
-    if (std::find(_model_edges->pkg_outputs.begin(), _model_edges->pkg_outputs.end(), edge.from) !=
-        _model_edges->pkg_outputs.end())
-    {
-      throw std::runtime_error{"Multi model execution does not support duplicating nnpkg outputs "
-                               "with `from` of edges yet"};
-    }
-  }
 }
 
 void MultiModelExecutors::createEdgeQuantLayers()
@@ -250,13 +263,26 @@ void MultiModelExecutors::createEdgeQuantLayers()
           const auto to_executor = _executors.at({to_model_index, to_subg_index}).get();
           const auto to_tensor = to_executor->getInputTensors().at(to_io_index.value());
 
-          // TODO Unify tensors with the same `from` tensor and same type
           if (from_tensor->data_type() != to_tensor->data_type())
           {
             assert(inputs.size() == outputs.size());
             const auto &to_info =
               to_executor->getInputTensors().at(to_io_index.value())->orig_info();
             const auto to_layout = to_tensor->orig_layout();
+
+            // Share tensor with other `to` which needs the same type from the same `from`
+            auto shared = std::find_if(to_list.begin(), to_list.end(), [&](const ir::IODesc &to) {
+              auto it = _edge_quant_tensors.find(to);
+              return it != _edge_quant_tensors.end() &&
+                     it->second->orig_info().typeInfo() == to_info.typeInfo() &&
+                     it->second->orig_layout() == to_layout;
+            });
+            if (shared != to_list.end())
+            {
+              _edge_quant_tensors[to_iodesc] = _edge_quant_tensors.at(*shared);
+              continue;
+            }
+
             inputs.emplace_back(from_tensor);
 
             auto type_aware_quant_tensor = std::make_unique<EdgeTensor>(to_info, to_layout);
@@ -273,9 +299,78 @@ void MultiModelExecutors::createEdgeQuantLayers()
     _edge_quant_layers[{model_index, subg_index}] = std::move(layer);
   }
 
+  planEdgeTensors();
+
   _is_created_edge_quant_layers = true;
 }
 
+// Buffers of edges are planned once instead of being allocated for each execution.
+// Models are executed in order of model index, so lifetime of each buffer is the range of model
+// index from the model which writes it to the last model which reads it.
+void MultiModelExecutors::planEdgeTensors()
+{
+  std::vector<EdgeTensor *> tensors;
+  std::unordered_map<EdgeTensor *, std::pair<uint16_t, uint16_t>> lifetimes;
+  auto extend_lifetime = [&](EdgeTensor *tensor, uint16_t first, uint16_t last) {
+    auto it = lifetimes.find(tensor);
+    if (it == lifetimes.end())
+    {
+      tensors.emplace_back(tensor);
+      lifetimes.emplace(tensor, std::make_pair(first, last));
+      return;
+    }
+    it->second.first = std::min(it->second.first, first);
+    it->second.second = std::max(it->second.second, last);
+  };
+
+  for (const auto &pair : _edge_map)
+  {
+    const auto &from_iodesc = pair.first;
+    const auto from_model = std::get<ir::ModelIndex>(from_iodesc).value();
+
+    // Edge tensor is used by quantization layer of `from` model at least
+    uint16_t last = from_model;
+    for (const auto &to_iodesc : pair.second)
+    {
+      const auto to_model = std::get<ir::ModelIndex>(to_iodesc).value();
+      auto it = _edge_quant_tensors.find(to_iodesc);
+      if (it == _edge_quant_tensors.end())
+        last = std::max(last, to_model);
+      else
+        extend_lifetime(it->second.get(), from_model, to_model);
+    }
+    extend_lifetime(_edge_tensors.at(from_iodesc).get(), from_model, last);
+  }
+
+  std::unique_ptr<backend::basic::IMemoryPlanner<ir::OperandIndex>> planner{
+    backend::basic::MemoryPlannerFactory::get().create(
+      util::getConfigString(util::config::CPU_MEMORY_PLANNER))};
+  for (uint16_t model = 0; model < modelCount(); model++)
+  {
+    for (uint32_t i = 0; i < tensors.size(); i++)
+    {
+      if (lifetimes.at(tensors[i]).first == model)
+        planner->claim(ir::OperandIndex{i}, tensors[i]->orig_info().total_size());
+    }
+    for (uint32_t i = 0; i < tensors.size(); i++)
+    {
+      if (lifetimes.at(tensors[i]).second == model)
+        planner->release(ir::OperandIndex{i});
+    }
+  }
+
+  _edge_allocator = std::make_unique<backend::basic::Allocator>(planner->capacity());
+  for (uint32_t i = 0; i < tensors.size(); i++)
+  {
+    const auto &block = planner->memory_plans().at(ir::OperandIndex{i});
+    tensors[i]->set_buffer(_edge_allocator->base() + block.offset);
+  }
+
+  VERBOSE(MultiModelExecutors) << "Edge tensors: " << tensors.size()
+                               << ", planned memory: " << planner->capacity() << " bytes"
+                               << std::endl;
+}
+
 void MultiModelExecutors::CreatePkgIOTensors(const IODescription &desc)
 {
   for (const auto &pkg_input : _model_edges->pkg_inputs)
@@ -436,6 +531,8 @@ void MultiModelExecutors::execute(const IODescription &desc)
     throw std::runtime_error{"Cannot find edge for model input"};
   };
 
+  _copied_bytes = 0;
+
   // Execute each model
   // NOTE May be better to use vector instead of unordered_map for _executors
   for (auto model_index = ir::ModelIndex{0}; model_index.value() < model_count; model_index++)
@@ -455,7 +552,6 @@ void MultiModelExecutors::execute(const IODescription &desc)
     outputs_inter.resize(output_size);
 
     // Set inputs of executor
-    // TODO Create layer to allocate/deallocate buffers of EdgeTensor for each executor
     for (uint32_t i = 0; i < input_size; i++)
     {
       const auto input_pkg_index = find_input_index(_model_edges->pkg_inputs, model_index,
@@ -484,18 +580,15 @@ void MultiModelExecutors::execute(const IODescription &desc)
       else
       {
         auto from_iodesc = find_from(model_index, ir::SubgraphIndex{0}, ir::IOIndex{i});
-        const auto &from_model_index = std::get<ir::ModelIndex>(from_iodesc);
-        const auto &from_subg_index = std::get<ir::SubgraphIndex>(from_iodesc);
-        const auto &from_ioindex = std::get<ir::IOIndex>(from_iodesc).value();
 
         // Supported only sequantial execution of models
-        assert(from_model_index.value() < model_index.value());
-        assert(from_subg_index.value() == 0);
-        const auto from_executor = _executors.at({from_model_index, from_subg_index}).get();
+        assert(std::get<ir::ModelIndex>(from_iodesc).value() < model_index.value());
+        assert(std::get<ir::SubgraphIndex>(from_iodesc).value() == 0);
         const auto to_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
         if (_edge_quant_tensors.find(to_iodesc) == _edge_quant_tensors.end())
         {
-          inputs_inter[i] = from_executor->getOutputTensors().at(from_ioindex);
+          // Read the buffer written by `from` executor directly
+          inputs_inter[i] = _edge_tensors.at(from_iodesc).get();
         }
         else
         {
@@ -532,102 +625,46 @@ void MultiModelExecutors::execute(const IODescription &desc)
       }
       else
       {
-        // Allocate buffer of `from` tensors
-        const auto from_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
-        _edge_tensors[from_iodesc]->allocate_buffer();
-        outputs_inter[i] = _edge_tensors[from_iodesc].get();
-
-        // Allocate buffer of tensors for type-aware quantization
-        for (const auto &to_iodesc : _edge_map[from_iodesc])
-        {
-          _edge_tensors[from_iodesc]->increase_ref();
-          if (_edge_quant_tensors.find(to_iodesc) != _edge_quant_tensors.end())
-          {
-            auto type_aware_quant_tensor = _edge_quant_tensors.at(to_iodesc).get();
-            type_aware_quant_tensor->allocate_buffer();
-
-            _edge_tensors[from_iodesc]->decrease_ref();
-          }
-        }
+        // Buffer of `from` tensor is planned in advance
+        outputs_inter[i] = _edge_tensors.at(output_io_desc).get();
       }
     }
 
-    _pkg_input_quant_layers[{model_index, ir::SubgraphIndex{0}}]->run();
+    const auto executor_index = std::make_pair(model_index, ir::SubgraphIndex{0});
+    const auto &pkg_input_layer = _pkg_input_quant_layers.at(executor_index);
+    const auto &edge_layer = _edge_quant_layers.at(executor_index);
+    const auto &pkg_output_layer = _pkg_output_quant_layers.at(executor_index);
+
+    pkg_input_layer->run();
 
     executor->execute(inputs_inter, outputs_inter);
 
-    _edge_quant_layers[{model_index, ir::SubgraphIndex{0}}]->run();
-    _pkg_output_quant_layers[{model_index, ir::SubgraphIndex{0}}]->run();
+    edge_layer->run();
+    pkg_output_layer->run();
+
+    _copied_bytes +=
+      pkg_input_layer->copiedBytes() + edge_layer->copiedBytes() + pkg_output_layer->copiedBytes();
 
-    // Release input buffers that are no longer needed
+    // Release buffers of type-aware quantization for nnpkg inputs/outputs
     for (uint32_t i = 0; i < input_size; i++)
     {
-      const auto input_pkg_index = find_input_index(_model_edges->pkg_inputs, model_index,
-                                                    ir::SubgraphIndex{0}, ir::IOIndex{i});
-
       const auto to_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
-      if (input_pkg_index == -1)
+      if (_pkg_input_quant_tensors.find(to_iodesc) != _pkg_input_quant_tensors.end())
       {
-        if (_edge_quant_tensors.find(to_iodesc) != _edge_quant_tensors.end())
-        {
-          // Decrease reference count of tensor for type-aware quantization if input tensor is the
-          // tensor
-          const auto to_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
-          if (_edge_quant_tensors.find(to_iodesc) != _edge_quant_tensors.end())
-          {
-            _edge_quant_tensors[to_iodesc]->decrease_ref();
-          }
-        }
-        else
-        {
-          // Decrease reference count of `from` tensor if input tensor is the `from` tensor
-          const auto from_iodesc = find_from(model_index, ir::SubgraphIndex{0}, ir::IOIndex{i});
-          _edge_tensors[from_iodesc]->decrease_ref();
-
-          // Decrease reference count of nnpkg inputs
-          if (_pkg_input_quant_tensors.find(to_iodesc) != _pkg_input_quant_tensors.end())
-          {
-            _pkg_input_quant_tensors[to_iodesc]->decrease_ref();
-          }
-        }
+        _pkg_input_quant_tensors[to_iodesc]->decrease_ref();
       }
     }
-
-    // Release output buffers if those buffers are no longer used other executors because of
-    // type-aware quantization
-    // FIXME if tensors for type-aware quantization unified for the same `from` tensor and same type
     for (uint32_t i = 0; i < output_size; i++)
     {
-      auto from_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
-
-      // Check if other executors will use the buffer of edge tensor
-      const auto &to_list = _edge_map[from_iodesc];
-      if (to_list.size() == 0)
-      {
-        // This condition means `from_iodesc` tensor is an output of nnpkg
-        continue;
-      }
-
-      bool to_be_release =
-        !std::any_of(to_list.begin(), to_list.end(), [&](const ir::IODesc &to_iodesc) {
-          // This condition means another executor uses the buffer of edge tensor
-          return _edge_quant_tensors.find(to_iodesc) == _edge_quant_tensors.end();
-        });
-
-      if (to_be_release)
-      {
-        // This edge tensor's buffer won't be used in other executors
-        // Tensors for type-aware quantization take over the role of this edge tensor instead
-        _edge_tensors[from_iodesc]->decrease_ref();
-      }
-
-      // Decrease reference count of nnpkg outputs
+      const auto from_iodesc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
       if (_pkg_output_quant_tensors.find(from_iodesc) != _pkg_output_quant_tensors.end())
       {
         _pkg_output_quant_tensors[from_iodesc]->decrease_ref();
       }
     }
   }
+
+  VERBOSE(MultiModelExecutors) << "Copied bytes: " << _copied_bytes << std::endl;
 }
 
 // modelCount() iterates _executors.
@@ -17,9 +17,11 @@
 #ifndef __ONERT_EXEC_EXECUTORS_H__
 #define __ONERT_EXEC_EXECUTORS_H__
 
+#include "backend/basic/Allocator.h"
 #include "exec/IExecutors.h"
 #include "ir/NNPkg.h"
 #include "IPermuteFunction.h"
+#include "../backend/builtin/IOTensor.h"
 
 namespace std
 {
@@ -51,7 +53,8 @@ public:
     : _executors{}, _model_edges{std::move(model_edges)}, _edge_quant_layers{},
       _edge_quant_tensors{}, _edge_tensors{}, _is_created_edge_quant_layers{false},
       _pkg_input_quant_layers{}, _pkg_output_quant_layers{}, _pkg_input_quant_tensors{},
-      _pkg_output_quant_tensors{}, _pkg_input_tensors{}, _pkg_output_tensors{}
+      _pkg_output_quant_tensors{}, _pkg_input_tensors{}, _pkg_output_tensors{},
+      _edge_allocator{nullptr}, _copied_bytes{0}
   {
     for (const auto &edge : _model_edges->edges)
     {
@@ -79,12 +82,26 @@ public:
 
   void execute(const IODescription &desc) override;
 
-private:
+  const ir::ModelEdges &modelEdges() const { return *_model_edges; }
   void checkSupportedMultimodel() const;
+  /**
+   * @brief Check edges and inputs of package without rejecting nnpkg outputs which are also
+   *        `from` of edges
+   */
+  void checkSupportedEdges() const;
+  uint16_t modelCount() const;
+
+  /**
+   * @brief   Get bytes copied by type-aware quantization layers in the last execution
+   * @return  Number of bytes
+   */
+  size_t copiedBytes() const { return _copied_bytes; }
+
+private:
   void createEdgeQuantLayers();
+  void planEdgeTensors();
   void CreatePkgIOTensors(const IODescription &desc);
   void createPkgIOQuantLayers(const IODescription &desc);
-  uint16_t modelCount() const;
 
 private:
   // TODO Remove this class
@@ -100,6 +117,14 @@ private:
     }
     virtual ~PermuteLayer() {}
     void optimize() override {}
+
+    size_t copiedBytes() const
+    {
+      size_t bytes = 0;
+      for (const auto &dst : _dst_tensors)
+        bytes += dst->total_size();
+      return bytes;
+    }
   };
 
   class EdgeTensor;
@@ -128,7 +153,7 @@ private:
   //
   // Q: Why is Key `to` IODesc
   // A: these tensors are currently created depending on the type of `to`
-  // TODO Unify tensors with the same `from` tensor and same type
+  // NOTE Tensors with the same `from` tensor and same type are shared.
   // NOTE The incomplete type 'EdgeTensor' cannot be declared as unique_ptr.
   std::unordered_map<ir::IODesc, std::shared_ptr<EdgeTensor>> _edge_quant_tensors;
 
@@ -160,6 +185,14 @@ private:
   // IOTensors for user buffer
   std::unordered_map<ir::IODesc, std::unique_ptr<backend::builtin::IOTensor>> _pkg_input_tensors;
   std::unordered_map<ir::IODesc, std::unique_ptr<backend::builtin::IOTensor>> _pkg_output_tensors;
+
+  /**
+   * @brief Memory shared by edge tensors and tensors for type-aware quantization of edges
+   *        Buffers are planned by lifetime in order of model execution
+   */
+  std::unique_ptr<backend::basic::Allocator> _edge_allocator;
+  // Bytes copied by type-aware quantization layers in the last execution
+  size_t _copied_bytes;
 };
 
 } // namespace exec
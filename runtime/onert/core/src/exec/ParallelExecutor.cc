@@ -15,40 +15,17 @@
  */
 
 #include "ParallelExecutor.h"
+#include "HookFunction.h"
 
 #include <cassert>
 
 #include "util/logging.h"
-#include "exec/IFunction.h"
 
 namespace onert
 {
 namespace exec
 {
 
-class HookFunction : public IFunction
-{
-public:
-  HookFunction(IFunction *fn, const std::function<void()> &setup,
-               const std::function<void()> &teardown)
-    : _fn{fn}, _setup{setup}, _teardown{teardown}
-  {
-  }
-
-public:
-  void run() override
-  {
-    _setup();
-    _fn->run();
-    _teardown();
-  }
-
-private:
-  IFunction *_fn;
-  std::function<void()> _setup;
-  std::function<void()> _teardown;
-};
-
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
   std::unique_lock<std::mutex> lock{_mu_jobs};
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineExecution.h"
+
+#include "MultiModelExecutors.h"
+#include "../backend/builtin/IOTensor.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace onert
+{
+namespace exec
+{
+
+struct PipelineExecution::Request
+{
+  ~Request()
+  {
+    // Outputs are not handed over to user
+    for (auto &&output : outputs)
+      std::free(output);
+  }
+
+  struct Edge
+  {
+    // nullptr if edge is also package output and shares its buffer
+    std::unique_ptr<uint8_t[]> owned;
+    uint8_t *buffer;
+    size_t size;
+  };
+
+  std::vector<std::unique_ptr<uint8_t[]>> inputs;
+  std::vector<void *> outputs;
+  // Buffers of edges between stages, Key: `from` IODesc
+  std::unordered_map<ir::IODesc, Edge> edges;
+  std::exception_ptr error;
+};
+
+struct PipelineExecution::Stage
+{
+  ir::ModelIndex model_index;
+  IExecutor *executor;
+  // IOTensors to set buffers of each request
+  std::vector<std::unique_ptr<backend::builtin::IOTensor>> inputs;
+  std::vector<std::unique_ptr<backend::builtin::IOTensor>> outputs;
+  std::vector<backend::IPortableTensor *> input_ptrs;
+  std::vector<backend::IPortableTensor *> output_ptrs;
+  // Package I/O index of each executor I/O, -1 if it is connected to edge
+  std::vector<int32_t> input_pkg_indices;
+  std::vector<int32_t> output_pkg_indices;
+  // Whether each executor output is read by next stages
+  std::vector<bool> output_is_edge;
+  // `from` of edge connected to each executor input
+  std::vector<ir::IODesc> input_froms;
+  // Edges which are not used after this stage
+  std::vector<ir::IODesc> releasing_edges;
+};
+
+/**
+ * @brief Pool of edge buffers reused by requests
+ * @note  Edge buffers are fully written by executor, so they are not initialized
+ */
+class PipelineExecution::BufferPool
+{
+public:
+  std::unique_ptr<uint8_t[]> acquire(size_t size)
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      auto it = _buffers.find(size);
+      if (it != _buffers.end() && !it->second.empty())
+      {
+        auto buffer = std::move(it->second.back());
+        it->second.pop_back();
+        return buffer;
+      }
+    }
+    return std::unique_ptr<uint8_t[]>{new uint8_t[size]};
+  }
+
+  void release(size_t size, std::unique_ptr<uint8_t[]> &&buffer)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _buffers[size].emplace_back(std::move(buffer));
+  }
+
+private:
+  std::mutex _mutex;
+  std::unordered_map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> _buffers;
+};
+
+/**
+ * @brief Bounded queue of requests between stages
+ */
+class PipelineExecution::RequestQueue
+{
+public:
+  RequestQueue(uint32_t capacity) : _capacity{capacity}, _closed{false} {}
+
+  /**
+   * @brief Push a request, blocks while queue is full
+   * @return @c false if queue is closed
+   */
+  bool push(std::unique_ptr<Request> &&request)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv_space.wait(lock, [this] { return _closed || _requests.size() < _capacity; });
+      if (_closed)
+        return false;
+      _requests.emplace_back(std::move(request));
+    }
+    _cv_requests.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Pop a request, blocks while queue is empty
+   * @return @c nullptr if queue is closed and empty
+   */
+  std::unique_ptr<Request> pop()
+  {
+    std::unique_ptr<Request> request;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv_requests.wait(lock, [this] { return _closed || !_requests.empty(); });
+      if (_requests.empty())
+        return nullptr;
+      request = std::move(_requests.front());
+      _requests.pop_front();
+    }
+    _cv_space.notify_one();
+    return request;
+  }
+
+  void close()
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _closed = true;
+    }
+    _cv_requests.notify_all();
+    _cv_space.notify_all();
+  }
+
+private:
+  const uint32_t _capacity;
+  bool _closed;
+  std::deque<std::unique_ptr<Request>> _requests;
+  std::mutex _mutex;
+  std::condition_variable _cv_requests;
+  std::condition_variable _cv_space;
+};
+
+PipelineExecution::PipelineExecution(const std::shared_ptr<IExecutors> &executors,
+                                     uint32_t queue_size)
+  : _executors{executors}, _input_sizes{}, _output_sizes{}, _stages{},
+    _edge_pool{std::make_unique<BufferPool>()}, _queues{}, _workers{}
+{
+  assert(_executors != nullptr);
+  if (queue_size < 1)
+    throw std::runtime_error{"PipelineExecution: queue size should be greater than 0"};
+
+  for (uint32_t i = 0; i < _executors->inputSize(); i++)
+  {
+    const auto &info = _executors->inputInfo(ir::IOIndex{i});
+    if (info.isDynamic())
+      throw std::runtime_error{"PipelineExecution: dynamic input is not supported"};
+    _input_sizes.emplace_back(info.total_size());
+  }
+  for (uint32_t i = 0; i < _executors->outputSize(); i++)
+  {
+    const auto &info = _executors->outputInfo(ir::IOIndex{i});
+    if (info.isDynamic())
+      throw std::runtime_error{"PipelineExecution: dynamic output is not supported"};
+    _output_sizes.emplace_back(info.total_size());
+  }
+
+  // Single model package is regarded as multi model package which has one model
+  ir::ModelEdges single_model_edges;
+  const ir::ModelEdges *model_edges = &single_model_edges;
+  uint16_t model_count = 1;
+  if (auto multi_model = dynamic_cast<MultiModelExecutors *>(_executors.get()))
+  {
+    // Package output can be `from` of edges as it is written before next stages read it
+    multi_model->checkSupportedEdges();
+    model_edges = &multi_model->modelEdges();
+    model_count = multi_model->modelCount();
+  }
+  else
+  {
+    for (uint32_t i = 0; i < _executors->inputSize(); i++)
+      single_model_edges.pkg_inputs.emplace_back(ir::ModelIndex{0}, ir::SubgraphIndex{0},
+                                                 ir::IOIndex{i});
+    for (uint32_t i = 0; i < _executors->outputSize(); i++)
+      single_model_edges.pkg_outputs.emplace_back(ir::ModelIndex{0}, ir::SubgraphIndex{0},
+                                                  ir::IOIndex{i});
+  }
+
+  auto find_pkg_index = [](const std::vector<ir::IODesc> &pkg_ios, const ir::IODesc &desc) {
+    auto it = std::find(pkg_ios.begin(), pkg_ios.end(), desc);
+    return it == pkg_ios.end() ? -1 : static_cast<int32_t>(it - pkg_ios.begin());
+  };
+
+  // The last stage which uses each edge
+  std::unordered_map<ir::IODesc, ir::ModelIndex> last_users;
+  for (const auto &edge : model_edges->edges)
+  {
+    const auto &to_model = std::get<ir::ModelIndex>(edge.to);
+    auto it = last_users.find(edge.from);
+    if (it == last_users.end() || it->second.value() < to_model.value())
+      last_users[edge.from] = to_model;
+  }
+
+  for (auto model_index = ir::ModelIndex{0}; model_index.value() < model_count; model_index++)
+  {
+    auto stage = std::make_unique<Stage>();
+    stage->model_index = model_index;
+    stage->executor = _executors->at(model_index, ir::SubgraphIndex{0});
+
+    const auto &input_tensors = stage->executor->getInputTensors();
+    for (uint32_t i = 0; i < input_tensors.size(); i++)
+    {
+      const auto &info = input_tensors[i]->orig_info();
+      stage->inputs.emplace_back(
+        std::make_unique<backend::builtin::IOTensor>(info, input_tensors[i]->orig_layout()));
+      stage->input_ptrs.emplace_back(stage->inputs.back().get());
+
+      const auto to = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      const auto pkg_index = find_pkg_index(model_edges->pkg_inputs, to);
+      stage->input_pkg_indices.emplace_back(pkg_index);
+      if (pkg_index != -1)
+      {
+        stage->input_froms.emplace_back();
+        continue;
+      }
+
+      auto edge = std::find_if(model_edges->edges.begin(), model_edges->edges.end(),
+                               [&](const ir::ModelEdge &edge) { return edge.to == to; });
+      if (edge == model_edges->edges.end())
+        throw std::runtime_error{"PipelineExecution: cannot find edge for model input"};
+
+      const auto &from = edge->from;
+      const auto from_executor =
+        _executors->at(std::get<ir::ModelIndex>(from), std::get<ir::SubgraphIndex>(from));
+      const auto &from_info =
+        from_executor->getOutputTensors().at(std::get<ir::IOIndex>(from).value())->orig_info();
+      // TODO Support type-aware quantization of edges
+      if (from_info.typeInfo().type() != info.typeInfo().type())
+        throw std::runtime_error{"PipelineExecution: type-aware quantization of edges is not "
+                                 "supported yet"};
+      if (from_info.isDynamic() || info.isDynamic())
+        throw std::runtime_error{"PipelineExecution: dynamic edge is not supported"};
+      stage->input_froms.emplace_back(from);
+    }
+
+    const auto &output_tensors = stage->executor->getOutputTensors();
+    for (uint32_t i = 0; i < output_tensors.size(); i++)
+    {
+      const auto &info = output_tensors[i]->orig_info();
+      stage->outputs.emplace_back(
+        std::make_unique<backend::builtin::IOTensor>(info, output_tensors[i]->orig_layout()));
+      stage->output_ptrs.emplace_back(stage->outputs.back().get());
+
+      const auto from = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      const auto pkg_index = find_pkg_index(model_edges->pkg_outputs, from);
+      stage->output_pkg_indices.emplace_back(pkg_index);
+      const bool is_edge = last_users.find(from) != last_users.end();
+      stage->output_is_edge.emplace_back(is_edge);
+      // Output which is not used by any stage is released right after execution
+      if (pkg_index == -1 && !is_edge)
+        stage->releasing_edges.emplace_back(from);
+    }
+
+    _stages.emplace_back(std::move(stage));
+  }
+
+  for (const auto &pair : last_users)
+    _stages.at(pair.second.value())->releasing_edges.emplace_back(pair.first);
+
+  for (uint32_t i = 0; i <= _stages.size(); i++)
+    _queues.emplace_back(std::make_unique<RequestQueue>(queue_size));
+
+  for (uint32_t i = 0; i < _stages.size(); i++)
+    _workers.emplace_back(&PipelineExecution::work, this, i);
+}
+
+PipelineExecution::~PipelineExecution()
+{
+  finish();
+
+  // Discard outputs which are not popped
+  while (_queues.back()->pop())
+    ;
+
+  for (auto &&worker : _workers)
+    worker.join();
+}
+
+void PipelineExecution::push(const std::vector<const void *> &inputs,
+                             const std::vector<size_t> &lengths)
+{
+  if (inputs.size() != _input_sizes.size() || lengths.size() != _input_sizes.size())
+    throw std::runtime_error{"PipelineExecution: invalid number of inputs"};
+
+  auto request = std::make_unique<Request>();
+  for (uint32_t i = 0; i < _input_sizes.size(); i++)
+  {
+    if (lengths[i] < _input_sizes[i])
+      throw std::runtime_error{"PipelineExecution: too small input buffer"};
+    // Not initialized as it is overwritten right after
+    request->inputs.emplace_back(new uint8_t[_input_sizes[i]]);
+    std::memcpy(request->inputs.back().get(), inputs[i], _input_sizes[i]);
+  }
+  for (const auto size : _output_sizes)
+  {
+    // Avoid nullptr for zero-sized output
+    auto output = std::malloc(std::max<size_t>(size, 1));
+    if (output == nullptr)
+      throw std::bad_alloc{};
+    request->outputs.emplace_back(output);
+  }
+
+  if (!_queues.front()->push(std::move(request)))
+    throw std::runtime_error{"PipelineExecution: pipeline is already finished"};
+}
+
+bool PipelineExecution::pop(std::vector<void *> &outputs)
+{
+  auto request = _queues.back()->pop();
+  if (request == nullptr)
+    return false;
+
+  if (request->error)
+    std::rethrow_exception(request->error);
+
+  outputs.insert(outputs.end(), request->outputs.begin(), request->outputs.end());
+  request->outputs.clear();
+  return true;
+}
+
+void PipelineExecution::finish() { _queues.front()->close(); }
+
+void PipelineExecution::work(uint32_t stage_index)
+{
+  auto &stage = *_stages.at(stage_index);
+  auto &in_queue = *_queues.at(stage_index);
+  auto &out_queue = *_queues.at(stage_index + 1);
+
+  while (auto request = in_queue.pop())
+  {
+    // Skip the request if previous stage failed
+    if (!request->error)
+    {
+      try
+      {
+        runStage(stage, *request);
+      }
+      catch (...)
+      {
+        request->error = std::current_exception();
+      }
+    }
+
+    if (!out_queue.push(std::move(request)))
+      break;
+  }
+
+  out_queue.close();
+}
+
+void PipelineExecution::runStage(Stage &stage, Request &request)
+{
+  for (uint32_t i = 0; i < stage.inputs.size(); i++)
+  {
+    const auto size = stage.inputs[i]->orig_info().total_size();
+    const auto pkg_index = stage.input_pkg_indices[i];
+    uint8_t *buffer = pkg_index != -1 ? request.inputs[pkg_index].get()
+                                      : request.edges.at(stage.input_froms[i]).buffer;
+    stage.inputs[i]->setUserTensor(buffer, size);
+  }
+
+  for (uint32_t i = 0; i < stage.outputs.size(); i++)
+  {
+    const auto size = stage.outputs[i]->orig_info().total_size();
+    const auto pkg_index = stage.output_pkg_indices[i];
+    const auto from = ir::IODesc{stage.model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+    uint8_t *buffer = nullptr;
+    if (pkg_index != -1)
+    {
+      buffer = reinterpret_cast<uint8_t *>(request.outputs[pkg_index]);
+      // Next stages read package output buffer directly
+      if (stage.output_is_edge[i])
+        request.edges[from] = Request::Edge{nullptr, buffer, size};
+    }
+    else
+    {
+      // Executor writes edge into the buffer which is read by next stages directly
+      auto owned = _edge_pool->acquire(size);
+      buffer = owned.get();
+      request.edges[from] = Request::Edge{std::move(owned), buffer, size};
+    }
+    stage.outputs[i]->setUserTensor(buffer, size);
+  }
+
+  stage.executor->execute(stage.input_ptrs, stage.output_ptrs);
+
+  for (const auto &from : stage.releasing_edges)
+  {
+    auto it = request.edges.find(from);
+    if (it == request.edges.end())
+      continue;
+    if (it->second.owned)
+      _edge_pool->release(it->second.size, std::move(it->second.owned));
+    request.edges.erase(it);
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/StateTensor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace onert
+{
+namespace exec
+{
+
+StateTensor::StateTensor(const ir::OperandInfo &info, StateUpdate update, int32_t axis)
+  : _info{info}, _update{update}, _axis{axis}
+{
+  const auto &shape = _info.shape();
+  if (shape.hasUnspecifiedDims())
+    throw std::runtime_error{"StateTensor: Shape of state should be specified"};
+
+  if (_update != StateUpdate::REPLACE)
+  {
+    const auto rank = shape.rank();
+    if (_axis < 0)
+      _axis += rank;
+    if (_axis < 0 || _axis >= rank)
+      throw std::runtime_error{"StateTensor: Invalid axis " + std::to_string(axis)};
+  }
+
+  _state.resize(_info.total_size(), 0);
+  _output.resize(_info.total_size(), 0);
+}
+
+void StateTensor::update(const ir::Shape &shape)
+{
+  const auto &state_shape = _info.shape();
+  if (_update == StateUpdate::REPLACE)
+  {
+    if (shape != state_shape)
+      throw std::runtime_error{"StateTensor: Output shape is different from state"};
+    std::memcpy(_state.data(), _output.data(), _state.size());
+    return;
+  }
+
+  if (shape.rank() != state_shape.rank())
+    throw std::runtime_error{"StateTensor: Output rank is different from state"};
+
+  // View state and output as [outer, entries along axis, inner]
+  size_t outer = 1;
+  size_t inner = ir::sizeOfDataType(_info.typeInfo().type());
+  for (int i = 0; i < shape.rank(); ++i)
+  {
+    if (i == _axis)
+      continue;
+    if (shape.dim(i) != state_shape.dim(i))
+      throw std::runtime_error{"StateTensor: Output shape is different from state except axis"};
+    if (i < _axis)
+      outer *= shape.dim(i);
+    else
+      inner *= shape.dim(i);
+  }
+
+  const int32_t capacity = state_shape.dim(_axis);
+  const int32_t num_entries = shape.dim(_axis);
+  if (num_entries > capacity)
+    throw std::runtime_error{"StateTensor: Output is longer than state"};
+  if (_update == StateUpdate::APPEND && _length + num_entries > capacity)
+    throw std::runtime_error{"StateTensor: State is full"};
+  if (num_entries == 0)
+    return;
+
+  // Entries beyond the end of state wrap around to the beginning for ROTATE
+  const int32_t first = std::min(num_entries, capacity - _pos);
+  for (size_t o = 0; o < outer; ++o)
+  {
+    const auto src = _output.data() + o * num_entries * inner;
+    const auto dst = _state.data() + o * capacity * inner;
+    std::memcpy(dst + _pos * inner, src, first * inner);
+    if (num_entries > first)
+      std::memcpy(dst, src + first * inner, (num_entries - first) * inner);
+  }
+
+  _pos = (_pos + num_entries) % capacity;
+  _length = std::min(_length + num_entries, capacity);
+}
+
+void StateTensor::reset()
+{
+  std::fill(_state.begin(), _state.end(), 0);
+  _length = 0;
+  _pos = 0;
+}
+
+} // namespace exec
+} // namespace onert
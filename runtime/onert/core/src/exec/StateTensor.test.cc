@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/StateTensor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+ir::OperandInfo stateInfo(const ir::Shape &shape)
+{
+  return ir::OperandInfo::createStaticInfo(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+}
+
+// Write values as the model output and update state
+void updateState(exec::StateTensor &state, const ir::Shape &shape, const std::vector<float> &values)
+{
+  std::memcpy(state.outputBuffer(), values.data(), values.size() * sizeof(float));
+  state.update(shape);
+}
+
+std::vector<float> stateValues(const exec::StateTensor &state)
+{
+  const auto data = static_cast<const float *>(state.buffer());
+  return std::vector<float>(data, data + state.size() / sizeof(float));
+}
+
+} // namespace
+
+TEST(StateTensor, replace)
+{
+  exec::StateTensor state{stateInfo(ir::Shape{2, 2}), exec::StateUpdate::REPLACE, 0};
+  ASSERT_EQ(state.size(), 16);
+  EXPECT_EQ(stateValues(state), (std::vector<float>{0, 0, 0, 0}));
+
+  updateState(state, ir::Shape{2, 2}, {1, 2, 3, 4});
+  EXPECT_EQ(stateValues(state), (std::vector<float>{1, 2, 3, 4}));
+
+  state.reset();
+  EXPECT_EQ(stateValues(state), (std::vector<float>{0, 0, 0, 0}));
+}
+
+TEST(StateTensor, append)
+{
+  // [heads, tokens, depth] = [2, 3, 1]
+  exec::StateTensor state{stateInfo(ir::Shape{2, 3, 1}), exec::StateUpdate::APPEND, 1};
+
+  updateState(state, ir::Shape{2, 2, 1}, {1, 2, 10, 20});
+  EXPECT_EQ(state.length(), 2);
+  EXPECT_EQ(stateValues(state), (std::vector<float>{1, 2, 0, 10, 20, 0}));
+
+  updateState(state, ir::Shape{2, 1, 1}, {3, 30});
+  EXPECT_EQ(state.length(), 3);
+  EXPECT_EQ(stateValues(state), (std::vector<float>{1, 2, 3, 10, 20, 30}));
+
+  state.reset();
+  EXPECT_EQ(state.length(), 0);
+  updateState(state, ir::Shape{2, 1, 1}, {4, 40});
+  EXPECT_EQ(stateValues(state), (std::vector<float>{4, 0, 0, 40, 0, 0}));
+}
+
+TEST(StateTensor, rotate)
+{
+  exec::StateTensor state{stateInfo(ir::Shape{2, 3}), exec::StateUpdate::ROTATE, -1};
+
+  updateState(state, ir::Shape{2, 2}, {1, 2, 10, 20});
+  updateState(state, ir::Shape{2, 2}, {3, 4, 30, 40});
+  EXPECT_EQ(state.length(), 3);
+  EXPECT_EQ(stateValues(state), (std::vector<float>{4, 2, 3, 40, 20, 30}));
+
+  updateState(state, ir::Shape{2, 3}, {5, 6, 7, 50, 60, 70});
+  EXPECT_EQ(stateValues(state), (std::vector<float>{7, 5, 6, 70, 50, 60}));
+}
+
+TEST(StateTensor, neg_update)
+{
+  EXPECT_ANY_THROW(exec::StateTensor(stateInfo(ir::Shape{2, 3}), exec::StateUpdate::APPEND, 2));
+
+  exec::StateTensor append{stateInfo(ir::Shape{2, 3}), exec::StateUpdate::APPEND, 1};
+  EXPECT_ANY_THROW(updateState(append, ir::Shape{3, 1}, {1, 2, 3}));
+  EXPECT_ANY_THROW(updateState(append, ir::Shape{2, 1, 1}, {1, 2}));
+  updateState(append, ir::Shape{2, 2}, {1, 2, 3, 4});
+  EXPECT_ANY_THROW(updateState(append, ir::Shape{2, 2}, {1, 2, 3, 4}));
+
+  exec::StateTensor replace{stateInfo(ir::Shape{2, 2}), exec::StateUpdate::REPLACE, 0};
+  EXPECT_ANY_THROW(updateState(replace, ir::Shape{1, 2}, {1, 2}));
+}
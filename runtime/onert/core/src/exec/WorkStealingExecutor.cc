@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingExecutor.h"
+#include "HookFunction.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+namespace onert
+{
+namespace exec
+{
+
+void WorkStealingExecutor::notify(uint32_t finished_job_id)
+{
+  for (auto &&id : _output_info[finished_job_id])
+  {
+    assert(_remaining_inputs[id] > 0);
+    if (--_remaining_inputs[id] == 0) // No dependent jobs left, ready for execution
+    {
+      assignJob(id);
+    }
+  }
+}
+
+WorkStealingExecutor::WorkStealingExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
+                                           backend::BackendContexts &&backend_contexts,
+                                           const compiler::TensorRegistries &tensor_regs,
+                                           compiler::CodeMap &&code_map,
+                                           const util::TracingCtx *tracing_ctx)
+  : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
+                     std::move(code_map), tracing_ctx}
+{
+  VERBOSE(WorkStealingExecutor) << "Constructing WorkStealing Executor" << std::endl;
+
+  _remaining_inputs = std::make_unique<std::atomic<uint32_t>[]>(_initial_input_info.size());
+
+  BackendSet backends;
+  _lowered_graph->lower_info().operation.iterate(
+    [&](const ir::OperationIndex &op_ind, const compiler::OperationLowerInfo &lower_info) {
+      backends.add(lower_info.backend());
+      if (_lowered_graph->getHasDynamicTensor(op_ind))
+        _has_dynamic_tensor = true;
+    });
+  for (auto &&backend : backends)
+  {
+    auto config = backend->config();
+    if (config && config->supportConcurrentExecution())
+      _concurrent_backends.emplace_back(backend);
+  }
+
+  auto num_workers = util::getConfigInt(util::config::WORKSTEALING_THREADS);
+  if (num_workers <= 0)
+    num_workers = std::max(1u, std::thread::hardware_concurrency());
+  _scheduler = std::make_unique<WorkStealingScheduler>(backends, num_workers);
+}
+
+void WorkStealingExecutor::assignJob(uint32_t job_index)
+{
+  // Jobs are not moved between job lists since the scheduler keeps ready jobs
+  auto &job = _finished_jobs[job_index];
+  assert(job != nullptr);
+
+  VERBOSE(WorkStealingExecutor) << "Assigning fn " << job_index << std::endl;
+
+  auto op_ind = _job_to_op.at(job_index);
+  auto backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
+  auto setup = [&, op_ind, backend]() {
+    _subject.notifyJobBegin(this, _profiling_subg_index, op_ind, backend);
+  };
+  auto teardown = [&, job_index, op_ind, backend]() {
+    _subject.notifyJobEnd(this, _profiling_subg_index, op_ind, backend);
+    notify(job_index);
+  };
+
+  job->fn_seq()->initRunning();
+
+  // dynamic tensor setting
+  bool handle_dynamic_tensor = _lowered_graph->getHasDynamicTensor(op_ind) || _dynamic_input_exists;
+  job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
+
+  _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend,
+                     calculateRank({op_ind}));
+}
+
+void WorkStealingExecutor::executeImpl()
+{
+  assert(noWaitingJobs());
+
+  _dynamic_input_exists = hasDynamicInput();
+  _profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+
+  // Dynamic tensors are allocated by a memory manager shared in a backend while running jobs,
+  // so jobs of a backend run one at a time in that case
+  const auto concurrency =
+    (_dynamic_input_exists || _has_dynamic_tensor) ? 1 : _scheduler->numWorkers();
+  for (auto &&backend : _concurrent_backends)
+    _scheduler->setConcurrency(backend, concurrency);
+
+  // Reset input info for this execution
+  for (uint32_t i = 0; i < _initial_input_info.size(); ++i)
+  {
+    _remaining_inputs[i] = _initial_input_info[i];
+  }
+
+  _subject.notifySubgraphBegin(_profiling_subg_index);
+
+  for (uint32_t i = 0; i < _initial_input_info.size(); ++i)
+  {
+    if (_initial_input_info[i] == 0)
+    {
+      assignJob(i);
+    }
+  }
+
+  // Wait for all the jobs done
+  _scheduler->finish();
+  _subject.notifySubgraphEnd(_profiling_subg_index);
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
+#define __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
+
+#include "DataflowExecutor.h"
+#include "WorkStealingScheduler.h"
+
+#include "util/TracingCtx.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to execute Graph in parallel with work-stealing workers
+ *
+ * Unlike @c ParallelExecutor, there is no ready job list shared by all threads. A finished job
+ * assigns its ready successors directly to the scheduler, and workers are kept between runs.
+ * The number of workers is given by WORKSTEALING_THREADS, and independent jobs of a backend
+ * supporting concurrent execution run at the same time unless dynamic tensors are involved.
+ */
+class WorkStealingExecutor : public DataflowExecutor
+{
+protected:
+  void notify(uint32_t finished_job_id) override;
+
+public:
+  /**
+   * @brief Constructs a WorkStealingExecutor object
+   *
+   * @param lowered_graph LoweredGraph object
+   * @param tensor_builders Tensor builders that are currently used
+   * @param code_map @c ir::Operation and its code map
+   */
+  WorkStealingExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
+                       backend::BackendContexts &&backend_contexts,
+                       const compiler::TensorRegistries &tensor_regs,
+                       compiler::CodeMap &&code_map, const util::TracingCtx *tracing_ctx);
+
+  void executeImpl() override;
+
+private:
+  void assignJob(uint32_t job_index);
+
+private:
+  /**
+   * @brief Number of unfinished input jobs for each job in current execution
+   *        Reset from #_initial_input_info when start a run
+   */
+  std::unique_ptr<std::atomic<uint32_t>[]> _remaining_inputs;
+  bool _dynamic_input_exists{false};
+  bool _has_dynamic_tensor{false};
+  // Backends whose independent jobs can run at the same time
+  std::vector<const backend::Backend *> _concurrent_backends;
+  ir::SubgraphIndex _profiling_subg_index;
+  std::unique_ptr<WorkStealingScheduler> _scheduler;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
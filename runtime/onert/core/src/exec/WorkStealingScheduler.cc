@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingScheduler.h"
+
+#include <cassert>
+
+namespace
+{
+
+// Scheduler and queue which the current thread works for
+thread_local const onert::exec::WorkStealingScheduler *current_scheduler = nullptr;
+thread_local uint32_t current_worker = 0;
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+WorkStealingScheduler::WorkStealingScheduler(const BackendSet &backends, uint32_t num_workers)
+{
+  assert(!backends.empty());
+  assert(num_workers >= 1);
+
+  for (auto &&backend : backends)
+  {
+    _backend_slots[backend];
+  }
+
+  for (uint32_t i = 0; i < num_workers; i++)
+  {
+    _queues.emplace_back(std::make_unique<TaskQueue>());
+  }
+
+  for (uint32_t i = 0; i < num_workers; i++)
+  {
+    _threads.emplace_back(&WorkStealingScheduler::work, this, i);
+  }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _terminating = true;
+  }
+  _cv_work.notify_all();
+
+  for (auto &&thread : _threads)
+  {
+    thread.join();
+  }
+}
+
+void WorkStealingScheduler::setConcurrency(const backend::Backend *backend,
+                                           uint32_t max_concurrency)
+{
+  assert(_num_pending == 0);
+  assert(max_concurrency >= 1);
+  _backend_slots.at(backend).max_concurrency = max_concurrency;
+}
+
+void WorkStealingScheduler::assign(std::unique_ptr<IFunction> &&fn,
+                                   const backend::Backend *backend, int64_t rank)
+{
+  assert(_backend_slots.find(backend) != _backend_slots.end());
+
+  // Keep the task on the current worker if possible for locality
+  auto queue_index = (current_scheduler == this)
+                       ? current_worker
+                       : _next_queue.fetch_add(1) % static_cast<uint32_t>(_queues.size());
+
+  _num_pending++;
+  {
+    auto &queue = *_queues.at(queue_index);
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    queue.tasks.emplace(rank, Task{backend, std::move(fn)});
+  }
+  wakeUp();
+}
+
+void WorkStealingScheduler::finish()
+{
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv_finish.wait(lock, [this] { return _num_pending == 0; });
+    std::swap(error, _error);
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+void WorkStealingScheduler::work(uint32_t worker_id)
+{
+  current_scheduler = this;
+  current_worker = worker_id;
+
+  while (!_terminating)
+  {
+    const auto epoch = _epoch.load();
+    if (runTask(worker_id))
+      continue;
+
+    // Nothing to run: sleep until a task is assigned or a backend is released
+    std::unique_lock<std::mutex> lock{_mutex};
+    _num_sleeping++;
+    _cv_work.wait(lock, [&] { return _terminating || _epoch != epoch; });
+    _num_sleeping--;
+  }
+}
+
+bool WorkStealingScheduler::runTask(uint32_t worker_id)
+{
+  const auto num_queues = static_cast<uint32_t>(_queues.size());
+
+  // Look at own queue first, then steal from others
+  for (uint32_t i = 0; i < num_queues; i++)
+  {
+    Task task;
+    if (!popTask(*_queues[(worker_id + i) % num_queues], task))
+      continue;
+
+    try
+    {
+      task.fn->run();
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      if (!_error)
+        _error = std::current_exception();
+    }
+
+    _backend_slots.at(task.backend).running--;
+    wakeUp();
+
+    // Tasks assigned by this task are already counted, so zero means all tasks are done
+    if (--_num_pending == 0)
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _cv_finish.notify_all();
+    }
+    return true;
+  }
+
+  return false;
+}
+
+bool WorkStealingScheduler::popTask(TaskQueue &queue, Task &task)
+{
+  std::lock_guard<std::mutex> lock{queue.mutex};
+  for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it)
+  {
+    auto &slot = _backend_slots.at(it->second.backend);
+    auto running = slot.running.load();
+    while (running < slot.max_concurrency)
+    {
+      // On failure, running is updated with the current value
+      if (slot.running.compare_exchange_weak(running, running + 1))
+      {
+        task = std::move(it->second);
+        queue.tasks.erase(it);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void WorkStealingScheduler::wakeUp()
+{
+  _epoch++;
+
+  // Sleeping workers check epoch with _mutex held. Taking it here makes sure that a worker
+  // going to sleep either sees the new epoch or receives the notification.
+  if (_num_sleeping > 0)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+  }
+  _cv_work.notify_one();
+}
+
+} // namespace exec
+} // namespace onert
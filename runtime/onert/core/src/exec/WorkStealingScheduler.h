@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_SCHEDULER_H__
+#define __ONERT_EXEC_WORK_STEALING_SCHEDULER_H__
+
+#include "exec/IFunction.h"
+#include "BackendSet.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Scheduler which runs tasks on workers with their own task queues
+ *
+ * Each worker has its own queue ordered by task rank, so there is no lock shared by all workers.
+ * A task assigned from a worker goes to the queue of that worker, and a task assigned from
+ * outside is distributed in round-robin. A worker runs the highest-rank task of its own queue,
+ * and steals the highest-rank task of another worker's queue when it has nothing to run.
+ * Like @c ParallelScheduler, tasks of the same backend do not run at the same time by default
+ * because backends do not guarantee thread safety of their kernels. Backends whose kernels are
+ * thread-safe can be allowed to run several tasks at once with @c setConcurrency.
+ */
+class WorkStealingScheduler
+{
+public:
+  /**
+   * @brief Constructs WorkStealingScheduler object
+   *
+   * @param backends    Backend set
+   * @param num_workers Number of worker threads
+   */
+  WorkStealingScheduler(const BackendSet &backends, uint32_t num_workers);
+  WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+  WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+  ~WorkStealingScheduler();
+
+public:
+  /**
+   * @brief Set the number of tasks of the given backend which can run at the same time
+   *
+   * @param[in] backend         Target backend
+   * @param[in] max_concurrency Number of tasks. It is 1 by default
+   * @note  It must be called while there is no assigned task
+   */
+  void setConcurrency(const backend::Backend *backend, uint32_t max_concurrency);
+  /**
+   * @brief Assign a task to be run on the given backend
+   *
+   * @param[in] fn      Function to be assigned
+   * @param[in] backend Target backend
+   * @param[in] rank    Priority of the task. Higher rank runs first
+   */
+  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend, int64_t rank);
+  /**
+   * @brief Block until all tasks are finished
+   * @note  The first exception thrown by tasks is rethrown
+   */
+  void finish();
+
+  uint32_t numWorkers() const { return _threads.size(); }
+
+private:
+  struct Task
+  {
+    const backend::Backend *backend;
+    std::unique_ptr<IFunction> fn;
+  };
+
+  struct BackendSlot
+  {
+    uint32_t max_concurrency{1};
+    std::atomic<uint32_t> running{0};
+  };
+
+  struct TaskQueue
+  {
+    std::mutex mutex;
+    std::multimap<int64_t, Task, std::greater<int64_t>> tasks;
+  };
+
+private:
+  void work(uint32_t worker_id);
+  bool runTask(uint32_t worker_id);
+  bool popTask(TaskQueue &queue, Task &task);
+  void wakeUp();
+
+private:
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::unordered_map<const backend::Backend *, BackendSlot> _backend_slots;
+  std::atomic<uint32_t> _next_queue{0};
+  std::atomic<uint32_t> _num_pending{0}; //< Number of assigned and not finished tasks
+  std::atomic<uint64_t> _epoch{0};       //< Increased when a task may become runnable
+  std::atomic<uint32_t> _num_sleeping{0};
+  std::atomic<bool> _terminating{false};
+  std::exception_ptr _error;
+  std::mutex _mutex;
+  std::condition_variable _cv_work;
+  std::condition_variable _cv_finish;
+  std::vector<std::thread> _threads;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_SCHEDULER_H__
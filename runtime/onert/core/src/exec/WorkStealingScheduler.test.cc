@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingScheduler.h"
+
+#include <backend/Backend.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+
+namespace
+{
+
+using namespace onert;
+using namespace exec;
+
+struct MockBackend : public backend::Backend
+{
+  std::shared_ptr<backend::IConfig> config() const override { return nullptr; }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+};
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+BackendSet makeBackendSet(const std::vector<const backend::Backend *> &backends)
+{
+  BackendSet set;
+  for (auto &&backend : backends)
+    set.add(backend);
+  return set;
+}
+
+std::unique_ptr<IFunction> makeFunction(const std::function<void()> &fn)
+{
+  return std::make_unique<LambdaFunction>(fn);
+}
+
+} // namespace
+
+TEST(WorkStealingScheduler, rankOrder)
+{
+  MockBackend backend;
+  WorkStealingScheduler scheduler{makeBackendSet({&backend}), 1};
+  ASSERT_EQ(scheduler.numWorkers(), 1u);
+
+  // Block the worker until all tasks are assigned
+  std::promise<void> start;
+  auto started = start.get_future().share();
+  scheduler.assign(makeFunction([started]() { started.wait(); }), &backend, 100);
+
+  std::vector<int64_t> order;
+  for (int64_t rank : {1, 3, 2})
+  {
+    scheduler.assign(makeFunction([&order, rank]() { order.push_back(rank); }), &backend, rank);
+  }
+  start.set_value();
+  scheduler.finish();
+
+  ASSERT_EQ(order, (std::vector<int64_t>{3, 2, 1}));
+}
+
+TEST(WorkStealingScheduler, backendExclusive)
+{
+  MockBackend backend1;
+  MockBackend backend2;
+  WorkStealingScheduler scheduler{makeBackendSet({&backend1, &backend2}), 4};
+
+  std::atomic<int> running1{0};
+  std::atomic<int> max_running1{0};
+  std::atomic<int> count{0};
+  for (int i = 0; i < 100; ++i)
+  {
+    const auto *backend = (i % 2 == 0) ? &backend1 : &backend2;
+    scheduler.assign(makeFunction([&, backend]() {
+                       if (backend == &backend1)
+                       {
+                         auto cur = ++running1;
+                         int expected = max_running1;
+                         while (cur > expected &&
+                                !max_running1.compare_exchange_weak(expected, cur))
+                           ;
+                         std::this_thread::yield();
+                         running1--;
+                       }
+                       count++;
+                     }),
+                     backend, 0);
+  }
+  scheduler.finish();
+
+  ASSERT_EQ(count.load(), 100);
+  ASSERT_EQ(max_running1.load(), 1);
+}
+
+TEST(WorkStealingScheduler, backendConcurrent)
+{
+  MockBackend backend;
+  WorkStealingScheduler scheduler{makeBackendSet({&backend}), 2};
+  scheduler.setConcurrency(&backend, 2);
+
+  // Each task waits for the other, which passes only if both run at the same time
+  std::atomic<int> arrived{0};
+  std::atomic<int> met{0};
+  for (int i = 0; i < 2; ++i)
+  {
+    scheduler.assign(makeFunction([&]() {
+                       arrived++;
+                       const auto deadline =
+                         std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                       while (arrived < 2 && std::chrono::steady_clock::now() < deadline)
+                         std::this_thread::yield();
+                       if (arrived == 2)
+                         met++;
+                     }),
+                     &backend, 0);
+  }
+  scheduler.finish();
+
+  ASSERT_EQ(met.load(), 2);
+}
+
+TEST(WorkStealingScheduler, assignFromTask)
+{
+  MockBackend backend;
+  WorkStealingScheduler scheduler{makeBackendSet({&backend}), 2};
+
+  // Each task assigns the next one until the count reaches the limit
+  std::atomic<int> count{0};
+  std::function<void()> chain = [&]() {
+    if (++count < 50)
+      scheduler.assign(makeFunction(chain), &backend, 0);
+  };
+  for (int i = 0; i < 2; ++i)
+    scheduler.assign(makeFunction(chain), &backend, 0);
+  scheduler.finish();
+
+  ASSERT_GE(count.load(), 50);
+}
+
+TEST(WorkStealingScheduler, neg_exception)
+{
+  MockBackend backend;
+  WorkStealingScheduler scheduler{makeBackendSet({&backend}), 2};
+
+  std::atomic<int> count{0};
+  scheduler.assign(makeFunction([]() { throw std::runtime_error{"error"}; }), &backend, 0);
+  scheduler.assign(makeFunction([&count]() { count++; }), &backend, 0);
+  EXPECT_THROW(scheduler.finish(), std::runtime_error);
+  ASSERT_EQ(count.load(), 1);
+
+  // Error is cleared after it is thrown
+  scheduler.assign(makeFunction([&count]() { count++; }), &backend, 0);
+  EXPECT_NO_THROW(scheduler.finish());
+  ASSERT_EQ(count.load(), 2);
+}
@@ -34,10 +34,12 @@ TrainableExecutor::TrainableExecutor(
   const compiler::train::TensorRegistries &tensor_regs,
   compiler::train::TrainableCodeMap &&code_map,
   const std::vector<ir::OperationIndex> &forward_order,
-  const std::vector<ir::OperationIndex> &backward_order, const util::TracingCtx *tracing_ctx,
-  const ir::train::LossInfo &loss_info)
+  const std::vector<ir::OperationIndex> &backward_order,
+  const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
+  const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &loss_info)
   : _code_map{std::move(code_map)}, _forward_order{std::move(forward_order)},
-    _backward_order{std::move(backward_order)}, _lowered_graph{std::move(lowered_graph)},
+    _backward_order{std::move(backward_order)}, _recompute_segments{recompute_segments},
+    _segment_of{}, _alive_segment{0}, _lowered_graph{std::move(lowered_graph)},
     _backend_contexts{std::move(backend_contexts)},
     _trainable_graph{_lowered_graph->trainable_graph()}, _tensor_regs{std::move(tensor_regs)},
     _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info)
@@ -54,6 +56,12 @@ TrainableExecutor::TrainableExecutor(
   };
   build_tensor_list(_trainable_graph.getInputs(), _input_tensors);
   build_tensor_list(_trainable_graph.getOutputs(), _output_tensors);
+
+  for (uint32_t seg = 0; seg < _recompute_segments.size(); ++seg)
+  {
+    for (const auto &index : _recompute_segments[seg])
+      _segment_of[index] = seg;
+  }
 }
 
 void TrainableExecutor::execute(const std::vector<backend::IPortableTensor *> &,
@@ -140,17 +148,49 @@ void TrainableExecutor::forwardImpl(bool training)
   }
 }
 
-void TrainableExecutor::backward(const IODescription &, uint32_t training_step)
+void TrainableExecutor::backward(const IODescription &, uint32_t training_step,
+                                 bool weight_update_enabled)
 {
   // For thread-safe, use mutex
   // TODO: if all used backends on this executor are thread-safe,
   //       do not need to use mutex (otherwise, use mutex)
   std::lock_guard<std::mutex> lock(_mutex);
 
-  backwardImpl(training_step);
+  // Activations of the last segment are alive after forwarding
+  _alive_segment = _recompute_segments.empty() ? 0 : _recompute_segments.size() - 1;
+  backwardImpl(training_step, weight_update_enabled);
+}
+
+void TrainableExecutor::applyGradients(uint32_t training_step)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto &&index : _backward_order)
+  {
+    auto &tn_seq = _code_map.at(index).tn_seq;
+    tn_seq->applyGradients(training_step);
+  }
+}
+
+void TrainableExecutor::recompute(const ir::OperationIndex &index)
+{
+  if (_recompute_segments.empty())
+    return;
+
+  // Activations of other segments share memory, so run forward of the segment again
+  const auto seg = _segment_of.at(index);
+  if (seg == _alive_segment)
+    return;
+
+  for (const auto &op_ind : _recompute_segments[seg])
+  {
+    auto &tn_seq = _code_map.at(op_ind).tn_seq;
+    tn_seq->forward(true);
+  }
+  _alive_segment = seg;
 }
 
-void TrainableExecutor::backwardImpl(uint32_t training_step)
+void TrainableExecutor::backwardImpl(uint32_t training_step, bool weight_update_enabled)
 {
   if (_tracing_ctx)
   {
@@ -165,10 +205,11 @@ void TrainableExecutor::backwardImpl(uint32_t training_step)
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
+      recompute(index);
       _subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
 
       auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step);
+      tn_seq->backward(training_step, weight_update_enabled);
 
       _subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -183,8 +224,9 @@ void TrainableExecutor::backwardImpl(uint32_t training_step)
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
+      recompute(index);
       auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step);
+      tn_seq->backward(training_step, weight_update_enabled);
     }
   }
 }
@@ -44,6 +44,8 @@ public:
    * @param lowered_graph LoweredTrainableGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param recompute_segments Segments of forward order recomputed during backwarding,
+   *                           empty if all activations are kept
    */
   TrainableExecutor(std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
                     backend::train::TrainableBackendContexts &&backend_contexts,
@@ -51,6 +53,7 @@ public:
                     compiler::train::TrainableCodeMap &&code_map,
                     const std::vector<ir::OperationIndex> &forward_order,
                     const std::vector<ir::OperationIndex> &backward_order,
+                    const std::vector<std::vector<ir::OperationIndex>> &recompute_segments,
                     const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info);
 
 public:
@@ -62,7 +65,12 @@ public:
                const std::vector<backend::IPortableTensor *> &outputs) override;
 
   void forward(const IODescription &desc, bool training);
-  void backward(const IODescription &desc, uint32_t training_step);
+  void backward(const IODescription &desc, uint32_t training_step,
+                bool weight_update_enabled = true);
+  /**
+   * @brief Apply gradients computed by @c backward without weight update
+   */
+  void applyGradients(uint32_t training_step);
 
   // Used only in Dataflow and Parallel Executors
   void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final
@@ -90,14 +98,29 @@ public:
 
   backend::train::TrainableBackendContexts &getBackendContexts() { return _backend_contexts; }
 
+  backend::ITensor *getTrainableTensor(const ir::OperandIndex &index) const
+  {
+    return _tensor_regs.getITensor(index);
+  }
+  backend::ITensor *getGradientTensor(const ir::OperandIndex &index) const
+  {
+    return _tensor_regs.getGradientITensor(index);
+  }
+
+  const ir::train::LossInfo &lossInfo() const { return _loss_info; }
+
 private:
   void forwardImpl(bool training);
-  void backwardImpl(uint32_t training_step);
+  void backwardImpl(uint32_t training_step, bool weight_update_enabled);
+  void recompute(const ir::OperationIndex &index);
 
 private:
   compiler::train::TrainableCodeMap _code_map;
   std::vector<ir::OperationIndex> _forward_order;
   std::vector<ir::OperationIndex> _backward_order;
+  std::vector<std::vector<ir::OperationIndex>> _recompute_segments;
+  ir::OperationIndexMap<uint32_t> _segment_of;
+  uint32_t _alive_segment;
   ExecutionObservee _subject;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<compiler::train::LoweredTrainableGraph> _lowered_graph;
@@ -18,8 +18,75 @@
 
 #include "../../backend/builtin/IOTensor.h"
 
+#include <backend/basic/train/TrainableTensor.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+
+namespace
+{
+
+using namespace onert;
+
+class Job : public exec::IFunction
+{
+public:
+  Job(std::function<void()> &&fn) : _fn{std::move(fn)} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+// IO description of the shard of mini-batch, whose buffers point into the given description
+exec::IODescription shardDesc(const exec::IODescription &desc, uint32_t shard,
+                              uint32_t num_shards)
+{
+  exec::IODescription ret;
+  ret.updated = desc.updated;
+  for (const auto &input : desc.inputs)
+  {
+    auto shard_input = std::make_unique<exec::InputDesc>(input->info);
+    if (input->size % num_shards != 0)
+      throw std::runtime_error{"TrainableExecutors: Input size is not divisible by replicas"};
+    shard_input->size = input->size / num_shards;
+    shard_input->buffer =
+      input->buffer ? static_cast<const uint8_t *>(input->buffer) + shard * shard_input->size
+                    : nullptr;
+    shard_input->layout = input->layout;
+    ret.inputs.emplace_back(std::move(shard_input));
+  }
+  for (const auto &output : desc.outputs)
+  {
+    auto shard_output = std::make_unique<exec::OutputDesc>(output->info);
+    if (output->size % num_shards != 0)
+      throw std::runtime_error{"TrainableExecutors: Output size is not divisible by replicas"};
+    shard_output->size = output->size / num_shards;
+    shard_output->buffer =
+      output->buffer ? static_cast<uint8_t *>(output->buffer) + shard * shard_output->size
+                     : nullptr;
+    shard_output->layout = output->layout;
+    ret.outputs.emplace_back(std::move(shard_output));
+  }
+  return ret;
+}
+
+ir::OperandInfo batchInfo(const ir::OperandInfo &shard_info, uint32_t num_shards)
+{
+  auto info = shard_info;
+  auto shape = info.shape();
+  if (shape.rank() == 0)
+    throw std::runtime_error{"TrainableExecutors: IO of replicas should have batch dimension"};
+  shape.dim(0) *= num_shards;
+  info.shape(shape);
+  return info;
+}
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -27,6 +94,50 @@ namespace exec
 namespace train
 {
 
+TrainableExecutors::~TrainableExecutors() = default;
+
+void TrainableExecutors::parallelRun(uint32_t n, const std::function<void(uint32_t)> &fn)
+{
+  assert(n <= _replicas.size() + 1);
+
+  std::vector<std::exception_ptr> errors(n);
+  auto run = [&](uint32_t i) {
+    try
+    {
+      fn(i);
+    }
+    catch (...)
+    {
+      errors[i] = std::current_exception();
+    }
+  };
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint32_t remaining = n > 1 ? n - 1 : 0;
+  for (uint32_t i = 1; i < n; ++i)
+  {
+    _workers->enqueue(std::make_unique<Job>([&, i]() {
+      run(i);
+      std::lock_guard<std::mutex> lock{mutex};
+      if (--remaining == 0)
+        cv.notify_one();
+    }));
+  }
+  if (n > 0)
+    run(0);
+  {
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.wait(lock, [&] { return remaining == 0; });
+  }
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
 void TrainableExecutors::emplace(const ir::ModelIndex &, const ir::SubgraphIndex &subg_index,
                                  std::unique_ptr<IExecutor> exec)
 {
@@ -35,6 +146,152 @@ void TrainableExecutors::emplace(const ir::ModelIndex &, const ir::SubgraphIndex
   _executors.emplace(subg_index, std::move(t_exec));
 }
 
+void TrainableExecutors::addReplica(std::unique_ptr<IExecutor> exec)
+{
+  std::unique_ptr<TrainableExecutor> t_exec{
+    nnfw::misc::polymorphic_downcast<TrainableExecutor *>(exec.release())};
+  // Replicas read weights of entry executor, as only entry executor updates weights after all
+  // replicas finish backwarding. Weights which cannot be shared are copied after each update.
+  // TODO Do not allocate memory of shared weights in replicas
+  entryExecutor()->iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *weight) {
+      auto tensor = dynamic_cast<backend::basic::train::TrainableTensor *>(
+        t_exec->getTrainableTensor(index));
+      if (tensor != nullptr && tensor->total_size() == weight->total_size())
+        tensor->setBuffer(weight->buffer());
+      else
+        _copied_weights.add(index);
+    });
+  _replicas.emplace_back(std::move(t_exec));
+
+  // Each replica except for entry executor runs on a worker
+  _workers = std::make_unique<ThreadPool>(_replicas.size());
+
+  const uint32_t num_shards = _replicas.size() + 1;
+  _input_infos.clear();
+  for (const auto &tensor : entryExecutor()->getInputTensors())
+    _input_infos.emplace_back(batchInfo(tensor->orig_info(), num_shards));
+  _output_infos.clear();
+  for (const auto &tensor : entryExecutor()->getOutputTensors())
+    _output_infos.emplace_back(batchInfo(tensor->orig_info(), num_shards));
+}
+
+std::vector<TrainableExecutor *> TrainableExecutors::replicas() const
+{
+  std::vector<TrainableExecutor *> ret{entryExecutor()};
+  for (const auto &replica : _replicas)
+    ret.emplace_back(replica.get());
+  return ret;
+}
+
+void TrainableExecutors::syncWeights()
+{
+  if (_copied_weights.empty())
+    return;
+
+  std::vector<std::pair<const backend::ITensor *, ir::OperandIndex>> weights;
+  entryExecutor()->iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *tensor) {
+      if (_copied_weights.contains(index))
+        weights.emplace_back(tensor, index);
+    });
+
+  parallelRun(_replicas.size(), [&](uint32_t i) {
+    for (const auto &weight : weights)
+    {
+      auto dst = _replicas[i]->getTrainableTensor(weight.second);
+      assert(dst != nullptr && dst->total_size() == weight.first->total_size());
+      std::memcpy(dst->buffer(), weight.first->buffer(), weight.first->total_size());
+    }
+  });
+}
+
+void TrainableExecutors::reduceGradients()
+{
+  const auto executors = replicas();
+  const uint32_t num_shards = executors.size();
+
+  // Gradients of each shard are averaged over the shard, so average them again
+  const float scale =
+    entryExecutor()->lossInfo().reduction_type == ir::train::LossReductionType::SumOverBatchSize
+      ? 1.0f / num_shards
+      : 1.0f;
+
+  // Buffers of each gradient, entry executor first, and the number of elements
+  std::vector<std::pair<std::vector<float *>, uint64_t>> gradients;
+  entryExecutor()->iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *) {
+      std::vector<float *> buffers;
+      for (const auto &executor : executors)
+      {
+        auto gradient = executor->getGradientTensor(index);
+        if (gradient == nullptr)
+          return;
+        if (gradient->data_type() != ir::DataType::FLOAT32)
+          throw std::runtime_error{"TrainableExecutors: Only float gradients can be reduced"};
+        buffers.emplace_back(reinterpret_cast<float *>(gradient->buffer()));
+      }
+      const auto size = executors[0]->getGradientTensor(index)->getShape().num_elements();
+      gradients.emplace_back(std::move(buffers), size);
+    });
+
+  // Elements of each gradient are split into threads
+  parallelRun(num_shards, [&](uint32_t t) {
+    for (const auto &gradient : gradients)
+    {
+      const auto &buffers = gradient.first;
+      const uint64_t begin = gradient.second * t / num_shards;
+      const uint64_t end = gradient.second * (t + 1) / num_shards;
+      for (uint64_t e = begin; e < end; ++e)
+      {
+        float sum = buffers[0][e];
+        for (uint32_t s = 1; s < num_shards; ++s)
+          sum += buffers[s][e];
+        buffers[0][e] = sum * scale;
+      }
+    }
+  });
+}
+
+void TrainableExecutors::accumulateGradients(uint32_t training_step)
+{
+  const bool first = training_step % _accumulation_steps == 0;
+  const bool last = (training_step + 1) % _accumulation_steps == 0;
+  // Gradients of each batch are averaged over the batch, so average them over batches as well
+  const float scale =
+    entryExecutor()->lossInfo().reduction_type == ir::train::LossReductionType::SumOverBatchSize
+      ? 1.0f / _accumulation_steps
+      : 1.0f;
+
+  entryExecutor()->iterateTrainableTensors(
+    [&](const ir::OperandIndex &index, const backend::train::ITrainableTensor *) {
+      auto gradient = entryExecutor()->getGradientTensor(index);
+      if (gradient == nullptr)
+        return;
+      if (gradient->data_type() != ir::DataType::FLOAT32)
+        throw std::runtime_error{"TrainableExecutors: Only float gradients can be accumulated"};
+
+      auto buffer = reinterpret_cast<float *>(gradient->buffer());
+      const auto size = gradient->getShape().num_elements();
+      auto &accumulated = _accumulated_gradients[index];
+      if (first)
+        accumulated.assign(buffer, buffer + size);
+      else
+      {
+        assert(accumulated.size() == size);
+        for (uint64_t i = 0; i < size; ++i)
+          accumulated[i] += buffer[i];
+      }
+
+      // Gradient tensor has the accumulated gradient to be applied
+      if (last)
+      {
+        for (uint64_t i = 0; i < size; ++i)
+          buffer[i] = accumulated[i] * scale;
+      }
+    });
+}
+
 TrainableExecutor *TrainableExecutors::at(const ir::ModelIndex &,
                                           const ir::SubgraphIndex &subg_index) const
 {
@@ -50,11 +307,15 @@ uint32_t TrainableExecutors::outputSize() const
 
 const ir::OperandInfo &TrainableExecutors::inputInfo(const ir::IOIndex &index) const
 {
+  if (!_replicas.empty())
+    return _input_infos.at(index.value());
   return entryExecutor()->getInputTensors().at(index.value())->orig_info();
 }
 
 const ir::OperandInfo &TrainableExecutors::outputInfo(const ir::IOIndex &index) const
 {
+  if (!_replicas.empty())
+    return _output_infos.at(index.value());
   return entryExecutor()->getOutputTensors().at(index.value())->orig_info();
 }
 
@@ -62,6 +323,17 @@ void TrainableExecutors::execute(const IODescription &desc)
 {
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
+
+  if (!_replicas.empty())
+  {
+    const auto executors = replicas();
+    parallelRun(executors.size(), [&](uint32_t i) {
+      const auto shard_desc = shardDesc(desc, i, executors.size());
+      executors[i]->forward(shard_desc, false);
+    });
+    return;
+  }
+
   entryExecutor()->forward(desc, false);
 
   // TODO Support multple executors
@@ -71,8 +343,47 @@ void TrainableExecutors::train(const IODescription &desc, uint32_t training_step
 {
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
-  entryExecutor()->forward(desc, true);
-  entryExecutor()->backward(desc, training_step);
+
+  if (_replicas.empty() && _accumulation_steps == 1)
+  {
+    entryExecutor()->forward(desc, true);
+    entryExecutor()->backward(desc, training_step);
+    return;
+  }
+
+  if (_replicas.empty())
+  {
+    entryExecutor()->forward(desc, true);
+    entryExecutor()->backward(desc, training_step, false);
+  }
+  else
+  {
+    const auto executors = replicas();
+    parallelRun(executors.size(), [&](uint32_t i) {
+      const auto shard_desc = shardDesc(desc, i, executors.size());
+      executors[i]->forward(shard_desc, true);
+      executors[i]->backward(shard_desc, training_step, false);
+    });
+    reduceGradients();
+  }
+
+  bool updated = true;
+  if (_accumulation_steps > 1)
+  {
+    accumulateGradients(training_step);
+    // Optimizers count the number of weight updates
+    updated = (training_step + 1) % _accumulation_steps == 0;
+    if (updated)
+      entryExecutor()->applyGradients(training_step / _accumulation_steps);
+  }
+  else
+  {
+    entryExecutor()->applyGradients(training_step);
+  }
+
+  // Replicas use updated weights from the next run
+  if (updated && !_replicas.empty())
+    syncWeights();
 
   // TODO Support multple executors
 }
@@ -81,7 +392,14 @@ float TrainableExecutors::getLoss(const ir::IOIndex &index) const
 {
   if (_executors.size() > 1)
     throw std::runtime_error("TrainableExecutors does not support multiple executors yet");
-  return entryExecutor()->getLoss(index);
+
+  float loss = 0;
+  for (const auto &executor : replicas())
+    loss += executor->getLoss(index);
+  if (entryExecutor()->lossInfo().reduction_type ==
+      ir::train::LossReductionType::SumOverBatchSize)
+    loss /= _replicas.size() + 1;
+  return loss;
 }
 
 void TrainableExecutors::iterateTrainableTensors(
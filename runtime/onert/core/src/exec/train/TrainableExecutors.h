@@ -18,8 +18,10 @@
 #define __ONERT_EXEC_TRAIN_TRAINABLE_EXECUTORS_H__
 
 #include "TrainableExecutor.h"
+#include "../ThreadPool.h"
 #include "exec/IExecutors.h"
 #include "ir/NNPkg.h"
+#include "util/Set.h"
 
 namespace onert
 {
@@ -36,15 +38,20 @@ class TrainableExecutors : public IExecutors
 public:
   /**
    * @brief Construct a new TrainableExecutors object
+   * @param accumulation_steps Number of batches whose gradients are accumulated before updating
+   *                           weights
    */
-  TrainableExecutors(void) = default;
+  explicit TrainableExecutors(uint32_t accumulation_steps = 1)
+    : _accumulation_steps{accumulation_steps}
+  {
+  }
   TrainableExecutors(const TrainableExecutors &) = delete;
   TrainableExecutors(TrainableExecutors &&) = default;
 
   /**
    * @brief Destroy the TrainableExecutors object
    */
-  ~TrainableExecutors() = default;
+  ~TrainableExecutors();
 
 public:
   TrainableExecutors &operator=(const TrainableExecutors &) = delete;
@@ -54,6 +61,19 @@ public:
   void emplace(const ir::ModelIndex &model_index, const ir::SubgraphIndex &subg_index,
                std::unique_ptr<IExecutor> exec) override;
 
+  /**
+   * @brief Add a replica of entry executor for data-parallel training
+   *
+   * Mini-batch is split into shards by the number of executors, and entry executor and its
+   * replicas run shards on workers owned by this object. Gradients of replicas are reduced into
+   * entry executor, and only entry executor updates weights. Replicas read weights of entry
+   * executor instead of their own, so they need no copy after each update.
+   * @note  Entry executor and replicas should be compiled with the batch size of a shard.
+   *        Memory of weights is still allocated in each replica, so replicas cost as much memory
+   *        as entry executor except for weights and optimizer variables being unused.
+   */
+  void addReplica(std::unique_ptr<IExecutor> exec);
+
   TrainableExecutor *at(const ir::ModelIndex &model_index,
                         const ir::SubgraphIndex &subg_index) const override;
 
@@ -74,7 +94,8 @@ public:
    *
    * @param desc          IO information
    * @param training_step The number of iterations of an training process.
-   *                      In other words, the number of gradient update.
+   *                      In other words, the number of batches trained. Weights are updated
+   *                      when it is the last batch of accumulation steps.
    */
   void train(const IODescription &desc, uint32_t training_step);
 
@@ -84,9 +105,27 @@ public:
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
 
+private:
+  std::vector<TrainableExecutor *> replicas() const;
+  // Run fn(0) ~ fn(n - 1) in parallel, fn(0) runs on the calling thread and others on workers
+  void parallelRun(uint32_t n, const std::function<void(uint32_t)> &fn);
+  void syncWeights();
+  void reduceGradients();
+  void accumulateGradients(uint32_t training_step);
+
 private:
   // TODO Append model index to ModelIndex
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<TrainableExecutor>> _executors;
+  std::vector<std::unique_ptr<TrainableExecutor>> _replicas;
+  std::unique_ptr<ThreadPool> _workers;
+  // Weights which are copied to replicas after each update as they cannot be shared
+  util::Set<ir::OperandIndex> _copied_weights;
+  // IO infos of whole mini-batch when replicas exist
+  std::vector<ir::OperandInfo> _input_infos;
+  std::vector<ir::OperandInfo> _output_infos;
+  uint32_t _accumulation_steps;
+  // Gradients accumulated over batches, by the index of trainable tensor
+  ir::OperandIndexMap<std::vector<float>> _accumulated_gradients;
 };
 
 } // namespace train
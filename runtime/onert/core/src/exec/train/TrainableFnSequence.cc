@@ -31,13 +31,19 @@ void TrainableFnSequence::forward(bool training)
   }
 }
 
-void TrainableFnSequence::backward(uint32_t training_step)
+void TrainableFnSequence::backward(uint32_t training_step, bool weight_update_enabled)
 {
   for (auto it = _functions.rbegin(); it != _functions.rend(); ++it)
   {
     (*it)->backward();
   }
 
+  if (weight_update_enabled)
+    applyGradients(training_step);
+}
+
+void TrainableFnSequence::applyGradients(uint32_t training_step)
+{
   for (const auto &applier : _appliers)
   {
     applier->applyGradient(training_step);
@@ -71,6 +71,18 @@ void OperationDumper::visit(const ArgMinMax &node)
   VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
 }
 
+void OperationDumper::visit(const Attention &node)
+{
+  VERBOSE(LIR) << "* " << node.name() << (node.param().causal ? "(Causal)" : "") << std::endl;
+  VERBOSE(LIR) << "  - Inputs : Query(" << node.getInputs().at(Attention::Input::QUERY) << ") Key("
+               << node.getInputs().at(Attention::Input::KEY) << ") Value("
+               << node.getInputs().at(Attention::Input::VALUE) << ")";
+  if (node.getInputs().size() > Attention::Input::MASK)
+    VERBOSE(LIR) << " Mask(" << node.getInputs().at(Attention::Input::MASK) << ")";
+  VERBOSE(LIR) << std::endl;
+  VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
+}
+
 void OperationDumper::visit(const BatchToSpaceND &node)
 {
   std::string block_size =
@@ -201,6 +213,14 @@ void OperationDumper::visit(const InstanceNorm &node)
 
 void OperationDumper::visit(const L2Normalization &node) { dumpOpGeneric(node); }
 
+void OperationDumper::visit(const LayerNorm &node)
+{
+  std::string inputs =
+    "Gamma(" + std::to_string(node.getInputs().at(LayerNorm::Input::GAMMA).value()) + ") Beta(" +
+    std::to_string(node.getInputs().at(LayerNorm::Input::BETA).value()) + ")";
+  dumpUnaryInputOp(node, inputs);
+}
+
 void OperationDumper::visit(const LocalResponseNormalization &node) { dumpOpGeneric(node); }
 
 void OperationDumper::visit(const Loss &node)
@@ -330,6 +350,13 @@ void OperationDumper::visit(const Reverse &node)
   dumpUnaryInputOp(node, axis);
 }
 
+void OperationDumper::visit(const RmsNorm &node)
+{
+  std::string inputs =
+    "Gamma(" + std::to_string(node.getInputs().at(RmsNorm::Input::GAMMA).value()) + ")";
+  dumpUnaryInputOp(node, inputs);
+}
+
 void OperationDumper::visit(const RNN &node)
 {
   VERBOSE(LIR) << "* RNN" << std::endl;
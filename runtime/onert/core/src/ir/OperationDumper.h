@@ -32,6 +32,7 @@ public:
 
 public:
   void visit(const operation::ArgMinMax &) override;
+  void visit(const operation::Attention &node) override;
   void visit(const operation::BatchToSpaceND &node) override;
   void visit(const operation::BCQFullyConnected &node) override;
   void visit(const operation::BinaryArithmetic &node) override;
@@ -54,6 +55,7 @@ public:
   void visit(const operation::HashtableLookup &) override;
   void visit(const operation::InstanceNorm &) override;
   void visit(const operation::L2Normalization &) override;
+  void visit(const operation::LayerNorm &) override;
   void visit(const operation::LocalResponseNormalization &) override;
   void visit(const operation::Loss &node) override;
   void visit(const operation::LSTM &) override;
@@ -70,6 +72,7 @@ public:
   void visit(const operation::ResizeBilinear &) override;
   void visit(const operation::ResizeNearestNeighbor &) override;
   void visit(const operation::Reverse &) override;
+  void visit(const operation::RmsNorm &) override;
   void visit(const operation::RNN &) override;
   void visit(const operation::Select &node) override;
   void visit(const operation::Shape &node) override;
@@ -113,6 +113,25 @@ void OperationValidator::visit(const operation::ArgMinMax &node)
   OP_REQUIRES(isValidType(output_index, output_type));
 }
 
+void OperationValidator::visit(const operation::Attention &node)
+{
+  const auto query_index(node.getInputs().at(operation::Attention::Input::QUERY));
+  const auto key_index(node.getInputs().at(operation::Attention::Input::KEY));
+  const auto value_index(node.getInputs().at(operation::Attention::Input::VALUE));
+  const auto output_index(node.getOutputs().at(0));
+
+  OP_REQUIRES(isValidType(query_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(query_index, key_index));
+  OP_REQUIRES(isSameType(query_index, value_index));
+  OP_REQUIRES(isSameType(query_index, output_index));
+
+  if (node.getInputs().size() > operation::Attention::Input::MASK)
+  {
+    const auto mask_index(node.getInputs().at(operation::Attention::Input::MASK));
+    OP_REQUIRES(!mask_index.valid() || isValidType(mask_index, DataType::FLOAT32));
+  }
+}
+
 void OperationValidator::visit(const operation::BatchMatMul &node)
 {
   const auto lhs_index(node.getInputs().at(operation::BatchMatMul::Input::LHS));
@@ -253,6 +272,7 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
   switch (node.param().op_type)
   {
     case operation::ElementwiseActivation::Type::ELU:
+    case operation::ElementwiseActivation::Type::GELU:
       OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
       break;
     case operation::ElementwiseActivation::Type::LEAKY_RELU:
@@ -374,6 +394,19 @@ void OperationValidator::visit(const operation::HashtableLookup &node)
   OP_REQUIRES(isValidType(hits_index, DataType::QUANT_UINT8_ASYMM));
 }
 
+void OperationValidator::visit(const operation::LayerNorm &node)
+{
+  const auto input_index{node.getInputs().at(operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(operation::LayerNorm::Input::BETA)};
+  const auto output_index{node.getOutputs().at(0)};
+
+  OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(input_index, gamma_index));
+  OP_REQUIRES(isSameType(input_index, beta_index));
+  OP_REQUIRES(isSameType(input_index, output_index));
+}
+
 void OperationValidator::visit(const operation::Pack &node)
 {
   const auto num{node.param().num};
@@ -436,6 +469,17 @@ void OperationValidator::visit(const operation::Reverse &node)
   OP_REQUIRES(isSameType(output_index, input_index));
 }
 
+void OperationValidator::visit(const operation::RmsNorm &node)
+{
+  const auto input_index{node.getInputs().at(operation::RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(operation::RmsNorm::Input::GAMMA)};
+  const auto output_index{node.getOutputs().at(0)};
+
+  OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(input_index, gamma_index));
+  OP_REQUIRES(isSameType(input_index, output_index));
+}
+
 void OperationValidator::visit(const operation::Select &node)
 {
   const auto condition_index{node.getInputs().at(operation::Select::Input::CONDITION)};
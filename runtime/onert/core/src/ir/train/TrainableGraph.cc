@@ -243,7 +243,8 @@ TrainableGraph::truncateBackwardOrder(std::vector<ir::OperationIndex> backward_o
     const auto &op = operations().at(index);
     const auto &trainable_op = dynamic_cast<const ITrainableOperation &>(op);
 
-    if (trainable_op.hasTrainableParameter())
+    // Operations before the earliest operation whose weights are updated are not backwarded
+    if (trainable_op.hasTrainableParameter() && trainable_op.isWeightsUpdateEnabled())
       alive.insert(index);
 
     // TODO: replace this with `std::set::contains` after C++20
@@ -48,14 +48,18 @@ OperationIndex addElementwiseActivationOperation(train::TrainableGraph &tgraph,
 
 OperationIndex addFullyConnectedOperation(train::TrainableGraph &tgraph,
                                           const OperandIndexSequence inputs,
-                                          const OperandIndexSequence outputs)
+                                          const OperandIndexSequence outputs,
+                                          bool trainable = true)
 {
   // Add "FullyConnected" operation
   operation::FullyConnected::Param param;
   param.weights_format = FullyConnectedWeightsFormat::Default;
   param.activation = Activation::NONE;
   auto fc_op = operation::FullyConnected(inputs, outputs, param);
-  return tgraph.addOperation(std::make_unique<train::operation::FullyConnected>(fc_op));
+  auto trainable_op = std::make_unique<train::operation::FullyConnected>(fc_op);
+  if (trainable)
+    trainable_op->enableWeightsUpdate();
+  return tgraph.addOperation(std::move(trainable_op));
 }
 
 OperationIndex addLossOperation(train::TrainableGraph &tgraph, const OperandIndexSequence inputs,
@@ -273,3 +277,48 @@ TEST(TrainableGraph, truncating_backward_topological_order_nonlinear)
 
   ASSERT_TRUE(truncation == expected_truncation_1 || truncation == expected_truncation_2);
 }
+
+TEST(TrainableGraph, truncating_backward_topological_order_frozen)
+{
+  train::TrainableGraph tgraph;
+
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+
+  /*
+  (input) ⎼[FC1]⎼> (u) ⎼[EA]⎼> (v)
+           ╱                      ╲
+  (weight1)             (weight2) ⎼[FC2]⎼> (y_pred)
+                                                   ╲
+                                                    [Loss]⎼> (output)
+                                                   ╱
+                                           (y_true)
+  */
+
+  auto input = tgraph.addOperand(shape, type);
+  auto weight1 = tgraph.addOperand(shape, type);
+  auto u = tgraph.addOperand(shape, type);
+  auto v = tgraph.addOperand(shape, type);
+  auto weight2 = tgraph.addOperand(shape, type);
+  auto y_pred = tgraph.addOperand(shape, type);
+  auto y_true = tgraph.addOperand(shape, type);
+  auto output = tgraph.addOperand(shape, type);
+
+  tgraph.addInput({input});
+  tgraph.addInput({weight1});
+  tgraph.addInput({weight2});
+  tgraph.addInput({y_true});
+  tgraph.addOutput({output});
+
+  // Only FC2 is trainable, so FC1 and EA before it are not backwarded
+  addFullyConnectedOperation(tgraph, {input, weight1}, {u}, false);
+  addElementwiseActivationOperation(tgraph, {u}, {v});
+  auto fc2 = addFullyConnectedOperation(tgraph, {v, weight2}, {y_pred});
+  auto loss = addLossOperation(tgraph, {y_pred, y_true}, {output});
+
+  std::vector<OperationIndex> expected_truncation{loss, fc2};
+  std::vector<OperationIndex> truncation =
+    tgraph.truncateBackwardOrder(tgraph.btopolSortOperations());
+
+  ASSERT_EQ(truncation, expected_truncation);
+}
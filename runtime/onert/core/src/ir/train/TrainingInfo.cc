@@ -28,6 +28,9 @@ bool TrainingInfo::isValid() const
   if (_batch_size == 0)
     return false;
 
+  if (_accumulation_steps == 0)
+    return false;
+
   if (_optimizer_info.optim_code == OptimizerCode::Undefined)
     return false;
 
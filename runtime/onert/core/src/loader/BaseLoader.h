@@ -131,6 +131,7 @@ private:
 
   void loadAddV2(const Operator *op, ir::Graph &subg);
   void loadArgMinMax(const Operator *op, ir::Graph &subg, bool is_argmax);
+  void loadAttention(const Operator *op, ir::Graph &subg);
   void loadBatchMatMul(const Operator *op, ir::Graph &subg);
   void loadBinaryArithmetic(const Operator *op, ir::Graph &subg,
                             ir::operation::BinaryArithmetic::ArithmeticType op_type);
@@ -151,7 +152,9 @@ private:
   void loadFC(const Operator *op, ir::Graph &subg);
   void loadFusedBatchNorm(const Operator *op, ir::Graph &subg);
   void loadGather(const Operator *op, ir::Graph &subg);
+  void loadGelu(const Operator *op, ir::Graph &subg);
   void loadIf(const Operator *op, ir::Graph &subg);
+  void loadLayerNorm(const Operator *op, ir::Graph &subg);
   void loadLeakyRelu(const Operator *op, ir::Graph &subg);
   void loadLogSoftmax(const Operator *op, ir::Graph &subg);
   void loadDetectionPostProcess(const Operator *op, ir::Graph &subg);
@@ -164,6 +167,7 @@ private:
   void loadReshape(const Operator *op, ir::Graph &subg);
   void loadResizeBilinear(const Operator *op, ir::Graph &subg);
   void loadResizeNearestNeighbor(const Operator *op, ir::Graph &subg);
+  void loadRmsNorm(const Operator *op, ir::Graph &subg);
   void loadSoftmax(const Operator *op, ir::Graph &subg);
   void loadSpaceToDepth(const Operator *op, ir::Graph &subg);
   void loadSplit(const Operator *op, ir::Graph &subg);
@@ -1119,10 +1123,15 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
     FusedBatchNorm,
     StatelessRandomUniform,
     Erf,
-    DetectionPostProcess
+    DetectionPostProcess,
+    LayerNorm,
+    RmsNorm,
+    Attention
   };
 
   // Mapping from custom op name string to BuiltinOP enum
+  // Forms of LayerNorm, RmsNorm and ScaledDotProductAttention are described in
+  // docs/runtime/fused-custom-operations.md
   std::map<std::string, BuiltinOP> builtin_map = {
     {"AddV2", BuiltinOP::AddV2},
     {"All", BuiltinOP::ReduceAll},
@@ -1134,6 +1143,9 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
     {"StatelessRandomUniform", BuiltinOP::StatelessRandomUniform},
     {"Erf", BuiltinOP::Erf},
     {"TFLite_Detection_PostProcess", BuiltinOP::DetectionPostProcess},
+    {"LayerNorm", BuiltinOP::LayerNorm},
+    {"RmsNorm", BuiltinOP::RmsNorm},
+    {"ScaledDotProductAttention", BuiltinOP::Attention},
   };
 
   try
@@ -1172,6 +1184,15 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
       case BuiltinOP::DetectionPostProcess:
         loadDetectionPostProcess(op, subg);
         break;
+      case BuiltinOP::LayerNorm:
+        loadLayerNorm(op, subg);
+        break;
+      case BuiltinOP::RmsNorm:
+        loadRmsNorm(op, subg);
+        break;
+      case BuiltinOP::Attention:
+        loadAttention(op, subg);
+        break;
       default:
         throw std::runtime_error{
           "Loader: Custom OP map is defined but operation loader function is not defined"};
@@ -1341,6 +1362,55 @@ void BaseLoader<LoaderDomain>::loadFusedBatchNorm(const Operator *op, ir::Graph
   }
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadLayerNorm(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::LayerNorm::Param param;
+  param.epsilon = 1e-5f;
+  if (op->custom_options() != nullptr)
+  {
+    const auto attr_map = getCustomOpAttrMap(op);
+    if (!attr_map["epsilon"].IsNull())
+      param.epsilon = attr_map["epsilon"].AsFloat();
+  }
+
+  loadOperationTo<ir::operation::LayerNorm>(op, subg, param);
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadRmsNorm(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::RmsNorm::Param param;
+  param.epsilon = 1e-6f;
+  if (op->custom_options() != nullptr)
+  {
+    const auto attr_map = getCustomOpAttrMap(op);
+    if (!attr_map["epsilon"].IsNull())
+      param.epsilon = attr_map["epsilon"].AsFloat();
+  }
+
+  loadOperationTo<ir::operation::RmsNorm>(op, subg, param);
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadAttention(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::Attention::Param param;
+  // Scale of 0 means 1/sqrt(depth)
+  param.scale = 0.f;
+  param.causal = false;
+  if (op->custom_options() != nullptr)
+  {
+    const auto attr_map = getCustomOpAttrMap(op);
+    if (!attr_map["scale"].IsNull())
+      param.scale = attr_map["scale"].AsFloat();
+    if (!attr_map["causal"].IsNull())
+      param.causal = attr_map["causal"].AsBool();
+  }
+
+  loadOperationTo<ir::operation::Attention>(op, subg, param);
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadOneHot(const Operator *op, ir::Graph &subg)
 {
@@ -1419,6 +1489,16 @@ void BaseLoader<LoaderDomain>::loadLeakyRelu(const Operator *op, ir::Graph &subg
                             1.f);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadGelu(const Operator *op, ir::Graph &subg)
+{
+  const auto *options = op->builtin_options_as_GeluOptions();
+  // GELU uses tanh approximation if alpha is not 0
+  const float approximate = (options != nullptr && options->approximate()) ? 1.f : 0.f;
+  loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::GELU,
+                            approximate);
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadUnidirectionalSequenceLSTM(const Operator *op, ir::Graph &subg)
 {
@@ -1741,6 +1821,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_HASHTABLE_LOOKUP:
       loadOperationTo<ir::operation::HashtableLookup>(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_GELU:
+      loadGelu(op, subg);
+      return;
     default:
       throw std::runtime_error(
         std::string("Unsupported operation: ").append(EnumNameBuiltinOperator(builtin_op)));
@@ -127,6 +127,18 @@ ir::Shape inferEltwiseShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_sha
   return broadcastShapes(lhs_shape, rhs_shape);
 }
 
+ir::Shape inferEmbeddingLookupShape(const ir::Shape &lookups_shape, const ir::Shape &values_shape)
+{
+  if (lookups_shape.rank() != 1 || values_shape.rank() < 2)
+    throw std::runtime_error("EmbeddingLookup shape inference: lookups should be 1D and values "
+                             "should have rank of at least 2");
+
+  // Each lookup is replaced with a row of values
+  ir::Shape out_shape = values_shape;
+  out_shape.dim(0) = lookups_shape.dim(0);
+  return out_shape;
+}
+
 ir::Shape inferArgMinMaxShape(const ir::Shape &input_shape, int axis, int rank)
 {
   if (axis < 0 || axis >= rank)
@@ -147,6 +159,19 @@ ir::Shape inferArgMinMaxShape(const ir::Shape &input_shape, int axis, int rank)
   return out_shape;
 }
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &value_shape)
+{
+  const auto rank = query_shape.rank();
+  if (rank < 2 || value_shape.rank() != rank)
+    throw std::runtime_error("Attention shape inference: query and value should have same rank "
+                             "of at least 2");
+
+  // Each query is replaced with a weighted sum of values
+  ir::Shape out_shape = query_shape;
+  out_shape.dim(rank - 1) = value_shape.dim(rank - 1);
+  return out_shape;
+}
+
 ir::Shape inferReduceShape(const ir::Shape &input_shape, const std::vector<int> &axes,
                            bool keep_dims)
 {
@@ -589,6 +614,40 @@ ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, const int32_t outp
   return ret;
 }
 
+ir::Shape inferResizeNearestNeighborShape(const ir::Shape &in_shape, const int32_t output_height,
+                                          const int32_t output_width)
+{
+  if (in_shape.rank() != 4)
+    throw std::runtime_error{"ResizeNearestNeighbor: input should be 4D, rank = " +
+                             std::to_string(in_shape.rank())};
+  if (output_height < 0 || output_width < 0)
+  {
+    throw std::runtime_error{"ResizeNearestNeighbor: size value must be positive value, size = " +
+                             std::to_string(output_height) + "x" + std::to_string(output_width)};
+  }
+
+  ir::Shape ret(in_shape.rank());
+
+  ret.dim(0) = in_shape.dim(0);
+  ret.dim(1) = output_height;
+  ret.dim(2) = output_width;
+  ret.dim(3) = in_shape.dim(3);
+
+  return ret;
+}
+
+ir::Shape inferRNNShape(const ir::Shape &input_shape, const ir::Shape &weights_shape)
+{
+  if (input_shape.rank() != 2 || weights_shape.rank() != 2)
+    throw std::runtime_error("RNN shape inference: input and weights should be 2D");
+
+  // [batch_size, num_units] for both output and hidden state
+  ir::Shape out_shape(2);
+  out_shape.dim(0) = input_shape.dim(0);
+  out_shape.dim(1) = weights_shape.dim(0);
+  return out_shape;
+}
+
 template <typename T> ir::Shape inferRangeShape(T start_val, T limit_val, T delta_val)
 {
   ir::Shape out_shape(static_cast<int>(1));
@@ -1079,6 +1138,20 @@ ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_bu
   return new_Shape;
 }
 
+ir::Shape inferTopKV2Shape(const ir::Shape &input_shape, int32_t k)
+{
+  if (input_shape.rank() < 1)
+    throw std::runtime_error("TopKV2 shape inference: input should have rank of at least 1");
+  if (k < 0 || k > input_shape.dim(input_shape.rank() - 1))
+    throw std::runtime_error("TopKV2 shape inference: k should be in [0, last dimension], k = " +
+                             std::to_string(k));
+
+  // Values and indices have the same shape
+  ir::Shape out_shape = input_shape;
+  out_shape.dim(input_shape.rank() - 1) = k;
+  return out_shape;
+}
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t perm_size)
 {
@@ -1129,6 +1202,23 @@ ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf
   return out_shape;
 }
 
+ir::Shape inferTransposeConvShape(const ir::Shape &output_shape_shape,
+                                  const int32_t *output_shape_buf)
+{
+  assert(output_shape_buf);
+  if (output_shape_shape.rank() != 1 || output_shape_shape.dim(0) != 4)
+    throw std::runtime_error("TransposeConv shape inference: output shape should have 4 elements");
+
+  ir::Shape out_shape(4);
+  for (int i = 0; i < 4; ++i)
+  {
+    if (output_shape_buf[i] < 0)
+      throw std::runtime_error("TransposeConv shape inference: negative output dimension");
+    out_shape.dim(i) = output_shape_buf[i];
+  }
+  return out_shape;
+}
+
 ir::Shape inferUnpackShape(const ir::Shape &input_shape, int axis, int rank)
 {
   ir::Shape out_shape;
@@ -542,3 +542,67 @@ TEST(ShapeInference, BCQGather)
     check(indices_shape, cluster_shape, cluster, hidden_size, axis, rank, expected);
   }
 }
+
+TEST(ShapeInference, Attention)
+{
+  Shape query_shape{1, 8, 5, 64};
+  Shape value_shape{1, 2, 7, 32};
+  auto infered_out_shape = onert::shape_inference::inferAttentionShape(query_shape, value_shape);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 1);
+  ASSERT_EQ(infered_out_shape.dim(1), 8);
+  ASSERT_EQ(infered_out_shape.dim(2), 5);
+  ASSERT_EQ(infered_out_shape.dim(3), 32);
+}
+
+TEST(ShapeInference, neg_Attention)
+{
+  Shape query_shape{5, 64};
+  Shape value_shape{1, 7, 32};
+  ASSERT_THROW(onert::shape_inference::inferAttentionShape(query_shape, value_shape),
+               std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferAttentionShape(Shape{64}, Shape{32}),
+               std::runtime_error);
+}
+
+TEST(ShapeInference, TopKV2)
+{
+  Shape input_shape{2, 3, 10};
+  auto infered_out_shape = onert::shape_inference::inferTopKV2Shape(input_shape, 4);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 4);
+}
+
+TEST(ShapeInference, neg_TopKV2)
+{
+  Shape input_shape{2, 3, 10};
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(input_shape, 11), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(input_shape, -1), std::runtime_error);
+}
+
+TEST(ShapeInference, TransposeConv)
+{
+  Shape output_shape_shape{4};
+  int32_t output_shape_buf[4] = {1, 8, 6, 3};
+  auto infered_out_shape =
+    onert::shape_inference::inferTransposeConvShape(output_shape_shape, output_shape_buf);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 1);
+  ASSERT_EQ(infered_out_shape.dim(1), 8);
+  ASSERT_EQ(infered_out_shape.dim(2), 6);
+  ASSERT_EQ(infered_out_shape.dim(3), 3);
+}
+
+TEST(ShapeInference, neg_TransposeConv)
+{
+  int32_t output_shape_buf[4] = {1, -8, 6, 3};
+  ASSERT_THROW(onert::shape_inference::inferTransposeConvShape(Shape{4}, output_shape_buf),
+               std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTransposeConvShape(Shape{3}, output_shape_buf),
+               std::runtime_error);
+}
@@ -225,6 +225,12 @@ uint32_t CircleGen::addOperatorElu(const OperatorParams &params)
                                 0);
 }
 
+uint32_t CircleGen::addOperatorEmbeddingLookup(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_EMBEDDING_LOOKUP,
+                                circle::BuiltinOptions_NONE, 0);
+}
+
 uint32_t CircleGen::addOperatorEqual(const OperatorParams &params)
 {
   auto options = circle::CreateEqualOptions(_fbb).Union();
@@ -296,6 +302,21 @@ uint32_t CircleGen::addOperatorL2Normalization(const OperatorParams &params)
                                 circle::BuiltinOptions_L2NormOptions, options);
 }
 
+uint32_t CircleGen::addOperatorLayerNorm(const OperatorParams &params, float epsilon)
+{
+  // flexbuffer custom_option
+  auto flex_buffers = std::make_unique<flexbuffers::Builder>();
+  size_t map_start = flex_buffers->StartMap();
+  flex_buffers->Float("epsilon", epsilon);
+  flex_buffers->EndMap(map_start);
+  flex_buffers->Finish();
+
+  return addCustomOperatorWithOptions(params, "LayerNorm", circle::BuiltinOptions_NONE, 0,
+                                      &flex_buffers->GetBuffer(),
+                                      circle::CustomOptionsFormat::CustomOptionsFormat_FLEXBUFFERS,
+                                      nullptr, nullptr);
+}
+
 uint32_t CircleGen::addOperatorLess(const OperatorParams &params)
 {
   auto options = circle::CreateLessOptions(_fbb).Union();
@@ -374,6 +395,12 @@ uint32_t CircleGen::addOperatorPadV2(const OperatorParams &params)
                                 circle::BuiltinOptions_PadV2Options, options);
 }
 
+uint32_t CircleGen::addOperatorPRelu(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_PRELU, circle::BuiltinOptions_NONE,
+                                0);
+}
+
 uint32_t CircleGen::addOperatorQuantize(const OperatorParams &params)
 {
   auto options = circle::CreateQuantizeOptions(_fbb).Union();
@@ -447,6 +474,38 @@ uint32_t CircleGen::addOperatorReverseV2(const OperatorParams &params)
                                 circle::BuiltinOptions_ReverseV2Options, options);
 }
 
+uint32_t CircleGen::addOperatorRmsNorm(const OperatorParams &params, float epsilon)
+{
+  // flexbuffer custom_option
+  auto flex_buffers = std::make_unique<flexbuffers::Builder>();
+  size_t map_start = flex_buffers->StartMap();
+  flex_buffers->Float("epsilon", epsilon);
+  flex_buffers->EndMap(map_start);
+  flex_buffers->Finish();
+
+  return addCustomOperatorWithOptions(params, "RmsNorm", circle::BuiltinOptions_NONE, 0,
+                                      &flex_buffers->GetBuffer(),
+                                      circle::CustomOptionsFormat::CustomOptionsFormat_FLEXBUFFERS,
+                                      nullptr, nullptr);
+}
+
+uint32_t CircleGen::addOperatorScaledDotProductAttention(const OperatorParams &params, float scale,
+                                                         bool causal)
+{
+  // flexbuffer custom_option
+  auto flex_buffers = std::make_unique<flexbuffers::Builder>();
+  size_t map_start = flex_buffers->StartMap();
+  flex_buffers->Float("scale", scale);
+  flex_buffers->Bool("causal", causal);
+  flex_buffers->EndMap(map_start);
+  flex_buffers->Finish();
+
+  return addCustomOperatorWithOptions(params, "ScaledDotProductAttention",
+                                      circle::BuiltinOptions_NONE, 0, &flex_buffers->GetBuffer(),
+                                      circle::CustomOptionsFormat::CustomOptionsFormat_FLEXBUFFERS,
+                                      nullptr, nullptr);
+}
+
 uint32_t CircleGen::addOperatorShape(const OperatorParams &params, circle::TensorType type)
 {
   auto options = circle::CreateShapeOptions(_fbb, type).Union();
@@ -546,6 +605,14 @@ uint32_t CircleGen::addOperatorTranspose(const OperatorParams &params)
                                 circle::BuiltinOptions_TransposeOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTransposeConv(const OperatorParams &params, circle::Padding padding,
+                                             int stride_w, int stride_h)
+{
+  auto options = circle::CreateTransposeConvOptions(_fbb, padding, stride_w, stride_h).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TRANSPOSE_CONV,
+                                circle::BuiltinOptions_TransposeConvOptions, options);
+}
+
 uint32_t CircleGen::addOperatorSqrt(const OperatorParams &params)
 {
   return addOperatorWithOptions(params, circle::BuiltinOperator_SQRT, circle::BuiltinOptions_NONE,
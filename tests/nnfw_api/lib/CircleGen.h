@@ -166,6 +166,7 @@ public:
                                            float nms_iou_threshold, int max_detections,
                                            int max_classes_per_detection, int detections_per_class);
   uint32_t addOperatorElu(const OperatorParams &params);
+  uint32_t addOperatorEmbeddingLookup(const OperatorParams &params);
   uint32_t addOperatorEqual(const OperatorParams &params);
   uint32_t addOperatorExpandDims(const OperatorParams &params);
   uint32_t addOperatorFill(const OperatorParams &params);
@@ -181,6 +182,7 @@ public:
   uint32_t addOperatorInstanceNorm(const OperatorParams &params, float epsilon,
                                    circle::ActivationFunctionType actfn);
   uint32_t addOperatorL2Normalization(const OperatorParams &params);
+  uint32_t addOperatorLayerNorm(const OperatorParams &params, float epsilon);
   uint32_t addOperatorLeakyRelu(const OperatorParams &params, float alpha);
   uint32_t addOperatorLess(const OperatorParams &params);
   uint32_t addOperatorLessEqual(const OperatorParams &params);
@@ -192,6 +194,7 @@ public:
   uint32_t addOperatorOneHot(const OperatorParams &params, int32_t axis);
   uint32_t addOperatorPad(const OperatorParams &params);
   uint32_t addOperatorPadV2(const OperatorParams &params);
+  uint32_t addOperatorPRelu(const OperatorParams &params);
   uint32_t addOperatorQuantize(const OperatorParams &params);
   uint32_t addOperatorRank(const OperatorParams &params);
   uint32_t addOperatorReduce(const OperatorParams &params, circle::BuiltinOperator reduce_op,
@@ -207,6 +210,9 @@ public:
                                      bool half_pixel_centers = false);
   uint32_t addOperatorResizeNearestNeighbor(const OperatorParams &params);
   uint32_t addOperatorReverseV2(const OperatorParams &params);
+  uint32_t addOperatorRmsNorm(const OperatorParams &params, float epsilon);
+  uint32_t addOperatorScaledDotProductAttention(const OperatorParams &params, float scale,
+                                                bool causal);
   uint32_t addOperatorShape(const OperatorParams &params,
                             circle::TensorType type = circle::TensorType::TensorType_INT32);
   uint32_t addOperatorSelect(const OperatorParams &params);
@@ -222,6 +228,8 @@ public:
   uint32_t addOperatorSub(const OperatorParams &params, circle::ActivationFunctionType actfn);
   uint32_t addOperatorTile(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
+  uint32_t addOperatorTransposeConv(const OperatorParams &params, circle::Padding padding,
+                                    int stride_w, int stride_h);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
 
   // NOTE Please add addOperator functions ABOVE this line in ALPHABETICAL ORDER
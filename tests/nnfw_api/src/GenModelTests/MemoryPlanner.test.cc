@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <cstdlib>
+
+/**
+ * @brief Run models with each memory planner of cpu backend
+ *        Results must not depend on the planner, including in-place sharing of tensors
+ */
+class MemoryPlannerTest : public GenModelTest, public ::testing::WithParamInterface<std::string>
+{
+protected:
+  void SetUp() override
+  {
+    GenModelTest::SetUp();
+    setenv("CPU_MEMORY_PLANNER", GetParam().c_str(), 1);
+  }
+
+  void TearDown() override
+  {
+    GenModelTest::TearDown();
+    unsetenv("CPU_MEMORY_PLANNER");
+  }
+};
+
+TEST_P(MemoryPlannerTest, ElementwiseChain)
+{
+  // in -> Neg -> ExpandDims -> Relu -> Neg -> out
+  // On InPlace, ExpandDims and Relu write on memory of their inputs
+  CircleGen cgen;
+  std::vector<int32_t> axis_data{0};
+  uint32_t axis_buf = cgen.addBuffer(axis_data);
+  int in = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int neg = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int axis = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, axis_buf});
+  int expanded = cgen.addTensor({{1, 1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int relu = cgen.addTensor({{1, 1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 1, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorNeg({{in}, {neg}});
+  cgen.addOperatorExpandDims({{neg, axis}, {expanded}});
+  cgen.addOperatorRelu({{expanded}, {relu}});
+  cgen.addOperatorNeg({{relu}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, -2, 3, -4}}, {{0, -2, 0, -4}}));
+  _context->addTestCase(uniformTCD<float>({{-5, 6, -7, 8}}, {{-5, 0, -7, 0}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_P(MemoryPlannerTest, AddChain)
+{
+  // (in0 + in1) -> Add with in1 -> Add with itself -> out
+  // On InPlace, the second Add writes on memory of its first input
+  CircleGen cgen;
+  int in0 = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int in1 = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int add0 = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int add1 = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{in0, in1}, {add0}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorAdd({{add0, in1}, {add1}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorAdd({{add1, add1}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({in0, in1}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}, {1, 1, 2, 2}}, {{6, 8, 14, 16}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+INSTANTIATE_TEST_SUITE_P(GenModelTest, MemoryPlannerTest,
+                         ::testing::Values("FirstFit", "WIC", "InPlace"));
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains test cases which compare training results of different training
+ *       options on the same data.
+ */
+
+#include "CircleGen.h"
+#include "fixtures.h"
+
+#include <nnfw_internal.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr uint32_t kInputSize = 3;
+constexpr uint32_t kOutputSize = 2;
+
+struct TrainOptions
+{
+  uint32_t batch_size = 1;
+  uint32_t replicas = 1;
+  uint32_t accumulation_steps = 1;
+  bool multi_layer = false; //< Train genMultiLayer() model instead of genFullyConnected()
+  std::string checkpoints;  //< TRAINING_CHECKPOINTS, empty to keep all activations
+};
+
+struct TrainResult
+{
+  std::vector<float> losses;  //< Loss of each step
+  std::vector<float> outputs; //< Inference result of a batch after training
+};
+
+CircleBuffer genFullyConnected()
+{
+  CircleGen cgen;
+  uint32_t weight_buf = cgen.addBuffer(std::vector<float>{0.1f, -0.2f, 0.3f, 0.4f, 0.5f, -0.6f});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<float>{0.1f, -0.1f});
+  int in = cgen.addTensor({{1, kInputSize}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor(
+    {{kOutputSize, kInputSize}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int bias = cgen.addTensor({{kOutputSize}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int out = cgen.addTensor({{1, kOutputSize}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{in, weight, bias}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+// FullyConnected(0) - Relu(1) - FullyConnected(2) - Relu(3) - FullyConnected(4)
+CircleBuffer genMultiLayer()
+{
+  constexpr uint32_t kHiddenSize = 4;
+  CircleGen cgen;
+  uint32_t weight0_buf = cgen.addBuffer(std::vector<float>{
+    0.1f, -0.2f, 0.3f, 0.4f, 0.5f, -0.6f, -0.3f, 0.2f, 0.1f, 0.2f, 0.1f, -0.4f});
+  uint32_t bias0_buf = cgen.addBuffer(std::vector<float>{0.1f, -0.1f, 0.2f, 0.0f});
+  uint32_t weight1_buf =
+    cgen.addBuffer(std::vector<float>{0.3f, -0.1f, 0.2f, 0.1f, -0.2f, 0.4f, 0.1f, 0.3f, 0.1f, 0.1f,
+                                      -0.3f, 0.2f, 0.2f, 0.2f, 0.1f, -0.1f});
+  uint32_t bias1_buf = cgen.addBuffer(std::vector<float>{0.0f, 0.1f, -0.1f, 0.2f});
+  uint32_t weight2_buf =
+    cgen.addBuffer(std::vector<float>{0.2f, -0.3f, 0.4f, 0.1f, -0.1f, 0.2f, 0.3f, -0.2f});
+  uint32_t bias2_buf = cgen.addBuffer(std::vector<float>{0.1f, -0.1f});
+
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  int in = cgen.addTensor({{1, kInputSize}, f32});
+  int weight0 = cgen.addTensor({{kHiddenSize, kInputSize}, f32, weight0_buf});
+  int bias0 = cgen.addTensor({{kHiddenSize}, f32, bias0_buf});
+  int fc0 = cgen.addTensor({{1, kHiddenSize}, f32});
+  int relu0 = cgen.addTensor({{1, kHiddenSize}, f32});
+  int weight1 = cgen.addTensor({{kHiddenSize, kHiddenSize}, f32, weight1_buf});
+  int bias1 = cgen.addTensor({{kHiddenSize}, f32, bias1_buf});
+  int fc1 = cgen.addTensor({{1, kHiddenSize}, f32});
+  int relu1 = cgen.addTensor({{1, kHiddenSize}, f32});
+  int weight2 = cgen.addTensor({{kOutputSize, kHiddenSize}, f32, weight2_buf});
+  int bias2 = cgen.addTensor({{kOutputSize}, f32, bias2_buf});
+  int out = cgen.addTensor({{1, kOutputSize}, f32});
+  cgen.addOperatorFullyConnected({{in, weight0, bias0}, {fc0}});
+  cgen.addOperatorRelu({{fc0}, {relu0}});
+  cgen.addOperatorFullyConnected({{relu0, weight1, bias1}, {fc1}});
+  cgen.addOperatorRelu({{fc1}, {relu1}});
+  cgen.addOperatorFullyConnected({{relu1, weight2, bias2}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+// Train FullyConnected model with consecutive batches of the given data, and run inference on
+// the first batch of data after training
+void train(const TrainOptions &options, const std::vector<float> &inputs,
+           const std::vector<float> &expecteds, TrainResult &result)
+{
+  const auto cbuf = options.multi_layer ? genMultiLayer() : genFullyConnected();
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_config(session, "TRAINING_REPLICAS", std::to_string(options.replicas).c_str()));
+  if (!options.checkpoints.empty())
+    NNFW_ENSURE_SUCCESS(
+      nnfw_set_config(session, "TRAINING_CHECKPOINTS", options.checkpoints.c_str()));
+
+  nnfw_train_info tri;
+  tri.learning_rate = 0.1f;
+  tri.batch_size = options.batch_size;
+  tri.loss_info.loss = NNFW_TRAIN_LOSS_MEAN_SQUARED_ERROR;
+  tri.loss_info.reduction_type = NNFW_TRAIN_LOSS_REDUCTION_SUM_OVER_BATCH_SIZE;
+  tri.opt = NNFW_TRAIN_OPTIMIZER_SGD;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_accumulation_steps(session, options.accumulation_steps));
+  NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+
+  nnfw_tensorinfo input_info;
+  nnfw_tensorinfo expected_info;
+  NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &input_info));
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &expected_info));
+  EXPECT_EQ(input_info.dims[0], static_cast<int32_t>(options.batch_size));
+
+  const uint32_t num_steps = inputs.size() / (options.batch_size * kInputSize);
+  for (uint32_t step = 0; step < num_steps; ++step)
+  {
+    const auto input = inputs.data() + step * options.batch_size * kInputSize;
+    const auto expected = expecteds.data() + step * options.batch_size * kOutputSize;
+    NNFW_ENSURE_SUCCESS(nnfw_train_set_input(session, 0, input, &input_info));
+    NNFW_ENSURE_SUCCESS(nnfw_train_set_expected(session, 0, expected, &expected_info));
+    NNFW_ENSURE_SUCCESS(nnfw_train(session, true));
+
+    float loss = 0.f;
+    NNFW_ENSURE_SUCCESS(nnfw_train_get_loss(session, 0, &loss));
+    result.losses.emplace_back(loss);
+  }
+
+  result.outputs.resize(options.batch_size * kOutputSize);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, inputs.data(),
+                                     options.batch_size * kInputSize * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, result.outputs.data(),
+                                      result.outputs.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+// 12 samples
+const std::vector<float> kInputs{1,  2,  -1, 0,  1,  3,  -2, 1, 0,  2,  2,  1,  0, -1, 1, 3, 0, 1,
+                                 -1, -2, 2,  1,  -1, -3, 2,  0, -1, -1, -1, -1, 1, 1,  2, 0, 3, -2};
+const std::vector<float> kExpecteds{1, 0, -1, 2,  0.5f, 1, 2,  -1, 0, 1,  1,  1,
+                                    0, 3, 2,  -2, -1,   0, -1, 1,  1, -2, -1, 0};
+
+} // namespace
+
+TEST(TrainingOptions, DataParallel_SameAsSingleReplica)
+{
+  TrainOptions single;
+  single.batch_size = 4;
+  TrainOptions parallel = single;
+  parallel.replicas = 2;
+
+  TrainResult expected;
+  TrainResult actual;
+  train(single, kInputs, kExpecteds, expected);
+  train(parallel, kInputs, kExpecteds, actual);
+
+  ASSERT_EQ(expected.losses.size(), 3u);
+  ASSERT_EQ(actual.losses.size(), expected.losses.size());
+  for (uint32_t i = 0; i < expected.losses.size(); ++i)
+    EXPECT_NEAR(expected.losses[i], actual.losses[i], 1e-5) << "Step #" << i;
+
+  // Replicas run inference on their shards with the weights of the last update
+  ASSERT_EQ(actual.outputs.size(), expected.outputs.size());
+  for (uint32_t i = 0; i < expected.outputs.size(); ++i)
+    EXPECT_NEAR(expected.outputs[i], actual.outputs[i], 1e-5) << "Output #" << i;
+}
+
+TEST(TrainingOptions, neg_DataParallel_IndivisibleBatch)
+{
+  const auto cbuf = genFullyConnected();
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "TRAINING_REPLICAS", "3"));
+
+  nnfw_train_info tri;
+  tri.batch_size = 4;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  EXPECT_NE(nnfw_train_prepare(session), NNFW_STATUS_NO_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TrainingOptions, Accumulation_SameAsLargeBatch)
+{
+  TrainOptions large;
+  large.batch_size = 4;
+  TrainOptions accumulated;
+  accumulated.batch_size = 2;
+  accumulated.accumulation_steps = 2;
+
+  TrainResult expected;
+  TrainResult actual;
+  train(large, kInputs, kExpecteds, expected);
+  train(accumulated, kInputs, kExpecteds, actual);
+
+  // Weights are not updated within a window, so the mean loss of a window is the loss of the
+  // large batch
+  ASSERT_EQ(expected.losses.size(), 3u);
+  ASSERT_EQ(actual.losses.size(), 6u);
+  for (uint32_t i = 0; i < expected.losses.size(); ++i)
+  {
+    const auto mean = (actual.losses[i * 2] + actual.losses[i * 2 + 1]) / 2;
+    EXPECT_NEAR(expected.losses[i], mean, 1e-5) << "Step #" << i;
+  }
+
+  // Compare inference results of the first 2 samples
+  ASSERT_EQ(actual.outputs.size(), 2 * kOutputSize);
+  for (uint32_t i = 0; i < actual.outputs.size(); ++i)
+    EXPECT_NEAR(expected.outputs[i], actual.outputs[i], 1e-5) << "Output #" << i;
+}
+
+TEST(TrainingOptions, Accumulation_WithReplicas)
+{
+  TrainOptions large;
+  large.batch_size = 4;
+  TrainOptions accumulated;
+  accumulated.batch_size = 2;
+  accumulated.replicas = 2;
+  accumulated.accumulation_steps = 2;
+
+  TrainResult expected;
+  TrainResult actual;
+  train(large, kInputs, kExpecteds, expected);
+  train(accumulated, kInputs, kExpecteds, actual);
+
+  ASSERT_EQ(actual.outputs.size(), 2 * kOutputSize);
+  for (uint32_t i = 0; i < actual.outputs.size(); ++i)
+    EXPECT_NEAR(expected.outputs[i], actual.outputs[i], 1e-5) << "Output #" << i;
+}
+
+TEST(TrainingOptions, neg_Accumulation_ZeroSteps)
+{
+  const auto cbuf = genFullyConnected();
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  EXPECT_NE(nnfw_train_set_accumulation_steps(session, 0), NNFW_STATUS_NO_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TrainingOptions, Checkpoints_SameAsKeepingAll)
+{
+  TrainOptions keep_all;
+  keep_all.batch_size = 2;
+  keep_all.multi_layer = true;
+
+  TrainResult expected;
+  train(keep_all, kInputs, kExpecteds, expected);
+  ASSERT_EQ(expected.losses.size(), 6u);
+
+  // Recomputed activations are the same as kept ones, so training results do not change
+  for (const std::string checkpoints : {"auto", "1;3", "2"})
+  {
+    TrainOptions checkpointed = keep_all;
+    checkpointed.checkpoints = checkpoints;
+
+    TrainResult actual;
+    train(checkpointed, kInputs, kExpecteds, actual);
+
+    ASSERT_EQ(actual.losses.size(), expected.losses.size()) << checkpoints;
+    for (uint32_t i = 0; i < expected.losses.size(); ++i)
+      EXPECT_FLOAT_EQ(expected.losses[i], actual.losses[i]) << checkpoints << " step #" << i;
+
+    ASSERT_EQ(actual.outputs.size(), expected.outputs.size()) << checkpoints;
+    for (uint32_t i = 0; i < expected.outputs.size(); ++i)
+      EXPECT_FLOAT_EQ(expected.outputs[i], actual.outputs[i]) << checkpoints << " output #" << i;
+  }
+}
+
+TEST(TrainingOptions, neg_Checkpoints_InvalidList)
+{
+  const auto cbuf = genMultiLayer();
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "TRAINING_CHECKPOINTS", "1;x"));
+
+  nnfw_train_info tri;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  EXPECT_NE(nnfw_train_prepare(session), NNFW_STATUS_NO_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
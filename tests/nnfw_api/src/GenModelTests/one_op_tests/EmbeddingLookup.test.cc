@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_EmbeddingLookup)
+{
+  CircleGen cgen;
+  uint32_t values_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4, 5, 6});
+  int lookups = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32});
+  int values = cgen.addTensor({{3, 2}, circle::TensorType::TensorType_FLOAT32, values_buf});
+  int out = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorEmbeddingLookup({{lookups, values}, {out}});
+  cgen.setInputsAndOutputs({lookups}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    TestCaseData{}.addInput<int32_t>({2, 0}).addOutput<float>({5, 6, 1, 2}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_EmbeddingLookup_InvalidLookupsRank)
+{
+  CircleGen cgen;
+  uint32_t values_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4, 5, 6});
+  // Lookups must be 1D
+  int lookups = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT32});
+  int values = cgen.addTensor({{3, 2}, circle::TensorType::TensorType_FLOAT32, values_buf});
+  int out = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorEmbeddingLookup({{lookups, values}, {out}});
+  cgen.setInputsAndOutputs({lookups}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
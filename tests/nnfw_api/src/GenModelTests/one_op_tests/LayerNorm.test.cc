@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_LayerNorm)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{2, 2, 2, 2});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0, 0, 1});
+  int gamma = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  // Variance of each row is 1, so rows are divided by sqrt(1 + epsilon) = 2
+  cgen.addOperatorLayerNorm({{in, gamma, beta}, {out}}, 3.f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    uniformTCD<float>({{0, 2, 0, 2, 5, 3, 3, 5}}, {{-1, 1, -1, 2, 1, -1, -1, 2}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_LayerNorm_InvalidGamma)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{2, 2});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0, 0, 1});
+  int gamma = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorLayerNorm({{in, gamma, beta}, {out}}, 1e-5f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
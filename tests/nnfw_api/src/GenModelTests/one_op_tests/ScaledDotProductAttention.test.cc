@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <limits>
+
+TEST_F(GenModelTest, OneOp_ScaledDotProductAttention_Causal)
+{
+  CircleGen cgen;
+  int query = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorScaledDotProductAttention({{query, key, value}, {out}}, 1.f, true);
+  cgen.setInputsAndOutputs({query, key, value}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Scores are all the same, so each query gets the mean of values it can see.
+  // The first query sees only the first key.
+  _context->addTestCase(
+    uniformTCD<float>({{0, 0, 0, 0}, {1, 2, 3, 4}, {1, 2, 3, 4}}, {{1, 2, 2, 3}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_ScaledDotProductAttention_Mask)
+{
+  CircleGen cgen;
+  const float inf = std::numeric_limits<float>::infinity();
+  uint32_t mask_buf = cgen.addBuffer(std::vector<float>{0, -inf, -inf, 0});
+  int query = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int mask = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32, mask_buf});
+  int out = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  // Two query heads share a key/value head. Each query sees only one key.
+  cgen.addOperatorScaledDotProductAttention({{query, key, value, mask}, {out}}, 0.f, false);
+  cgen.setInputsAndOutputs({query, key, value}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4, 5, 6, 7, 8}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1, 2, 3, 4, 1, 2, 3, 4}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_ScaledDotProductAttention_InvalidDepth)
+{
+  CircleGen cgen;
+  int query = cgen.addTensor({{2, 3}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorScaledDotProductAttention({{query, key, value}, {out}}, 0.f, false);
+  cgen.setInputsAndOutputs({query, key, value}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
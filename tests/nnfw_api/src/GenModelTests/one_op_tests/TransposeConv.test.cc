@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_TransposeConv)
+{
+  CircleGen cgen;
+  uint32_t output_shape_buf = cgen.addBuffer(std::vector<int32_t>{1, 4, 4, 1});
+  uint32_t weights_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int output_shape =
+    cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, output_shape_buf});
+  int weights = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, weights_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 4, 4, 1}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorTransposeConv({{output_shape, weights, in}, {out}}, circle::Padding_VALID, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4}}, {{1, 2, 2, 4, 3, 4, 6, 8, 3, 6, 4, 8, 9, 12, 12, 16}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TransposeConv_OutputShapeToVar)
+{
+  CircleGen cgen;
+  uint32_t weights_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int output_shape = cgen.addTensor({{4}, circle::TensorType::TensorType_INT32});
+  int weights = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, weights_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 4, 4, 1}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorTransposeConv({{output_shape, weights, in}, {out}}, circle::Padding_VALID, 2, 2);
+  cgen.setInputsAndOutputs({output_shape, in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    TestCaseData{}
+      .addInput<int32_t>({1, 4, 4, 1})
+      .addInput<float>({1, 2, 3, 4})
+      .addOutput<float>({1, 2, 2, 4, 3, 4, 6, 8, 3, 6, 4, 8, 9, 12, 12, 16}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_TransposeConv_InvalidKernelDepth)
+{
+  CircleGen cgen;
+  uint32_t output_shape_buf = cgen.addBuffer(std::vector<int32_t>{1, 4, 4, 1});
+  uint32_t weights_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+  int output_shape =
+    cgen.addTensor({{4}, circle::TensorType::TensorType_INT32, output_shape_buf});
+  // Input depth of kernel does not match depth of input
+  int weights = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32, weights_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 4, 4, 1}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorTransposeConv({{output_shape, weights, in}, {out}}, circle::Padding_VALID, 2, 2);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
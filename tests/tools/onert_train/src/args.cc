@@ -258,6 +258,9 @@ void Args::Initialize(void)
     ("learning_rate", po::value<float>()->notifier([&](const auto &v) { _learning_rate = v; }), 
       "Learning rate\n"
       "If not given, model's hyper parameter is used")
+    ("accumulation_steps", po::value<int>()->notifier([&](const auto &v) { _accumulation_steps = v; }),
+      "Number of batches whose gradients are accumulated before updating weights\n"
+      "If not given, weights are updated every batch")
     ("loss", po::value<int>()
       ->notifier([&](const auto& v){_loss_type = checkValidation("loss", valid_loss, v);}),
       genHelpMsg("Loss type", valid_loss).c_str()
@@ -276,6 +279,9 @@ void Args::Initialize(void)
       "0: CATEGORICAL_ACCURACY")
     ("validation_split", po::value<float>()->default_value(0.0f)->notifier(process_validation_split),
          "Float between 0 and 1(0 < float < 1). Fraction of the training data to be used as validation data.")
+    ("shuffle_seed", po::value<uint32_t>()->notifier([&](const auto &v) { _shuffle_seed = v; }),
+      "Seed to shuffle training data every epoch\n"
+      "If not given, training data is not shuffled")
     ("verbose_level,v", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _verbose_level = v; }),
          "Verbose level\n"
          "0: prints the only result. Messages btw run don't print\n"
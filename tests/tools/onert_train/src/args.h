@@ -58,6 +58,7 @@ public:
   const int getEpoch(void) const { return _epoch; }
   const std::optional<int> getBatchSize(void) const { return _batch_size; }
   const std::optional<float> getLearningRate(void) const { return _learning_rate; }
+  const std::optional<int> getAccumulationSteps(void) const { return _accumulation_steps; }
   const std::optional<NNFW_TRAIN_LOSS> getLossType(void) const { return _loss_type; }
   const std::optional<NNFW_TRAIN_LOSS_REDUCTION> getLossReductionType(void) const
   {
@@ -66,6 +67,7 @@ public:
   const std::optional<NNFW_TRAIN_OPTIMIZER> getOptimizerType(void) const { return _optimizer_type; }
   const int getMetricType(void) const { return _metric_type; }
   const float getValidationSplit(void) const { return _validation_split; }
+  const std::optional<uint32_t> getShuffleSeed(void) const { return _shuffle_seed; }
   const bool printVersion(void) const { return _print_version; }
   const int getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
@@ -107,11 +109,13 @@ private:
   int _epoch;
   std::optional<int> _batch_size;
   std::optional<float> _learning_rate;
+  std::optional<int> _accumulation_steps;
   std::optional<NNFW_TRAIN_LOSS> _loss_type;
   std::optional<NNFW_TRAIN_LOSS_REDUCTION> _loss_reduction_type;
   std::optional<NNFW_TRAIN_OPTIMIZER> _optimizer_type;
   int _metric_type;
   float _validation_split;
+  std::optional<uint32_t> _shuffle_seed;
   bool _print_version = false;
   int _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
@@ -23,7 +23,6 @@
 #include <functional>
 #include <vector>
 #include <tuple>
-#include <fstream>
 
 namespace onert_train
 {
@@ -46,12 +45,24 @@ public:
   virtual std::tuple<Generator, uint32_t>
   loadData(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f) = 0;
 
+  /**
+   * @brief Shuffle data of generators loaded after this call
+   *
+   * Each generator draws a new permutation of its data from a random engine seeded with seed
+   * whenever it loads index 0, i.e. at the beginning of every epoch.
+   */
+  void setShuffle(uint32_t seed)
+  {
+    _shuffle = true;
+    _seed = seed;
+  }
+
 protected:
   std::vector<nnfw_tensorinfo> _input_infos;
   std::vector<nnfw_tensorinfo> _expected_infos;
-  std::ifstream _input_file;
-  std::ifstream _expected_file;
   uint32_t _data_length;
+  bool _shuffle = false;
+  uint32_t _seed = 0;
 };
 
 } // namespace onert_train
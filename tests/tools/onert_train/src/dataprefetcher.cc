@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dataprefetcher.h"
+#include "nnfw_util.h"
+
+#include <chrono>
+
+namespace onert_train
+{
+
+DataPrefetcher::DataPrefetcher(const Generator &generator, uint32_t num_steps,
+                               const std::vector<nnfw_tensorinfo> &input_infos,
+                               const std::vector<nnfw_tensorinfo> &expected_infos)
+  : _generator{generator}, _num_steps{num_steps}
+{
+  for (auto &batch : _batches)
+  {
+    batch.inputs = std::vector<Allocation>(input_infos.size());
+    for (uint32_t i = 0; i < input_infos.size(); ++i)
+      batch.inputs[i].alloc(bufsize_for(&input_infos[i]));
+
+    batch.expecteds = std::vector<Allocation>(expected_infos.size());
+    for (uint32_t i = 0; i < expected_infos.size(); ++i)
+      batch.expecteds[i].alloc(bufsize_for(&expected_infos[i]));
+  }
+
+  _thread = std::thread([this] { run(); });
+}
+
+DataPrefetcher::~DataPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  _thread.join();
+}
+
+void DataPrefetcher::run()
+{
+  for (uint32_t idx = 0; idx < _num_steps; ++idx)
+  {
+    {
+      // The buffer of idx is free after the batch of (idx - 2) is released, i.e. next() is called
+      // idx times
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [&] { return _stop || idx < _batches.size() || idx <= _consumed; });
+      if (_stop)
+        return;
+    }
+
+    auto &batch = _batches[idx % _batches.size()];
+    bool loaded = false;
+    std::exception_ptr error;
+    try
+    {
+      loaded = _generator(idx, batch.inputs, batch.expecteds);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (loaded)
+        _loaded++;
+      else
+      {
+        _failed = true;
+        _error = error;
+      }
+    }
+    _cv.notify_all();
+    if (!loaded)
+      return;
+  }
+}
+
+const Batch *DataPrefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_consumed >= _num_steps)
+    return nullptr;
+
+  // Release the previous batch
+  const auto idx = _consumed++;
+  _cv.notify_all();
+
+  const auto begin = std::chrono::steady_clock::now();
+  _cv.wait(lock, [&] { return _failed || _loaded > idx; });
+  _wait_micros += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - begin)
+                    .count();
+
+  if (_loaded <= idx)
+  {
+    if (_error)
+      std::rethrow_exception(_error);
+    return nullptr;
+  }
+  return &_batches[idx % _batches.size()];
+}
+
+} // namespace onert_train
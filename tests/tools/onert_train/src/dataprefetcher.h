@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TRAIN_DATAPREFETCHER_H__
+#define __ONERT_TRAIN_DATAPREFETCHER_H__
+
+#include "dataloader.h"
+
+#include <array>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace onert_train
+{
+
+struct Batch
+{
+  std::vector<Allocation> inputs;
+  std::vector<Allocation> expecteds;
+};
+
+/**
+ * @brief Load batches of a generator on a background thread
+ *
+ * Batches are loaded into two buffers in turn, so the next batch is loaded while the current
+ * batch is being used.
+ */
+class DataPrefetcher
+{
+public:
+  DataPrefetcher(const Generator &generator, uint32_t num_steps,
+                 const std::vector<nnfw_tensorinfo> &input_infos,
+                 const std::vector<nnfw_tensorinfo> &expected_infos);
+  ~DataPrefetcher();
+
+  DataPrefetcher(const DataPrefetcher &) = delete;
+  DataPrefetcher &operator=(const DataPrefetcher &) = delete;
+
+  /**
+   * @brief Get the next batch. The batch returned by the previous call is reused to load another
+   *        batch after this call.
+   * @return Null if all batches are consumed or the generator fails
+   */
+  const Batch *next();
+
+  /**
+   * @brief Time spent in next() waiting for batches to be loaded
+   */
+  uint64_t waitMicros() const { return _wait_micros; }
+
+private:
+  void run();
+
+private:
+  Generator _generator;
+  uint32_t _num_steps;
+  std::array<Batch, 2> _batches;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  uint32_t _loaded = 0;   // Number of batches loaded
+  uint32_t _consumed = 0; // Number of batches returned by next()
+  bool _failed = false;
+  bool _stop = false;
+  std::exception_ptr _error;
+  uint64_t _wait_micros = 0;
+  std::thread _thread;
+};
+
+} // namespace onert_train
+
+#endif // __ONERT_TRAIN_DATAPREFETCHER_H__
@@ -25,6 +25,7 @@
 #include "randomgen.h"
 #include "rawformatter.h"
 #include "dataloader.h"
+#include "dataprefetcher.h"
 #include "rawdataloader.h"
 #include "metrics.h"
 
@@ -144,13 +145,16 @@ int main(const int argc, char **argv)
     tri.loss_info.reduction_type =
       args.getLossReductionType().value_or(tri.loss_info.reduction_type);
     tri.opt = args.getOptimizerType().value_or(tri.opt);
+    const int accumulation_steps = args.getAccumulationSteps().value_or(1);
 
     std::cout << "== training parameter ==" << std::endl;
     std::cout << tri;
+    std::cout << "- accumulation    = " << accumulation_steps << std::endl;
     std::cout << "========================" << std::endl;
 
     // set training information
     NNPR_ENSURE_STATUS(nnfw_train_set_traininfo(session, &tri));
+    NNPR_ENSURE_STATUS(nnfw_train_set_accumulation_steps(session, accumulation_steps));
 
     // prepare execution
 
@@ -162,15 +166,13 @@ int main(const int argc, char **argv)
     std::vector<nnfw_tensorinfo> expected_infos;
 
     // prepare data buffers
-    std::vector<Allocation> input_data(num_inputs);
-    std::vector<Allocation> expected_data(num_expecteds);
+    // NOTE Buffers of inputs and expecteds are prepared by DataPrefetcher
     std::vector<Allocation> output_data(num_expecteds);
 
     for (uint32_t i = 0; i < num_inputs; ++i)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      input_data[i].alloc(bufsize_for(&ti));
       input_infos.emplace_back(std::move(ti));
     }
 
@@ -185,7 +187,6 @@ int main(const int argc, char **argv)
       NNPR_ENSURE_STATUS(
         nnfw_train_set_output(session, i, ti.dtype, output_data[i].data(), output_size_in_bytes));
 
-      expected_data[i].alloc(output_size_in_bytes);
       expected_infos.emplace_back(std::move(ti));
     }
 
@@ -202,9 +203,12 @@ int main(const int argc, char **argv)
                                                    expected_infos);
 
       auto train_to = 1.0f - args.getValidationSplit();
-      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(tri.batch_size, 0.f, train_to);
       std::tie(vdata_generator, vdata_length) =
         dataLoader->loadData(tri.batch_size, train_to, 1.0f);
+      // Only training data is shuffled
+      if (args.getShuffleSeed().has_value())
+        dataLoader->setShuffle(args.getShuffleSeed().value());
+      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(tri.batch_size, 0.f, train_to);
     }
     else
     {
@@ -221,6 +225,15 @@ int main(const int argc, char **argv)
       exit(-1);
     }
 
+    // Gradients of a window are applied at its last batch, so a window should not cross epochs
+    if ((tdata_length / tri.batch_size) % accumulation_steps != 0)
+    {
+      std::cerr << "E: the number of batches in an epoch is not a multiple of accumulation_steps. "
+                   "Adjust batch_size or accumulation_steps"
+                << std::endl;
+      exit(-1);
+    }
+
     // If the user does not give the validation_split value,
     // the vdata_length is 0 by default and it does not execute
     // validation loop.
@@ -245,24 +258,27 @@ int main(const int argc, char **argv)
         //
         {
           std::fill(losses.begin(), losses.end(), 0);
+          DataPrefetcher tdata_prefetcher(tdata_generator, num_step, input_infos, expected_infos);
+          const auto epoch_begin = nowMicros();
           for (uint32_t n = 0; n < num_step; ++n)
           {
             // get batchsize data
-            if (!tdata_generator(n, input_data, expected_data))
+            auto batch = tdata_prefetcher.next();
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // train
@@ -287,6 +303,14 @@ int main(const int argc, char **argv)
           {
             std::cout << "[" << i << "] " << losses[i] / num_step;
           }
+
+          // print the share of time waiting for training data
+          const auto epoch_time = nowMicros() - epoch_begin;
+          const auto prev_precision = std::cout.precision(1);
+          std::cout << " - data wait: "
+                    << (epoch_time > 0 ? 100.0 * tdata_prefetcher.waitMicros() / epoch_time : 0.0)
+                    << "%";
+          std::cout.precision(prev_precision);
         }
 
         //
@@ -297,31 +321,34 @@ int main(const int argc, char **argv)
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
           const int num_valid_step = vdata_length / tri.batch_size;
+          DataPrefetcher vdata_prefetcher(vdata_generator, num_valid_step, input_infos,
+                                          expected_infos);
           for (uint32_t n = 0; n < num_valid_step; ++n)
           {
             // get batchsize validation data
-            if (!vdata_generator(n, input_data, expected_data))
+            auto batch = vdata_prefetcher.next();
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // validation
             NNPR_ENSURE_STATUS(nnfw_train(session, false));
 
             // get validation loss and accuracy
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch->expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -17,10 +17,18 @@
 #include "rawdataloader.h"
 #include "nnfw_util.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
-#include <stdexcept>
+#include <memory>
 #include <numeric>
-#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert_train
 {
@@ -41,21 +49,47 @@ uint64_t getRawTensorSize(const std::vector<nnfw_tensorinfo> &infos)
 namespace onert_train
 {
 
+MappedFile::MappedFile(const std::string &filename) : _data{nullptr}, _size{0}
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open " + filename);
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    throw std::runtime_error("Failed to get the size of " + filename);
+  }
+
+  _size = static_cast<uint64_t>(st.st_size);
+  if (_size > 0)
+  {
+    void *data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      close(fd);
+      throw std::runtime_error("Failed to map " + filename);
+    }
+    _data = static_cast<uint8_t *>(data);
+  }
+  // The mapping is still valid after the file is closed
+  close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+  if (_data != nullptr)
+    munmap(_data, _size);
+}
+
 RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &expected_file,
                              const std::vector<nnfw_tensorinfo> &input_infos,
                              const std::vector<nnfw_tensorinfo> &expected_infos)
-  : DataLoader(input_infos, expected_infos)
+  : DataLoader(input_infos, expected_infos), _input_file{input_file}, _expected_file{expected_file}
 {
-  _input_file = std::ifstream(input_file, std::ios::binary);
-  _expected_file = std::ifstream(expected_file, std::ios::binary);
-
-  _input_file.seekg(0, std::ios::end);
-  uint32_t input_file_size = _input_file.tellg();
-  uint32_t input_data_length = input_file_size / getRawTensorSize(_input_infos);
-
-  _expected_file.seekg(0, std::ios::end);
-  uint32_t expected_file_size = _expected_file.tellg();
-  uint32_t expected_data_length = expected_file_size / getRawTensorSize(_expected_infos);
+  uint32_t input_data_length = _input_file.size() / getRawTensorSize(_input_infos);
+  uint32_t expected_data_length = _expected_file.size() / getRawTensorSize(_expected_infos);
 
   if (input_data_length != expected_data_length)
   {
@@ -72,10 +106,10 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
   assert(to >= 0.f && to <= 1.f);
   assert(from <= to);
 
-  int32_t split_size = _data_length * (to - from);
-  int32_t split_start = _data_length * from;
-  std::vector<uint32_t> input_origins(_input_infos.size());
-  uint32_t start = 0;
+  uint32_t split_size = _data_length * (to - from);
+  uint32_t split_start = _data_length * from;
+  std::vector<uint64_t> input_origins(_input_infos.size());
+  uint64_t start = 0;
   for (uint32_t i = 0; i < _input_infos.size(); ++i)
   {
     auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
@@ -83,7 +117,7 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
     start += (hwc_size * _data_length);
   }
 
-  std::vector<uint32_t> expected_origins(_expected_infos.size());
+  std::vector<uint64_t> expected_origins(_expected_infos.size());
   start = 0;
   for (uint32_t i = 0; i < _expected_infos.size(); ++i)
   {
@@ -92,21 +126,56 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
     start += (hwc_size * _data_length);
   }
 
-  return std::make_tuple(
-    [input_origins, expected_origins, this](uint32_t idx, std::vector<Allocation> &inputs,
-                                            std::vector<Allocation> &expecteds) {
-      for (uint32_t i = 0; i < _input_infos.size(); ++i)
+  // Order of data in the split, which is shared by copies of the generator
+  struct Order
+  {
+    std::mt19937 engine;
+    std::vector<uint32_t> indices;
+  };
+  std::shared_ptr<Order> order;
+  if (_shuffle)
+  {
+    order = std::make_shared<Order>();
+    order->engine.seed(_seed);
+    order->indices.resize(split_size);
+    std::iota(order->indices.begin(), order->indices.end(), 0);
+  }
+
+  // Copy a batch of data from mapped file to buffers
+  auto copy = [batch_size, order](uint32_t idx, const MappedFile &file,
+                                  const std::vector<nnfw_tensorinfo> &infos,
+                                  const std::vector<uint64_t> &origins,
+                                  std::vector<Allocation> &buffers) {
+    for (uint32_t i = 0; i < infos.size(); ++i)
+    {
+      auto bufsz = bufsize_for(&infos[i]);
+      auto dst = static_cast<uint8_t *>(buffers[i].data());
+      if (!order)
       {
-        auto bufsz = bufsize_for(&_input_infos[i]);
-        _input_file.seekg(input_origins[i] + idx * bufsz, std::ios::beg);
-        _input_file.read(reinterpret_cast<char *>(inputs[i].data()), bufsz);
+        std::memcpy(dst, file.data() + origins[i] + idx * bufsz, bufsz);
+        continue;
       }
-      for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+
+      auto hwc_size = bufsz / batch_size;
+      for (uint32_t b = 0; b < batch_size; ++b)
       {
-        auto bufsz = bufsize_for(&_expected_infos[i]);
-        _expected_file.seekg(expected_origins[i] + idx * bufsz, std::ios::beg);
-        _expected_file.read(reinterpret_cast<char *>(expecteds[i].data()), bufsz);
+        auto src = file.data() + origins[i] + order->indices[idx * batch_size + b] * hwc_size;
+        std::memcpy(dst + b * hwc_size, src, hwc_size);
       }
+    }
+  };
+
+  return std::make_tuple(
+    [input_origins, expected_origins, batch_size, split_size, order, copy,
+     this](uint32_t idx, std::vector<Allocation> &inputs, std::vector<Allocation> &expecteds) {
+      if (static_cast<uint64_t>(idx + 1) * batch_size > split_size)
+        return false;
+
+      if (order && idx == 0)
+        std::shuffle(order->indices.begin(), order->indices.end(), order->engine);
+
+      copy(idx, _input_file, _input_infos, input_origins, inputs);
+      copy(idx, _expected_file, _expected_infos, expected_origins, expecteds);
       return true;
     },
     split_size);
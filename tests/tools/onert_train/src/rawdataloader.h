@@ -19,9 +19,31 @@
 
 #include "dataloader.h"
 
+#include <string>
+
 namespace onert_train
 {
 
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const uint8_t *data() const { return _data; }
+  uint64_t size() const { return _size; }
+
+private:
+  uint8_t *_data;
+  uint64_t _size;
+};
+
 class RawDataLoader : public DataLoader
 {
 public:
@@ -31,6 +53,10 @@ public:
 
   std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size, const float from = 0.0f,
                                            const float to = 1.0f) override;
+
+private:
+  MappedFile _input_file;
+  MappedFile _expected_file;
 };
 
 } // namespace onert_train
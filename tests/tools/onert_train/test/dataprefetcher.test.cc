@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nnfw.h>
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "../src/dataprefetcher.h"
+
+namespace
+{
+using namespace onert_train;
+
+const nnfw_tensorinfo info = {
+  .dtype = NNFW_TYPE_TENSOR_INT32,
+  .rank = 1,
+  .dims = {4},
+};
+
+// Fill buffers with index of batch
+bool fillIndex(uint32_t idx, std::vector<Allocation> &inputs, std::vector<Allocation> &expecteds)
+{
+  for (auto &&buffers : {&inputs, &expecteds})
+  {
+    for (auto &buffer : *buffers)
+    {
+      auto data = reinterpret_cast<int32_t *>(buffer.data());
+      std::fill(data, data + 4, static_cast<int32_t>(idx));
+    }
+  }
+  return true;
+}
+
+TEST(DataPrefetcherTest, next)
+{
+  const uint32_t num_steps = 10;
+  DataPrefetcher prefetcher(fillIndex, num_steps, {info}, {info, info});
+
+  for (uint32_t n = 0; n < num_steps; ++n)
+  {
+    auto batch = prefetcher.next();
+    ASSERT_NE(batch, nullptr);
+    ASSERT_EQ(batch->inputs.size(), 1);
+    ASSERT_EQ(batch->expecteds.size(), 2);
+    for (auto &&buffers : {&batch->inputs, &batch->expecteds})
+    {
+      for (auto &buffer : *buffers)
+      {
+        auto data = reinterpret_cast<const int32_t *>(buffer.data());
+        for (uint32_t i = 0; i < 4; ++i)
+          EXPECT_EQ(data[i], n);
+      }
+    }
+  }
+  EXPECT_EQ(prefetcher.next(), nullptr);
+}
+
+TEST(DataPrefetcherTest, stopEarly)
+{
+  // Prefetcher is destroyed while loading is blocked
+  DataPrefetcher prefetcher(fillIndex, 100, {info}, {info});
+  EXPECT_NE(prefetcher.next(), nullptr);
+}
+
+TEST(DataPrefetcherTest, neg_generatorFails)
+{
+  Generator generator = [](uint32_t idx, std::vector<Allocation> &inputs,
+                           std::vector<Allocation> &expecteds) {
+    return idx < 2 && fillIndex(idx, inputs, expecteds);
+  };
+  DataPrefetcher prefetcher(generator, 5, {info}, {info});
+  EXPECT_NE(prefetcher.next(), nullptr);
+  EXPECT_NE(prefetcher.next(), nullptr);
+  EXPECT_EQ(prefetcher.next(), nullptr);
+}
+
+TEST(DataPrefetcherTest, neg_generatorThrows)
+{
+  Generator generator = [](uint32_t, std::vector<Allocation> &, std::vector<Allocation> &) -> bool {
+    throw std::runtime_error("Failed to load");
+  };
+  DataPrefetcher prefetcher(generator, 5, {info}, {info});
+  EXPECT_THROW(prefetcher.next(), std::runtime_error);
+}
+
+} // namespace
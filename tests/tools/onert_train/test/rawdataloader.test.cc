@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <fstream>
 #include <numeric>
 
 #include "../src/rawdataloader.h"
@@ -224,4 +225,92 @@ TEST_F(RawDataLoaderTest, loadDatas_1)
   }
 }
 
+TEST_F(RawDataLoaderTest, loadDatas_shuffle)
+{
+  const uint32_t data_length = 12;
+  const uint32_t batch_size = 4;
+
+  nnfw_tensorinfo in_info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {batch_size, 1},
+  };
+  std::vector<nnfw_tensorinfo> in_infos{in_info};
+  std::vector<nnfw_tensorinfo> expected_infos{in_info};
+
+  // Each data has its index as value
+  const std::string input_file = "shuffle_input.bin";
+  const std::string expected_file = "shuffle_expected.bin";
+  for (const auto &name : {input_file, expected_file})
+  {
+    std::ofstream file(name, std::ios::binary);
+    for (uint32_t i = 0; i < data_length; ++i)
+      file.write(reinterpret_cast<const char *>(&i), sizeof(i));
+  }
+
+  auto loadAll = [&](Generator &generator) {
+    std::vector<Allocation> inputs(1);
+    inputs[0].alloc(bufsize_for(&in_info));
+    std::vector<Allocation> expecteds(1);
+    expecteds[0].alloc(bufsize_for(&in_info));
+
+    std::vector<uint32_t> order;
+    for (uint32_t n = 0; n < data_length / batch_size; ++n)
+    {
+      EXPECT_TRUE(generator(n, inputs, expecteds));
+      auto in = reinterpret_cast<uint32_t *>(inputs[0].data());
+      auto ex = reinterpret_cast<uint32_t *>(expecteds[0].data());
+      for (uint32_t b = 0; b < batch_size; ++b)
+      {
+        EXPECT_EQ(in[b], ex[b]);
+        order.emplace_back(in[b]);
+      }
+    }
+    EXPECT_FALSE(generator(data_length / batch_size, inputs, expecteds));
+    return order;
+  };
+
+  std::vector<uint32_t> sorted(data_length);
+  std::iota(sorted.begin(), sorted.end(), 0);
+
+  RawDataLoader loader(input_file, expected_file, in_infos, expected_infos);
+  loader.setShuffle(7);
+  Generator generator;
+  uint32_t length;
+  std::tie(generator, length) = loader.loadData(batch_size);
+  EXPECT_EQ(length, data_length);
+
+  // Every data is loaded once in each epoch
+  auto epoch1 = loadAll(generator);
+  auto epoch2 = loadAll(generator);
+  EXPECT_NE(epoch1, sorted);
+  EXPECT_NE(epoch1, epoch2);
+  auto sorted1 = epoch1;
+  std::sort(sorted1.begin(), sorted1.end());
+  EXPECT_EQ(sorted1, sorted);
+  auto sorted2 = epoch2;
+  std::sort(sorted2.begin(), sorted2.end());
+  EXPECT_EQ(sorted2, sorted);
+
+  // Same seed gives the same order
+  Generator generator2;
+  std::tie(generator2, length) = loader.loadData(batch_size);
+  EXPECT_EQ(loadAll(generator2), epoch1);
+
+  std::remove(input_file.c_str());
+  std::remove(expected_file.c_str());
+}
+
+TEST_F(RawDataLoaderTest, neg_loadDatas_no_file)
+{
+  nnfw_tensorinfo info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {1, 1},
+  };
+  std::vector<nnfw_tensorinfo> infos{info};
+  EXPECT_THROW(RawDataLoader("not_exist_input.bin", "not_exist_expected.bin", infos, infos),
+               std::runtime_error);
+}
+
 } // namespace